@@ -0,0 +1,125 @@
+import 'dart:ffi';
+import 'dart:typed_data';
+
+import '../zego_express_defines.dart';
+import '../zego_express_enum_extension.dart';
+import 'zego_express_ffi_impl.dart';
+
+/// Reads the native `ZegoAudioDataRing`, see its header for the layout.
+class ZegoAudioDataRingImpl extends ZegoAudioDataRing {
+  static const int _recordHeaderSize = 16;
+
+  // Indexes of the 64 bit header fields.
+  static const int _writePosition = 8;
+  static const int _frameCount = 9;
+  static const int _overrunCount = 10;
+  static const int _overrunBytes = 11;
+  static const int _readPosition = 16;
+  // Index of the 32 bit notify flag.
+  static const int _notifyPending = 34;
+
+  @override
+  final int source;
+  @override
+  final String streamID;
+
+  final int address;
+  final Pointer<Uint64> _positions;
+  final Pointer<Uint32> _fields;
+  final Pointer<Uint64> _writePositionAddress;
+  final Pointer<Uint64> _readPositionAddress;
+  final Pointer<Uint32> _notifyPendingAddress;
+  late final int _capacity;
+  late final Uint8List _buffer;
+  late final ByteData _bufferData;
+
+  // Set before native frees the ring, the counters keep their last values.
+  bool _disposed = false;
+  int _lastFrameCount = 0;
+  int _lastOverrunCount = 0;
+  int _lastOverrunBytes = 0;
+
+  ZegoAudioDataRingImpl(this.source, this.streamID, this.address)
+      : _positions = Pointer<Uint64>.fromAddress(address),
+        _fields = Pointer<Uint32>.fromAddress(address),
+        _writePositionAddress =
+            Pointer<Uint64>.fromAddress(address + _writePosition * 8),
+        _readPositionAddress =
+            Pointer<Uint64>.fromAddress(address + _readPosition * 8),
+        _notifyPendingAddress =
+            Pointer<Uint32>.fromAddress(address + _notifyPending * 4) {
+    final int headerSize = _fields[1];
+    _capacity = _fields[2];
+    _buffer = Pointer<Uint8>.fromAddress(address + headerSize)
+        .asTypedList(_capacity);
+    _bufferData = ByteData.sublistView(_buffer);
+  }
+
+  /// Called before [onDataAvailable] so frames written while reading
+  /// trigger a new notification.
+  void clearNotification() {
+    if (!_disposed) {
+      ZegoExpressFFIImpl.exchange(_notifyPendingAddress, 0);
+    }
+  }
+
+  /// Called before the native ring is destroyed, the ring reads nothing
+  /// afterwards.
+  void dispose() {
+    if (_disposed) {
+      return;
+    }
+    _lastFrameCount = frameCount;
+    _lastOverrunCount = overrunCount;
+    _lastOverrunBytes = overrunBytes;
+    _disposed = true;
+  }
+
+  bool get isDisposed => _disposed;
+
+  @override
+  ZegoAudioDataRingFrame? readFrame() {
+    if (_disposed) {
+      return null;
+    }
+    int readPosition = _positions[_readPosition];
+    if (readPosition == ZegoExpressFFIImpl.loadAcquire(_writePositionAddress)) {
+      return null;
+    }
+
+    int offset = readPosition % _capacity;
+    int dataLength = _bufferData.getUint32(offset, Endian.little);
+    int sampleRate = _bufferData.getUint32(offset + 4, Endian.little);
+    int channel = _bufferData.getUint32(offset + 8, Endian.little);
+
+    Uint8List data = Uint8List(dataLength);
+    int dataOffset = (offset + _recordHeaderSize) % _capacity;
+    int firstPart = _capacity - dataOffset < dataLength
+        ? _capacity - dataOffset
+        : dataLength;
+    data.setRange(0, firstPart, _buffer, dataOffset);
+    if (firstPart < dataLength) {
+      data.setRange(firstPart, dataLength, _buffer);
+    }
+
+    // Hands the space back to the writer once the frame is copied.
+    ZegoExpressFFIImpl.storeRelease(_readPositionAddress,
+        readPosition + _recordHeaderSize + ((dataLength + 15) & ~15));
+
+    return ZegoAudioDataRingFrame(
+        data,
+        ZegoAudioFrameParam(ZegoAudioSampleRateExtension.fromValue(sampleRate),
+            ZegoAudioChannel.values[channel]));
+  }
+
+  @override
+  int get frameCount => _disposed ? _lastFrameCount : _positions[_frameCount];
+
+  @override
+  int get overrunCount =>
+      _disposed ? _lastOverrunCount : _positions[_overrunCount];
+
+  @override
+  int get overrunBytes =>
+      _disposed ? _lastOverrunBytes : _positions[_overrunBytes];
+}
@@ -0,0 +1,34 @@
+import '../zego_express_defines.dart';
+
+/// Web implementation of [ZegoAudioDataRingImpl], native rings are not
+/// available on web.
+class ZegoAudioDataRingImpl extends ZegoAudioDataRing {
+  @override
+  final int source;
+  @override
+  final String streamID;
+
+  final int address;
+
+  ZegoAudioDataRingImpl(this.source, this.streamID, this.address) {
+    throw UnsupportedError('ZegoAudioDataRing is not supported on web');
+  }
+
+  void clearNotification() {}
+
+  void dispose() {}
+
+  bool get isDisposed => true;
+
+  @override
+  ZegoAudioDataRingFrame? readFrame() => null;
+
+  @override
+  int get frameCount => 0;
+
+  @override
+  int get overrunCount => 0;
+
+  @override
+  int get overrunBytes => 0;
+}
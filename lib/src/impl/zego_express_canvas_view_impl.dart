@@ -2,6 +2,8 @@ import 'dart:async';
 
 import 'package:flutter/material.dart';
 
+import '../zego_express_canvas_view_utils.dart';
+import '../utils/zego_express_utils.dart';
 import 'zego_express_impl.dart';
 import 'zego_express_texture_renderer_impl.dart';
 import 'zego_express_platform_view_impl.dart'
@@ -48,4 +50,91 @@ class ZegoExpressCanvasViewImpl {
     }
     return false;
   }
+
+  static Future<bool> setCanvasViewMaxRenderFps(int viewID, int fps) async {
+    if (ZegoExpressImpl.isEngineCreated &&
+        kIsWindows &&
+        !ZegoExpressImpl.shouldUsePlatformView()) {
+      return await ZegoExpressImpl.methodChannel.invokeMethod(
+          'setTextureRendererMaxFps', {'textureID': viewID, 'fps': fps});
+    }
+    return false;
+  }
+
+  static Future<void> setCanvasViewFpsPolicy(
+      ZegoCanvasViewFpsPolicy policy, int throttledFps) async {
+    if (ZegoExpressImpl.isEngineCreated &&
+        kIsWindows &&
+        !ZegoExpressImpl.shouldUsePlatformView()) {
+      return await ZegoExpressImpl.methodChannel.invokeMethod(
+          'setTextureRendererFpsPolicy',
+          {'policy': policy.index, 'throttledFps': throttledFps});
+    }
+  }
+
+  static Future<void> enableCanvasViewRenderPrepWorker(bool enable) async {
+    if (ZegoExpressImpl.isEngineCreated &&
+        kIsWindows &&
+        !ZegoExpressImpl.shouldUsePlatformView()) {
+      return await ZegoExpressImpl.methodChannel
+          .invokeMethod('enableTextureRendererPrepWorker', {'enable': enable});
+    }
+  }
+
+  static Future<void> enableCanvasViewSingleCopy(bool enable) async {
+    if (ZegoExpressImpl.isEngineCreated &&
+        kIsWindows &&
+        !ZegoExpressImpl.shouldUsePlatformView()) {
+      return await ZegoExpressImpl.methodChannel
+          .invokeMethod('enableTextureRendererSingleCopy', {'enable': enable});
+    }
+  }
+
+  static Future<void> enableCanvasViewFrameBatching(
+      bool enable, int interval) async {
+    if (ZegoExpressImpl.isEngineCreated &&
+        kIsWindows &&
+        !ZegoExpressImpl.shouldUsePlatformView()) {
+      return await ZegoExpressImpl.methodChannel.invokeMethod(
+          'enableTextureRendererFrameBatching',
+          {'enable': enable, 'interval': interval});
+    }
+  }
+
+  static Future<Map<String, int>> getCanvasViewRenderStats(int viewID) async {
+    if (ZegoExpressImpl.isEngineCreated &&
+        kIsWindows &&
+        !ZegoExpressImpl.shouldUsePlatformView()) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getTextureRendererStats', {'textureID': viewID});
+      return Map<String, int>.from(map);
+    }
+    return {};
+  }
+
+  static Future<void> enableVideoHealthAnalyzer(
+      bool enable, int freezeThreshold, int sampleInterval) async {
+    if (ZegoExpressImpl.isEngineCreated &&
+        kIsWindows &&
+        !ZegoExpressImpl.shouldUsePlatformView()) {
+      return await ZegoExpressImpl.methodChannel.invokeMethod(
+          'enableVideoHealthAnalyzer', {
+        'enable': enable,
+        'freezeThreshold': freezeThreshold,
+        'sampleInterval': sampleInterval
+      });
+    }
+  }
+
+  static Future<Map<String, dynamic>> getVideoHealthSummary(
+      String streamID) async {
+    if (ZegoExpressImpl.isEngineCreated &&
+        kIsWindows &&
+        !ZegoExpressImpl.shouldUsePlatformView()) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getVideoHealthSummary', {'streamID': streamID});
+      return Map<String, dynamic>.from(map);
+    }
+    return {};
+  }
 }
@@ -0,0 +1,200 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import '../zego_express_api.dart';
+import '../zego_express_defines.dart';
+
+/// Decodes the packed high frequency events of the Windows plugin, the layout
+/// is documented in `ZegoCompactEventCodec.h`. Records of streams whose ID
+/// was lost with a dropped packet are skipped.
+class ZegoCompactEventDecoder {
+  static const int _version = 1;
+
+  static const int _typePublisherQuality = 1;
+  static const int _typePlayerQuality = 2;
+  static const int _typeCapturedSoundLevelInfo = 3;
+  static const int _typeRemoteSoundLevelInfo = 4;
+  static const int _typeCapturedAudioSpectrum = 5;
+  static const int _typeRemoteAudioSpectrum = 6;
+
+  static int _epoch = -1;
+  static final Map<int, String> _streamIDs = {};
+
+  static void handleEvent(Uint8List data) {
+    final reader = _ByteReader(ByteData.sublistView(data));
+    if (reader.u8() != _version) return;
+    final type = reader.u8();
+
+    final epoch = reader.u16();
+    if (epoch != _epoch) {
+      // Packets of an older epoch were queued before a packet was dropped
+      // on the way here and may use the strings it carried.
+      if (_epoch >= 0 && ((epoch - _epoch) & 0xFFFF) >= 0x8000) return;
+      _epoch = epoch;
+      _streamIDs.clear();
+    }
+    final stringCount = reader.u16();
+    for (var i = 0; i < stringCount; i++) {
+      final index = reader.u16();
+      final length = reader.u16();
+      _streamIDs[index] = utf8.decode(
+          Uint8List.sublistView(data, reader.offset, reader.offset + length));
+      reader.offset += length;
+    }
+
+    final recordCount = reader.u16();
+    switch (type) {
+      case _typePublisherQuality:
+        if (ZegoExpressEngine.onPublisherQualityUpdate == null) return;
+
+        for (var i = 0; i < recordCount; i++) {
+          final streamID = _streamIDs[reader.u16()];
+          final quality = ZegoPublishStreamQuality(
+            reader.f64(),
+            reader.f64(),
+            reader.f64(),
+            reader.f64(),
+            reader.f64(),
+            reader.f64(),
+            reader.f64(),
+            reader.i32(),
+            reader.f64(),
+            ZegoStreamQualityLevel.values[reader.i32()],
+            reader.u8() != 0,
+            _videoCodecID(reader.i32()),
+            reader.f64(),
+            reader.f64(),
+            reader.f64(),
+          );
+          if (streamID != null) {
+            ZegoExpressEngine.onPublisherQualityUpdate!(streamID, quality);
+          }
+        }
+        break;
+
+      case _typePlayerQuality:
+        if (ZegoExpressEngine.onPlayerQualityUpdate == null) return;
+
+        for (var i = 0; i < recordCount; i++) {
+          final streamID = _streamIDs[reader.u16()];
+          final quality = ZegoPlayStreamQuality(
+              reader.f64(),
+              reader.f64(),
+              reader.f64(),
+              reader.f64(),
+              reader.f64(),
+              reader.f64(),
+              reader.f64(),
+              reader.f64(),
+              reader.f64(),
+              reader.f64(),
+              reader.f64(),
+              reader.f64(),
+              reader.f64(),
+              reader.i32(),
+              reader.f64(),
+              reader.i32(),
+              reader.f64(),
+              ZegoStreamQualityLevel.values[reader.i32()],
+              reader.i32(),
+              reader.i32(),
+              reader.u8() != 0,
+              _videoCodecID(reader.i32()),
+              reader.f64(),
+              reader.f64(),
+              reader.f64());
+          if (streamID != null) {
+            ZegoExpressEngine.onPlayerQualityUpdate!(streamID, quality);
+          }
+        }
+        break;
+
+      case _typeCapturedSoundLevelInfo:
+        if (ZegoExpressEngine.onCapturedSoundLevelInfoUpdate == null) return;
+
+        ZegoExpressEngine.onCapturedSoundLevelInfoUpdate!(
+            ZegoSoundLevelInfo(_soundLevel(reader.f32()), reader.i32()));
+        break;
+
+      case _typeRemoteSoundLevelInfo:
+        if (ZegoExpressEngine.onRemoteSoundLevelInfoUpdate == null) return;
+
+        Map<String, ZegoSoundLevelInfo> soundLevelInfos = {};
+        for (var i = 0; i < recordCount; i++) {
+          final streamID = _streamIDs[reader.u16()];
+          final soundLevelInfo =
+              ZegoSoundLevelInfo(_soundLevel(reader.f32()), reader.i32());
+          if (streamID != null) soundLevelInfos[streamID] = soundLevelInfo;
+        }
+        ZegoExpressEngine.onRemoteSoundLevelInfoUpdate!(soundLevelInfos);
+        break;
+
+      case _typeCapturedAudioSpectrum:
+        if (ZegoExpressEngine.onCapturedAudioSpectrumUpdate == null) return;
+
+        ZegoExpressEngine.onCapturedAudioSpectrumUpdate!(reader.f32List());
+        break;
+
+      case _typeRemoteAudioSpectrum:
+        if (ZegoExpressEngine.onRemoteAudioSpectrumUpdate == null) return;
+
+        Map<String, List<double>> audioSpectrums = {};
+        for (var i = 0; i < recordCount; i++) {
+          final streamID = _streamIDs[reader.u16()];
+          final audioSpectrum = reader.f32List();
+          if (streamID != null) audioSpectrums[streamID] = audioSpectrum;
+        }
+        ZegoExpressEngine.onRemoteAudioSpectrumUpdate!(audioSpectrums);
+        break;
+    }
+  }
+
+  static double _soundLevel(double soundLevel) =>
+      soundLevel < 0.000001 ? 0.0 : soundLevel;
+
+  static ZegoVideoCodecID _videoCodecID(int codecID) =>
+      ZegoVideoCodecID.values[codecID >= ZegoVideoCodecID.values.length
+          ? ZegoVideoCodecID.values.length - 1
+          : codecID];
+}
+
+class _ByteReader {
+  _ByteReader(this._data);
+
+  final ByteData _data;
+  int offset = 0;
+
+  int u8() => _data.getUint8(offset++);
+
+  int u16() {
+    final value = _data.getUint16(offset, Endian.little);
+    offset += 2;
+    return value;
+  }
+
+  int i32() {
+    final value = _data.getInt32(offset, Endian.little);
+    offset += 4;
+    return value;
+  }
+
+  double f32() {
+    final value = _data.getFloat32(offset, Endian.little);
+    offset += 4;
+    return value;
+  }
+
+  double f64() {
+    final value = _data.getFloat64(offset, Endian.little);
+    offset += 8;
+    return value;
+  }
+
+  List<double> f32List() {
+    final count = u16();
+    final list = List<double>.generate(
+        count, (i) => _data.getFloat32(offset + i * 4, Endian.little));
+    offset += count * 4;
+    return list;
+  }
+}
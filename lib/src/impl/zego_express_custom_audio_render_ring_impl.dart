@@ -0,0 +1,140 @@
+import 'dart:ffi';
+import 'dart:typed_data';
+
+import '../zego_express_defines.dart';
+import 'zego_express_ffi_impl.dart';
+
+/// Reads the native `ZegoCustomAudioRenderRing`, see its header for the
+/// layout.
+class ZegoCustomAudioRenderRingImpl extends ZegoCustomAudioRenderRing {
+  // Indexes of the 64 bit header fields.
+  static const int _writeFrame = 8;
+  static const int _fetchCount = 9;
+  static const int _skippedFetchCount = 10;
+  static const int _failedFetchCount = 11;
+  static const int _readFrame = 16;
+  static const int _underrunCount = 17;
+  static const int _underrunFrames = 18;
+
+  @override
+  final ZegoAudioFrameParam param;
+  final int address;
+  final Pointer<Uint64> _positions;
+  final Pointer<Uint32> _fields;
+  final Pointer<Uint64> _writeFrameAddress;
+  final Pointer<Uint64> _readFrameAddress;
+  late final int _capacityFrames;
+  late final int _frameSize;
+  @override
+  late final int chunkFrames;
+  late final Uint8List _buffer;
+
+  // Set before native frees the ring, the cursors and counters keep their
+  // last values.
+  bool _disposed = false;
+  final List<int> _lastPositions = List<int>.filled(19, 0);
+
+  ZegoCustomAudioRenderRingImpl(this.param, this.address)
+      : _positions = Pointer<Uint64>.fromAddress(address),
+        _fields = Pointer<Uint32>.fromAddress(address),
+        _writeFrameAddress =
+            Pointer<Uint64>.fromAddress(address + _writeFrame * 8),
+        _readFrameAddress =
+            Pointer<Uint64>.fromAddress(address + _readFrame * 8) {
+    final int headerSize = _fields[1];
+    _capacityFrames = _fields[2];
+    _frameSize = _fields[3];
+    chunkFrames = _fields[4];
+    _buffer = Pointer<Uint8>.fromAddress(address + headerSize)
+        .asTypedList(_capacityFrames * _frameSize);
+  }
+
+  /// Called before the native ring is destroyed, the ring reads and
+  /// fetches nothing afterwards.
+  void dispose() {
+    if (_disposed) {
+      return;
+    }
+    for (final index in [
+      _writeFrame,
+      _fetchCount,
+      _skippedFetchCount,
+      _failedFetchCount,
+      _readFrame,
+      _underrunCount,
+      _underrunFrames
+    ]) {
+      _lastPositions[index] = _positions[index];
+    }
+    _disposed = true;
+  }
+
+  bool get isDisposed => _disposed;
+
+  int _position(int index) =>
+      _disposed ? _lastPositions[index] : _positions[index];
+
+  @override
+  int read(Uint8List destination) {
+    if (_disposed) {
+      return 0;
+    }
+    final int readFrame = _positions[_readFrame];
+    final int available =
+        ZegoExpressFFIImpl.loadAcquire(_writeFrameAddress) - readFrame;
+    final int wanted = destination.length ~/ _frameSize;
+    final int frames = wanted < available ? wanted : available;
+
+    final int offset = readFrame % _capacityFrames;
+    final int firstPart =
+        _capacityFrames - offset < frames ? _capacityFrames - offset : frames;
+    destination.setRange(0, firstPart * _frameSize, _buffer,
+        offset * _frameSize);
+    if (firstPart < frames) {
+      destination.setRange(
+          firstPart * _frameSize, frames * _frameSize, _buffer);
+    }
+    // Hands the space back to the fetches once the PCM is copied.
+    ZegoExpressFFIImpl.storeRelease(_readFrameAddress, readFrame + frames);
+
+    if (frames < wanted) {
+      destination.fillRange(frames * _frameSize, wanted * _frameSize, 0);
+      _positions[_underrunCount] = _positions[_underrunCount] + 1;
+      _positions[_underrunFrames] =
+          _positions[_underrunFrames] + wanted - frames;
+    }
+    return frames;
+  }
+
+  @override
+  int fetch(int chunkCount) {
+    if (_disposed) {
+      return 0;
+    }
+    return ZegoExpressFFIImpl.fetchCustomAudioRenderRing(address, chunkCount);
+  }
+
+  @override
+  int get writeFrame => _position(_writeFrame);
+
+  @override
+  int get readFrame => _position(_readFrame);
+
+  @override
+  int get availableFrames => _position(_writeFrame) - _position(_readFrame);
+
+  @override
+  int get fetchCount => _position(_fetchCount);
+
+  @override
+  int get skippedFetchCount => _position(_skippedFetchCount);
+
+  @override
+  int get failedFetchCount => _position(_failedFetchCount);
+
+  @override
+  int get underrunCount => _position(_underrunCount);
+
+  @override
+  int get underrunFrames => _position(_underrunFrames);
+}
@@ -0,0 +1,53 @@
+import 'dart:typed_data';
+
+import '../zego_express_defines.dart';
+
+/// Web implementation of [ZegoCustomAudioRenderRingImpl], native rings are
+/// not available on web.
+class ZegoCustomAudioRenderRingImpl extends ZegoCustomAudioRenderRing {
+  @override
+  final ZegoAudioFrameParam param;
+
+  final int address;
+
+  @override
+  int get chunkFrames => 0;
+
+  ZegoCustomAudioRenderRingImpl(this.param, this.address) {
+    throw UnsupportedError('ZegoCustomAudioRenderRing is not supported on web');
+  }
+
+  void dispose() {}
+
+  bool get isDisposed => true;
+
+  @override
+  int read(Uint8List destination) => 0;
+
+  @override
+  int fetch(int chunkCount) => 0;
+
+  @override
+  int get writeFrame => 0;
+
+  @override
+  int get readFrame => 0;
+
+  @override
+  int get availableFrames => 0;
+
+  @override
+  int get fetchCount => 0;
+
+  @override
+  int get skippedFetchCount => 0;
+
+  @override
+  int get failedFetchCount => 0;
+
+  @override
+  int get underrunCount => 0;
+
+  @override
+  int get underrunFrames => 0;
+}
@@ -0,0 +1,295 @@
+import 'dart:async';
+import 'dart:convert';
+import 'dart:ffi';
+import 'dart:typed_data';
+
+import 'package:flutter/services.dart';
+
+import '../zego_express_defines.dart';
+import '../zego_express_enum_extension.dart';
+
+typedef _SendSEINative = Int32 Function(Pointer<Uint8>, Uint32, Int32);
+typedef _SendSEI = int Function(Pointer<Uint8>, int, int);
+typedef _SendAudioSideInfoNative = Int32 Function(
+    Pointer<Uint8>, Uint32, Double, Int32);
+typedef _SendAudioSideInfo = int Function(Pointer<Uint8>, int, double, int);
+typedef _SendCustomAudioCapturePCMDataNative = Int32 Function(
+    Pointer<Uint8>, Uint32, Int32, Int32, Int32);
+typedef _SendCustomAudioCapturePCMData = int Function(
+    Pointer<Uint8>, int, int, int, int);
+typedef _SendCustomAudioCaptureAACDataNative = Int32 Function(
+    Pointer<Uint8>, Uint32, Uint32, Uint64, Uint32, Int32, Int32, Int32);
+typedef _SendCustomAudioCaptureAACData = int Function(
+    Pointer<Uint8>, int, int, int, int, int, int, int);
+typedef _SendRealTimeSequentialDataNative = Int32 Function(
+    Int32, Pointer<Uint8>, Uint32, Pointer<Uint8>, Int64);
+typedef _SendRealTimeSequentialData = int Function(
+    int, Pointer<Uint8>, int, Pointer<Uint8>, int);
+typedef _FetchCustomAudioRenderPCMDataNative = Int32 Function(
+    Pointer<Uint8>, Uint32, Int32, Int32);
+typedef _FetchCustomAudioRenderPCMData = int Function(
+    Pointer<Uint8>, int, int, int);
+typedef _FetchCustomAudioRenderRingNative = Int32 Function(
+    Int64, Uint32, Pointer<Uint32>);
+typedef _FetchCustomAudioRenderRing = int Function(int, int, Pointer<Uint32>);
+typedef _AllocNative = Pointer<Uint8> Function(Uint32);
+typedef _Alloc = Pointer<Uint8> Function(int);
+typedef _FreeNative = Void Function(Pointer<Uint8>);
+typedef _Free = void Function(Pointer<Uint8>);
+typedef _LoadAcquireNative = Uint64 Function(Pointer<Uint64>);
+typedef _LoadAcquire = int Function(Pointer<Uint64>);
+typedef _StoreReleaseNative = Void Function(Pointer<Uint64>, Uint64);
+typedef _StoreRelease = void Function(Pointer<Uint64>, int);
+typedef _ExchangeNative = Uint32 Function(Pointer<Uint32>, Uint32);
+typedef _Exchange = int Function(Pointer<Uint32>, int);
+
+/// Calls the C entry points of the plugin library directly, see
+/// `zego_express_engine_ffi.h`. Payloads are copied once into a reused
+/// native buffer instead of being encoded into a platform channel message.
+class ZegoExpressFFIImpl {
+  static const int _errorEngineNotCreated = 1000001;
+  static const int _errorInstanceNotFound = -1;
+  static const int _errorNoEventSink = -2;
+
+  /// False if the plugin library lacks the entry points, the callers then
+  /// use the platform channel.
+  static final bool isAvailable = _load();
+
+  static late final _SendSEI _sendSEI;
+  static late final _SendAudioSideInfo _sendAudioSideInfo;
+  static late final _SendCustomAudioCapturePCMData
+      _sendCustomAudioCapturePCMData;
+  static late final _SendCustomAudioCaptureAACData
+      _sendCustomAudioCaptureAACData;
+  static late final _SendRealTimeSequentialData _sendRealTimeSequentialData;
+  static late final _FetchCustomAudioRenderPCMData
+      _fetchCustomAudioRenderPCMData;
+  static late final _FetchCustomAudioRenderRing _fetchCustomAudioRenderRing;
+  static late final _Alloc _alloc;
+  static late final _Free _free;
+  static late final _LoadAcquire _loadAcquire;
+  static late final _StoreRelease _storeRelease;
+  static late final _Exchange _exchange;
+
+  static Pointer<Uint8> _buffer = nullptr;
+  static Uint8List _bufferView = Uint8List(0);
+
+  static int _nextSequence = 0;
+  static final Map<int, Completer<ZegoRealTimeSequentialDataSentResult>>
+      _pendingSends = {};
+
+  static bool _load() {
+    try {
+      final library = DynamicLibrary.open('zego_express_engine_plugin.dll');
+      _sendSEI = library.lookupFunction<_SendSEINative, _SendSEI>(
+          'zego_express_ffi_send_sei');
+      _sendAudioSideInfo =
+          library.lookupFunction<_SendAudioSideInfoNative, _SendAudioSideInfo>(
+              'zego_express_ffi_send_audio_side_info');
+      _sendCustomAudioCapturePCMData = library.lookupFunction<
+              _SendCustomAudioCapturePCMDataNative,
+              _SendCustomAudioCapturePCMData>(
+          'zego_express_ffi_send_custom_audio_capture_pcm_data');
+      _sendCustomAudioCaptureAACData = library.lookupFunction<
+              _SendCustomAudioCaptureAACDataNative,
+              _SendCustomAudioCaptureAACData>(
+          'zego_express_ffi_send_custom_audio_capture_aac_data');
+      _sendRealTimeSequentialData = library.lookupFunction<
+              _SendRealTimeSequentialDataNative, _SendRealTimeSequentialData>(
+          'zego_express_ffi_data_manager_send_real_time_sequential_data');
+      _fetchCustomAudioRenderPCMData = library.lookupFunction<
+              _FetchCustomAudioRenderPCMDataNative,
+              _FetchCustomAudioRenderPCMData>(
+          'zego_express_ffi_fetch_custom_audio_render_pcm_data');
+      _fetchCustomAudioRenderRing = library.lookupFunction<
+              _FetchCustomAudioRenderRingNative, _FetchCustomAudioRenderRing>(
+          'zego_express_ffi_fetch_custom_audio_render_ring');
+      _alloc = library
+          .lookupFunction<_AllocNative, _Alloc>('zego_express_ffi_alloc');
+      _free =
+          library.lookupFunction<_FreeNative, _Free>('zego_express_ffi_free');
+      _loadAcquire = library.lookupFunction<_LoadAcquireNative, _LoadAcquire>(
+          'zego_express_ffi_load_acquire');
+      _storeRelease =
+          library.lookupFunction<_StoreReleaseNative, _StoreRelease>(
+              'zego_express_ffi_store_release');
+      _exchange = library
+          .lookupFunction<_ExchangeNative, _Exchange>('zego_express_ffi_exchange');
+      return true;
+    } catch (e) {
+      return false;
+    }
+  }
+
+  /// Copies [data] into the native buffer, leaving [extraLength] bytes
+  /// after it.
+  static Pointer<Uint8> _stage(Uint8List data, int length,
+      [int extraLength = 0]) {
+    length = length < data.length ? length : data.length;
+    _reserve(length + extraLength);
+    _bufferView.setRange(0, length, data);
+    return _buffer;
+  }
+
+  static void _reserve(int length) {
+    if (_bufferView.length < length) {
+      var size = 4096;
+      while (size < length) {
+        size *= 2;
+      }
+      if (_buffer != nullptr) {
+        _free(_buffer);
+      }
+      _buffer = _alloc(size);
+      if (_buffer == nullptr) {
+        _bufferView = Uint8List(0);
+        throw PlatformException(
+            code: 'Out_of_memory', message: 'Can not stage $size bytes');
+      }
+      _bufferView = _buffer.asTypedList(size);
+    }
+  }
+
+  static void _check(int errorCode) {
+    if (errorCode == _errorEngineNotCreated) {
+      throw PlatformException(
+          code: 'Engine_not_created',
+          message: 'Please call createEngineWithProfile first');
+    }
+  }
+
+  static void sendSEI(
+      Uint8List data, int dataLength, ZegoPublishChannel channel) {
+    final length = dataLength < data.length ? dataLength : data.length;
+    _check(_sendSEI(_stage(data, length), length, channel.index));
+  }
+
+  static void sendAudioSideInfo(
+      Uint8List data, double timeStampMs, ZegoPublishChannel channel) {
+    _check(_sendAudioSideInfo(
+        _stage(data, data.length), data.length, timeStampMs, channel.index));
+  }
+
+  static void sendCustomAudioCapturePCMData(Uint8List data, int dataLength,
+      ZegoAudioFrameParam param, ZegoPublishChannel channel) {
+    final length = dataLength < data.length ? dataLength : data.length;
+    _check(_sendCustomAudioCapturePCMData(_stage(data, length), length,
+        param.sampleRate.value, param.channel.index, channel.index));
+  }
+
+  static void sendCustomAudioCaptureAACData(
+      Uint8List data,
+      int dataLength,
+      int configLength,
+      int referenceTimeMillisecond,
+      int samples,
+      ZegoAudioFrameParam param,
+      ZegoPublishChannel channel) {
+    final length = dataLength < data.length ? dataLength : data.length;
+    _check(_sendCustomAudioCaptureAACData(
+        _stage(data, length),
+        length,
+        configLength,
+        referenceTimeMillisecond,
+        samples,
+        param.sampleRate.value,
+        param.channel.index,
+        channel.index));
+  }
+
+  /// Returns null without sending while the plugin does not deliver events,
+  /// the caller then sends through the platform channel.
+  static Future<ZegoRealTimeSequentialDataSentResult>?
+      sendRealTimeSequentialData(int index, Uint8List data, String streamID) {
+    final streamIDBytes = utf8.encode(streamID);
+    final buffer = _stage(data, data.length, streamIDBytes.length + 1);
+    _bufferView.setRange(
+        data.length, data.length + streamIDBytes.length, streamIDBytes);
+    _bufferView[data.length + streamIDBytes.length] = 0;
+
+    final sequence = _nextSequence++;
+    final errorCode = _sendRealTimeSequentialData(index, buffer, data.length,
+        Pointer<Uint8>.fromAddress(buffer.address + data.length), sequence);
+    _check(errorCode);
+    if (errorCode == _errorInstanceNotFound) {
+      throw PlatformException(
+          code: 'dataManagerSendRealTimeSequentialData_Can_not_find_instance',
+          message:
+              'Invoke `dataManagerSendRealTimeSequentialData` but can\'t find specific instance');
+    }
+    if (errorCode == _errorNoEventSink) {
+      return null;
+    }
+
+    final completer = Completer<ZegoRealTimeSequentialDataSentResult>();
+    _pendingSends[sequence] = completer;
+    return completer.future;
+  }
+
+  static void fetchCustomAudioRenderPCMData(
+      Uint8List data, int dataLength, ZegoAudioFrameParam param) {
+    final length = dataLength < data.length ? dataLength : data.length;
+    _reserve(length);
+    _check(_fetchCustomAudioRenderPCMData(
+        _buffer, length, param.sampleRate.value, param.channel.index));
+    data.setRange(0, length, _bufferView);
+  }
+
+  static int fetchCustomAudioRenderRing(int address, int chunkCount) {
+    _reserve(4);
+    final fetchedCount = _buffer.cast<Uint32>();
+    final errorCode =
+        _fetchCustomAudioRenderRing(address, chunkCount, fetchedCount);
+    _check(errorCode);
+    if (errorCode == _errorInstanceNotFound) {
+      throw PlatformException(
+          code: 'fetchCustomAudioRenderRing_Can_not_find_instance',
+          message:
+              'Invoke `fetchCustomAudioRenderRing` but can\'t find specific instance');
+    }
+    return fetchedCount.value;
+  }
+
+  /// Loads a ring cursor written by native code, plain loads are used
+  /// where the plugin library is not loaded.
+  static int loadAcquire(Pointer<Uint64> address) {
+    return isAvailable ? _loadAcquire(address) : address.value;
+  }
+
+  /// Stores a ring cursor read by native code.
+  static void storeRelease(Pointer<Uint64> address, int value) {
+    if (isAvailable) {
+      _storeRelease(address, value);
+    } else {
+      address.value = value;
+    }
+  }
+
+  /// Swaps a ring flag shared with native code, returns the previous value.
+  static int exchange(Pointer<Uint32> address, int value) {
+    if (!isAvailable) {
+      final previous = address.value;
+      address.value = value;
+      return previous;
+    }
+    return _exchange(address, value);
+  }
+
+  static void onRealTimeSequentialDataSent(int sequence, int errorCode) {
+    _pendingSends
+        .remove(sequence)
+        ?.complete(ZegoRealTimeSequentialDataSentResult(errorCode));
+  }
+
+  /// Fails the sends whose result can no longer arrive, called when the
+  /// engine is destroyed or the event stream is cancelled.
+  static void failPendingSends(String reason) {
+    final pendingSends = _pendingSends.values.toList();
+    _pendingSends.clear();
+    for (final completer in pendingSends) {
+      completer.completeError(PlatformException(
+          code: 'dataManagerSendRealTimeSequentialData_No_result',
+          message: 'The send result was not delivered, $reason'));
+    }
+  }
+}
@@ -0,0 +1,53 @@
+import 'dart:typed_data';
+
+import '../zego_express_defines.dart';
+
+/// Web implementation of [ZegoExpressFFIImpl], the plugin library is not
+/// available on web.
+class ZegoExpressFFIImpl {
+  static const bool isAvailable = false;
+
+  static void sendSEI(
+      Uint8List data, int dataLength, ZegoPublishChannel channel) {
+    throw UnsupportedError('ffi is not supported on web');
+  }
+
+  static void sendAudioSideInfo(
+      Uint8List data, double timeStampMs, ZegoPublishChannel channel) {
+    throw UnsupportedError('ffi is not supported on web');
+  }
+
+  static void sendCustomAudioCapturePCMData(Uint8List data, int dataLength,
+      ZegoAudioFrameParam param, ZegoPublishChannel channel) {
+    throw UnsupportedError('ffi is not supported on web');
+  }
+
+  static void sendCustomAudioCaptureAACData(
+      Uint8List data,
+      int dataLength,
+      int configLength,
+      int referenceTimeMillisecond,
+      int samples,
+      ZegoAudioFrameParam param,
+      ZegoPublishChannel channel) {
+    throw UnsupportedError('ffi is not supported on web');
+  }
+
+  static Future<ZegoRealTimeSequentialDataSentResult>?
+      sendRealTimeSequentialData(int index, Uint8List data, String streamID) {
+    throw UnsupportedError('ffi is not supported on web');
+  }
+
+  static void fetchCustomAudioRenderPCMData(
+      Uint8List data, int dataLength, ZegoAudioFrameParam param) {
+    throw UnsupportedError('ffi is not supported on web');
+  }
+
+  static int fetchCustomAudioRenderRing(int address, int chunkCount) {
+    throw UnsupportedError('ffi is not supported on web');
+  }
+
+  static void onRealTimeSequentialDataSent(int sequence, int errorCode) {}
+
+  static void failPendingSends(String reason) {}
+}
@@ -7,6 +7,10 @@ import 'dart:typed_data';
 import 'package:flutter/foundation.dart';
 import 'package:flutter/material.dart';
 import 'package:flutter/services.dart';
+import 'zego_express_compact_event_decoder.dart';
+import 'zego_express_ffi_impl.dart'
+    if (dart.library.html) 'zego_express_ffi_impl_web.dart';
+import 'zego_express_performance_impl.dart';
 import 'zego_express_texture_renderer_impl.dart';
 import '../zego_express_api.dart';
 import '../zego_express_defines.dart';
@@ -23,8 +27,33 @@ class MethodChannelWrapper extends MethodChannel {
   MethodChannelWrapper(String name) : super(name);
   bool showFlutterApiCalledDetail = false;
 
+  /// Methods that the publisher FFI sends depend on, the native side orders
+  /// channel calls after them but FFI calls would overtake them.
+  static const Set<String> _publishStateMethods = {
+    'createEngine',
+    'createEngineWithProfile',
+    'loginRoom',
+    'logoutRoom',
+    'switchRoom',
+    'startPublishingStream',
+    'stopPublishingStream',
+  };
+  int _pendingPublishStateCalls = 0;
+
+  /// Whether a call of [_publishStateMethods] has not completed yet.
+  bool get hasPendingPublishStateCalls => _pendingPublishStateCalls > 0;
+
   @override
   Future<T?> invokeMethod<T>(String method, [arguments]) {
+    if (_publishStateMethods.contains(method)) {
+      _pendingPublishStateCalls++;
+      return _invokeMethod<T>(method, arguments)
+          .whenComplete(() => _pendingPublishStateCalls--);
+    }
+    return _invokeMethod<T>(method, arguments);
+  }
+
+  Future<T?> _invokeMethod<T>(String method, [arguments]) {
     if (showFlutterApiCalledDetail) {
       if (ZegoExpressImpl.onFlutterApiCalledDetail != null) {
         ZegoExpressImpl.onFlutterApiCalledDetail!(
@@ -63,6 +92,14 @@ class ZegoExpressImpl {
   // enablePlatformView
   static bool _enablePlatformView = false;
 
+  /// Whether the publisher sends can take the FFI path. While a call they
+  /// depend on is pending they go through the channel, which keeps them in
+  /// order after it.
+  static bool get _canSendThroughFFI =>
+      kIsWindows &&
+      ZegoExpressFFIImpl.isAvailable &&
+      !_channel.hasPendingPublishStateCalls;
+
   static bool shouldUsePlatformView() {
     bool use = ZegoExpressImpl._enablePlatformView;
     // Web only supports PlatformView
@@ -602,6 +639,10 @@ class ZegoExpressImpl {
 
   Future<void> sendSEI(Uint8List data, int dataLength,
       {ZegoPublishChannel? channel}) async {
+    if (_canSendThroughFFI) {
+      return ZegoExpressFFIImpl.sendSEI(
+          data, dataLength, channel ?? ZegoPublishChannel.Main);
+    }
     return await _channel.invokeMethod('sendSEI', {
       'data': data,
       'dataLength': dataLength,
@@ -611,6 +652,10 @@ class ZegoExpressImpl {
 
   Future<void> sendAudioSideInfo(Uint8List data, double timeStampMs,
       {ZegoPublishChannel? channel}) async {
+    if (_canSendThroughFFI) {
+      return ZegoExpressFFIImpl.sendAudioSideInfo(
+          data, timeStampMs, channel ?? ZegoPublishChannel.Main);
+    }
     return await _channel.invokeMethod('sendAudioSideInfo', {
       'data': data,
       'timeStampMs': timeStampMs,
@@ -1787,6 +1832,16 @@ class ZegoExpressImpl {
       int samples,
       ZegoAudioFrameParam param,
       {ZegoPublishChannel? channel}) async {
+    if (_canSendThroughFFI) {
+      return ZegoExpressFFIImpl.sendCustomAudioCaptureAACData(
+          data,
+          dataLength,
+          configLength,
+          referenceTimeMillisecond,
+          samples,
+          param,
+          channel ?? ZegoPublishChannel.Main);
+    }
     return await _channel.invokeMethod('sendCustomAudioCaptureAACData', {
       'data': data,
       'dataLength': dataLength,
@@ -1804,6 +1859,10 @@ class ZegoExpressImpl {
   Future<void> sendCustomAudioCapturePCMData(
       Uint8List data, int dataLength, ZegoAudioFrameParam param,
       {ZegoPublishChannel? channel}) async {
+    if (_canSendThroughFFI) {
+      return ZegoExpressFFIImpl.sendCustomAudioCapturePCMData(
+          data, dataLength, param, channel ?? ZegoPublishChannel.Main);
+    }
     return await _channel.invokeMethod('sendCustomAudioCapturePCMData', {
       'data': data,
       'dataLength': dataLength,
@@ -1817,7 +1876,12 @@ class ZegoExpressImpl {
 
   Future<void> fetchCustomAudioRenderPCMData(
       Uint8List data, int dataLength, ZegoAudioFrameParam param) async {
-    return await _channel.invokeMethod('fetchCustomAudioRenderPCMData', {
+    if (kIsWindows && ZegoExpressFFIImpl.isAvailable) {
+      return ZegoExpressFFIImpl.fetchCustomAudioRenderPCMData(
+          data, dataLength, param);
+    }
+    final fetched =
+        await _channel.invokeMethod('fetchCustomAudioRenderPCMData', {
       'data': data,
       'dataLength': dataLength,
       'param': {
@@ -1825,6 +1889,10 @@ class ZegoExpressImpl {
         'channel': param.channel.index
       }
     });
+    // Platforms that fill a copy of the data reply with it.
+    if (fetched is Uint8List) {
+      data.setRange(0, min(fetched.length, data.length), fetched);
+    }
   }
 
   /* Range Audio */
@@ -2066,11 +2134,18 @@ class ZegoExpressImpl {
   }
 
   static void _unregisterEventHandler() async {
+    // FFI send results arrive as events, none will come after this.
+    ZegoExpressFFIImpl.failPendingSends('the event handler is unregistered');
     await _streamSubscription?.cancel();
     _streamSubscription = null;
   }
 
   static void _eventListener(dynamic data) {
+    if (data is Uint8List) {
+      ZegoCompactEventDecoder.handleEvent(data);
+      return;
+    }
+
     final Map<dynamic, dynamic> map = data;
     switch (map['method']) {
       case 'onDebugError':
@@ -2170,6 +2245,18 @@ class ZegoExpressImpl {
             map['roomID'], ZegoUpdateType.values[map['updateType']], userList);
         break;
 
+      case 'onRoomRosterUpdate':
+        if (ZegoExpressEngine.onRoomRosterUpdate == null) return;
+
+        ZegoExpressEngine.onRoomRosterUpdate!(
+            map['roomID'],
+            ZegoRoomRosterType.values[map['rosterType']],
+            ZegoUpdateType.values[map['updateType']],
+            map['changedCount'],
+            map['totalCount'],
+            Map<String, dynamic>.from(jsonDecode(map['extendedData'])));
+        break;
+
       case 'onRoomOnlineUserCountUpdate':
         if (ZegoExpressEngine.onRoomOnlineUserCountUpdate == null) return;
 
@@ -2495,6 +2582,10 @@ class ZegoExpressImpl {
             map['streamID'], map['SEIData'], map['timestampNs']));
         break;
 
+      case 'onSEIBatch':
+        ZegoExpressPerformanceImpl.onSEIBatch(map);
+        break;
+
       case 'onPlayerRecvAudioSideInfo':
         if (ZegoExpressEngine.onPlayerRecvAudioSideInfo == null) return;
 
@@ -2629,7 +2720,14 @@ class ZegoExpressImpl {
         if (ZegoExpressEngine.onRemoteSoundLevelUpdate == null) return;
 
         var soundLevels = <dynamic, dynamic>{};
-        if (map['soundLevels'] != null) {
+        if (map['soundLevelData'] != null) {
+          List<dynamic> streamIDs = map['streamIDs'];
+          Float32List soundLevelData = map['soundLevelData'];
+          for (int i = 0; i < streamIDs.length; i++) {
+            double value = soundLevelData[i];
+            soundLevels[streamIDs[i]] = value < 0.000001 ? 0.0 : value;
+          }
+        } else if (map['soundLevels'] != null) {
           soundLevels = (map['soundLevels'] as Map).map(
               (key, value) => MapEntry(key, value < 0.000001 ? 0.0 : value));
         }
@@ -2651,8 +2749,9 @@ class ZegoExpressImpl {
       case 'onCapturedAudioSpectrumUpdate':
         if (ZegoExpressEngine.onCapturedAudioSpectrumUpdate == null) return;
 
-        List<double> originAudioSpectrum =
-            List<double>.from(map['audioSpectrum']);
+        List<double> originAudioSpectrum = map['audioSpectrum'] is Float32List
+            ? map['audioSpectrum']
+            : List<double>.from(map['audioSpectrum']);
 
         ZegoExpressEngine.onCapturedAudioSpectrumUpdate!(originAudioSpectrum);
         break;
@@ -2660,16 +2759,30 @@ class ZegoExpressImpl {
       case 'onRemoteAudioSpectrumUpdate':
         if (ZegoExpressEngine.onRemoteAudioSpectrumUpdate == null) return;
 
-        Map<dynamic, dynamic> originAudioSpectrums = map['audioSpectrums'];
         Map<String, List<double>> audioSpectrums = {};
-        for (String streamID in originAudioSpectrums.keys) {
-          audioSpectrums[streamID] =
-              List<double>.from(originAudioSpectrums[streamID]);
+        if (map['audioSpectrumData'] != null) {
+          // Packed by the Windows plugin, see `_unpackFloat32Lists`
+          audioSpectrums = _unpackFloat32Lists(
+              map['streamIDs'], map['offsets'], map['audioSpectrumData']);
+        } else {
+          Map<dynamic, dynamic> originAudioSpectrums = map['audioSpectrums'];
+          for (String streamID in originAudioSpectrums.keys) {
+            audioSpectrums[streamID] =
+                List<double>.from(originAudioSpectrums[streamID]);
+          }
         }
 
         ZegoExpressEngine.onRemoteAudioSpectrumUpdate!(audioSpectrums);
         break;
 
+      case 'onAudioMetersUpdate':
+        _handleAudioMetersUpdate(map);
+        break;
+
+      case 'onAudioDataRingAvailable':
+        ZegoExpressPerformanceImpl.onAudioDataRingAvailable(map['address']);
+        break;
+
       case 'onLocalDeviceExceptionOccurred':
         if (ZegoExpressEngine.onLocalDeviceExceptionOccurred == null) return;
 
@@ -2762,6 +2875,10 @@ class ZegoExpressImpl {
             map['command']);
         break;
 
+      case 'onIMMessageBatch':
+        ZegoExpressPerformanceImpl.onIMMessageBatch(map['messageList']);
+        break;
+
       /* Utilities */
 
       case 'onPerformanceStatusUpdate':
@@ -2958,7 +3075,9 @@ class ZegoExpressImpl {
         ZegoMediaPlayer? mediaPlayer =
             ZegoExpressImpl.mediaPlayerMap[mediaPlayerIndex!];
         if (mediaPlayer != null) {
-          List<double> spectrumList = List<double>.from(map['spectrumList']);
+          List<double> spectrumList = map['spectrumList'] is Float32List
+              ? map['spectrumList']
+              : List<double>.from(map['spectrumList']);
           ZegoExpressEngine.onMediaPlayerFrequencySpectrumUpdate!(
               mediaPlayer, spectrumList);
         }
@@ -3136,6 +3255,11 @@ class ZegoExpressImpl {
         break;
       /* Real Time Sequential Data Manager */
 
+      case 'onRealTimeSequentialDataSent':
+        ZegoExpressFFIImpl.onRealTimeSequentialDataSent(
+            map['sequence'], map['errorCode']);
+        break;
+
       case 'onReceiveRealTimeSequentialData':
         if (ZegoExpressEngine.onReceiveRealTimeSequentialData == null) return;
 
@@ -3149,6 +3273,10 @@ class ZegoExpressImpl {
         }
         break;
 
+      case 'onReceiveRealTimeSequentialDataBatch':
+        ZegoExpressPerformanceImpl.onReceiveRealTimeSequentialDataBatch(map);
+        break;
+
       /* Copyrighted Music */
       case 'onDownloadProgressUpdate':
         if (ZegoExpressEngine.onDownloadProgressUpdate == null ||
@@ -3272,6 +3400,90 @@ class ZegoExpressImpl {
         break;
     }
   }
+
+  /// Splits spectrums packed into one Float32List into views of it, the
+  /// spectrum of `streamIDs[i]` is `data[offsets[i], offsets[i + 1])`.
+  static Map<String, List<double>> _unpackFloat32Lists(
+      List<dynamic> streamIDs, Int32List offsets, Float32List data) {
+    Map<String, List<double>> lists = {};
+    for (int i = 0; i < streamIDs.length; i++) {
+      lists[streamIDs[i]] =
+          Float32List.sublistView(data, offsets[i], offsets[i + 1]);
+    }
+    return lists;
+  }
+
+  static void _handleAudioMetersUpdate(Map<dynamic, dynamic> map) {
+    double soundLevel(double value) => value < 0.000001 ? 0.0 : value;
+    ZegoAudioLevelMeter levelMeter(dynamic value) {
+      final List<double> meter = List<double>.from(value);
+      return ZegoAudioLevelMeter(
+          soundLevel(meter[0]), soundLevel(meter[1]), meter[2].toInt());
+    }
+
+    ZegoAudioSpectrumMeter spectrumMeter(dynamic value) {
+      final List<dynamic> meter = value;
+      return ZegoAudioSpectrumMeter(
+          List<double>.from(meter[0]), List<double>.from(meter[1]));
+    }
+
+    final meters = ZegoAudioMeters(
+        map['capturedSoundLevel'] != null
+            ? levelMeter(map['capturedSoundLevel'])
+            : null,
+        (map['remoteSoundLevels'] as Map? ?? {}).map(
+            (key, value) => MapEntry(key as String, levelMeter(value))),
+        (map['remoteSoundLevelInfos'] as Map? ?? {}).map(
+            (key, value) => MapEntry(key as String, levelMeter(value))),
+        map['capturedAudioSpectrum'] != null
+            ? spectrumMeter(map['capturedAudioSpectrum'])
+            : null,
+        (map['remoteAudioSpectrums'] as Map? ?? {}).map(
+            (key, value) => MapEntry(key as String, spectrumMeter(value))),
+        (map['mediaPlayerFrequencySpectrums'] as Map? ?? {}).map(
+            (key, value) => MapEntry(key as int, spectrumMeter(value))),
+        map['capturedSoundLevelInfo'] != null
+            ? levelMeter(map['capturedSoundLevelInfo'])
+            : null);
+
+    if (meters.capturedSoundLevel != null) {
+      ZegoExpressEngine.onCapturedSoundLevelUpdate
+          ?.call(meters.capturedSoundLevel!.latest);
+    }
+    if (meters.capturedSoundLevelInfo != null) {
+      ZegoExpressEngine.onCapturedSoundLevelInfoUpdate?.call(ZegoSoundLevelInfo(
+          meters.capturedSoundLevelInfo!.latest,
+          meters.capturedSoundLevelInfo!.vad));
+    }
+    if (meters.remoteSoundLevels.isNotEmpty) {
+      ZegoExpressEngine.onRemoteSoundLevelUpdate?.call(meters.remoteSoundLevels
+          .map((key, value) => MapEntry(key, value.latest)));
+    }
+    if (meters.remoteSoundLevelInfos.isNotEmpty) {
+      ZegoExpressEngine.onRemoteSoundLevelInfoUpdate?.call(meters
+          .remoteSoundLevelInfos
+          .map((key, value) =>
+              MapEntry(key, ZegoSoundLevelInfo(value.latest, value.vad))));
+    }
+    if (meters.capturedAudioSpectrum != null) {
+      ZegoExpressEngine.onCapturedAudioSpectrumUpdate
+          ?.call(meters.capturedAudioSpectrum!.latest);
+    }
+    if (meters.remoteAudioSpectrums.isNotEmpty) {
+      ZegoExpressEngine.onRemoteAudioSpectrumUpdate?.call(meters
+          .remoteAudioSpectrums
+          .map((key, value) => MapEntry(key, value.latest)));
+    }
+    meters.mediaPlayerFrequencySpectrums.forEach((index, value) {
+      ZegoMediaPlayer? mediaPlayer = ZegoExpressImpl.mediaPlayerMap[index];
+      if (mediaPlayer != null) {
+        ZegoExpressEngine.onMediaPlayerFrequencySpectrumUpdate
+            ?.call(mediaPlayer, value.latest);
+      }
+    });
+
+    ZegoExpressEngine.onAudioMetersUpdate?.call(meters);
+  }
 }
 
 class ZegoMediaPlayerImpl extends ZegoMediaPlayer {
@@ -3983,6 +4195,13 @@ class ZegoRealTimeSequentialDataManagerImpl
   @override
   Future<ZegoRealTimeSequentialDataSentResult> sendRealTimeSequentialData(
       Uint8List data, String streamID) async {
+    if (kIsWindows && ZegoExpressFFIImpl.isAvailable) {
+      final result = ZegoExpressFFIImpl.sendRealTimeSequentialData(
+          _index, data, streamID);
+      if (result != null) {
+        return await result;
+      }
+    }
     final Map<dynamic, dynamic> map = await ZegoExpressImpl._channel
         .invokeMethod('dataManagerSendRealTimeSequentialData',
             {'index': _index, 'data': data, 'streamID': streamID});
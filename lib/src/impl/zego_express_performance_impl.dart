@@ -0,0 +1,731 @@
+import 'dart:typed_data';
+
+import 'package:flutter/services.dart';
+
+import '../utils/zego_express_utils.dart';
+import '../zego_express_api.dart';
+import '../zego_express_defines.dart';
+import '../zego_express_enum_extension.dart';
+import 'zego_express_audio_data_ring_impl.dart'
+    if (dart.library.html) 'zego_express_audio_data_ring_impl_web.dart';
+import 'zego_express_custom_audio_render_ring_impl.dart'
+    if (dart.library.html) 'zego_express_custom_audio_render_ring_impl_web.dart';
+import 'zego_express_impl.dart';
+
+class ZegoExpressPerformanceImpl {
+  static Future<Map<String, int>> getEventQueueStats() async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getEventQueueStats');
+      return Map<String, int>.from(map);
+    }
+    return {};
+  }
+
+  static Future<void> enableCompactEventEncoding(bool enable) async {
+    if (kIsWindows) {
+      return await ZegoExpressImpl.methodChannel
+          .invokeMethod('enableCompactEventEncoding', {'enable': enable});
+    }
+  }
+
+  static Future<void> enableAudioMeterCoalescing(
+      bool enable, int interval) async {
+    if (kIsWindows) {
+      return await ZegoExpressImpl.methodChannel.invokeMethod(
+          'enableAudioMeterCoalescing', {'enable': enable, 'interval': interval});
+    }
+  }
+
+  static Future<void> updateEventSubscriptions() async {
+    if (kIsWindows) {
+      final List<String> methods = [];
+      _eventSubscriptions.forEach((method, isSubscribed) {
+        if (!isSubscribed()) {
+          methods.add(method);
+        }
+      });
+      return await ZegoExpressImpl.methodChannel
+          .invokeMethod('setUnsubscribedEvents', {'methods': methods});
+    }
+  }
+
+  static Future<void> resetEventSubscriptions() async {
+    if (kIsWindows) {
+      return await ZegoExpressImpl.methodChannel
+          .invokeMethod('setUnsubscribedEvents', {'methods': <String>[]});
+    }
+  }
+
+  static Future<Map<String, int>> getSuppressedEventCounts() async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getSuppressedEventCounts');
+      return Map<String, int>.from(map);
+    }
+    return {};
+  }
+
+  static final Map<int, ZegoAudioDataRingImpl> _audioDataRings = {};
+
+  static Future<ZegoAudioDataRing?> createAudioDataRing(
+      int source, String streamID, int capacity, bool notify) async {
+    if (kIsWindows) {
+      final int address = await ZegoExpressImpl.methodChannel.invokeMethod(
+          'createAudioDataRing', {
+        'source': source,
+        'streamID': streamID,
+        'capacity': capacity,
+        'notify': notify
+      });
+      final ring = ZegoAudioDataRingImpl(source, streamID, address);
+      _audioDataRings[address] = ring;
+      return ring;
+    }
+    return null;
+  }
+
+  static Future<void> destroyAudioDataRing(ZegoAudioDataRing ring) async {
+    if (kIsWindows) {
+      // Stop reading the ring before native frees its memory.
+      if (ring is! ZegoAudioDataRingImpl || ring.isDisposed) {
+        return;
+      }
+      ring.dispose();
+      _audioDataRings.remove(ring.address);
+      return await ZegoExpressImpl.methodChannel.invokeMethod(
+          'destroyAudioDataRing',
+          {'source': ring.source, 'streamID': ring.streamID});
+    }
+  }
+
+  static void onAudioDataRingAvailable(int address) {
+    final ring = _audioDataRings[address];
+    if (ring == null) {
+      return;
+    }
+    ring.clearNotification();
+    ring.onDataAvailable?.call(ring);
+  }
+
+  static Future<Map<String, ZegoStreamQualitySummary>> queryStreamQuality(
+      List<String> streamIDs, int window) async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('queryStreamQuality',
+              {'streamIDs': streamIDs, 'window': window});
+      return map.map((streamID, summary) => MapEntry(
+          streamID,
+          ZegoStreamQualitySummary(_qualityWindow(summary['publisher']),
+              _qualityWindow(summary['player']))));
+    }
+    return {};
+  }
+
+  static Future<void> enableRoomRoster(bool enable) async {
+    if (kIsWindows) {
+      return await ZegoExpressImpl.methodChannel
+          .invokeMethod('enableRoomRoster', {'enable': enable});
+    }
+  }
+
+  static Future<ZegoRoomUserPage> getRoomUsers(
+      String roomID, int offset, int limit, String filter) async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getRoomUsers', {
+        'roomID': roomID,
+        'offset': offset,
+        'limit': limit,
+        'filter': filter
+      });
+      List<ZegoUser> userList = [];
+      for (Map<dynamic, dynamic> userMap in map['userList']) {
+        userList.add(ZegoUser(userMap['userID'], userMap['userName']));
+      }
+      return ZegoRoomUserPage(map['totalCount'], map['version'], userList);
+    }
+    return ZegoRoomUserPage(0, 0, []);
+  }
+
+  static Future<ZegoRoomStreamPage> getRoomStreams(
+      String roomID, int offset, int limit, String filter) async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getRoomStreams', {
+        'roomID': roomID,
+        'offset': offset,
+        'limit': limit,
+        'filter': filter
+      });
+      List<ZegoStream> streamList = [];
+      for (Map<dynamic, dynamic> streamMap in map['streamList']) {
+        streamList.add(ZegoStream(
+            ZegoUser(
+                streamMap['user']['userID'], streamMap['user']['userName']),
+            streamMap['streamID'],
+            streamMap['extraInfo']));
+      }
+      return ZegoRoomStreamPage(map['totalCount'], map['version'], streamList);
+    }
+    return ZegoRoomStreamPage(0, 0, []);
+  }
+
+  static Future<void> enableIMMessageBuffer(bool enable, int interval,
+      int maxBatchSize, int maxBacklog, int senderRateLimit) async {
+    if (kIsWindows) {
+      return await ZegoExpressImpl.methodChannel
+          .invokeMethod('enableIMMessageBuffer', {
+        'enable': enable,
+        'interval': interval,
+        'maxBatchSize': maxBatchSize,
+        'maxBacklog': maxBacklog,
+        'senderRateLimit': senderRateLimit
+      });
+    }
+  }
+
+  static Future<Map<String, int>> getIMMessageBufferStats() async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getIMMessageBufferStats');
+      return Map<String, int>.from(map);
+    }
+    return {};
+  }
+
+  /// Splits a buffered batch into runs of the same type and room, each
+  /// delivered through the regular message callback.
+  static void onIMMessageBatch(List<dynamic> messageMapList) {
+    int start = 0;
+    while (start < messageMapList.length) {
+      final int type = messageMapList[start]['type'];
+      final String roomID = messageMapList[start]['roomID'];
+      int end = start + 1;
+      while (end < messageMapList.length &&
+          messageMapList[end]['type'] == type &&
+          messageMapList[end]['roomID'] == roomID) {
+        end++;
+      }
+      final run = messageMapList.sublist(start, end);
+      start = end;
+
+      if (type == 0) {
+        ZegoExpressEngine.onIMRecvBroadcastMessage?.call(
+            roomID,
+            run
+                .map((messageMap) => ZegoBroadcastMessageInfo(
+                    messageMap['message'],
+                    messageMap['messageID'],
+                    messageMap['sendTime'],
+                    ZegoUser(messageMap['fromUser']['userID'],
+                        messageMap['fromUser']['userName'])))
+                .toList());
+      } else if (type == 1) {
+        ZegoExpressEngine.onIMRecvBarrageMessage?.call(
+            roomID,
+            run
+                .map((messageMap) => ZegoBarrageMessageInfo(
+                    messageMap['message'],
+                    messageMap['messageID'],
+                    messageMap['sendTime'],
+                    ZegoUser(messageMap['fromUser']['userID'],
+                        messageMap['fromUser']['userName'])))
+                .toList());
+      } else {
+        for (final messageMap in run) {
+          ZegoExpressEngine.onIMRecvCustomCommand?.call(
+              roomID,
+              ZegoUser(messageMap['fromUser']['userID'],
+                  messageMap['fromUser']['userName']),
+              messageMap['message']);
+        }
+      }
+    }
+  }
+
+  static Future<List<ZegoRealTimeSequentialDataSentResult>>
+      sendRealTimeSequentialDataBatch(ZegoRealTimeSequentialDataManager manager,
+          List<ZegoRealTimeSequentialDataRecord> records) async {
+    if (kIsWindows) {
+      final streamIDs = <String>[];
+      final offsets = Int32List(records.length);
+      final builder = BytesBuilder(copy: false);
+      for (int i = 0; i < records.length; i++) {
+        streamIDs.add(records[i].streamID);
+        offsets[i] = builder.length;
+        builder.add(records[i].data);
+      }
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('dataManagerSendRealTimeSequentialDataBatch', {
+        'index': manager.getIndex(),
+        'streamIDs': streamIDs,
+        'offsets': offsets,
+        'data': builder.takeBytes()
+      });
+      final List<int> errorCodes = map['errorCodes'];
+      return errorCodes
+          .map((errorCode) => ZegoRealTimeSequentialDataSentResult(errorCode))
+          .toList();
+    }
+    return [
+      for (final record in records)
+        await manager.sendRealTimeSequentialData(record.data, record.streamID)
+    ];
+  }
+
+  static Future<void> enableRealTimeSequentialDataBatching(
+      bool enable, int interval, int maxPendingBytes) async {
+    if (kIsWindows) {
+      return await ZegoExpressImpl.methodChannel
+          .invokeMethod('enableRealTimeSequentialDataBatching', {
+        'enable': enable,
+        'interval': interval,
+        'maxPendingBytes': maxPendingBytes
+      });
+    }
+  }
+
+  static Future<Map<String, int>> getRealTimeSequentialDataStats() async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getRealTimeSequentialDataStats');
+      return Map<String, int>.from(map);
+    }
+    return {};
+  }
+
+  /// Delivers every record of a packed batch through
+  /// [ZegoExpressEngine.onReceiveRealTimeSequentialData] as a view into
+  /// the batch buffer.
+  static void onReceiveRealTimeSequentialDataBatch(Map<dynamic, dynamic> map) {
+    if (ZegoExpressEngine.onReceiveRealTimeSequentialData == null) return;
+
+    final manager = ZegoExpressImpl.realTimeSequentialDataManagerMap[
+        map['realTimeSequentialDataManagerIndex']];
+    if (manager == null) return;
+
+    final List<dynamic> streamIDs = map['streamIDs'];
+    final Int32List offsets = map['offsets'];
+    final Uint8List data = map['data'];
+    for (int i = 0; i < streamIDs.length; i++) {
+      final end = i + 1 < offsets.length ? offsets[i + 1] : data.length;
+      ZegoExpressEngine.onReceiveRealTimeSequentialData!(
+          manager, Uint8List.sublistView(data, offsets[i], end), streamIDs[i]);
+    }
+  }
+
+  static Future<void> enableSEIBatching(bool enable, int interval,
+      int maxUnitsPerStream, bool latestOnly) async {
+    if (kIsWindows) {
+      return await ZegoExpressImpl.methodChannel
+          .invokeMethod('enableSEIBatching', {
+        'enable': enable,
+        'interval': interval,
+        'maxUnitsPerStream': maxUnitsPerStream,
+        'latestOnly': latestOnly
+      });
+    }
+  }
+
+  static Future<Map<String, int>> getSEIBatchStats() async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getSEIBatchStats');
+      return Map<String, int>.from(map);
+    }
+    return {};
+  }
+
+  /// Delivers every unit of a packed SEI batch through its regular
+  /// callback, as a view into the batch buffer.
+  static void onSEIBatch(Map<dynamic, dynamic> map) {
+    final Int32List types = map['types'];
+    final Int32List sources = map['sources'];
+    final List<dynamic> streamIDs = map['streamIDs'];
+    final Int64List timestamps = map['timestamps'];
+    final Int32List offsets = map['offsets'];
+    final Uint8List data = map['data'];
+    for (int i = 0; i < types.length; i++) {
+      final end = i + 1 < offsets.length ? offsets[i + 1] : data.length;
+      final unit = Uint8List.sublistView(data, offsets[i], end);
+      switch (types[i]) {
+        case 0:
+          ZegoExpressEngine.onPlayerRecvSEI?.call(streamIDs[i], unit);
+          break;
+        case 1:
+          ZegoExpressEngine.onPlayerRecvMediaSideInfo
+              ?.call(ZegoMediaSideInfo(streamIDs[i], unit, timestamps[i]));
+          break;
+        case 2:
+          final mediaPlayer = ZegoExpressImpl.mediaPlayerMap[sources[i]];
+          if (mediaPlayer != null) {
+            ZegoExpressEngine.onMediaPlayerRecvSEI?.call(mediaPlayer, unit);
+          }
+          break;
+      }
+    }
+  }
+
+  static Future<void> setEventLaneMaxDepth(
+      ZegoEventLane lane, int maxDepth) async {
+    if (kIsWindows) {
+      return await ZegoExpressImpl.methodChannel.invokeMethod(
+          'setEventLaneMaxDepth', {'lane': lane.index, 'maxDepth': maxDepth});
+    }
+  }
+
+  static Future<Map<String, Map<String, int>>> getEventLaneStats() async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getEventLaneStats');
+      return map.map((key, value) =>
+          MapEntry(key as String, Map<String, int>.from(value)));
+    }
+    return {};
+  }
+
+  static Future<List<ZegoBatchCallResult>> invokeBatch(
+      List<ZegoBatchCall> calls, bool stopOnError) async {
+    if (kIsWindows) {
+      final List<dynamic> results =
+          await ZegoExpressImpl.methodChannel.invokeMethod('invokeBatch', {
+        'calls': [
+          for (final call in calls)
+            {'method': call.method, 'arguments': call.arguments ?? {}}
+        ],
+        'stopOnError': stopOnError
+      });
+      return results
+          .map((result) => ZegoBatchCallResult(
+              result['result'], result['errorCode'], result['errorMessage']))
+          .toList();
+    }
+
+    final results = <ZegoBatchCallResult>[];
+    for (final call in calls) {
+      try {
+        results.add(ZegoBatchCallResult(
+            await ZegoExpressImpl.methodChannel
+                .invokeMethod(call.method, call.arguments),
+            null,
+            null));
+      } on PlatformException catch (e) {
+        results.add(ZegoBatchCallResult(null, e.code, e.message));
+        if (stopOnError) {
+          break;
+        }
+      } on MissingPluginException catch (e) {
+        results.add(ZegoBatchCallResult(null, 'not_implemented', e.message));
+        if (stopOnError) {
+          break;
+        }
+      }
+    }
+    return results;
+  }
+
+  static Future<Map<String, ZegoMethodCallStats>> getMethodCallStats() async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getMethodCallStats');
+      return map.map((method, stats) => MapEntry(
+          method as String,
+          ZegoMethodCallStats(_methodLatencyHistogram(stats['handler']),
+              _methodLatencyHistogram(stats['reply']))));
+    }
+    return {};
+  }
+
+  static Future<void> setMethodCallStatsLogInterval(int interval) async {
+    if (kIsWindows) {
+      return await ZegoExpressImpl.methodChannel.invokeMethod(
+          'setMethodCallStatsLogInterval', {'interval': interval});
+    }
+  }
+
+  static ZegoMethodLatencyHistogram _methodLatencyHistogram(
+      Map<dynamic, dynamic> map) {
+    return ZegoMethodLatencyHistogram(map['count'], map['totalMicroseconds'],
+        map['maxMicroseconds'], List<int>.from(map['buckets']));
+  }
+
+  static Future<Map<String, Map<String, int>>> getTaskQueueStats() async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getTaskQueueStats');
+      return map.map((key, value) =>
+          MapEntry(key as String, Map<String, int>.from(value)));
+    }
+    return {};
+  }
+
+  static Future<void> setPluginLogLevel(ZegoPluginLogLevel level) async {
+    if (kIsWindows) {
+      return await ZegoExpressImpl.methodChannel
+          .invokeMethod('setPluginLogLevel', {'level': level.index});
+    }
+  }
+
+  static Future<Map<String, int>> getPluginLogStats() async {
+    if (kIsWindows) {
+      final Map<dynamic, dynamic> map = await ZegoExpressImpl.methodChannel
+          .invokeMethod('getPluginLogStats');
+      return Map<String, int>.from(map);
+    }
+    return {};
+  }
+
+  static ZegoCustomAudioRenderRingImpl? _customAudioRenderRing;
+
+  static Future<ZegoCustomAudioRenderRing?> createCustomAudioRenderRing(
+      ZegoAudioFrameParam param,
+      int interval,
+      int capacity,
+      bool autoFetch) async {
+    if (kIsWindows) {
+      final int address = await ZegoExpressImpl.methodChannel
+          .invokeMethod('createCustomAudioRenderRing', {
+        'sampleRate': param.sampleRate.value,
+        'channel': param.channel.index,
+        'interval': interval,
+        'capacity': capacity,
+        'autoFetch': autoFetch
+      });
+      _customAudioRenderRing = ZegoCustomAudioRenderRingImpl(param, address);
+      return _customAudioRenderRing;
+    }
+    return null;
+  }
+
+  static Future<void> destroyCustomAudioRenderRing(
+      ZegoCustomAudioRenderRing ring) async {
+    if (kIsWindows) {
+      // Stop reading the ring before native frees its memory.
+      if (ring != _customAudioRenderRing) {
+        return;
+      }
+      _customAudioRenderRing!.dispose();
+      _customAudioRenderRing = null;
+      return await ZegoExpressImpl.methodChannel
+          .invokeMethod('destroyCustomAudioRenderRing');
+    }
+  }
+
+  static ZegoStreamQualityWindow? _qualityWindow(Map<dynamic, dynamic>? map) {
+    if (map == null) {
+      return null;
+    }
+    ZegoQualityPercentiles? percentiles(String metric) {
+      final List<double>? values = map[metric];
+      return values == null
+          ? null
+          : ZegoQualityPercentiles(values[0], values[1], values[2]);
+    }
+
+    return ZegoStreamQualityWindow(map['sampleCount'],
+        rtt: percentiles('rtt'),
+        packetLostRate: percentiles('packetLostRate'),
+        delay: percentiles('delay'),
+        fps: percentiles('fps'),
+        kbps: percentiles('kbps'),
+        mos: percentiles('mos'),
+        videoBreakRate: percentiles('videoBreakRate'),
+        audioBreakRate: percentiles('audioBreakRate'));
+  }
+
+  /// Whether dart handles the event of each native event method.
+  static final Map<String, bool Function()> _eventSubscriptions = {
+    'onDebugError': () => ZegoExpressEngine.onDebugError != null,
+    'onApiCalledResult': () => ZegoExpressEngine.onApiCalledResult != null,
+    'onFatalError': () => ZegoExpressEngine.onFatalError != null,
+    'onEngineStateUpdate': () => ZegoExpressEngine.onEngineStateUpdate != null,
+    'onRoomStateUpdate': () => ZegoExpressEngine.onRoomStateUpdate != null,
+    'onRoomStateChanged': () => ZegoExpressEngine.onRoomStateChanged != null,
+    'onRoomUserUpdate': () => ZegoExpressEngine.onRoomUserUpdate != null,
+    'onRoomOnlineUserCountUpdate': () =>
+        ZegoExpressEngine.onRoomOnlineUserCountUpdate != null,
+    'onRoomStreamUpdate': () => ZegoExpressEngine.onRoomStreamUpdate != null,
+    'onRoomRosterUpdate': () => ZegoExpressEngine.onRoomRosterUpdate != null,
+    'onRoomStreamExtraInfoUpdate': () =>
+        ZegoExpressEngine.onRoomStreamExtraInfoUpdate != null,
+    'onRoomExtraInfoUpdate': () =>
+        ZegoExpressEngine.onRoomExtraInfoUpdate != null,
+    'onPublisherStateUpdate': () =>
+        ZegoExpressEngine.onPublisherStateUpdate != null,
+    'onPublisherQualityUpdate': () =>
+        ZegoExpressEngine.onPublisherQualityUpdate != null,
+    'onPublisherCapturedAudioFirstFrame': () =>
+        ZegoExpressEngine.onPublisherCapturedAudioFirstFrame != null,
+    'onPublisherSendAudioFirstFrame': () =>
+        ZegoExpressEngine.onPublisherSendAudioFirstFrame != null,
+    'onPublisherStreamEvent': () =>
+        ZegoExpressEngine.onPublisherStreamEvent != null,
+    'onVideoObjectSegmentationStateChanged': () =>
+        ZegoExpressEngine.onVideoObjectSegmentationStateChanged != null,
+    'onPublisherLowFpsWarning': () =>
+        ZegoExpressEngine.onPublisherLowFpsWarning != null,
+    'onPublisherDummyCaptureImagePathError': () =>
+        ZegoExpressEngine.onPublisherDummyCaptureImagePathError != null,
+    'onPlayerStateUpdate': () => ZegoExpressEngine.onPlayerStateUpdate != null,
+    'onPlayerQualityUpdate': () =>
+        ZegoExpressEngine.onPlayerQualityUpdate != null,
+    'onPlayerMediaEvent': () => ZegoExpressEngine.onPlayerMediaEvent != null,
+    'onPlayerRecvAudioFirstFrame': () =>
+        ZegoExpressEngine.onPlayerRecvAudioFirstFrame != null,
+    'onPlayerRecvSEI': () => ZegoExpressEngine.onPlayerRecvSEI != null,
+    'onPlayerRecvMediaSideInfo': () =>
+        ZegoExpressEngine.onPlayerRecvMediaSideInfo != null,
+    'onPlayerRecvAudioSideInfo': () =>
+        ZegoExpressEngine.onPlayerRecvAudioSideInfo != null,
+    'onPlayerStreamEvent': () => ZegoExpressEngine.onPlayerStreamEvent != null,
+    'onPlayerRenderCameraVideoFirstFrame': () =>
+        ZegoExpressEngine.onPlayerRenderCameraVideoFirstFrame != null,
+    'onPlayerVideoSuperResolutionUpdate': () =>
+        ZegoExpressEngine.onPlayerVideoSuperResolutionUpdate != null,
+    'onMixerRelayCDNStateUpdate': () =>
+        ZegoExpressEngine.onMixerRelayCDNStateUpdate != null,
+    'onMixerSoundLevelUpdate': () =>
+        ZegoExpressEngine.onMixerSoundLevelUpdate != null,
+    'onAudioDeviceStateChanged': () =>
+        ZegoExpressEngine.onAudioDeviceStateChanged != null,
+    'onAudioDeviceVolumeChanged': () =>
+        ZegoExpressEngine.onAudioDeviceVolumeChanged != null,
+    'onCapturedSoundLevelUpdate': () =>
+        ZegoExpressEngine.onCapturedSoundLevelUpdate != null ||
+        ZegoExpressEngine.onAudioMetersUpdate != null,
+    'onRemoteSoundLevelUpdate': () =>
+        ZegoExpressEngine.onRemoteSoundLevelUpdate != null ||
+        ZegoExpressEngine.onAudioMetersUpdate != null,
+    'onRemoteMicStateUpdate': () =>
+        ZegoExpressEngine.onRemoteMicStateUpdate != null,
+    'onAudioEffectPlayStateUpdate': () =>
+        ZegoExpressEngine.onAudioEffectPlayStateUpdate != null,
+    'onMediaPlayerStateUpdate': () =>
+        ZegoExpressEngine.onMediaPlayerStateUpdate != null,
+    'onMediaPlayerNetworkEvent': () =>
+        ZegoExpressEngine.onMediaPlayerNetworkEvent != null,
+    'onMediaPlayerPlayingProgress': () =>
+        ZegoExpressEngine.onMediaPlayerPlayingProgress != null,
+    'onMediaPlayerRecvSEI': () =>
+        ZegoExpressEngine.onMediaPlayerRecvSEI != null,
+    'onMediaPlayerSoundLevelUpdate': () =>
+        ZegoExpressEngine.onMediaPlayerSoundLevelUpdate != null,
+    'onMediaPlayerFrequencySpectrumUpdate': () =>
+        ZegoExpressEngine.onMediaPlayerFrequencySpectrumUpdate != null ||
+        ZegoExpressEngine.onAudioMetersUpdate != null,
+    'onMediaPlayerFirstFrameEvent': () =>
+        ZegoExpressEngine.onMediaPlayerFirstFrameEvent != null,
+    'onMediaPlayerRenderingProgress': () =>
+        ZegoExpressEngine.onMediaPlayerRenderingProgress != null,
+    'onMediaDataPublisherFileOpen': () =>
+        ZegoExpressEngine.onMediaDataPublisherFileOpen != null,
+    'onMediaDataPublisherFileClose': () =>
+        ZegoExpressEngine.onMediaDataPublisherFileClose != null,
+    'onMediaDataPublisherFileDataBegin': () =>
+        ZegoExpressEngine.onMediaDataPublisherFileDataBegin != null,
+    'onCapturedAudioData': () => ZegoExpressEngine.onCapturedAudioData != null,
+    'onPlaybackAudioData': () => ZegoExpressEngine.onPlaybackAudioData != null,
+    'onMixedAudioData': () => ZegoExpressEngine.onMixedAudioData != null,
+    'onPlayerAudioData': () => ZegoExpressEngine.onPlayerAudioData != null,
+    'onCapturedDataRecordStateUpdate': () =>
+        ZegoExpressEngine.onCapturedDataRecordStateUpdate != null,
+    'onCapturedDataRecordProgressUpdate': () =>
+        ZegoExpressEngine.onCapturedDataRecordProgressUpdate != null,
+    'onDownloadProgressUpdate': () =>
+        ZegoExpressEngine.onDownloadProgressUpdate != null,
+    'onCurrentPitchValueUpdate': () =>
+        ZegoExpressEngine.onCurrentPitchValueUpdate != null,
+    'onNetworkTimeSynchronized': () =>
+        ZegoExpressEngine.onNetworkTimeSynchronized != null,
+    'onRequestDumpData': () => ZegoExpressEngine.onRequestDumpData != null,
+    'onStartDumpData': () => ZegoExpressEngine.onStartDumpData != null,
+    'onStopDumpData': () => ZegoExpressEngine.onStopDumpData != null,
+    'onUploadDumpData': () => ZegoExpressEngine.onUploadDumpData != null,
+    'onRoomTokenWillExpire': () =>
+        ZegoExpressEngine.onRoomTokenWillExpire != null,
+    'onPublisherCapturedVideoFirstFrame': () =>
+        ZegoExpressEngine.onPublisherCapturedVideoFirstFrame != null,
+    'onPublisherSendVideoFirstFrame': () =>
+        ZegoExpressEngine.onPublisherSendVideoFirstFrame != null,
+    'onPublisherRenderVideoFirstFrame': () =>
+        ZegoExpressEngine.onPublisherRenderVideoFirstFrame != null,
+    'onPublisherVideoSizeChanged': () =>
+        ZegoExpressEngine.onPublisherVideoSizeChanged != null,
+    'onPublisherRelayCDNStateUpdate': () =>
+        ZegoExpressEngine.onPublisherRelayCDNStateUpdate != null,
+    'onPublisherVideoEncoderChanged': () =>
+        ZegoExpressEngine.onPublisherVideoEncoderChanged != null,
+    'onPlayerRecvVideoFirstFrame': () =>
+        ZegoExpressEngine.onPlayerRecvVideoFirstFrame != null,
+    'onPlayerRenderVideoFirstFrame': () =>
+        ZegoExpressEngine.onPlayerRenderVideoFirstFrame != null,
+    'onPlayerVideoSizeChanged': () =>
+        ZegoExpressEngine.onPlayerVideoSizeChanged != null,
+    'onPlayerLowFpsWarning': () =>
+        ZegoExpressEngine.onPlayerLowFpsWarning != null,
+    'onAutoMixerSoundLevelUpdate': () =>
+        ZegoExpressEngine.onAutoMixerSoundLevelUpdate != null,
+    'onVideoDeviceStateChanged': () =>
+        ZegoExpressEngine.onVideoDeviceStateChanged != null,
+    'onCapturedSoundLevelInfoUpdate': () =>
+        ZegoExpressEngine.onCapturedSoundLevelInfoUpdate != null ||
+        ZegoExpressEngine.onAudioMetersUpdate != null,
+    'onRemoteSoundLevelInfoUpdate': () =>
+        ZegoExpressEngine.onRemoteSoundLevelInfoUpdate != null ||
+        ZegoExpressEngine.onAudioMetersUpdate != null,
+    'onCapturedAudioSpectrumUpdate': () =>
+        ZegoExpressEngine.onCapturedAudioSpectrumUpdate != null ||
+        ZegoExpressEngine.onAudioMetersUpdate != null,
+    'onRemoteAudioSpectrumUpdate': () =>
+        ZegoExpressEngine.onRemoteAudioSpectrumUpdate != null ||
+        ZegoExpressEngine.onAudioMetersUpdate != null,
+    'onLocalDeviceExceptionOccurred': () =>
+        ZegoExpressEngine.onLocalDeviceExceptionOccurred != null,
+    'onRemoteCameraStateUpdate': () =>
+        ZegoExpressEngine.onRemoteCameraStateUpdate != null,
+    'onRemoteSpeakerStateUpdate': () =>
+        ZegoExpressEngine.onRemoteSpeakerStateUpdate != null,
+    'onAudioVADStateUpdate': () =>
+        ZegoExpressEngine.onAudioVADStateUpdate != null,
+    'onIMRecvBroadcastMessage': () =>
+        ZegoExpressEngine.onIMRecvBroadcastMessage != null,
+    'onIMRecvBarrageMessage': () =>
+        ZegoExpressEngine.onIMRecvBarrageMessage != null,
+    'onIMRecvCustomCommand': () =>
+        ZegoExpressEngine.onIMRecvCustomCommand != null,
+    'onPerformanceStatusUpdate': () =>
+        ZegoExpressEngine.onPerformanceStatusUpdate != null,
+    'onNetworkModeChanged': () =>
+        ZegoExpressEngine.onNetworkModeChanged != null,
+    'onNetworkSpeedTestError': () =>
+        ZegoExpressEngine.onNetworkSpeedTestError != null,
+    'onNetworkSpeedTestQualityUpdate': () =>
+        ZegoExpressEngine.onNetworkSpeedTestQualityUpdate != null,
+    'onRecvExperimentalAPI': () =>
+        ZegoExpressEngine.onRecvExperimentalAPI != null,
+    'onNetworkQuality': () => ZegoExpressEngine.onNetworkQuality != null,
+    'onReceiveRealTimeSequentialData': () =>
+        ZegoExpressEngine.onReceiveRealTimeSequentialData != null,
+    'onRangeAudioMicrophoneStateUpdate': () =>
+        ZegoExpressEngine.onRangeAudioMicrophoneStateUpdate != null,
+    'onProcessCapturedAudioData': () =>
+        ZegoExpressEngine.onProcessCapturedAudioData != null,
+    'onProcessCapturedAudioDataAfterUsedHeadphoneMonitor': () =>
+        ZegoExpressEngine.onProcessCapturedAudioDataAfterUsedHeadphoneMonitor != null,
+    'onProcessRemoteAudioData': () =>
+        ZegoExpressEngine.onProcessRemoteAudioData != null,
+    'onProcessPlaybackAudioData': () =>
+        ZegoExpressEngine.onProcessPlaybackAudioData != null,
+    'onExceptionOccurred': () => ZegoExpressEngine.onExceptionOccurred != null,
+    'onWindowStateChanged': () =>
+        ZegoExpressEngine.onWindowStateChanged != null,
+    'onRectChanged': () => ZegoExpressEngine.onRectChanged != null,
+    'onAIVoiceChangerInit': () =>
+        ZegoExpressEngine.onAIVoiceChangerInit != null,
+    'onAIVoiceChangerUpdate': () =>
+        ZegoExpressEngine.onAIVoiceChangerUpdate != null,
+    'onAIVoiceChangerGetSpeakerList': () =>
+        ZegoExpressEngine.onAIVoiceChangerGetSpeakerList != null,
+  };
+}
@@ -5,6 +5,7 @@ import 'package:flutter/foundation.dart';
 import 'package:flutter/material.dart';
 import 'package:flutter/services.dart';
 
+import '../zego_express_api.dart';
 import '../zego_express_defines.dart';
 import '../utils/zego_express_utils.dart';
 import 'zego_express_impl.dart';
@@ -117,6 +118,11 @@ class ZegoExpressTextureRenderer {
           _mirrorMap[textureID] = map['isMirror'];
           _updateController.sink
               .add({'textureID': textureID, 'type': 'update'});
+          break;
+        case 'videoHealth':
+          ZegoExpressEngine.onVideoHealthEvent?.call(map['streamID'],
+              ZegoVideoHealthEvent.values[map['event']], map['duration']);
+          break;
       }
     }
 
@@ -348,6 +348,25 @@ class ZegoExpressEngine {
           String roomID, ZegoUpdateType updateType, List<ZegoUser> userList)?
       onRoomUserUpdate;
 
+  /// The callback triggered when the native room roster of a room changes.
+  ///
+  /// Description: After the room roster is enabled by [ZegoExpressPerformanceUtils.enableRoomRoster], user and stream updates are kept natively and this callback replaces [onRoomUserUpdate] and [onRoomStreamUpdate]. Only counts are delivered, read the lists with [ZegoExpressPerformanceUtils.getRoomUsers] and [ZegoExpressPerformanceUtils.getRoomStreams].
+  /// Restrictions: Only available on Windows.
+  ///
+  /// - [roomID] Room ID.
+  /// - [rosterType] Whether the users or the streams of the room changed.
+  /// - [updateType] Update type (add/delete).
+  /// - [changedCount] Number of users or streams actually added or removed.
+  /// - [totalCount] Number of users or streams in the room after the update.
+  /// - [extendedData] Extended information of a stream update, the same as in [onRoomStreamUpdate]. Empty for a user update.
+  static void Function(
+      String roomID,
+      ZegoRoomRosterType rosterType,
+      ZegoUpdateType updateType,
+      int changedCount,
+      int totalCount,
+      Map<String, dynamic> extendedData)? onRoomRosterUpdate;
+
   /// The callback triggered every 30 seconds to report the current number of online users.
   ///
   /// Available since: 1.7.0
@@ -704,6 +723,17 @@ class ZegoExpressEngine {
   static void Function(String streamID, int width, int height)?
       onPlayerVideoSizeChanged;
 
+  /// The callback triggered when the video health of a playing stream changes.
+  ///
+  /// Description: After the video health analyzer is enabled by [ZegoExpressCanvasViewUtils.enableVideoHealthAnalyzer], this callback is triggered when a playing stream freezes or recovers from a freeze, or when its video becomes black, a single color, or regular content again.
+  /// Restrictions: Only available on Windows, where the canvas view is rendered with a texture.
+  ///
+  /// - [streamID] Stream ID.
+  /// - [event] The health event.
+  /// - [duration] Freeze duration in milliseconds for [ZegoVideoHealthEvent.Freeze] (time since the last new frame) and [ZegoVideoHealthEvent.FreezeRecovered] (total freeze time), 0 otherwise.
+  static void Function(String streamID, ZegoVideoHealthEvent event, int duration)?
+      onVideoHealthEvent;
+
   /// The callback triggered when Supplemental Enhancement Information is received.
   ///
   /// Available since: 1.1.0
@@ -937,6 +967,14 @@ class ZegoExpressEngine {
   static void Function(Map<String, List<double>> audioSpectrums)?
       onRemoteAudioSpectrumUpdate;
 
+  /// The merged sound level and audio spectrum callback.
+  ///
+  /// Description: After audio meter coalescing is enabled by [ZegoExpressPerformanceUtils.enableAudioMeterCoalescing], the sound level and audio spectrum updates of all streams and media players are merged into this callback once per interval, with the latest and the peak value of each meter since the previous callback. The individual sound level and audio spectrum callbacks are still triggered once per interval with the latest values.
+  /// Restrictions: Only available on Windows.
+  ///
+  /// - [meters] The meters updated since the previous callback.
+  static void Function(ZegoAudioMeters meters)? onAudioMetersUpdate;
+
   /// The callback triggered when a local device exception occurred.
   ///
   /// Available since: 2.15.0
@@ -10,6 +10,16 @@ import 'package:flutter/material.dart';
 import 'impl/zego_express_canvas_view_impl.dart';
 import 'zego_express_api.dart';
 
+/// How the frame rate is distributed between remote canvas views.
+enum ZegoCanvasViewFpsPolicy {
+  /// Every canvas view refreshes at its own max render fps.
+  None,
+
+  /// The loudest remote stream (from the sound level monitor) refreshes at its
+  /// own max render fps, the other remote streams are additionally throttled.
+  SpeakerPriority
+}
+
 extension ZegoExpressCanvasViewUtils on ZegoExpressEngine {
   /// Create a canvas view.
   ///
@@ -46,4 +56,129 @@ extension ZegoExpressCanvasViewUtils on ZegoExpressEngine {
   Future<bool> destroyCanvasView(int viewID) async {
     return await ZegoExpressCanvasViewImpl.destroyCanvasView(viewID);
   }
+
+  /// Limit the frame rate at which a canvas view refreshes.
+  ///
+  /// Small views such as participant thumbnails look the same at a lower
+  /// frame rate. Frames over the limit are dropped in native before they
+  /// are copied, which saves the pixel conversion cost.
+  ///
+  /// Set [fps] to 0 to remove the limit.
+  ///
+  /// Note: Only takes effect on Windows, where the canvas view is rendered
+  /// with a texture.
+  Future<bool> setCanvasViewMaxRenderFps(int viewID, int fps) async {
+    return await ZegoExpressCanvasViewImpl.setCanvasViewMaxRenderFps(
+        viewID, fps);
+  }
+
+  /// Set the frame rate policy of remote canvas views.
+  ///
+  /// With [ZegoCanvasViewFpsPolicy.SpeakerPriority], the loudest remote
+  /// stream keeps its own max render fps while the other remote streams are
+  /// capped at [throttledFps], so the rendering cost stays bounded as the
+  /// room grows. The policy relies on [startSoundLevelMonitor] to find out
+  /// the loudest stream.
+  ///
+  /// Note: Only takes effect on Windows, where the canvas view is rendered
+  /// with a texture.
+  Future<void> setCanvasViewFpsPolicy(ZegoCanvasViewFpsPolicy policy,
+      {int throttledFps = 0}) async {
+    return await ZegoExpressCanvasViewImpl.setCanvasViewFpsPolicy(
+        policy, throttledFps);
+  }
+
+  /// Convert video frames for canvas views on a dedicated worker thread.
+  ///
+  /// By default the pixel conversion of a canvas view runs inside the
+  /// texture callback, which Flutter invokes on its raster thread. When
+  /// enabled, frames are converted as soon as they arrive and the texture
+  /// callback only hands the converted buffer to Flutter.
+  ///
+  /// Note: Only takes effect on Windows, where the canvas view is rendered
+  /// with a texture.
+  Future<void> enableCanvasViewRenderPrepWorker(bool enable) async {
+    return await ZegoExpressCanvasViewImpl.enableCanvasViewRenderPrepWorker(
+        enable);
+  }
+
+  /// Convert video frames for canvas views while they are received.
+  ///
+  /// By default each frame is copied into a source buffer first and
+  /// converted into the buffer handed to Flutter later. When enabled, the
+  /// frame is converted straight from the SDK's buffer, which saves one copy
+  /// per frame and half of the memory of each canvas view. Takes precedence
+  /// over [enableCanvasViewRenderPrepWorker].
+  ///
+  /// Note: Only takes effect on Windows, where the canvas view is rendered
+  /// with a texture.
+  Future<void> enableCanvasViewSingleCopy(bool enable) async {
+    return await ZegoExpressCanvasViewImpl.enableCanvasViewSingleCopy(enable);
+  }
+
+  /// Notify Flutter of new canvas view frames in one batch per refresh.
+  ///
+  /// By default every canvas view tells Flutter about a new frame as soon as
+  /// it arrives, so many views produce a stream of wakeups at slightly
+  /// different phases. When enabled, new frames of all canvas views are
+  /// flushed together once every [interval] milliseconds. Set [interval] to
+  /// 0 to use the refresh interval of the primary monitor.
+  ///
+  /// Note: Only takes effect on Windows, where the canvas view is rendered
+  /// with a texture.
+  Future<void> enableCanvasViewFrameBatching(bool enable,
+      {int interval = 0}) async {
+    return await ZegoExpressCanvasViewImpl.enableCanvasViewFrameBatching(
+        enable, interval);
+  }
+
+  /// Get the rendering statistics of a canvas view.
+  ///
+  /// Returns the number of frames handed to Flutter on its raster thread
+  /// (`rasterFrameCount`) and the total and max time in microseconds spent
+  /// doing so (`rasterTotalMicroseconds`, `rasterMaxMicroseconds`).
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise.
+  Future<Map<String, int>> getCanvasViewRenderStats(int viewID) async {
+    return await ZegoExpressCanvasViewImpl.getCanvasViewRenderStats(viewID);
+  }
+
+  /// Enable the video health analyzer for playing streams.
+  ///
+  /// When enabled, the arrival jitter of every playing stream is recorded and
+  /// a sparse grid of pixels of every [sampleInterval]th frame is checked for
+  /// black, single-colored and repeated content. A stream without new frames
+  /// or new content for longer than [freezeThreshold] milliseconds is
+  /// reported as frozen. Changes are reported through
+  /// [ZegoExpressEngine.onVideoHealthEvent], the accumulated statistics can be
+  /// queried with [getVideoHealthSummary].
+  ///
+  /// Repeated content is reported as a freeze even while frames keep
+  /// arriving, so a stream that legitimately shows a still image, e.g. a
+  /// shared slide, is also reported as frozen until its content changes.
+  ///
+  /// Note: Only takes effect on Windows, where the canvas view is rendered
+  /// with a texture.
+  Future<void> enableVideoHealthAnalyzer(bool enable,
+      {int freezeThreshold = 500, int sampleInterval = 10}) async {
+    return await ZegoExpressCanvasViewImpl.enableVideoHealthAnalyzer(
+        enable, freezeThreshold, sampleInterval);
+  }
+
+  /// Get the video health summary of a playing stream.
+  ///
+  /// Returns the number of frames (`frameCount`), the average frame interval
+  /// in milliseconds (`averageInterval`), the arrival jitter histogram with
+  /// buckets of [0, 2), [2, 5), [5, 10), [10, 20), [20, 50), [50, 100) and
+  /// 100+ milliseconds (`jitterHistogram`), the number and total duration in
+  /// milliseconds of freezes (`freezeCount`, `totalFreezeDuration`), whether
+  /// the stream is currently frozen (`isFrozen`), and the number of sampled,
+  /// black and single-colored frames (`sampledFrameCount`,
+  /// `blackFrameCount`, `uniformFrameCount`).
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise or
+  /// when the analyzer has not seen the stream.
+  Future<Map<String, dynamic>> getVideoHealthSummary(String streamID) async {
+    return await ZegoExpressCanvasViewImpl.getVideoHealthSummary(streamID);
+  }
 }
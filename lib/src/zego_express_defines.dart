@@ -1876,6 +1876,387 @@ enum ZegoDumpDataType {
   Audio
 }
 
+/// Video health event of a playing stream.
+enum ZegoVideoHealthEvent {
+  /// No new frame or no new content for longer than the freeze threshold.
+  /// A still image that keeps arriving, e.g. a shared slide, counts as no
+  /// new content.
+  Freeze,
+
+  /// New content arrives again after a freeze.
+  FreezeRecovered,
+
+  /// The video became black.
+  Black,
+
+  /// The video became a single color other than black.
+  Uniform,
+
+  /// The video shows regular content again after being black or a single color.
+  ContentRecovered
+}
+
+/// Latest and peak sound level since the previous [ZegoExpressEngine.onAudioMetersUpdate].
+class ZegoAudioLevelMeter {
+  /// The latest sound level.
+  double latest;
+
+  /// The highest sound level.
+  double peak;
+
+  /// The latest voice activity detection result, only for sound level infos.
+  int vad;
+
+  ZegoAudioLevelMeter(this.latest, this.peak, this.vad);
+}
+
+/// Latest and per-band peak audio spectrum since the previous [ZegoExpressEngine.onAudioMetersUpdate].
+class ZegoAudioSpectrumMeter {
+  /// The latest audio spectrum.
+  List<double> latest;
+
+  /// The highest value of each band.
+  List<double> peak;
+
+  ZegoAudioSpectrumMeter(this.latest, this.peak);
+}
+
+/// The audio meters updated since the previous [ZegoExpressEngine.onAudioMetersUpdate].
+class ZegoAudioMeters {
+  /// Locally captured sound level, null if not updated.
+  ZegoAudioLevelMeter? capturedSoundLevel;
+
+  /// Remote sound levels, key is the streamID.
+  Map<String, ZegoAudioLevelMeter> remoteSoundLevels;
+
+  /// Remote sound level infos, key is the streamID.
+  Map<String, ZegoAudioLevelMeter> remoteSoundLevelInfos;
+
+  /// Locally captured audio spectrum, null if not updated.
+  ZegoAudioSpectrumMeter? capturedAudioSpectrum;
+
+  /// Remote audio spectrums, key is the streamID.
+  Map<String, ZegoAudioSpectrumMeter> remoteAudioSpectrums;
+
+  /// Media player frequency spectrums, key is the media player index.
+  Map<int, ZegoAudioSpectrumMeter> mediaPlayerFrequencySpectrums;
+
+  /// Locally captured sound level info, null if not updated.
+  ZegoAudioLevelMeter? capturedSoundLevelInfo;
+
+  ZegoAudioMeters(
+      this.capturedSoundLevel,
+      this.remoteSoundLevels,
+      this.remoteSoundLevelInfos,
+      this.capturedAudioSpectrum,
+      this.remoteAudioSpectrums,
+      this.mediaPlayerFrequencySpectrums,
+      [this.capturedSoundLevelInfo]);
+}
+
+/// p50, p95 and max of one quality metric over a time window.
+class ZegoQualityPercentiles {
+  /// Median.
+  double p50;
+
+  /// 95th percentile.
+  double p95;
+
+  /// Max value.
+  double max;
+
+  ZegoQualityPercentiles(this.p50, this.p95, this.max);
+}
+
+/// Quality of a published or played stream over a time window.
+///
+/// Metrics that the stream type does not report are null.
+class ZegoStreamQualityWindow {
+  /// Number of quality samples in the window.
+  int sampleCount;
+
+  /// Round-trip time in ms.
+  ZegoQualityPercentiles? rtt;
+
+  /// Packet loss rate, in percentage, 0.0 ~ 1.0.
+  ZegoQualityPercentiles? packetLostRate;
+
+  /// Delay from the publisher to the player in ms, player only.
+  ZegoQualityPercentiles? delay;
+
+  /// Video send fps of a publisher, video render fps of a player.
+  ZegoQualityPercentiles? fps;
+
+  /// Audio and video kbps.
+  ZegoQualityPercentiles? kbps;
+
+  /// Audio MOS score, player only.
+  ZegoQualityPercentiles? mos;
+
+  /// Video break rate, player only.
+  ZegoQualityPercentiles? videoBreakRate;
+
+  /// Audio break rate, player only.
+  ZegoQualityPercentiles? audioBreakRate;
+
+  ZegoStreamQualityWindow(this.sampleCount,
+      {this.rtt,
+      this.packetLostRate,
+      this.delay,
+      this.fps,
+      this.kbps,
+      this.mos,
+      this.videoBreakRate,
+      this.audioBreakRate});
+}
+
+/// Quality of a stream over a time window, as queried by
+/// [ZegoExpressPerformanceUtils.queryStreamQuality].
+class ZegoStreamQualitySummary {
+  /// Quality as a published stream, null if it was not published.
+  ZegoStreamQualityWindow? publisher;
+
+  /// Quality as a played stream, null if it was not played.
+  ZegoStreamQualityWindow? player;
+
+  ZegoStreamQualitySummary(this.publisher, this.player);
+}
+
+/// Which list of a room a [ZegoExpressEngine.onRoomRosterUpdate] is about.
+enum ZegoRoomRosterType {
+  /// Users of the room.
+  User,
+
+  /// Streams of the room.
+  Stream
+}
+
+/// A page of room users, see [ZegoExpressPerformanceUtils.getRoomUsers].
+class ZegoRoomUserPage {
+  /// Number of users matching the filter, all users without one.
+  int totalCount;
+
+  /// Roster version the page was read at, changes with every update of the room.
+  int version;
+
+  /// Users of the page in join order.
+  List<ZegoUser> userList;
+
+  ZegoRoomUserPage(this.totalCount, this.version, this.userList);
+}
+
+/// A page of room streams, see [ZegoExpressPerformanceUtils.getRoomStreams].
+class ZegoRoomStreamPage {
+  /// Number of streams matching the filter, all streams without one.
+  int totalCount;
+
+  /// Roster version the page was read at, changes with every update of the room.
+  int version;
+
+  /// Streams of the page in the order they were added.
+  List<ZegoStream> streamList;
+
+  ZegoRoomStreamPage(this.totalCount, this.version, this.streamList);
+}
+
+/// One record of [ZegoExpressPerformanceUtils.sendRealTimeSequentialDataBatch].
+class ZegoRealTimeSequentialDataRecord {
+  /// The stream ID to which the data is sent.
+  String streamID;
+
+  /// The real-time sequential data to be sent.
+  Uint8List data;
+
+  ZegoRealTimeSequentialDataRecord(this.streamID, this.data);
+}
+
+/// One call of [ZegoExpressPerformanceUtils.invokeBatch].
+class ZegoBatchCall {
+  /// Name of the platform channel method.
+  String method;
+
+  /// Arguments of the platform channel method.
+  Map<String, dynamic>? arguments;
+
+  ZegoBatchCall(this.method, [this.arguments]);
+}
+
+/// Result of one call of [ZegoExpressPerformanceUtils.invokeBatch].
+class ZegoBatchCallResult {
+  /// Value the method replied with, null for a method without result.
+  dynamic result;
+
+  /// Error code if the call failed, null if it succeeded.
+  String? errorCode;
+
+  /// Error message if the call failed.
+  String? errorMessage;
+
+  ZegoBatchCallResult(this.result, this.errorCode, this.errorMessage);
+
+  /// Whether the call succeeded.
+  bool get isSuccess => errorCode == null;
+}
+
+/// Latency histogram of one kind of duration of a method, see
+/// [ZegoMethodCallStats].
+class ZegoMethodLatencyHistogram {
+  /// Number of recorded durations.
+  int count;
+
+  /// Sum of the recorded durations in microseconds.
+  int totalMicroseconds;
+
+  /// Longest recorded duration in microseconds.
+  int maxMicroseconds;
+
+  /// Bucket i counts the durations from 2^(i-1) up to 2^i microseconds,
+  /// bucket 0 those below 1 microsecond and the last bucket also those
+  /// above.
+  List<int> buckets;
+
+  ZegoMethodLatencyHistogram(
+      this.count, this.totalMicroseconds, this.maxMicroseconds, this.buckets);
+}
+
+/// Call statistics of one method, see
+/// [ZegoExpressPerformanceUtils.getMethodCallStats].
+class ZegoMethodCallStats {
+  /// Time the native handler runs on the platform thread.
+  ZegoMethodLatencyHistogram handler;
+
+  /// Time until the method replies, which includes the wait for the SDK
+  /// callback of asynchronous methods.
+  ZegoMethodLatencyHistogram reply;
+
+  ZegoMethodCallStats(this.handler, this.reply);
+}
+
+/// Level of the native plugin log, see
+/// [ZegoExpressPerformanceUtils.setPluginLogLevel].
+enum ZegoPluginLogLevel {
+  /// Verbose lines for debugging.
+  Debug,
+
+  /// Method calls and events, the default.
+  Info,
+
+  /// Warning.
+  Warning,
+
+  /// Error.
+  Error,
+
+  /// Nothing is logged.
+  None
+}
+
+/// Delivery lane of native events, see
+/// [ZegoExpressPerformanceUtils.setEventLaneMaxDepth].
+enum ZegoEventLane {
+  /// State and other low frequency events, never dropped.
+  Critical,
+
+  /// Quality and meter events, only the newest pending event of each
+  /// stream or source is kept.
+  Latest,
+
+  /// Raw audio data, SEI and real-time sequential data events, the oldest
+  /// pending event is dropped when the lane is full.
+  Bounded
+}
+
+/// One PCM frame read from a [ZegoAudioDataRing].
+class ZegoAudioDataRingFrame {
+  /// Audio PCM data.
+  Uint8List data;
+
+  /// Audio frame parameter.
+  ZegoAudioFrameParam param;
+
+  ZegoAudioDataRingFrame(this.data, this.param);
+}
+
+/// Ring of audio data observer PCM frames in native memory.
+///
+/// Created by [ZegoExpressPerformanceUtils.createAudioDataRing]. Frames are
+/// written by the SDK audio thread and read in place through ffi, without
+/// an event per frame.
+abstract class ZegoAudioDataRing {
+  /// The [ZegoAudioDataCallbackBitMask] bit this ring receives frames of.
+  int get source;
+
+  /// Stream ID of the [ZegoAudioDataCallbackBitMask.Player] source, empty
+  /// otherwise.
+  String get streamID;
+
+  /// Triggered at most once per drain when new frames are written, if the
+  /// ring was created with `notify`. Read all frames in the callback.
+  void Function(ZegoAudioDataRing ring)? onDataAvailable;
+
+  /// Read the oldest frame, returns null if the ring is empty or destroyed.
+  ZegoAudioDataRingFrame? readFrame();
+
+  /// Number of frames written into the ring.
+  int get frameCount;
+
+  /// Number of frames dropped because the ring was full.
+  int get overrunCount;
+
+  /// Number of PCM bytes dropped because the ring was full.
+  int get overrunBytes;
+}
+
+/// Ring of custom audio render PCM in native memory.
+///
+/// Created by [ZegoExpressPerformanceUtils.createCustomAudioRenderRing].
+/// Chunks are fetched from the SDK straight into the ring and read in place
+/// through ffi, without a platform channel call or an allocation per chunk.
+/// All cursors count sample frames, one sample of every channel.
+abstract class ZegoCustomAudioRenderRing {
+  /// Audio frame parameter of the PCM in the ring.
+  ZegoAudioFrameParam get param;
+
+  /// Sample frames of one chunk fetched from the SDK.
+  int get chunkFrames;
+
+  /// Read the oldest PCM into [destination], up to its length rounded down
+  /// to whole sample frames. If fewer frames are available the rest of
+  /// [destination] is filled with silence and an underrun is counted.
+  /// Returns the number of sample frames read.
+  int read(Uint8List destination);
+
+  /// Fetch up to [chunkCount] chunks from the SDK now, e.g. when the ring
+  /// was created without `autoFetch`. Returns the number of chunks fetched,
+  /// which is smaller if the ring became full.
+  int fetch(int chunkCount);
+
+  /// Sample frames written into the ring since it was created.
+  int get writeFrame;
+
+  /// Sample frames read from the ring since it was created.
+  int get readFrame;
+
+  /// Sample frames that can be read now.
+  int get availableFrames;
+
+  /// Number of chunks fetched from the SDK.
+  int get fetchCount;
+
+  /// Number of fetches skipped because the ring was full, the SDK keeps the
+  /// audio meanwhile.
+  int get skippedFetchCount;
+
+  /// Number of fetches that failed because the engine was not created.
+  int get failedFetchCount;
+
+  /// Number of reads that got fewer frames than asked for.
+  int get underrunCount;
+
+  /// Sample frames filled with silence by reads.
+  int get underrunFrames;
+}
+
 /// Log config.
 ///
 /// Description: This parameter is required when calling [setlogconfig] to customize log configuration.
@@ -0,0 +1,462 @@
+//
+//  zego_express_performance_utils.dart
+//  flutter
+//
+//  Copyright © 2022 Zego. All rights reserved.
+//
+
+import 'impl/zego_express_performance_impl.dart';
+import 'zego_express_api.dart';
+import 'zego_express_defines.dart';
+
+extension ZegoExpressPerformanceUtils on ZegoExpressEngine {
+  /// Get the statistics of the native event queue.
+  ///
+  /// Engine callbacks are queued on the SDK threads that trigger them and
+  /// delivered to dart in batches on the platform thread. Returns the number
+  /// of queued, delivered and dropped events (`enqueuedCount`,
+  /// `deliveredCount`, `droppedCount`), the number of batches
+  /// (`drainCount`), the current and max queue depth (`depth`, `maxDepth`)
+  /// and the total and max time in microseconds from queueing to delivery
+  /// (`totalLatencyMicroseconds`, `maxLatencyMicroseconds`).
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise.
+  Future<Map<String, int>> getEventQueueStats() async {
+    return await ZegoExpressPerformanceImpl.getEventQueueStats();
+  }
+
+  /// Deliver high frequency events as packed bytes.
+  ///
+  /// By default every quality, sound level info and audio spectrum callback
+  /// is sent from native as a map with a string key for each field. When
+  /// enabled, the events of [ZegoExpressEngine.onPublisherQualityUpdate],
+  /// [ZegoExpressEngine.onPlayerQualityUpdate],
+  /// [ZegoExpressEngine.onCapturedSoundLevelInfoUpdate],
+  /// [ZegoExpressEngine.onRemoteSoundLevelInfoUpdate],
+  /// [ZegoExpressEngine.onCapturedAudioSpectrumUpdate] and
+  /// [ZegoExpressEngine.onRemoteAudioSpectrumUpdate] are sent as compact
+  /// binary packets instead, which are much cheaper to build and to decode
+  /// with many streams. The callbacks themselves are unchanged.
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> enableCompactEventEncoding(bool enable) async {
+    return await ZegoExpressPerformanceImpl.enableCompactEventEncoding(enable);
+  }
+
+  /// Merge sound level and audio spectrum events into one event per interval.
+  ///
+  /// By default every sound level and audio spectrum update of every stream
+  /// is sent from native as a separate event. When enabled, all of them are
+  /// merged natively and delivered once every [interval] milliseconds through
+  /// [ZegoExpressEngine.onAudioMetersUpdate], keeping the latest and the peak
+  /// value in between. An interval is skipped if the previous event has not
+  /// been delivered yet. The individual callbacks are still triggered once per
+  /// interval with the latest values. Takes precedence over
+  /// [enableCompactEventEncoding] for these events.
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> enableAudioMeterCoalescing(bool enable,
+      {int interval = 100}) async {
+    return await ZegoExpressPerformanceImpl.enableAudioMeterCoalescing(
+        enable, interval);
+  }
+
+  /// Stop native from sending events that have no callback set.
+  ///
+  /// Every engine callback is serialized natively and sent to dart, even if
+  /// the corresponding callback of [ZegoExpressEngine] is null and the event
+  /// is discarded in dart. This takes a snapshot of which callbacks are
+  /// currently set and lets native skip the events of all the others before
+  /// they are serialized. Callbacks that are set afterwards are not triggered
+  /// until this is called again or [resetEventSubscriptions] is called.
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> updateEventSubscriptions() async {
+    return await ZegoExpressPerformanceImpl.updateEventSubscriptions();
+  }
+
+  /// Send all events to dart again, undoing [updateEventSubscriptions].
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> resetEventSubscriptions() async {
+    return await ZegoExpressPerformanceImpl.resetEventSubscriptions();
+  }
+
+  /// Get the number of events skipped natively so far,
+  /// keyed by callback name, see [updateEventSubscriptions].
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise.
+  Future<Map<String, int>> getSuppressedEventCounts() async {
+    return await ZegoExpressPerformanceImpl.getSuppressedEventCounts();
+  }
+
+  /// Receive audio data observer PCM through a ring in native memory.
+  ///
+  /// By default every frame of [ZegoExpressEngine.onCapturedAudioData],
+  /// [ZegoExpressEngine.onPlaybackAudioData],
+  /// [ZegoExpressEngine.onMixedAudioData] and
+  /// [ZegoExpressEngine.onPlayerAudioData] is copied into an event on the
+  /// audio thread. After this, the frames of [source] (one
+  /// [ZegoAudioDataCallbackBitMask] bit, for [ZegoAudioDataCallbackBitMask.Player]
+  /// the frames of [streamID]) are written into a ring of [capacity] bytes
+  /// instead and read in place with [ZegoAudioDataRing.readFrame]. The
+  /// callback of the source is no longer triggered. Frames that do not fit
+  /// are dropped and counted in [ZegoAudioDataRing.overrunCount].
+  ///
+  /// If [notify] is true, [ZegoAudioDataRing.onDataAvailable] is triggered
+  /// once new frames arrive after the previous drain, otherwise the ring has
+  /// to be polled. Creating a ring for a source that already has one throws
+  /// a `PlatformException`, destroy the existing ring first.
+  ///
+  /// Note: Only takes effect on Windows, returns null otherwise.
+  Future<ZegoAudioDataRing?> createAudioDataRing(int source,
+      {String streamID = '', int capacity = 65536, bool notify = true}) async {
+    return await ZegoExpressPerformanceImpl.createAudioDataRing(
+        source, streamID, capacity, notify);
+  }
+
+  /// Destroy a ring created by [createAudioDataRing], the frames of its
+  /// source are sent as events again. Afterwards [ZegoAudioDataRing.readFrame]
+  /// returns null and the counters keep their last values.
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> destroyAudioDataRing(ZegoAudioDataRing ring) async {
+    return await ZegoExpressPerformanceImpl.destroyAudioDataRing(ring);
+  }
+
+  /// Query the quality of streams over a time window.
+  ///
+  /// The publisher and player quality of every stream is kept natively for
+  /// up to 30 minutes, whether or not [ZegoExpressEngine.onPublisherQualityUpdate]
+  /// and [ZegoExpressEngine.onPlayerQualityUpdate] are set. Returns the p50,
+  /// p95 and max of each metric over the last [window] seconds, keyed by
+  /// stream ID, for all known streams if [streamIDs] is empty. Together with
+  /// [updateEventSubscriptions] this lets an app skip the per-interval
+  /// quality events and only query while a stats panel is shown.
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise.
+  Future<Map<String, ZegoStreamQualitySummary>> queryStreamQuality(
+      List<String> streamIDs,
+      {int window = 60}) async {
+    return await ZegoExpressPerformanceImpl.queryStreamQuality(
+        streamIDs, window);
+  }
+
+  /// Keep the users and streams of logged in rooms natively.
+  ///
+  /// Once enabled, [ZegoExpressEngine.onRoomUserUpdate] and
+  /// [ZegoExpressEngine.onRoomStreamUpdate] are replaced by
+  /// [ZegoExpressEngine.onRoomRosterUpdate], which only carries counts, so
+  /// large rooms do not send every delta list across the channel. Read the
+  /// lists page by page with [getRoomUsers] and [getRoomStreams].
+  /// [ZegoExpressEngine.onRoomStreamExtraInfoUpdate] is still delivered and
+  /// the pages read after it carry the new extra info.
+  ///
+  /// Enable it before [ZegoExpressEngine.loginRoom], the initial lists of a
+  /// room are only reported once. Enabling it while logged in to a room
+  /// throws a `PlatformException` with the code `enableRoomRoster_Logged_in`.
+  /// Disabling it drops the roster.
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> enableRoomRoster(bool enable) async {
+    return await ZegoExpressPerformanceImpl.enableRoomRoster(enable);
+  }
+
+  /// Read up to [limit] users of a room from [offset], in join order.
+  ///
+  /// If [filter] is not empty only users whose ID or name contains it are
+  /// returned and counted. Compare [ZegoRoomUserPage.version] across pages
+  /// to notice updates in between.
+  ///
+  /// Note: Only takes effect on Windows, returns an empty page otherwise.
+  Future<ZegoRoomUserPage> getRoomUsers(String roomID,
+      {int offset = 0, int limit = 100, String filter = ''}) async {
+    return await ZegoExpressPerformanceImpl.getRoomUsers(
+        roomID, offset, limit, filter);
+  }
+
+  /// Read up to [limit] streams of a room from [offset], see [getRoomUsers].
+  ///
+  /// [filter] matches the stream ID and the publishing user ID.
+  ///
+  /// Note: Only takes effect on Windows, returns an empty page otherwise.
+  Future<ZegoRoomStreamPage> getRoomStreams(String roomID,
+      {int offset = 0, int limit = 100, String filter = ''}) async {
+    return await ZegoExpressPerformanceImpl.getRoomStreams(
+        roomID, offset, limit, filter);
+  }
+
+  /// Buffer room messages natively and deliver them in batches.
+  ///
+  /// By default every [ZegoExpressEngine.onIMRecvBroadcastMessage],
+  /// [ZegoExpressEngine.onIMRecvBarrageMessage] and
+  /// [ZegoExpressEngine.onIMRecvCustomCommand] is forwarded as soon as it
+  /// arrives, which floods the UI isolate with busy barrage. When enabled,
+  /// messages are buffered natively and at most [maxBatchSize] of them are
+  /// delivered every [interval] milliseconds, and only once the previous
+  /// batch has been handled. The callbacks are unchanged, a batch triggers
+  /// them once per run of messages of the same type and room.
+  ///
+  /// Messages are deduplicated by message ID. At most [maxBacklog] messages
+  /// are kept, the oldest are dropped first. If [senderRateLimit] is not 0,
+  /// messages beyond that many per second from one sender are dropped.
+  /// Disabling delivers the remaining backlog. See [getIMMessageBufferStats]
+  /// for the counters.
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> enableIMMessageBuffer(bool enable,
+      {int interval = 33,
+      int maxBatchSize = 200,
+      int maxBacklog = 2000,
+      int senderRateLimit = 0}) async {
+    return await ZegoExpressPerformanceImpl.enableIMMessageBuffer(
+        enable, interval, maxBatchSize, maxBacklog, senderRateLimit);
+  }
+
+  /// Counters of the message buffer since it was enabled.
+  ///
+  /// Contains `receivedCount`, `deliveredCount`, `batchCount`,
+  /// `duplicateCount`, `rateLimitedCount`, `overflowCount` (dropped from a
+  /// full backlog), `backlogSize` and `maxBacklogSize`.
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise.
+  Future<Map<String, int>> getIMMessageBufferStats() async {
+    return await ZegoExpressPerformanceImpl.getIMMessageBufferStats();
+  }
+
+  /// Send many real-time sequential data records in one call.
+  ///
+  /// All payloads are packed into one buffer and sent natively record by
+  /// record, instead of one channel call with its own copy per record.
+  /// Returns the result of every record in order.
+  ///
+  /// Note: Only takes effect on Windows, the records are sent one by one
+  /// otherwise.
+  Future<List<ZegoRealTimeSequentialDataSentResult>>
+      sendRealTimeSequentialDataBatch(ZegoRealTimeSequentialDataManager manager,
+          List<ZegoRealTimeSequentialDataRecord> records) async {
+    return await ZegoExpressPerformanceImpl.sendRealTimeSequentialDataBatch(
+        manager, records);
+  }
+
+  /// Deliver received real-time sequential data in batches.
+  ///
+  /// By default every record received by a [ZegoRealTimeSequentialDataManager]
+  /// is sent from native as a separate event. When enabled, the records of
+  /// each manager are appended to one native buffer and delivered as a
+  /// single packed event every [interval] milliseconds, once the previous
+  /// batch has been handled. [ZegoExpressEngine.onReceiveRealTimeSequentialData]
+  /// is still triggered per record, with views into the batch buffer. Up to
+  /// [maxPendingBytes] are kept per manager while dart is busy, newer
+  /// records are dropped beyond that. Disabling delivers the pending
+  /// records. See [getRealTimeSequentialDataStats] for the counters.
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> enableRealTimeSequentialDataBatching(bool enable,
+      {int interval = 16, int maxPendingBytes = 1048576}) async {
+    return await ZegoExpressPerformanceImpl.enableRealTimeSequentialDataBatching(
+        enable, interval, maxPendingBytes);
+  }
+
+  /// Counters of the received real-time sequential data batching since it
+  /// was enabled.
+  ///
+  /// Contains `receivedCount`, `deliveredCount`, `droppedCount`,
+  /// `batchCount`, `depth` (records pending now), `maxDepth`,
+  /// `totalLatencyMicroseconds` and `maxLatencyMicroseconds` (from receive
+  /// to batch).
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise.
+  Future<Map<String, int>> getRealTimeSequentialDataStats() async {
+    return await ZegoExpressPerformanceImpl.getRealTimeSequentialDataStats();
+  }
+
+  /// Deliver received SEI in batches.
+  ///
+  /// By default every SEI unit of [ZegoExpressEngine.onPlayerRecvSEI],
+  /// [ZegoExpressEngine.onPlayerRecvMediaSideInfo] and
+  /// [ZegoExpressEngine.onMediaPlayerRecvSEI] is sent from native as a
+  /// separate event, which adds up when publishers attach SEI to every
+  /// frame. When enabled, units are kept in a native ring per stream and
+  /// media player, holding up to [maxUnitsPerStream] units with the oldest
+  /// dropped first, and delivered as one packed event every [interval]
+  /// milliseconds. If [latestOnly] is true only the newest unit of each
+  /// stream is delivered. The callbacks are still triggered per unit, in
+  /// order within a stream, with views into the batch buffer.
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> enableSEIBatching(bool enable,
+      {int interval = 50,
+      int maxUnitsPerStream = 64,
+      bool latestOnly = false}) async {
+    return await ZegoExpressPerformanceImpl.enableSEIBatching(
+        enable, interval, maxUnitsPerStream, latestOnly);
+  }
+
+  /// Counters of the SEI batching since it was enabled.
+  ///
+  /// Contains `receivedCount`, `deliveredCount`, `droppedCount` (from a full
+  /// ring), `replacedCount` (by a newer unit with `latestOnly`) and
+  /// `batchCount`.
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise.
+  Future<Map<String, int>> getSEIBatchStats() async {
+    return await ZegoExpressPerformanceImpl.getSEIBatchStats();
+  }
+
+  /// Set the max number of pending events of a native event lane.
+  ///
+  /// Events waiting for delivery are sorted into lanes by their callback.
+  /// State events such as [ZegoExpressEngine.onRoomStateChanged] are on the
+  /// [ZegoEventLane.Critical] lane, which is never dropped. Quality and
+  /// sound level events are on the [ZegoEventLane.Latest] lane, where a
+  /// pending event is replaced by a newer one of the same stream. Raw audio
+  /// data and SEI events are on the [ZegoEventLane.Bounded] lane, where the
+  /// oldest pending event is dropped when the lane is full. The defaults are
+  /// 256 for the latest lane and 1024 for the bounded lane, a [maxDepth] of
+  /// 0 restores the default. The critical lane cannot be limited.
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> setEventLaneMaxDepth(ZegoEventLane lane, int maxDepth) async {
+    return await ZegoExpressPerformanceImpl.setEventLaneMaxDepth(
+        lane, maxDepth);
+  }
+
+  /// Counters of each native event lane, keyed by `critical`, `latest` and
+  /// `bounded`.
+  ///
+  /// Each lane contains `enqueuedCount`, `deliveredCount`, `droppedCount`
+  /// (from a full lane), `replacedCount` (by a newer event, latest lane
+  /// only), the current, max and configured depth (`depth`, `maxDepth`,
+  /// `maxQueueDepth`) and the total and max time in microseconds from
+  /// queueing to delivery (`totalLatencyMicroseconds`,
+  /// `maxLatencyMicroseconds`).
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise.
+  Future<Map<String, Map<String, int>>> getEventLaneStats() async {
+    return await ZegoExpressPerformanceImpl.getEventLaneStats();
+  }
+
+  /// Run several engine calls with a single platform channel round trip.
+  ///
+  /// Joining a room with many streams triggers dozens of calls such as
+  /// `startPlayingStream`, `setPlayVolume` and `mutePlayStreamVideo`, each
+  /// of which is a separate round trip. The [calls] are run in order in one
+  /// go on the platform thread and their results are returned in the same
+  /// order. [ZegoBatchCall.method] and [ZegoBatchCall.arguments] are the
+  /// platform channel method name and arguments that the corresponding
+  /// [ZegoExpressEngine] method sends. If [stopOnError] is true the calls
+  /// after the first failed one are not run and the returned list is
+  /// shorter than [calls]. Methods that reply asynchronously, such as
+  /// `loginRoom`, do not stop the batch when they fail.
+  ///
+  /// Note: Runs the calls one by one on platforms other than Windows.
+  Future<List<ZegoBatchCallResult>> invokeBatch(List<ZegoBatchCall> calls,
+      {bool stopOnError = false}) async {
+    return await ZegoExpressPerformanceImpl.invokeBatch(calls, stopOnError);
+  }
+
+  /// Get the call statistics of every native method called so far.
+  ///
+  /// Every platform channel call is timed natively, both the synchronous run
+  /// of its handler and the time until it replies. Returns the counts and
+  /// log-bucket latency histograms keyed by method name, e.g.
+  /// `startPlayingStream`. Methods that have not been called are left out.
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise.
+  Future<Map<String, ZegoMethodCallStats>> getMethodCallStats() async {
+    return await ZegoExpressPerformanceImpl.getMethodCallStats();
+  }
+
+  /// Write the call statistics of the methods called since the previous
+  /// write to the SDK log every [interval] seconds, 0 stops writing.
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> setMethodCallStatsLogInterval(int interval) async {
+    return await ZegoExpressPerformanceImpl.setMethodCallStatsLogInterval(
+        interval);
+  }
+
+  /// Counters of the native task queues, keyed by `device` and `publish`.
+  ///
+  /// Blocking device calls such as [ZegoExpressEngine.useVideoDevice],
+  /// [ZegoExpressEngine.enableCamera] and
+  /// [ZegoExpressEngine.enableAudioCaptureDevice] run in order on the device
+  /// queue, and [ZegoExpressEngine.startPublishingStream] and
+  /// [ZegoExpressEngine.stopPublishingStream] run on the publish queue,
+  /// instead of blocking the platform thread. Calls on the same queue run
+  /// in order and the two queues run in parallel. Later method calls that
+  /// depend on the state of a busy queue, e.g.
+  /// [ZegoExpressEngine.mutePublishStreamVideo] after
+  /// [ZegoExpressEngine.startPublishingStream], wait until the earlier
+  /// queued calls return, other calls run right away. Each queue contains
+  /// `postedCount`, `completedCount`, the current and max depth (`depth`,
+  /// `maxDepth`), the total and max time in microseconds a call waits in
+  /// the queue (`totalWaitMicroseconds`, `maxWaitMicroseconds`) and the
+  /// total and max time it runs (`totalRunMicroseconds`,
+  /// `maxRunMicroseconds`).
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise.
+  Future<Map<String, Map<String, int>>> getTaskQueueStats() async {
+    return await ZegoExpressPerformanceImpl.getTaskQueueStats();
+  }
+
+  /// Set the level below which native plugin log lines are dropped.
+  ///
+  /// The plugin logs every Dart call and many SDK callbacks. Lines are
+  /// formatted on the calling thread and written to the console and the SDK
+  /// log by a background thread, runs of the same line are written once
+  /// with a repeat count. Lines below [level] are dropped before they are
+  /// formatted. The default is [ZegoPluginLogLevel.Info].
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> setPluginLogLevel(ZegoPluginLogLevel level) async {
+    return await ZegoExpressPerformanceImpl.setPluginLogLevel(level);
+  }
+
+  /// Counters of the native plugin log: `writtenCount`, `repeatedCount`
+  /// (lines collapsed into a repeat count), `droppedCount` (lines dropped
+  /// because the background writer fell behind, logging threads never wait
+  /// for it) and `filteredCount` (lines dropped by [setPluginLogLevel]).
+  ///
+  /// Note: Only takes effect on Windows, returns an empty map otherwise.
+  Future<Map<String, int>> getPluginLogStats() async {
+    return await ZegoExpressPerformanceImpl.getPluginLogStats();
+  }
+
+  /// Render custom audio from a ring of PCM in native memory.
+  ///
+  /// [ZegoExpressEngine.fetchCustomAudioRenderPCMData] makes one platform
+  /// channel call per chunk. After this, chunks of [interval] milliseconds
+  /// in the format of [param] are fetched from the SDK straight into a ring
+  /// of [capacity] milliseconds, by a native timer at the render cadence if
+  /// [autoFetch] is true, otherwise by [ZegoCustomAudioRenderRing.fetch].
+  /// Read them in place with [ZegoCustomAudioRenderRing.read], which
+  /// allocates nothing. [ZegoCustomAudioRenderRing.readFrame] is a sample
+  /// frame accurate cursor, and reads that find too little PCM are counted
+  /// in [ZegoCustomAudioRenderRing.underrunCount]. Creating a ring while
+  /// one exists throws a `PlatformException`, destroy it first.
+  ///
+  /// Custom audio render must be enabled with
+  /// [ZegoExpressEngine.enableCustomAudioIO] before the ring is fetched.
+  ///
+  /// Note: Only takes effect on Windows, returns null otherwise.
+  Future<ZegoCustomAudioRenderRing?> createCustomAudioRenderRing(
+      ZegoAudioFrameParam param,
+      {int interval = 10,
+      int capacity = 200,
+      bool autoFetch = true}) async {
+    return await ZegoExpressPerformanceImpl.createCustomAudioRenderRing(
+        param, interval, capacity, autoFetch);
+  }
+
+  /// Destroy a ring created by [createCustomAudioRenderRing]. Afterwards
+  /// [ZegoCustomAudioRenderRing.read] and [ZegoCustomAudioRenderRing.fetch]
+  /// return 0 and the counters keep their last values.
+  ///
+  /// Note: Only takes effect on Windows.
+  Future<void> destroyCustomAudioRenderRing(
+      ZegoCustomAudioRenderRing ring) async {
+    return await ZegoExpressPerformanceImpl.destroyCustomAudioRenderRing(ring);
+  }
+}
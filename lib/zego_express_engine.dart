@@ -22,4 +22,5 @@ export 'src/zego_express_api_utilities.dart';
 export 'src/zego_express_assets_utils.dart';
 export 'src/zego_express_canvas_view_utils.dart';
 export 'src/zego_express_defines.dart';
+export 'src/zego_express_performance_utils.dart';
 export 'src/zego_express_error_code.dart';
@@ -0,0 +1,125 @@
+import 'dart:ffi';
+import 'dart:io';
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:zego_express_engine/src/impl/zego_express_audio_data_ring_impl.dart';
+import 'package:zego_express_engine/zego_express_engine.dart';
+
+typedef _MallocNative = Pointer<Uint8> Function(IntPtr);
+typedef _Malloc = Pointer<Uint8> Function(int);
+typedef _FreeNative = Void Function(Pointer<Uint8>);
+typedef _Free = void Function(Pointer<Uint8>);
+
+final DynamicLibrary _libc = Platform.isWindows
+    ? DynamicLibrary.open('ucrtbase.dll')
+    : DynamicLibrary.process();
+final _Malloc _malloc = _libc.lookupFunction<_MallocNative, _Malloc>('malloc');
+final _Free _free = _libc.lookupFunction<_FreeNative, _Free>('free');
+
+/// Native memory laid out like `ZegoAudioDataRing`, written the way the SDK
+/// audio thread writes it.
+class _NativeRing {
+  static const int headerSize = 192;
+
+  final int capacity;
+  final Pointer<Uint8> memory;
+  late final ByteData _view =
+      ByteData.sublistView(memory.asTypedList(headerSize + capacity));
+
+  _NativeRing(this.capacity) : memory = _malloc(headerSize + capacity) {
+    memory.asTypedList(headerSize + capacity).fillRange(
+        0, headerSize + capacity, 0);
+    _view.setUint32(0, 1, Endian.little);
+    _view.setUint32(4, headerSize, Endian.little);
+    _view.setUint32(8, capacity, Endian.little);
+  }
+
+  bool write(Uint8List data, int sampleRate, int channel) {
+    final int recordSize = 16 + ((data.length + 15) & ~15);
+    final int writePosition = _view.getUint64(64, Endian.little);
+    final int readPosition = _view.getUint64(128, Endian.little);
+    if (recordSize > capacity - (writePosition - readPosition)) {
+      _view.setUint64(80, _view.getUint64(80, Endian.little) + 1, Endian.little);
+      return false;
+    }
+
+    final record = Uint8List(16 + data.length);
+    ByteData.sublistView(record)
+      ..setUint32(0, data.length, Endian.little)
+      ..setUint32(4, sampleRate, Endian.little)
+      ..setUint32(8, channel, Endian.little);
+    record.setRange(16, record.length, data);
+    for (int i = 0; i < record.length; i++) {
+      _view.setUint8(headerSize + (writePosition + i) % capacity, record[i]);
+    }
+
+    _view.setUint64(72, _view.getUint64(72, Endian.little) + 1, Endian.little);
+    _view.setUint64(64, writePosition + recordSize, Endian.little);
+    return true;
+  }
+
+  void dispose() => _free(memory);
+}
+
+Uint8List _frame(int length, int seed) {
+  return Uint8List.fromList(List<int>.generate(length, (i) => seed + i));
+}
+
+void main() {
+  late _NativeRing native;
+  late ZegoAudioDataRingImpl ring;
+
+  setUp(() {
+    native = _NativeRing(128);
+    ring = ZegoAudioDataRingImpl(
+        ZegoAudioDataCallbackBitMask.Captured, '', native.memory.address);
+  });
+
+  tearDown(() {
+    ring.dispose();
+    native.dispose();
+  });
+
+  test('reads frames that wrap around the end of the ring', () {
+    // 16 byte header plus 24 bytes padded to 32, so records keep moving
+    // across the end of the 128 byte ring.
+    for (int i = 0; i < 20; i++) {
+      final data = _frame(24, i);
+      expect(native.write(data, 48000, 1), isTrue);
+
+      final frame = ring.readFrame();
+      expect(frame, isNotNull);
+      expect(frame!.data, data);
+      expect(frame.param.sampleRate, ZegoAudioSampleRate.SampleRate48K);
+      expect(frame.param.channel, ZegoAudioChannel.Mono);
+    }
+    expect(ring.readFrame(), isNull);
+    expect(ring.frameCount, 20);
+  });
+
+  test('frees space for the writer after each read', () {
+    final data = _frame(40, 0);
+    expect(native.write(data, 48000, 1), isTrue);
+    expect(native.write(data, 48000, 1), isTrue);
+    expect(native.write(data, 48000, 1), isFalse);
+    expect(ring.overrunCount, 1);
+
+    expect(ring.readFrame()!.data, data);
+    expect(native.write(data, 48000, 1), isTrue);
+    expect(ring.readFrame(), isNotNull);
+    expect(ring.readFrame(), isNotNull);
+    expect(ring.readFrame(), isNull);
+  });
+
+  test('reads nothing once disposed', () {
+    expect(native.write(_frame(24, 0), 48000, 1), isTrue);
+    ring.dispose();
+
+    expect(ring.isDisposed, isTrue);
+    expect(ring.readFrame(), isNull);
+    // The counters keep their values from before the ring was destroyed.
+    expect(ring.frameCount, 1);
+    expect(ring.overrunCount, 0);
+  });
+}
@@ -0,0 +1,155 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:zego_express_engine/src/impl/zego_express_compact_event_decoder.dart';
+import 'package:zego_express_engine/zego_express_engine.dart';
+
+const int _typeRemoteSoundLevelInfo = 4;
+const int _typeRemoteAudioSpectrum = 6;
+
+/// Packet laid out like `ZegoCompactEventCodec` writes it.
+class _Packet {
+  final int type;
+  final int epoch;
+  final Map<int, String> strings;
+  final List<void Function(BytesBuilder)> records = [];
+
+  _Packet(this.type, this.epoch, [this.strings = const {}]);
+
+  void soundLevel(int stream, double soundLevel, int vad) {
+    records.add((builder) => builder
+      ..add(_u16(stream))
+      ..add((ByteData(4)..setFloat32(0, soundLevel, Endian.little))
+          .buffer
+          .asUint8List())
+      ..add((ByteData(4)..setInt32(0, vad, Endian.little))
+          .buffer
+          .asUint8List()));
+  }
+
+  void spectrum(int stream, List<double> spectrum) {
+    records.add((builder) {
+      builder
+        ..add(_u16(stream))
+        ..add(_u16(spectrum.length));
+      for (final value in spectrum) {
+        builder.add((ByteData(4)..setFloat32(0, value, Endian.little))
+            .buffer
+            .asUint8List());
+      }
+    });
+  }
+
+  Uint8List build() {
+    final builder = BytesBuilder()
+      ..addByte(1)
+      ..addByte(type)
+      ..add(_u16(epoch))
+      ..add(_u16(strings.length));
+    strings.forEach((index, string) {
+      final bytes = utf8.encode(string);
+      builder
+        ..add(_u16(index))
+        ..add(_u16(bytes.length))
+        ..add(bytes);
+    });
+    builder.add(_u16(records.length));
+    for (final record in records) {
+      record(builder);
+    }
+    return builder.toBytes();
+  }
+
+  static Uint8List _u16(int value) =>
+      (ByteData(2)..setUint16(0, value, Endian.little)).buffer.asUint8List();
+}
+
+void main() {
+  late List<Map<String, ZegoSoundLevelInfo>> soundLevels;
+  late List<Map<String, List<double>>> spectrums;
+
+  setUp(() {
+    soundLevels = [];
+    spectrums = [];
+    ZegoExpressEngine.onRemoteSoundLevelInfoUpdate = soundLevels.add;
+    ZegoExpressEngine.onRemoteAudioSpectrumUpdate = spectrums.add;
+  });
+
+  tearDown(() {
+    ZegoExpressEngine.onRemoteSoundLevelInfoUpdate = null;
+    ZegoExpressEngine.onRemoteAudioSpectrumUpdate = null;
+  });
+
+  test('decodes records with strings sent by earlier packets', () {
+    ZegoCompactEventDecoder.handleEvent(
+        (_Packet(_typeRemoteSoundLevelInfo, 10, {0: 'a', 1: 'b'})
+              ..soundLevel(0, 12.5, 1)
+              ..soundLevel(1, 80, 0))
+            .build());
+    ZegoCompactEventDecoder.handleEvent(
+        (_Packet(_typeRemoteAudioSpectrum, 10, {2: 'c'})
+              ..spectrum(0, [1, 2, 3])
+              ..spectrum(2, []))
+            .build());
+
+    expect(soundLevels, hasLength(1));
+    expect(soundLevels[0]['a']!.soundLevel, 12.5);
+    expect(soundLevels[0]['a']!.vad, 1);
+    expect(soundLevels[0]['b']!.soundLevel, 80);
+    expect(spectrums, [
+      {
+        'a': [1.0, 2.0, 3.0],
+        'c': <double>[],
+      }
+    ]);
+  });
+
+  test('drops the string table when the epoch changes', () {
+    ZegoCompactEventDecoder.handleEvent(
+        (_Packet(_typeRemoteSoundLevelInfo, 20, {0: 'a'})
+              ..soundLevel(0, 1, 0))
+            .build());
+    // Index 0 is "b" in the new epoch, it must not resolve to "a".
+    ZegoCompactEventDecoder.handleEvent(
+        (_Packet(_typeRemoteSoundLevelInfo, 21, {0: 'b'})
+              ..soundLevel(0, 2, 0))
+            .build());
+
+    expect(soundLevels.map((infos) => infos.keys.single), ['a', 'b']);
+  });
+
+  test('skips records of strings that were never received', () {
+    ZegoCompactEventDecoder.handleEvent(
+        (_Packet(_typeRemoteSoundLevelInfo, 40, {0: 'a'})
+              ..soundLevel(0, 1, 0)
+              ..soundLevel(1, 2, 0))
+            .build());
+
+    expect(soundLevels.single.keys, ['a']);
+  });
+
+  test('skips packets of an older epoch', () {
+    ZegoCompactEventDecoder.handleEvent(
+        (_Packet(_typeRemoteSoundLevelInfo, 51, {0: 'new'})
+              ..soundLevel(0, 1, 0))
+            .build());
+    // Queued before the packet that made the encoder start epoch 51.
+    ZegoCompactEventDecoder.handleEvent(
+        (_Packet(_typeRemoteSoundLevelInfo, 50)..soundLevel(0, 2, 0)).build());
+    ZegoCompactEventDecoder.handleEvent(
+        (_Packet(_typeRemoteSoundLevelInfo, 51)..soundLevel(0, 3, 0)).build());
+
+    expect(soundLevels.map((infos) => infos['new']!.soundLevel), [1, 3]);
+  });
+
+  test('ignores packets of another version', () {
+    final packet =
+        (_Packet(_typeRemoteSoundLevelInfo, 30, {0: 'a'})..soundLevel(0, 1, 0))
+            .build();
+    packet[0] = 2;
+    ZegoCompactEventDecoder.handleEvent(packet);
+
+    expect(soundLevels, isEmpty);
+  });
+}
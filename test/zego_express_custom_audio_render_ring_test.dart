@@ -0,0 +1,131 @@
+import 'dart:ffi';
+import 'dart:io';
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:zego_express_engine/src/impl/zego_express_custom_audio_render_ring_impl.dart';
+import 'package:zego_express_engine/zego_express_engine.dart';
+
+typedef _MallocNative = Pointer<Uint8> Function(IntPtr);
+typedef _Malloc = Pointer<Uint8> Function(int);
+typedef _FreeNative = Void Function(Pointer<Uint8>);
+typedef _Free = void Function(Pointer<Uint8>);
+
+final DynamicLibrary _libc = Platform.isWindows
+    ? DynamicLibrary.open('ucrtbase.dll')
+    : DynamicLibrary.process();
+final _Malloc _malloc = _libc.lookupFunction<_MallocNative, _Malloc>('malloc');
+final _Free _free = _libc.lookupFunction<_FreeNative, _Free>('free');
+
+/// Native memory laid out like `ZegoCustomAudioRenderRing` with 16 bit mono
+/// PCM, filled the way its fetches fill it.
+class _NativeRing {
+  static const int headerSize = 192;
+  static const int frameSize = 2;
+
+  final int capacityFrames;
+  final int chunkFrames;
+  final Pointer<Uint8> memory;
+  late final ByteData _view = ByteData.sublistView(
+      memory.asTypedList(headerSize + capacityFrames * frameSize));
+
+  _NativeRing(this.capacityFrames, this.chunkFrames)
+      : memory = _malloc(headerSize + capacityFrames * frameSize) {
+    memory
+        .asTypedList(headerSize + capacityFrames * frameSize)
+        .fillRange(0, headerSize + capacityFrames * frameSize, 0);
+    _view.setUint32(0, 1, Endian.little);
+    _view.setUint32(4, headerSize, Endian.little);
+    _view.setUint32(8, capacityFrames, Endian.little);
+    _view.setUint32(12, frameSize, Endian.little);
+    _view.setUint32(16, chunkFrames, Endian.little);
+  }
+
+  int get _writeFrame => _view.getUint64(64, Endian.little);
+
+  /// Writes one chunk whose samples count up from [firstSample].
+  void fetchChunk(int firstSample) {
+    final int writeFrame = _writeFrame;
+    for (int i = 0; i < chunkFrames; i++) {
+      _view.setInt16(
+          headerSize + ((writeFrame + i) % capacityFrames) * frameSize,
+          firstSample + i,
+          Endian.little);
+    }
+    _view.setUint64(
+        72, _view.getUint64(72, Endian.little) + 1, Endian.little);
+    _view.setUint64(64, writeFrame + chunkFrames, Endian.little);
+  }
+
+  void dispose() => _free(memory);
+}
+
+List<int> _samples(Uint8List pcm) {
+  return Int16List.sublistView(pcm).toList();
+}
+
+void main() {
+  late _NativeRing native;
+  late ZegoCustomAudioRenderRingImpl ring;
+
+  setUp(() {
+    native = _NativeRing(8, 4);
+    ring = ZegoCustomAudioRenderRingImpl(
+        ZegoAudioFrameParam(
+            ZegoAudioSampleRate.SampleRate16K, ZegoAudioChannel.Mono),
+        native.memory.address);
+  });
+
+  tearDown(() {
+    ring.dispose();
+    native.dispose();
+  });
+
+  test('reads the header', () {
+    expect(ring.chunkFrames, 4);
+    expect(ring.availableFrames, 0);
+  });
+
+  test('reads PCM that wraps around the end of the ring', () {
+    final destination = Uint8List(3 * _NativeRing.frameSize);
+    int sample = 0;
+    int expected = 0;
+    // Reads of 3 frames out of chunks of 4 move across the end of the
+    // 8 frame ring.
+    for (int i = 0; i < 12; i++) {
+      while (ring.availableFrames < 3) {
+        native.fetchChunk(sample);
+        sample += 4;
+      }
+      expect(ring.read(destination), 3);
+      expect(_samples(destination), [expected, expected + 1, expected + 2]);
+      expected += 3;
+    }
+    expect(ring.readFrame, 36);
+    expect(ring.underrunCount, 0);
+  });
+
+  test('fills an underrun with silence and counts it', () {
+    native.fetchChunk(1);
+    final destination = Uint8List(6 * _NativeRing.frameSize);
+
+    expect(ring.read(destination), 4);
+    expect(_samples(destination), [1, 2, 3, 4, 0, 0]);
+    expect(ring.underrunCount, 1);
+    expect(ring.underrunFrames, 2);
+    expect(ring.availableFrames, 0);
+  });
+
+  test('reads and fetches nothing once disposed', () {
+    native.fetchChunk(1);
+    ring.dispose();
+
+    expect(ring.isDisposed, isTrue);
+    expect(ring.read(Uint8List(4 * _NativeRing.frameSize)), 0);
+    expect(ring.fetch(1), 0);
+    // The cursors keep their values from before the ring was destroyed.
+    expect(ring.writeFrame, 4);
+    expect(ring.fetchCount, 1);
+    expect(ring.availableFrames, 4);
+  });
+}
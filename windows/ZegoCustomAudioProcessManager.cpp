@@ -0,0 +1,438 @@
+#include "include/zego_express_engine/ZegoCustomAudioProcessManager.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <unordered_map>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define ZEGO_AUDIO_PROCESS_USE_SSE2 1
+#endif
+
+static std::shared_ptr<ZegoCustomAudioProcessManager> instance_ = nullptr;
+static std::once_flag singletonFlag;
+
+namespace {
+
+// A stage is bypassed after this many frames in a row over its deadline.
+constexpr uint32_t kMaxConsecutiveOverruns = 3;
+// Number of frames a stage stays bypassed before it is tried again.
+constexpr uint32_t kBypassFrames = 200;
+
+void pcm16ToFloat(const int16_t *src, float *dst, size_t count) {
+    const float scale = 1.0f / 32768.0f;
+    size_t i = 0;
+#ifdef ZEGO_AUDIO_PROCESS_USE_SSE2
+    const __m128 scaleVec = _mm_set1_ps(scale);
+    for (; i + 8 <= count; i += 8) {
+        __m128i pcm = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        // Sign extend by unpacking into the high half and shifting back.
+        __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(pcm, pcm), 16);
+        __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(pcm, pcm), 16);
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(low), scaleVec));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scaleVec));
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = src[i] * scale;
+    }
+}
+
+void floatToPcm16(const float *src, int16_t *dst, size_t count) {
+    size_t i = 0;
+#ifdef ZEGO_AUDIO_PROCESS_USE_SSE2
+    const __m128 scaleVec = _mm_set1_ps(32768.0f);
+    const __m128 maxVec = _mm_set1_ps(32767.0f);
+    const __m128 minVec = _mm_set1_ps(-32768.0f);
+    for (; i + 8 <= count; i += 8) {
+        // Clamped before the conversion, which turns values past the int32
+        // range into INT32_MIN whatever their sign.
+        __m128 lowSamples = _mm_mul_ps(_mm_loadu_ps(src + i), scaleVec);
+        __m128 highSamples = _mm_mul_ps(_mm_loadu_ps(src + i + 4), scaleVec);
+        __m128i low = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(lowSamples, minVec), maxVec));
+        __m128i high = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(highSamples, minVec), maxVec));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_packs_epi32(low, high));
+    }
+#endif
+    for (; i < count; i++) {
+        float sample = src[i] * 32768.0f;
+        sample = sample > 32767.0f ? 32767.0f : (sample < -32768.0f ? -32768.0f : sample);
+        dst[i] = (int16_t)lrintf(sample);
+    }
+}
+
+void applyGain(float *samples, size_t count, float gain) {
+    size_t i = 0;
+#ifdef ZEGO_AUDIO_PROCESS_USE_SSE2
+    const __m128 gainVec = _mm_set1_ps(gain);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(samples + i, _mm_mul_ps(_mm_loadu_ps(samples + i), gainVec));
+    }
+#endif
+    for (; i < count; i++) {
+        samples[i] *= gain;
+    }
+}
+
+float findPeak(const float *samples, size_t count) {
+    float peak = 0.0f;
+    size_t i = 0;
+#ifdef ZEGO_AUDIO_PROCESS_USE_SSE2
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    __m128 peakVec = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        peakVec = _mm_max_ps(peakVec, _mm_and_ps(_mm_loadu_ps(samples + i), absMask));
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, peakVec);
+    for (float lane : lanes) {
+        peak = lane > peak ? lane : peak;
+    }
+#endif
+    for (; i < count; i++) {
+        float value = fabsf(samples[i]);
+        peak = value > peak ? value : peak;
+    }
+    return peak;
+}
+
+class ZegoGainAudioProcessor : public IZegoFlutterAudioProcessor {
+  public:
+    explicit ZegoGainAudioProcessor(float gain) : gain_(gain) {}
+
+    void process(float *samples, unsigned int frames, unsigned int channels,
+                 unsigned int /*sampleRate*/, const std::string & /*streamID*/) override {
+        applyGain(samples, (size_t)frames * channels, gain_);
+    }
+
+    std::string getName() override { return "gain"; }
+
+  private:
+    float gain_;
+};
+
+// Block based peak limiter: the gain drops at once to keep the block peak
+// below the threshold and ramps back up with the release time.
+class ZegoLimiterAudioProcessor : public IZegoFlutterAudioProcessor {
+  public:
+    ZegoLimiterAudioProcessor(float threshold, float releaseMilliseconds)
+        : threshold_(threshold), releaseMilliseconds_(releaseMilliseconds) {}
+
+    void process(float *samples, unsigned int frames, unsigned int channels,
+                 unsigned int sampleRate, const std::string &streamID) override {
+        size_t count = (size_t)frames * channels;
+        if (count == 0 || sampleRate == 0) {
+            return;
+        }
+
+        float &gain = getGain(streamID);
+        float peak = findPeak(samples, count);
+        float target = peak > threshold_ ? threshold_ / peak : 1.0f;
+
+        if (target <= gain) {
+            gain = target;
+            if (gain < 1.0f) {
+                applyGain(samples, count, gain);
+            }
+            return;
+        }
+
+        float blockMilliseconds = frames * 1000.0f / sampleRate;
+        float release = releaseMilliseconds_ > 0 ? 1.0f - expf(-blockMilliseconds / releaseMilliseconds_) : 1.0f;
+        float nextGain = gain + (1.0f - gain) * release;
+        nextGain = nextGain < target ? nextGain : target;
+
+        if (gain == 1.0f && nextGain == 1.0f) {
+            return;
+        }
+        float step = (nextGain - gain) / frames;
+        float frameGain = gain;
+        for (unsigned int frame = 0; frame < frames; frame++) {
+            frameGain += step;
+            for (unsigned int channel = 0; channel < channels; channel++) {
+                samples[frame * channels + channel] *= frameGain;
+            }
+        }
+        gain = nextGain;
+    }
+
+    std::string getName() override { return "limiter"; }
+
+  private:
+    float &getGain(const std::string &streamID) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return gains_.emplace(streamID, 1.0f).first->second;
+    }
+
+    float threshold_;
+    float releaseMilliseconds_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, float> gains_;
+};
+
+// Second order Butterworth high-pass, a transposed direct form II biquad
+// per channel. The recursion runs sample by sample.
+class ZegoHighPassAudioProcessor : public IZegoFlutterAudioProcessor {
+  public:
+    explicit ZegoHighPassAudioProcessor(float cutoffHz) : cutoffHz_(cutoffHz) {}
+
+    void process(float *samples, unsigned int frames, unsigned int channels,
+                 unsigned int sampleRate, const std::string &streamID) override {
+        if (sampleRate == 0 || cutoffHz_ <= 0 || cutoffHz_ * 2 >= sampleRate) {
+            return;
+        }
+
+        Filter &filter = getFilter(streamID);
+        if (filter.sampleRate != sampleRate || filter.state.size() != channels * 2) {
+            updateFilter(filter, sampleRate, channels);
+        }
+
+        for (unsigned int channel = 0; channel < channels; channel++) {
+            float z1 = filter.state[channel * 2];
+            float z2 = filter.state[channel * 2 + 1];
+            for (unsigned int frame = 0; frame < frames; frame++) {
+                float &sample = samples[frame * channels + channel];
+                float input = sample;
+                float output = filter.b0 * input + z1;
+                z1 = filter.b1 * input - filter.a1 * output + z2;
+                z2 = filter.b2 * input - filter.a2 * output;
+                sample = output;
+            }
+            filter.state[channel * 2] = z1;
+            filter.state[channel * 2 + 1] = z2;
+        }
+    }
+
+    std::string getName() override { return "high-pass"; }
+
+  private:
+    struct Filter {
+        unsigned int sampleRate = 0;
+        float b0 = 1, b1 = 0, b2 = 0, a1 = 0, a2 = 0;
+        std::vector<float> state;
+    };
+
+    Filter &getFilter(const std::string &streamID) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return filters_[streamID];
+    }
+
+    void updateFilter(Filter &filter, unsigned int sampleRate, unsigned int channels) {
+        const double pi = 3.14159265358979323846;
+        double w0 = 2 * pi * cutoffHz_ / sampleRate;
+        double cosW0 = cos(w0);
+        double alpha = sin(w0) / (2 * 0.7071067811865476);
+        double a0 = 1 + alpha;
+
+        filter.sampleRate = sampleRate;
+        filter.b0 = (float)((1 + cosW0) / 2 / a0);
+        filter.b1 = (float)(-(1 + cosW0) / a0);
+        filter.b2 = filter.b0;
+        filter.a1 = (float)(-2 * cosW0 / a0);
+        filter.a2 = (float)((1 - alpha) / a0);
+        filter.state.assign(channels * 2, 0.0f);
+    }
+
+    float cutoffHz_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, Filter> filters_;
+};
+
+}  // namespace
+
+class ZegoAudioProcessorChain {
+  public:
+    void add(std::shared_ptr<IZegoFlutterAudioProcessor> processor, uint32_t deadlineMicroseconds) {
+        auto stage = std::make_shared<Stage>();
+        stage->processor = processor;
+        stage->name = processor->getName();
+        stage->deadlineMicroseconds = deadlineMicroseconds;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto stages = std::make_shared<StageList>(*stages_);
+        stages->push_back(stage);
+        setStages(stages);
+    }
+
+    void remove(std::shared_ptr<IZegoFlutterAudioProcessor> processor) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto stages = std::make_shared<StageList>();
+        for (auto &stage : *stages_) {
+            if (stage->processor != processor) {
+                stages->push_back(stage);
+            }
+        }
+        setStages(stages);
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        setStages(std::make_shared<StageList>());
+    }
+
+    std::vector<ZGFlutterAudioProcessorStats> getStats() {
+        std::vector<ZGFlutterAudioProcessorStats> statsList;
+        for (auto &stage : *getStages()) {
+            ZGFlutterAudioProcessorStats stats;
+            stats.name = stage->name;
+            stats.callCount = stage->callCount;
+            stats.totalMicroseconds = stage->totalMicroseconds;
+            stats.maxMicroseconds = stage->maxMicroseconds;
+            stats.overrunCount = stage->overrunCount;
+            stats.bypassedCount = stage->bypassedCount;
+            statsList.push_back(stats);
+        }
+        return statsList;
+    }
+
+    void process(unsigned char *data, unsigned int dataLength, unsigned int channels,
+                 unsigned int sampleRate, const std::string &streamID) {
+        if (stageCount_ == 0 || channels == 0) {
+            return;
+        }
+        auto stages = getStages();
+
+        size_t count = dataLength / sizeof(int16_t);
+        unsigned int frames = (unsigned int)(count / channels);
+        count = (size_t)frames * channels;
+
+        // Each SDK callback thread converts into its own buffer.
+        thread_local std::vector<float> samples;
+        if (samples.size() < count) {
+            samples.resize(count);
+        }
+        int16_t *pcm = reinterpret_cast<int16_t *>(data);
+        pcm16ToFloat(pcm, samples.data(), count);
+
+        for (auto &stage : *stages) {
+            if (stage->bypassRemaining > 0) {
+                stage->bypassRemaining--;
+                stage->bypassedCount++;
+                continue;
+            }
+
+            auto begin = std::chrono::steady_clock::now();
+            stage->processor->process(samples.data(), frames, channels, sampleRate, streamID);
+            uint64_t elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                                   std::chrono::steady_clock::now() - begin).count();
+
+            stage->callCount++;
+            stage->totalMicroseconds += elapsed;
+            uint64_t maxMicroseconds = stage->maxMicroseconds;
+            while (elapsed > maxMicroseconds &&
+                   !stage->maxMicroseconds.compare_exchange_weak(maxMicroseconds, elapsed)) {
+            }
+
+            if (stage->deadlineMicroseconds == 0 || elapsed <= stage->deadlineMicroseconds) {
+                stage->consecutiveOverruns = 0;
+                continue;
+            }
+            stage->overrunCount++;
+            if (++stage->consecutiveOverruns >= kMaxConsecutiveOverruns) {
+                stage->consecutiveOverruns = 0;
+                stage->bypassRemaining = kBypassFrames;
+            }
+        }
+
+        floatToPcm16(samples.data(), pcm, count);
+    }
+
+  private:
+    struct Stage {
+        std::shared_ptr<IZegoFlutterAudioProcessor> processor;
+        std::string name;
+        uint32_t deadlineMicroseconds = 0;
+        std::atomic<uint64_t> callCount = 0;
+        std::atomic<uint64_t> totalMicroseconds = 0;
+        std::atomic<uint64_t> maxMicroseconds = 0;
+        std::atomic<uint64_t> overrunCount = 0;
+        std::atomic<uint64_t> bypassedCount = 0;
+        std::atomic<uint32_t> consecutiveOverruns = 0;
+        std::atomic<uint32_t> bypassRemaining = 0;
+    };
+    using StageList = std::vector<std::shared_ptr<Stage>>;
+
+    std::shared_ptr<const StageList> getStages() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stages_;
+    }
+
+    // Called with mutex_ held.
+    void setStages(std::shared_ptr<const StageList> stages) {
+        stages_ = stages;
+        stageCount_ = stages->size();
+    }
+
+    std::mutex mutex_;
+    std::shared_ptr<const StageList> stages_ = std::make_shared<StageList>();
+    std::atomic<size_t> stageCount_ = 0;
+};
+
+ZegoCustomAudioProcessManager::ZegoCustomAudioProcessManager() {
+    for (auto &chain : chains_) {
+        chain = std::make_unique<ZegoAudioProcessorChain>();
+    }
+}
+
+ZegoCustomAudioProcessManager::~ZegoCustomAudioProcessManager() {}
+
+std::shared_ptr<ZegoCustomAudioProcessManager> ZegoCustomAudioProcessManager::getInstance() {
+    std::call_once(singletonFlag, [&] {
+        instance_ = std::make_shared<ZegoCustomAudioProcessManager>();
+    });
+    return instance_;
+}
+
+void ZegoCustomAudioProcessManager::addProcessor(ZGFlutterAudioProcessType type,
+                                                 std::shared_ptr<IZegoFlutterAudioProcessor> processor,
+                                                 unsigned int deadlineMicroseconds) {
+    if (type < 0 || type >= kProcessTypeCount || !processor) {
+        return;
+    }
+    chains_[type]->add(processor, deadlineMicroseconds);
+}
+
+void ZegoCustomAudioProcessManager::removeProcessor(ZGFlutterAudioProcessType type,
+                                                    std::shared_ptr<IZegoFlutterAudioProcessor> processor) {
+    if (type < 0 || type >= kProcessTypeCount) {
+        return;
+    }
+    chains_[type]->remove(processor);
+}
+
+void ZegoCustomAudioProcessManager::clearProcessors(ZGFlutterAudioProcessType type) {
+    if (type < 0 || type >= kProcessTypeCount) {
+        return;
+    }
+    chains_[type]->clear();
+}
+
+std::vector<ZGFlutterAudioProcessorStats> ZegoCustomAudioProcessManager::getProcessorStats(ZGFlutterAudioProcessType type) {
+    if (type < 0 || type >= kProcessTypeCount) {
+        return {};
+    }
+    return chains_[type]->getStats();
+}
+
+std::shared_ptr<IZegoFlutterAudioProcessor> ZegoCustomAudioProcessManager::createGainProcessor(float gain) {
+    return std::make_shared<ZegoGainAudioProcessor>(gain);
+}
+
+std::shared_ptr<IZegoFlutterAudioProcessor> ZegoCustomAudioProcessManager::createLimiterProcessor(float threshold,
+                                                                                                   float releaseMilliseconds) {
+    return std::make_shared<ZegoLimiterAudioProcessor>(threshold, releaseMilliseconds);
+}
+
+std::shared_ptr<IZegoFlutterAudioProcessor> ZegoCustomAudioProcessManager::createHighPassProcessor(float cutoffHz) {
+    return std::make_shared<ZegoHighPassAudioProcessor>(cutoffHz);
+}
+
+void ZegoCustomAudioProcessManager::process(ZGFlutterAudioProcessType type, unsigned char *data,
+                                            unsigned int dataLength, unsigned int channels,
+                                            unsigned int sampleRate, const std::string &streamID) {
+    if (type < 0 || type >= kProcessTypeCount) {
+        return;
+    }
+    chains_[type]->process(data, dataLength, channels, sampleRate, streamID);
+}
@@ -1,20 +1,384 @@
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 #include "ZegoLog.h"
 #include <ZegoInternalPrivate.h>
 
 #undef __MODULE__
 #define __MODULE__ "Flutter"
 
-void ZF::logInfo(const char* format, ...) {
-    char log_buf[4096] = { 0 };
+namespace {
+
+constexpr size_t kMaxLineLength = 4096;
+
+struct LogLine {
+    // Taken before the line is queued, so the lines of one pass are written
+    // in about the order they were logged. A line whose thread was preempted
+    // between taking it and queueing can still land in a later pass.
+    uint64_t sequence;
+    ZF::LogLevel level;
+    std::string text;
+};
+
+// Single producer single consumer ring of formatted lines, one per logging
+// thread.
+class LogRing {
+  public:
+    static constexpr uint32_t kCapacity = 1 << 15;
+
+    // Called on the owning thread only.
+    bool push(uint64_t sequence, ZF::LogLevel level, const char *text, uint32_t length) {
+        auto size = recordSize(length);
+        auto head = head_.load(std::memory_order_relaxed);
+        auto tail = tail_.load(std::memory_order_acquire);
+        auto offset = (uint32_t)(head % kCapacity);
+        // Records do not wrap, the rest of the ring is skipped instead.
+        auto skip = offset + size > kCapacity ? kCapacity - offset : 0;
+        if (head + skip + size - tail > kCapacity) {
+            return false;
+        }
+
+        if (skip > 0) {
+            if (skip >= sizeof(Header)) {
+                Header wrap = {};
+                memcpy(buffer_ + offset, &wrap, sizeof(Header));
+            }
+            head += skip;
+            offset = 0;
+        }
+        Header header = {size, length, (int32_t)level, 0, sequence};
+        memcpy(buffer_ + offset, &header, sizeof(Header));
+        memcpy(buffer_ + offset + sizeof(Header), text, length);
+        head_.store(head + size, std::memory_order_release);
+        return true;
+    }
+
+    // Called on the writer thread only.
+    void drain(std::vector<LogLine> &lines) {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        auto head = head_.load(std::memory_order_acquire);
+        while (tail != head) {
+            auto offset = (uint32_t)(tail % kCapacity);
+            Header header;
+            if (kCapacity - offset >= sizeof(Header)) {
+                memcpy(&header, buffer_ + offset, sizeof(Header));
+            } else {
+                header.size = 0;
+            }
+            if (header.size == 0) {
+                tail += kCapacity - offset;
+                continue;
+            }
+            lines.push_back({header.sequence, (ZF::LogLevel)header.level,
+                             std::string(buffer_ + offset + sizeof(Header), header.length)});
+            tail += header.size;
+        }
+        tail_.store(tail, std::memory_order_release);
+    }
+
+    bool isHalfFull() {
+        return head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_relaxed) >
+               kCapacity / 2;
+    }
+
+    // Set when the owning thread exits, the writer drops the ring once drained.
+    std::atomic_bool isClosed = false;
+
+  private:
+    struct Header {
+        // Whole record aligned to 8 bytes, 0 marks the skipped end of the ring.
+        uint32_t size;
+        uint32_t length;
+        int32_t level;
+        uint32_t reserved;
+        uint64_t sequence;
+    };
+
+    static uint32_t recordSize(uint32_t length) {
+        return (uint32_t)((sizeof(Header) + length + 7) & ~(size_t)7);
+    }
+
+    char buffer_[kCapacity];
+    std::atomic<uint64_t> head_ = 0;
+    std::atomic<uint64_t> tail_ = 0;
+};
+
+// Writes the lines of every thread's ring on a background thread and
+// collapses runs of the same line into a repeat count.
+class LogWriter {
+  public:
+    ~LogWriter() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            running_ = false;
+        }
+        condition_.notify_all();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        isDestroyed() = true;
+    }
+
+    // Set once the writer is gone during static destruction, lines are
+    // written on the calling thread from then on.
+    static std::atomic_bool &isDestroyed() {
+        static std::atomic_bool destroyed = false;
+        return destroyed;
+    }
+
+    std::shared_ptr<LogRing> createRing() {
+        auto ring = std::make_shared<LogRing>();
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings_.push_back(ring);
+        if (!thread_.joinable()) {
+            running_ = true;
+            thread_ = std::thread(&LogWriter::run, this);
+        }
+        return ring;
+    }
+
+    void wake() { condition_.notify_one(); }
+
+    void flush() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        // The pass that is running may have missed the latest lines.
+        auto target = writeCount_ + 2;
+        flushRequested_ = true;
+        condition_.notify_one();
+        flushCondition_.wait(lock, [&] { return writeCount_ >= target || !running_; });
+    }
+
+    // Console and SDK log, also used on the calling thread as fallback.
+    static void write(ZF::LogLevel level, const char *text) {
+        static const char *const prefixes[] = {"[D] ", "", "[W] ", "[E] "};
+        auto prefix = level >= ZF::LOG_LEVEL_DEBUG && level <= ZF::LOG_LEVEL_ERROR ? prefixes[level] : "";
+        if (prefix[0] == '\0') {
+            printf("flutter: %s\n", text);
+            zego_express_custom_log(text, __MODULE__);
+            return;
+        }
+
+        char line[kMaxLineLength + 8];
+        snprintf(line, sizeof(line), "%s%s", prefix, text);
+        printf("flutter: %s\n", line);
+        zego_express_custom_log(line, __MODULE__);
+    }
+
+    std::atomic<uint64_t> writtenCount = 0;
+    std::atomic<uint64_t> repeatedCount = 0;
+    // Counted by the logging threads.
+    std::atomic<uint64_t> droppedCount = 0;
+
+  private:
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            condition_.wait_for(lock, std::chrono::milliseconds(20),
+                                [this] { return !running_ || flushRequested_; });
+            auto stopping = !running_;
+            flushRequested_ = false;
+            auto rings = rings_;
+            lock.unlock();
+
+            // A thread that exited has pushed its last line before closing.
+            std::vector<bool> closed;
+            for (auto &ring : rings) {
+                closed.push_back(ring->isClosed);
+            }
+            std::vector<LogLine> lines;
+            for (auto &ring : rings) {
+                ring->drain(lines);
+            }
+            // Sequences of one ring only grow, so this keeps the order of
+            // every thread and interleaves the threads.
+            std::sort(lines.begin(), lines.end(),
+                      [](const LogLine &a, const LogLine &b) { return a.sequence < b.sequence; });
+            for (auto &line : lines) {
+                writeLine(line.level, std::move(line.text));
+            }
+            writeDrops();
+            auto now = std::chrono::steady_clock::now();
+            if (stopping || (repeats_ > 0 && now - lastLineTime_ > std::chrono::seconds(1))) {
+                writeRepeats();
+            }
+
+            lock.lock();
+            for (size_t i = 0; i < rings.size(); i++) {
+                if (closed[i]) {
+                    rings_.erase(std::find(rings_.begin(), rings_.end(), rings[i]));
+                }
+            }
+            writeCount_++;
+            flushCondition_.notify_all();
+            if (stopping) {
+                break;
+            }
+        }
+    }
+
+    void writeLine(ZF::LogLevel level, std::string &&line) {
+        if (line == lastLine_ && level == lastLevel_) {
+            repeats_++;
+            return;
+        }
+        writeRepeats();
+        write(level, line.c_str());
+        writtenCount++;
+        lastLine_ = std::move(line);
+        lastLevel_ = level;
+        lastLineTime_ = std::chrono::steady_clock::now();
+    }
+
+    // Notes the lines dropped from full rings since the previous pass.
+    void writeDrops() {
+        auto dropped = droppedCount.load(std::memory_order_relaxed);
+        if (dropped == reportedDroppedCount_) {
+            return;
+        }
+        writeRepeats();
+        char line[64];
+        snprintf(line, sizeof(line), "[ZegoLog] dropped %llu lines, the log ring was full",
+                 (unsigned long long)(dropped - reportedDroppedCount_));
+        write(ZF::LOG_LEVEL_WARNING, line);
+        reportedDroppedCount_ = dropped;
+    }
+
+    void writeRepeats() {
+        if (repeats_ == 0) {
+            return;
+        }
+        char line[64];
+        snprintf(line, sizeof(line), "[ZegoLog] last line repeated %llu times",
+                 (unsigned long long)repeats_);
+        write(lastLevel_, line);
+        repeatedCount += repeats_;
+        repeats_ = 0;
+        // The next line is written even if it equals the repeated one.
+        lastLine_.clear();
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::condition_variable flushCondition_;
+    std::vector<std::shared_ptr<LogRing>> rings_;
+    std::thread thread_;
+    bool running_ = false;
+    bool flushRequested_ = false;
+    uint64_t writeCount_ = 0;
+
+    // Used by the writer thread only.
+    std::string lastLine_;
+    ZF::LogLevel lastLevel_ = ZF::LOG_LEVEL_INFO;
+    uint64_t repeats_ = 0;
+    uint64_t reportedDroppedCount_ = 0;
+    std::chrono::steady_clock::time_point lastLineTime_;
+};
+
+LogWriter &logWriter() {
+    static LogWriter writer;
+    return writer;
+}
+
+std::atomic<int> g_logLevel = ZF::LOG_LEVEL_INFO;
+std::atomic<uint64_t> g_sequence = 0;
+std::atomic<uint64_t> g_filteredCount = 0;
+
+// Registers the ring of the calling thread on first use.
+struct ThreadLogRing {
+    std::shared_ptr<LogRing> ring = logWriter().createRing();
+
+    ~ThreadLogRing() { ring->isClosed = true; }
+};
+
+void queueLine(ZF::LogLevel level, const char *format, va_list args) {
+    char line[kMaxLineLength];
+    auto length = vsnprintf(line, sizeof(line), format, args);
+    if (length < 0) {
+        return;
+    }
+    if ((size_t)length >= sizeof(line)) {
+        length = (int)sizeof(line) - 1;
+    }
+
+    if (!LogWriter::isDestroyed()) {
+        thread_local ThreadLogRing threadRing;
+        auto sequence = g_sequence.fetch_add(1, std::memory_order_relaxed);
+        // Woken only on the line that crosses half full, the writer polls
+        // anyway, and waking it on every line after costs more than the write.
+        auto wasHalfFull = threadRing.ring->isHalfFull();
+        if (threadRing.ring->push(sequence, level, line, (uint32_t)length)) {
+            if (!wasHalfFull && threadRing.ring->isHalfFull()) {
+                logWriter().wake();
+            }
+            return;
+        }
+        // The caller may be an SDK audio or render thread, so the line is
+        // dropped rather than waiting for the writer. The writer notes it.
+        logWriter().droppedCount.fetch_add(1, std::memory_order_relaxed);
+        logWriter().wake();
+        return;
+    }
+
+    LogWriter::write(level, line);
+}
+
+}  // namespace
+
+void ZF::setLogLevel(LogLevel level) { g_logLevel = level; }
+
+bool ZF::isLogEnabled(LogLevel level) {
+    if (level < g_logLevel.load(std::memory_order_relaxed)) {
+        g_filteredCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void ZF::log(LogLevel level, const char *format, ...) {
+    if (!isLogEnabled(level)) {
+        return;
+    }
+    va_list la;
+    va_start(la, format);
+    queueLine(level, format, la);
+    va_end(la);
+}
+
+void ZF::logInfo(const char *format, ...) {
+    if (!isLogEnabled(LOG_LEVEL_INFO)) {
+        return;
+    }
     va_list la;
     va_start(la, format);
-    vsprintf(log_buf, format, la);
+    queueLine(LOG_LEVEL_INFO, format, la);
     va_end(la);
+}
 
-    printf("flutter: %s\n", log_buf);
+void ZF::flushLog() {
+    if (!LogWriter::isDestroyed()) {
+        logWriter().flush();
+    }
+}
 
-    zego_express_custom_log(log_buf, __MODULE__);
-}
\ No newline at end of file
+ZF::LogStats ZF::getLogStats() {
+    LogStats stats;
+    if (!LogWriter::isDestroyed()) {
+        stats.writtenCount = logWriter().writtenCount;
+        stats.repeatedCount = logWriter().repeatedCount;
+        stats.droppedCount = logWriter().droppedCount;
+    }
+    stats.filteredCount = g_filteredCount;
+    return stats;
+}
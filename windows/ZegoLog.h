@@ -1,5 +1,42 @@
 #pragma once
 
+#include <cstdint>
+
 namespace ZF {
+    enum LogLevel {
+        LOG_LEVEL_DEBUG = 0,
+        LOG_LEVEL_INFO,
+        LOG_LEVEL_WARNING,
+        LOG_LEVEL_ERROR,
+        // Nothing is logged.
+        LOG_LEVEL_NONE
+    };
+
+    struct LogStats {
+        uint64_t writtenCount = 0;
+        // Repeats of the previous line, written as a single count.
+        uint64_t repeatedCount = 0;
+        // Lines dropped because the ring of their thread was full.
+        uint64_t droppedCount = 0;
+        uint64_t filteredCount = 0;
+    };
+
+    // Lines below `level` are dropped before they are formatted.
+    void setLogLevel(LogLevel level);
+
+    bool isLogEnabled(LogLevel level);
+
+    // Formats on the calling thread and queues the line in a ring of that
+    // thread, a background thread writes it to the console and the SDK log.
+    // Never blocks, the line is dropped and counted when the ring is full.
+    // Lines of one thread keep their order, lines of different threads are
+    // only roughly ordered.
+    void log(LogLevel level, const char *format, ...);
+
     void logInfo(const char *format, ...);
+
+    // Blocks until every queued line is written.
+    void flushLog();
+
+    LogStats getLogStats();
 }
@@ -0,0 +1,112 @@
+#ifndef ZEGO_CUSTOM_AUDIO_PROCESS_MANAGER_H_
+#define ZEGO_CUSTOM_AUDIO_PROCESS_MANAGER_H_
+
+#include "ZegoCustomVideoDefine.h"
+
+#include <string>
+
+/// Custom audio processing callback that a processor chain runs on.
+enum FLUTTER_PLUGIN_EXPORT ZGFlutterAudioProcessType {
+    /// [onProcessCapturedAudioData], the locally captured audio.
+    ZG_FLUTTER_AUDIO_PROCESS_TYPE_CAPTURED = 0,
+
+    /// [onProcessCapturedAudioDataAfterUsedHeadphoneMonitor], the locally captured audio after headphone monitoring.
+    ZG_FLUTTER_AUDIO_PROCESS_TYPE_CAPTURED_AFTER_HEADPHONE_MONITOR = 1,
+
+    /// [onProcessRemoteAudioData], the audio of each played stream.
+    ZG_FLUTTER_AUDIO_PROCESS_TYPE_REMOTE = 2,
+
+    /// [onProcessPlaybackAudioData], the mixed audio before playback.
+    ZG_FLUTTER_AUDIO_PROCESS_TYPE_PLAYBACK = 3
+
+};
+
+/// Time spent in one stage of a processor chain.
+struct FLUTTER_PLUGIN_EXPORT ZGFlutterAudioProcessorStats {
+    /// Name returned by the processor.
+    std::string name;
+
+    /// Number of frames processed.
+    unsigned long long callCount;
+
+    /// Total processing time in microseconds.
+    unsigned long long totalMicroseconds;
+
+    /// Max processing time of one frame in microseconds.
+    unsigned long long maxMicroseconds;
+
+    /// Number of frames that took longer than the deadline.
+    unsigned long long overrunCount;
+
+    /// Number of frames skipped while the stage was bypassed.
+    unsigned long long bypassedCount;
+};
+
+class FLUTTER_PLUGIN_EXPORT IZegoFlutterAudioProcessor {
+  protected:
+    virtual ~IZegoFlutterAudioProcessor() {}
+
+  public:
+    /// Processes one audio frame in place on the SDK audio thread.
+    ///
+    /// @param samples Interleaved samples in the range [-1, 1], converted from and back to 16 bit PCM by the chain.
+    /// @param frames Number of samples per channel.
+    /// @param channels Number of channels.
+    /// @param sampleRate Sample rate in Hz.
+    /// @param streamID Stream ID of [ZG_FLUTTER_AUDIO_PROCESS_TYPE_REMOTE], empty otherwise. Stateful processors keep their state per stream.
+    virtual void process(float *samples, unsigned int frames, unsigned int channels,
+                         unsigned int sampleRate, const std::string &streamID) = 0;
+
+    /// Name of the processor in the chain stats.
+    virtual std::string getName() { return "processor"; }
+};
+
+class ZegoAudioProcessorChain;
+
+class FLUTTER_PLUGIN_EXPORT ZegoCustomAudioProcessManager {
+public:
+    ZegoCustomAudioProcessManager();
+    ~ZegoCustomAudioProcessManager();
+
+    static std::shared_ptr<ZegoCustomAudioProcessManager> getInstance();
+
+    /// Appends a processor to the chain of the given custom audio processing callback.
+    ///
+    /// Description: The chain runs synchronously inside the SDK callback and modifies the audio in place, so the processed audio is what the SDK publishes or plays.
+    /// Restrictions: The custom audio processing of [type] must be enabled from dart, e.g. [enableCustomAudioCaptureProcessing].
+    ///
+    /// @param type Custom audio processing callback.
+    /// @param processor Processor to append.
+    /// @param deadlineMicroseconds If the processor takes longer than this for several frames in a row, it is bypassed for a while before being tried again. 0 means no deadline.
+    void addProcessor(ZGFlutterAudioProcessType type, std::shared_ptr<IZegoFlutterAudioProcessor> processor,
+                      unsigned int deadlineMicroseconds = 0);
+
+    /// Removes a processor from the chain of the given custom audio processing callback.
+    void removeProcessor(ZGFlutterAudioProcessType type, std::shared_ptr<IZegoFlutterAudioProcessor> processor);
+
+    /// Removes all processors from the chain of the given custom audio processing callback.
+    void clearProcessors(ZGFlutterAudioProcessType type);
+
+    /// Returns the stats of every stage of the chain, in chain order.
+    std::vector<ZGFlutterAudioProcessorStats> getProcessorStats(ZGFlutterAudioProcessType type);
+
+    /// Creates a processor that multiplies every sample by [gain].
+    static std::shared_ptr<IZegoFlutterAudioProcessor> createGainProcessor(float gain);
+
+    /// Creates a peak limiter that keeps samples below [threshold] (linear, 0-1), recovering over [releaseMilliseconds].
+    static std::shared_ptr<IZegoFlutterAudioProcessor> createLimiterProcessor(float threshold,
+                                                                               float releaseMilliseconds = 50.0f);
+
+    /// Creates a second order high-pass filter with the given cutoff frequency in Hz.
+    static std::shared_ptr<IZegoFlutterAudioProcessor> createHighPassProcessor(float cutoffHz);
+
+    /// Runs the chain of [type] on 16 bit PCM, called by the plugin from the SDK callbacks.
+    void process(ZGFlutterAudioProcessType type, unsigned char *data, unsigned int dataLength,
+                 unsigned int channels, unsigned int sampleRate, const std::string &streamID);
+
+private:
+    static constexpr int kProcessTypeCount = 4;
+    std::unique_ptr<ZegoAudioProcessorChain> chains_[kProcessTypeCount];
+};
+
+#endif  // ZEGO_CUSTOM_AUDIO_PROCESS_MANAGER_H_
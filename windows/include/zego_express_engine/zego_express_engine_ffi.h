@@ -0,0 +1,81 @@
+#ifndef FLUTTER_PLUGIN_ZEGO_EXPRESS_ENGINE_FFI_H_
+#define FLUTTER_PLUGIN_ZEGO_EXPRESS_ENGINE_FFI_H_
+
+#include <stdint.h>
+
+#include "zego_express_engine_plugin.h"
+
+// C entry points that dart calls through dart:ffi instead of the method
+// channel, for methods that carry payloads at a high rate. They run on the
+// calling isolate thread and pass the payload to the SDK without copying.
+//
+// Every function returns 0 on success or
+// ZEGO_EXPRESS_FFI_ERROR_ENGINE_NOT_CREATED before the engine is created.
+//
+// They do not wait for method channel calls that are still in flight, the
+// caller must only use them once the calls they depend on have completed.
+// Dart sends through the channel while such a call is pending.
+
+#define ZEGO_EXPRESS_FFI_ERROR_ENGINE_NOT_CREATED 1000001
+#define ZEGO_EXPRESS_FFI_ERROR_INSTANCE_NOT_FOUND -1
+#define ZEGO_EXPRESS_FFI_ERROR_NO_EVENT_SINK -2
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// Native memory that dart stages payloads in, dart:ffi has no allocator of
+// its own.
+FLUTTER_PLUGIN_EXPORT void *zego_express_ffi_alloc(uint32_t size);
+
+FLUTTER_PLUGIN_EXPORT void zego_express_ffi_free(void *data);
+
+// Ordered access to the cursors of the rings that dart reads in place, the
+// loads and stores of dart:ffi have no memory ordering.
+FLUTTER_PLUGIN_EXPORT uint64_t zego_express_ffi_load_acquire(uint64_t *address);
+
+FLUTTER_PLUGIN_EXPORT void zego_express_ffi_store_release(uint64_t *address, uint64_t value);
+
+FLUTTER_PLUGIN_EXPORT uint32_t zego_express_ffi_exchange(uint32_t *address, uint32_t value);
+
+FLUTTER_PLUGIN_EXPORT int32_t zego_express_ffi_send_sei(uint8_t *data, uint32_t dataLength,
+                                                        int32_t channel);
+
+FLUTTER_PLUGIN_EXPORT int32_t zego_express_ffi_send_audio_side_info(uint8_t *data,
+                                                                    uint32_t dataLength,
+                                                                    double timeStampMs,
+                                                                    int32_t channel);
+
+FLUTTER_PLUGIN_EXPORT int32_t zego_express_ffi_send_custom_audio_capture_pcm_data(
+    uint8_t *data, uint32_t dataLength, int32_t sampleRate, int32_t audioChannel,
+    int32_t channel);
+
+FLUTTER_PLUGIN_EXPORT int32_t zego_express_ffi_send_custom_audio_capture_aac_data(
+    uint8_t *data, uint32_t dataLength, uint32_t configLength,
+    uint64_t referenceTimeMillisecond, uint32_t samples, int32_t sampleRate,
+    int32_t audioChannel, int32_t channel);
+
+// `streamID` is null terminated UTF-8. The send result is delivered as an
+// `onRealTimeSequentialDataSent` event carrying `sequence`. Returns
+// ZEGO_EXPRESS_FFI_ERROR_INSTANCE_NOT_FOUND for an unknown manager `index`,
+// and ZEGO_EXPRESS_FFI_ERROR_NO_EVENT_SINK without sending while dart does
+// not listen to events, as the result could not be delivered.
+FLUTTER_PLUGIN_EXPORT int32_t zego_express_ffi_data_manager_send_real_time_sequential_data(
+    int32_t index, uint8_t *data, uint32_t dataLength, const char *streamID,
+    int64_t sequence);
+
+// Fills `data` with the custom audio render PCM of `dataLength` bytes.
+FLUTTER_PLUGIN_EXPORT int32_t zego_express_ffi_fetch_custom_audio_render_pcm_data(
+    uint8_t *data, uint32_t dataLength, int32_t sampleRate, int32_t audioChannel);
+
+// Fetches up to `chunkCount` chunks into the custom audio render ring at
+// `address` now, `fetchedCount` receives the number fetched. Returns
+// ZEGO_EXPRESS_FFI_ERROR_INSTANCE_NOT_FOUND if that ring was destroyed.
+FLUTTER_PLUGIN_EXPORT int32_t zego_express_ffi_fetch_custom_audio_render_ring(
+    int64_t address, uint32_t chunkCount, uint32_t *fetchedCount);
+
+#if defined(__cplusplus)
+}  // extern "C"
+#endif
+
+#endif  // FLUTTER_PLUGIN_ZEGO_EXPRESS_ENGINE_FFI_H_
@@ -0,0 +1,158 @@
+#include "ZegoAudioDataRing.h"
+
+#include <cstring>
+#include <new>
+#include <thread>
+
+namespace {
+
+constexpr uint32_t kRecordAlignment = 16;
+
+inline uint32_t alignRecord(uint32_t size) {
+  return (size + kRecordAlignment - 1) & ~(kRecordAlignment - 1);
+}
+
+}  // namespace
+
+ZegoAudioDataRing::ZegoAudioDataRing(uint32_t capacity) {
+  capacity_ = alignRecord(capacity > kRecordAlignment ? capacity : kRecordAlignment);
+
+  void *memory = ::operator new(sizeof(Header) + capacity_, std::align_val_t(alignof(Header)));
+  header_ = new (memory) Header();
+  header_->version = kVersion;
+  header_->headerSize = sizeof(Header);
+  header_->capacity = capacity_;
+  header_->reserved = 0;
+  buffer_ = static_cast<uint8_t *>(memory) + sizeof(Header);
+}
+
+ZegoAudioDataRing::~ZegoAudioDataRing() {
+  header_->~Header();
+  ::operator delete(header_, std::align_val_t(alignof(Header)));
+}
+
+bool ZegoAudioDataRing::write(const uint8_t *data, uint32_t dataLength, uint32_t sampleRate,
+                              uint32_t channel) {
+  uint32_t recordSize = kRecordHeaderSize + alignRecord(dataLength);
+  uint64_t writePosition = header_->writePosition.load(std::memory_order_relaxed);
+  uint64_t readPosition = header_->readPosition.load(std::memory_order_acquire);
+
+  if (recordSize > capacity_ - (writePosition - readPosition)) {
+    header_->overrunCount.fetch_add(1, std::memory_order_relaxed);
+    header_->overrunBytes.fetch_add(dataLength, std::memory_order_relaxed);
+    return false;
+  }
+
+  uint32_t recordHeader[4] = {dataLength, sampleRate, channel, 0};
+  copyIn(writePosition, reinterpret_cast<const uint8_t *>(recordHeader), kRecordHeaderSize);
+  copyIn(writePosition + kRecordHeaderSize, data, dataLength);
+
+  header_->frameCount.fetch_add(1, std::memory_order_relaxed);
+  header_->writePosition.store(writePosition + recordSize, std::memory_order_release);
+  return true;
+}
+
+bool ZegoAudioDataRing::takeNotification() {
+  return header_->notifyPending.exchange(1, std::memory_order_acq_rel) == 0;
+}
+
+uint64_t ZegoAudioDataRing::getOverrunCount() const {
+  return header_->overrunCount.load(std::memory_order_relaxed);
+}
+
+void ZegoAudioDataRing::copyIn(uint64_t position, const uint8_t *data, uint32_t length) {
+  uint32_t offset = (uint32_t)(position % capacity_);
+  uint32_t firstPart = capacity_ - offset < length ? capacity_ - offset : length;
+  memcpy(buffer_ + offset, data, firstPart);
+  if (firstPart < length) {
+    memcpy(buffer_, data + firstPart, length - firstPart);
+  }
+}
+
+ZegoAudioDataRingSet::~ZegoAudioDataRingSet() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  publish(nullptr);
+}
+
+int64_t ZegoAudioDataRingSet::create(int32_t source, const std::string &streamID,
+                                     uint32_t capacity, bool notify) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto table = table_ ? std::make_unique<Table>(*table_) : std::make_unique<Table>();
+  for (auto const &entry : *table) {
+    if (entry.source == source && entry.streamID == streamID) {
+      return 0;
+    }
+  }
+
+  auto ring = std::make_shared<ZegoAudioDataRing>(capacity);
+  auto address = ring->getAddress();
+  table->push_back({source, streamID, std::move(ring), notify});
+  publish(std::move(table));
+  return address;
+}
+
+bool ZegoAudioDataRingSet::destroy(int32_t source, const std::string &streamID) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!table_) {
+    return false;
+  }
+  auto table = std::make_unique<Table>(*table_);
+  for (auto it = table->begin(); it != table->end(); it++) {
+    if (it->source == source && it->streamID == streamID) {
+      table->erase(it);
+      publish(std::move(table));
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ZegoAudioDataRingSet::write(int32_t source, const std::string &streamID,
+                                 const uint8_t *data, uint32_t dataLength, uint32_t sampleRate,
+                                 uint32_t channel, int64_t &notifyAddress) {
+  notifyAddress = 0;
+  if (!(sources_.load(std::memory_order_relaxed) & source)) {
+    return false;
+  }
+
+  auto &readers = readers_[epoch_.load() & 1];
+  readers.fetch_add(1);
+  bool found = false;
+  auto table = current_.load();
+  if (table) {
+    for (auto const &entry : *table) {
+      if (entry.source == source && entry.streamID == streamID) {
+        found = true;
+        // Frames that do not fit are counted by the ring and dropped, falling
+        // back to events would reorder them.
+        if (entry.ring->write(data, dataLength, sampleRate, channel) && entry.notify &&
+            entry.ring->takeNotification()) {
+          notifyAddress = entry.ring->getAddress();
+        }
+        break;
+      }
+    }
+  }
+  readers.fetch_sub(1, std::memory_order_release);
+  return found;
+}
+
+void ZegoAudioDataRingSet::publish(std::unique_ptr<Table> table) {
+  int32_t sources = 0;
+  if (table) {
+    for (auto const &entry : *table) {
+      sources |= entry.source;
+    }
+  }
+  // A reader that still sees the old sources finds the new table.
+  current_.store(table ? table.get() : nullptr);
+  sources_ = sources;
+
+  // Readers that start from here on count in the other slot and see the new
+  // table, the old one goes once its slot is empty.
+  auto &readers = readers_[epoch_.fetch_add(1) & 1];
+  while (readers.load() != 0) {
+    std::this_thread::yield();
+  }
+  table_ = std::move(table);
+}
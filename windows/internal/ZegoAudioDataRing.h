@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Single-producer/single-consumer ring of PCM frames in native memory that
+// dart reads in place through ffi. The SDK audio thread writes, dart reads
+// and advances `readPosition`.
+//
+// Memory layout, all positions are byte counts since creation:
+//   0    u32 version | u32 headerSize | u32 capacity | u32 reserved
+//   64   u64 writePosition | u64 frameCount | u64 overrunCount | u64 overrunBytes
+//   128  u64 readPosition | u32 notifyPending
+//
+// The reader loads writePosition with acquire, stores readPosition with
+// release and clears notifyPending with an exchange.
+//   headerSize  capacity bytes of records
+//
+// Each record is a 16 byte header `u32 dataLength | u32 sampleRate |
+// u32 channel | u32 reserved` followed by the PCM padded to 16 bytes, so
+// record headers never wrap around the end of the ring.
+class ZegoAudioDataRing {
+ public:
+  static constexpr uint32_t kVersion = 1;
+  static constexpr uint32_t kRecordHeaderSize = 16;
+
+  // Capacity is rounded up to a multiple of the record alignment.
+  explicit ZegoAudioDataRing(uint32_t capacity);
+  ~ZegoAudioDataRing();
+
+  // Prevent copying.
+  ZegoAudioDataRing(ZegoAudioDataRing const&) = delete;
+  ZegoAudioDataRing& operator=(ZegoAudioDataRing const&) = delete;
+
+  // Copies one frame into the ring, returns false and counts an overrun if
+  // the reader has not freed enough space.
+  bool write(const uint8_t *data, uint32_t dataLength, uint32_t sampleRate, uint32_t channel);
+
+  // Returns true once per drain of the reader, which clears the flag before
+  // it starts reading.
+  bool takeNotification();
+
+  // Address of the header, handed to dart.
+  int64_t getAddress() const { return reinterpret_cast<int64_t>(header_); }
+
+  uint32_t getCapacity() const { return capacity_; }
+
+  uint64_t getOverrunCount() const;
+
+ private:
+  struct Header {
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t capacity;
+    uint32_t reserved;
+
+    alignas(64) std::atomic<uint64_t> writePosition;
+    std::atomic<uint64_t> frameCount;
+    std::atomic<uint64_t> overrunCount;
+    std::atomic<uint64_t> overrunBytes;
+
+    alignas(64) std::atomic<uint64_t> readPosition;
+    std::atomic<uint32_t> notifyPending;
+  };
+
+  void copyIn(uint64_t position, const uint8_t *data, uint32_t length);
+
+  uint32_t capacity_ = 0;
+  Header *header_ = nullptr;
+  uint8_t *buffer_ = nullptr;
+};
+
+// The rings by source and stream ID. Rings are created and destroyed on the
+// platform thread and looked up by the SDK audio threads without a lock: a
+// change publishes a new table, and the previous one, with any ring it alone
+// holds, is freed once no audio thread reads it.
+class ZegoAudioDataRingSet {
+ public:
+  ZegoAudioDataRingSet() = default;
+  ~ZegoAudioDataRingSet();
+
+  // Prevent copying.
+  ZegoAudioDataRingSet(ZegoAudioDataRingSet const&) = delete;
+  ZegoAudioDataRingSet& operator=(ZegoAudioDataRingSet const&) = delete;
+
+  // Returns the address of the new ring, or 0 if source and streamID
+  // already have one, whose memory dart may still read.
+  int64_t create(int32_t source, const std::string &streamID, uint32_t capacity, bool notify);
+
+  // Returns false if source and streamID have no ring.
+  bool destroy(int32_t source, const std::string &streamID);
+
+  // Called on the audio threads. Returns false if source and streamID have
+  // no ring. notifyAddress receives the ring address if the reader is to be
+  // notified, 0 otherwise.
+  bool write(int32_t source, const std::string &streamID, const uint8_t *data,
+             uint32_t dataLength, uint32_t sampleRate, uint32_t channel,
+             int64_t &notifyAddress);
+
+ private:
+  struct Entry {
+    int32_t source;
+    std::string streamID;
+    std::shared_ptr<ZegoAudioDataRing> ring;
+    bool notify;
+  };
+  using Table = std::vector<Entry>;
+
+  // Swaps in table and waits for the readers of the previous one.
+  void publish(std::unique_ptr<Table> table);
+
+  std::mutex mutex_;
+  std::unique_ptr<Table> table_;
+  std::atomic<const Table *> current_ = nullptr;
+  // Sources that have at least one ring, checked before the table.
+  std::atomic<int32_t> sources_ = 0;
+  // Readers count themselves in the slot of the epoch they started in.
+  std::atomic<uint32_t> epoch_ = 0;
+  std::atomic<uint32_t> readers_[2] = {};
+};
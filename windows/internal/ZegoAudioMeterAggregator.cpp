@@ -0,0 +1,164 @@
+#include "ZegoAudioMeterAggregator.h"
+
+ZegoAudioMeterAggregator::~ZegoAudioMeterAggregator() {
+  stop();
+}
+
+void ZegoAudioMeterAggregator::start(uint32_t intervalMs, ReadyCallback ready, EmitCallback emit) {
+  stop();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  emit_ = std::move(emit);
+  startTicking(intervalMs > 0 ? intervalMs : 100, std::move(ready));
+}
+
+void ZegoAudioMeterAggregator::stop() {
+  stopTicking();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  emit_ = nullptr;
+  remoteSoundLevels_.clear();
+  remoteSoundLevelInfos_.clear();
+  remoteAudioSpectrums_.clear();
+  mediaPlayerSpectrums_.clear();
+}
+
+void ZegoAudioMeterAggregator::updateCapturedSoundLevel(float soundLevel) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capturedSoundLevel_.update(soundLevel);
+  hasUpdates_ = true;
+}
+
+void ZegoAudioMeterAggregator::updateCapturedSoundLevelInfo(float soundLevel, int vad) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capturedSoundLevelInfo_.update(soundLevel);
+  capturedSoundLevelInfo_.vad = vad;
+  hasUpdates_ = true;
+}
+
+void ZegoAudioMeterAggregator::updateRemoteSoundLevels(const std::unordered_map<std::string, float> &soundLevels) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto const& soundLevel : soundLevels) {
+    remoteSoundLevels_[soundLevel.first].update(soundLevel.second);
+  }
+  hasUpdates_ = true;
+}
+
+void ZegoAudioMeterAggregator::updateRemoteSoundLevelInfo(const std::string &streamID, float soundLevel, int vad) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &meter = remoteSoundLevelInfos_[streamID];
+  meter.update(soundLevel);
+  meter.vad = vad;
+  hasUpdates_ = true;
+}
+
+void ZegoAudioMeterAggregator::updateCapturedAudioSpectrum(const std::vector<float> &spectrum) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capturedAudioSpectrum_.update(spectrum);
+  hasUpdates_ = true;
+}
+
+void ZegoAudioMeterAggregator::updateRemoteAudioSpectrum(const std::string &streamID, const std::vector<float> &spectrum) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  remoteAudioSpectrums_[streamID].update(spectrum);
+  hasUpdates_ = true;
+}
+
+void ZegoAudioMeterAggregator::updateMediaPlayerSpectrum(int mediaPlayerIndex, const std::vector<float> &spectrum) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  mediaPlayerSpectrums_[mediaPlayerIndex].update(spectrum);
+  hasUpdates_ = true;
+}
+
+void ZegoAudioMeterAggregator::LevelMeter::update(float value) {
+  peak = updated && peak > value ? peak : value;
+  latest = value;
+  updated = true;
+}
+
+void ZegoAudioMeterAggregator::SpectrumMeter::update(const std::vector<float> &value) {
+  if (!updated || peak.size() != value.size()) {
+    peak = value;
+  } else {
+    for (size_t i = 0; i < value.size(); i++) {
+      peak[i] = peak[i] > value[i] ? peak[i] : value[i];
+    }
+  }
+  latest = value;
+  updated = true;
+}
+
+std::function<void()> ZegoAudioMeterAggregator::takeBatch(bool isStopping) {
+  auto meters = takeMeters();
+  if (isStopping || !emit_) {
+    return nullptr;
+  }
+  return [emit = emit_, meters = std::move(meters)]() mutable { emit(std::move(meters)); };
+}
+
+flutter::EncodableMap ZegoAudioMeterAggregator::takeMeters() {
+  flutter::EncodableMap meters;
+  hasUpdates_ = false;
+
+  auto levelValue = [](LevelMeter &meter) {
+    meter.updated = false;
+    return flutter::EncodableValue(std::vector<double>{meter.latest, meter.peak, (double)meter.vad});
+  };
+  auto spectrumValue = [](SpectrumMeter &meter) {
+    meter.updated = false;
+    return flutter::EncodableValue(flutter::EncodableList{
+        flutter::EncodableValue(std::move(meter.latest)), flutter::EncodableValue(std::move(meter.peak))});
+  };
+
+  if (capturedSoundLevel_.updated) {
+    meters[flutter::EncodableValue("capturedSoundLevel")] = levelValue(capturedSoundLevel_);
+  }
+  if (capturedSoundLevelInfo_.updated) {
+    meters[flutter::EncodableValue("capturedSoundLevelInfo")] = levelValue(capturedSoundLevelInfo_);
+  }
+  if (capturedAudioSpectrum_.updated) {
+    meters[flutter::EncodableValue("capturedAudioSpectrum")] = spectrumValue(capturedAudioSpectrum_);
+  }
+
+  flutter::EncodableMap remoteSoundLevels;
+  for (auto &meter : remoteSoundLevels_) {
+    if (meter.second.updated) {
+      remoteSoundLevels[flutter::EncodableValue(meter.first)] = levelValue(meter.second);
+    }
+  }
+  if (!remoteSoundLevels.empty()) {
+    meters[flutter::EncodableValue("remoteSoundLevels")] = flutter::EncodableValue(std::move(remoteSoundLevels));
+  }
+
+  flutter::EncodableMap remoteSoundLevelInfos;
+  for (auto &meter : remoteSoundLevelInfos_) {
+    if (meter.second.updated) {
+      remoteSoundLevelInfos[flutter::EncodableValue(meter.first)] = levelValue(meter.second);
+    }
+  }
+  if (!remoteSoundLevelInfos.empty()) {
+    meters[flutter::EncodableValue("remoteSoundLevelInfos")] = flutter::EncodableValue(std::move(remoteSoundLevelInfos));
+  }
+
+  flutter::EncodableMap remoteAudioSpectrums;
+  for (auto &meter : remoteAudioSpectrums_) {
+    if (meter.second.updated) {
+      remoteAudioSpectrums[flutter::EncodableValue(meter.first)] = spectrumValue(meter.second);
+    }
+  }
+  if (!remoteAudioSpectrums.empty()) {
+    meters[flutter::EncodableValue("remoteAudioSpectrums")] = flutter::EncodableValue(std::move(remoteAudioSpectrums));
+  }
+
+  flutter::EncodableMap mediaPlayerSpectrums;
+  for (auto &meter : mediaPlayerSpectrums_) {
+    if (meter.second.updated) {
+      mediaPlayerSpectrums[flutter::EncodableValue(meter.first)] = spectrumValue(meter.second);
+    }
+  }
+  if (!mediaPlayerSpectrums.empty()) {
+    meters[flutter::EncodableValue("mediaPlayerFrequencySpectrums")] = flutter::EncodableValue(std::move(mediaPlayerSpectrums));
+  }
+
+  return meters;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <flutter/encodable_value.h>
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ZegoBatchTicker.h"
+
+// Merges sound level and spectrum callbacks of all streams into a single
+// "audio meters" event per tick. Between ticks the latest and the peak value
+// of every meter are kept. A tick is skipped while the previous one has not
+// been delivered yet, its values are merged into the next tick.
+class ZegoAudioMeterAggregator : public ZegoTickBatcher {
+ public:
+  using EmitCallback = std::function<void(flutter::EncodableMap &&meters)>;
+
+  ZegoAudioMeterAggregator() = default;
+  ~ZegoAudioMeterAggregator();
+
+  // Prevent copying.
+  ZegoAudioMeterAggregator(ZegoAudioMeterAggregator const&) = delete;
+  ZegoAudioMeterAggregator& operator=(ZegoAudioMeterAggregator const&) = delete;
+
+  void start(uint32_t intervalMs, ReadyCallback ready, EmitCallback emit);
+
+  // Pending values are dropped, they are stale once stopped.
+  void stop();
+
+  void updateCapturedSoundLevel(float soundLevel);
+
+  void updateCapturedSoundLevelInfo(float soundLevel, int vad);
+
+  void updateRemoteSoundLevels(const std::unordered_map<std::string, float> &soundLevels);
+
+  void updateRemoteSoundLevelInfo(const std::string &streamID, float soundLevel, int vad);
+
+  void updateCapturedAudioSpectrum(const std::vector<float> &spectrum);
+
+  void updateRemoteAudioSpectrum(const std::string &streamID, const std::vector<float> &spectrum);
+
+  void updateMediaPlayerSpectrum(int mediaPlayerIndex, const std::vector<float> &spectrum);
+
+ protected:
+  bool hasPending() override { return hasUpdates_; }
+
+  std::function<void()> takeBatch(bool isStopping) override;
+
+ private:
+  struct LevelMeter {
+    float latest = 0;
+    float peak = 0;
+    int vad = 0;
+    bool updated = false;
+
+    void update(float value);
+  };
+
+  struct SpectrumMeter {
+    std::vector<float> latest;
+    std::vector<float> peak;
+    bool updated = false;
+
+    void update(const std::vector<float> &value);
+  };
+
+  // Moves the updated meters into the event and resets them.
+  flutter::EncodableMap takeMeters();
+
+  EmitCallback emit_;
+
+  bool hasUpdates_ = false;
+  LevelMeter capturedSoundLevel_;
+  LevelMeter capturedSoundLevelInfo_;
+  std::unordered_map<std::string, LevelMeter> remoteSoundLevels_;
+  std::unordered_map<std::string, LevelMeter> remoteSoundLevelInfos_;
+  SpectrumMeter capturedAudioSpectrum_;
+  std::unordered_map<std::string, SpectrumMeter> remoteAudioSpectrums_;
+  std::unordered_map<int, SpectrumMeter> mediaPlayerSpectrums_;
+};
@@ -0,0 +1,131 @@
+#include "ZegoBatchTicker.h"
+
+#include <algorithm>
+
+void ZegoTickBatcher::startTicking(uint32_t intervalMs, ReadyCallback ready) {
+  ready_ = std::move(ready);
+  skippedTickCount_ = 0;
+  running_ = true;
+  if (!ticker_) {
+    ticker_ = ZegoBatchTicker::getInstance();
+  }
+  ticker_->add(this, std::chrono::milliseconds(intervalMs));
+}
+
+void ZegoTickBatcher::stopTicking() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_) {
+      return;
+    }
+    running_ = false;
+  }
+  ticker_->remove(this);
+
+  std::function<void()> emit;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (hasPending()) {
+      emit = takeBatch(true);
+    }
+    ready_ = nullptr;
+  }
+  if (emit) {
+    emit();
+  }
+}
+
+void ZegoTickBatcher::tick() {
+  std::function<void()> emit;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_ || !hasPending()) {
+      return;
+    }
+    if (ready_ && !ready_()) {
+      skippedTickCount_++;
+      return;
+    }
+    emit = takeBatch(false);
+  }
+  if (emit) {
+    emit();
+  }
+}
+
+std::shared_ptr<ZegoBatchTicker> ZegoBatchTicker::getInstance() {
+  static std::shared_ptr<ZegoBatchTicker> instance = std::make_shared<ZegoBatchTicker>();
+  return instance;
+}
+
+ZegoBatchTicker::~ZegoBatchTicker() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void ZegoBatchTicker::add(ZegoTickBatcher *batcher, std::chrono::milliseconds interval) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.push_back({batcher, interval, Clock::now() + interval});
+    if (!thread_.joinable()) {
+      thread_ = std::thread(&ZegoBatchTicker::run, this);
+    }
+  }
+  condition_.notify_all();
+}
+
+void ZegoBatchTicker::remove(ZegoTickBatcher *batcher) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                [batcher](const Entry &entry) { return entry.batcher == batcher; }),
+                 entries_.end());
+  condition_.notify_all();
+  if (std::this_thread::get_id() != thread_.get_id()) {
+    tickCondition_.wait(lock, [this, batcher] { return ticking_ != batcher; });
+  }
+}
+
+void ZegoBatchTicker::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stopping_) {
+    if (entries_.empty()) {
+      condition_.wait(lock, [this] { return stopping_ || !entries_.empty(); });
+      continue;
+    }
+
+    auto due = std::min_element(entries_.begin(), entries_.end(), [](const Entry &a, const Entry &b) {
+      return a.nextTick < b.nextTick;
+    });
+    auto nextTick = due->nextTick;
+    auto batcher = due->batcher;
+    // Woken early when a batcher is added or removed, due is looked up again.
+    condition_.wait_until(lock, nextTick);
+    if (stopping_ || Clock::now() < nextTick) {
+      continue;
+    }
+
+    auto now = Clock::now();
+    due = std::find_if(entries_.begin(), entries_.end(),
+                       [batcher](const Entry &entry) { return entry.batcher == batcher; });
+    if (due == entries_.end()) {
+      continue;
+    }
+    due->nextTick += due->interval;
+    if (due->nextTick < now) {
+      due->nextTick = now + due->interval;
+    }
+
+    ticking_ = batcher;
+    lock.unlock();
+    batcher->tick();
+    lock.lock();
+    ticking_ = nullptr;
+    tickCondition_.notify_all();
+  }
+}
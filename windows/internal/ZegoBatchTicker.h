@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ZegoBatchTicker;
+
+// Base of the components that collect SDK callbacks and emit them to dart
+// as one batch per tick, e.g. ZegoAudioMeterAggregator. The base runs the
+// ticks on the shared ZegoBatchTicker, skips a tick while the previous
+// batch has not been delivered yet, and emits what is pending as a last
+// batch on stop. A component only supplies its merge policy: what it keeps
+// between ticks, hasPending and takeBatch.
+class ZegoTickBatcher {
+ public:
+  // Returns false while the previous batch is not delivered yet.
+  using ReadyCallback = std::function<bool()>;
+
+  virtual ~ZegoTickBatcher() = default;
+
+  // Prevent copying.
+  ZegoTickBatcher(ZegoTickBatcher const&) = delete;
+  ZegoTickBatcher& operator=(ZegoTickBatcher const&) = delete;
+
+  inline bool isRunning() { return running_; }
+
+  uint64_t getSkippedTickCount() { return skippedTickCount_; }
+
+ protected:
+  ZegoTickBatcher() = default;
+
+  // Called with mutex_ held, to be set up before the first tick.
+  void startTicking(uint32_t intervalMs, ReadyCallback ready);
+
+  // Waits for a running tick, then emits the pending batch regardless of
+  // ready. Components call it from their stop and destructor, as takeBatch
+  // is no longer reachable once the base destructor runs.
+  void stopTicking();
+
+  // Called with mutex_ held.
+  virtual bool hasPending() = 0;
+
+  // Called with mutex_ held and only if hasPending. Moves the pending
+  // items out and returns the emit to run once mutex_ is released, or
+  // nullptr to emit nothing. isStopping is set for the last batch.
+  virtual std::function<void()> takeBatch(bool isStopping) = 0;
+
+  std::mutex mutex_;
+
+ private:
+  friend class ZegoBatchTicker;
+
+  // Called on the ticker thread.
+  void tick();
+
+  std::atomic_bool running_ = false;
+  ReadyCallback ready_;
+  std::shared_ptr<ZegoBatchTicker> ticker_;
+  std::atomic<uint64_t> skippedTickCount_ = 0;
+};
+
+// Single timer thread that runs the ticks of every started ZegoTickBatcher,
+// each at its own interval.
+class ZegoBatchTicker {
+ public:
+  // Batchers keep the ticker alive until they are destroyed.
+  static std::shared_ptr<ZegoBatchTicker> getInstance();
+
+  ZegoBatchTicker() = default;
+  ~ZegoBatchTicker();
+
+  // Prevent copying.
+  ZegoBatchTicker(ZegoBatchTicker const&) = delete;
+  ZegoBatchTicker& operator=(ZegoBatchTicker const&) = delete;
+
+  void add(ZegoTickBatcher *batcher, std::chrono::milliseconds interval);
+
+  // Returns once a tick of batcher that is running has returned, unless
+  // called from that tick.
+  void remove(ZegoTickBatcher *batcher);
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry {
+    ZegoTickBatcher *batcher;
+    std::chrono::milliseconds interval;
+    Clock::time_point nextTick;
+  };
+
+  void run();
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::condition_variable tickCondition_;
+  std::vector<Entry> entries_;
+  // Batcher whose tick runs with mutex_ released.
+  ZegoTickBatcher *ticking_ = nullptr;
+  std::thread thread_;
+  bool stopping_ = false;
+};
@@ -0,0 +1,187 @@
+#include "ZegoCompactEventCodec.h"
+
+#include <algorithm>
+
+using namespace ZEGO::EXPRESS;
+
+// Size of the fixed part of the header.
+static const size_t kHeaderSize = 8;
+
+void ZegoCompactEventCodec::reset() {
+    streamIndexes_.clear();
+    epoch_++;
+}
+
+std::string ZegoCompactEventCodec::latestKey(ZegoCompactEventType type,
+                                             std::vector<std::string> streamIDs) {
+    // The order of the SDK maps is not stable.
+    std::sort(streamIDs.begin(), streamIDs.end());
+    std::string key = "compact=" + std::to_string((int)type);
+    for (auto const &streamID : streamIDs) {
+        key += "\n";
+        key += streamID;
+    }
+    return key;
+}
+
+ZegoCompactEventCodec::Writer ZegoCompactEventCodec::beginPacket(
+    ZegoCompactEventType type, const std::vector<const std::string *> &streamIDs,
+    std::vector<uint16_t> &indexes, size_t recordSize) {
+    if (streamIndexes_.size() + streamIDs.size() > UINT16_MAX) {
+        reset();
+    }
+
+    std::vector<const std::string *> newStreamIDs;
+    indexes.clear();
+    indexes.reserve(streamIDs.size());
+    for (auto streamID : streamIDs) {
+        auto result = streamIndexes_.emplace(*streamID, (uint16_t)streamIndexes_.size());
+        if (result.second) {
+            newStreamIDs.push_back(streamID);
+        }
+        indexes.push_back(result.first->second);
+    }
+
+    size_t stringsSize = 0;
+    for (auto streamID : newStreamIDs) {
+        stringsSize += 4 + streamID->size();
+    }
+
+    Writer writer(kHeaderSize + stringsSize + recordSize);
+    writer.u8(kVersion);
+    writer.u8((uint8_t)type);
+    writer.u16(epoch_);
+    writer.u16((uint16_t)newStreamIDs.size());
+    for (auto streamID : newStreamIDs) {
+        writer.u16(streamIndexes_[*streamID]);
+        writer.u16((uint16_t)streamID->size());
+        writer.bytes(*streamID);
+    }
+    return writer;
+}
+
+std::vector<uint8_t> ZegoCompactEventCodec::encodePublisherQuality(const std::string &streamID,
+                                                                   const ZegoPublishStreamQuality &quality) {
+    std::vector<uint16_t> indexes;
+    auto writer = beginPacket(ZEGO_COMPACT_EVENT_TYPE_PUBLISHER_QUALITY, {&streamID}, indexes, 2 + 103);
+    writer.u16(1);
+
+    writer.u16(indexes[0]);
+    writer.f64((double)quality.videoCaptureFPS);
+    writer.f64((double)quality.videoEncodeFPS);
+    writer.f64((double)quality.videoSendFPS);
+    writer.f64((double)quality.videoKBPS);
+    writer.f64((double)quality.audioCaptureFPS);
+    writer.f64((double)quality.audioSendFPS);
+    writer.f64((double)quality.audioKBPS);
+    writer.i32((int32_t)quality.rtt);
+    writer.f64((double)quality.packetLostRate);
+    writer.i32((int32_t)quality.level);
+    writer.u8(quality.isHardwareEncode ? 1 : 0);
+    writer.i32((int32_t)quality.videoCodecID);
+    writer.f64((double)quality.totalSendBytes);
+    writer.f64((double)quality.audioSendBytes);
+    writer.f64((double)quality.videoSendBytes);
+    return std::move(writer.buffer());
+}
+
+std::vector<uint8_t> ZegoCompactEventCodec::encodePlayerQuality(const std::string &streamID,
+                                                                const ZegoPlayStreamQuality &quality) {
+    std::vector<uint16_t> indexes;
+    auto writer = beginPacket(ZEGO_COMPACT_EVENT_TYPE_PLAYER_QUALITY, {&streamID}, indexes, 2 + 171);
+    writer.u16(1);
+
+    writer.u16(indexes[0]);
+    writer.f64((double)quality.videoRecvFPS);
+    writer.f64((double)quality.videoDejitterFPS);
+    writer.f64((double)quality.videoDecodeFPS);
+    writer.f64((double)quality.videoRenderFPS);
+    writer.f64((double)quality.videoKBPS);
+    writer.f64((double)quality.videoBreakRate);
+    writer.f64((double)quality.audioRecvFPS);
+    writer.f64((double)quality.audioDejitterFPS);
+    writer.f64((double)quality.audioDecodeFPS);
+    writer.f64((double)quality.audioRenderFPS);
+    writer.f64((double)quality.audioKBPS);
+    writer.f64((double)quality.audioBreakRate);
+    writer.f64((double)quality.mos);
+    writer.i32((int32_t)quality.rtt);
+    writer.f64((double)quality.packetLostRate);
+    writer.i32((int32_t)quality.peerToPeerDelay);
+    writer.f64((double)quality.peerToPeerPacketLostRate);
+    writer.i32((int32_t)quality.level);
+    writer.i32((int32_t)quality.delay);
+    writer.i32((int32_t)quality.avTimestampDiff);
+    writer.u8(quality.isHardwareDecode ? 1 : 0);
+    writer.i32((int32_t)quality.videoCodecID);
+    writer.f64((double)quality.totalRecvBytes);
+    writer.f64((double)quality.audioRecvBytes);
+    writer.f64((double)quality.videoRecvBytes);
+    return std::move(writer.buffer());
+}
+
+std::vector<uint8_t> ZegoCompactEventCodec::encodeCapturedSoundLevelInfo(const ZegoSoundLevelInfo &soundLevelInfo) {
+    std::vector<uint16_t> indexes;
+    auto writer = beginPacket(ZEGO_COMPACT_EVENT_TYPE_CAPTURED_SOUND_LEVEL_INFO, {}, indexes, 2 + 8);
+    writer.u16(1);
+
+    writer.f32((float)soundLevelInfo.soundLevel);
+    writer.i32((int32_t)soundLevelInfo.vad);
+    return std::move(writer.buffer());
+}
+
+std::vector<uint8_t> ZegoCompactEventCodec::encodeRemoteSoundLevelInfos(
+    const std::unordered_map<std::string, ZegoSoundLevelInfo> &soundLevelInfos) {
+    std::vector<const std::string *> streamIDs;
+    streamIDs.reserve(soundLevelInfos.size());
+    for (auto const& soundLevelInfo : soundLevelInfos) {
+        streamIDs.push_back(&soundLevelInfo.first);
+    }
+
+    std::vector<uint16_t> indexes;
+    auto writer = beginPacket(ZEGO_COMPACT_EVENT_TYPE_REMOTE_SOUND_LEVEL_INFO, streamIDs, indexes,
+                              2 + soundLevelInfos.size() * 10);
+    writer.u16((uint16_t)soundLevelInfos.size());
+
+    size_t i = 0;
+    for (auto const& soundLevelInfo : soundLevelInfos) {
+        writer.u16(indexes[i++]);
+        writer.f32((float)soundLevelInfo.second.soundLevel);
+        writer.i32((int32_t)soundLevelInfo.second.vad);
+    }
+    return std::move(writer.buffer());
+}
+
+std::vector<uint8_t> ZegoCompactEventCodec::encodeCapturedAudioSpectrum(const ZegoAudioSpectrum &audioSpectrum) {
+    std::vector<uint16_t> indexes;
+    auto writer = beginPacket(ZEGO_COMPACT_EVENT_TYPE_CAPTURED_AUDIO_SPECTRUM, {}, indexes,
+                              2 + 2 + audioSpectrum.size() * 4);
+    writer.u16(1);
+
+    writer.u16((uint16_t)audioSpectrum.size());
+    writer.raw(audioSpectrum.data(), audioSpectrum.size() * sizeof(float));
+    return std::move(writer.buffer());
+}
+
+std::vector<uint8_t> ZegoCompactEventCodec::encodeRemoteAudioSpectrums(
+    const std::unordered_map<std::string, ZegoAudioSpectrum> &audioSpectrums) {
+    std::vector<const std::string *> streamIDs;
+    streamIDs.reserve(audioSpectrums.size());
+    size_t recordSize = 2;
+    for (auto const& audioSpectrum : audioSpectrums) {
+        streamIDs.push_back(&audioSpectrum.first);
+        recordSize += 4 + audioSpectrum.second.size() * 4;
+    }
+
+    std::vector<uint16_t> indexes;
+    auto writer = beginPacket(ZEGO_COMPACT_EVENT_TYPE_REMOTE_AUDIO_SPECTRUM, streamIDs, indexes, recordSize);
+    writer.u16((uint16_t)audioSpectrums.size());
+
+    size_t i = 0;
+    for (auto const& audioSpectrum : audioSpectrums) {
+        writer.u16(indexes[i++]);
+        writer.u16((uint16_t)audioSpectrum.second.size());
+        writer.raw(audioSpectrum.second.data(), audioSpectrum.second.size() * sizeof(float));
+    }
+    return std::move(writer.buffer());
+}
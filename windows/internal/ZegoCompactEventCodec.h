@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ZegoExpressSDK.h>
+
+enum ZegoCompactEventType {
+    ZEGO_COMPACT_EVENT_TYPE_PUBLISHER_QUALITY = 1,
+    ZEGO_COMPACT_EVENT_TYPE_PLAYER_QUALITY = 2,
+    ZEGO_COMPACT_EVENT_TYPE_CAPTURED_SOUND_LEVEL_INFO = 3,
+    ZEGO_COMPACT_EVENT_TYPE_REMOTE_SOUND_LEVEL_INFO = 4,
+    ZEGO_COMPACT_EVENT_TYPE_CAPTURED_AUDIO_SPECTRUM = 5,
+    ZEGO_COMPACT_EVENT_TYPE_REMOTE_AUDIO_SPECTRUM = 6
+};
+
+// Packs high frequency events into a single byte buffer instead of nested
+// EncodableMaps, decoded on the dart side with ByteData views.
+//
+// All values are little endian. Every packet starts with the header
+//
+//   u8 version | u8 type | u16 epoch | u16 stringCount
+//   stringCount x (u16 index | u16 byteLength | utf8 bytes)
+//   u16 recordCount
+//
+// followed by recordCount records of the event type, fields in the order of
+// the corresponding struct:
+//
+//   PUBLISHER_QUALITY  u16 stream | 7 x f64 | i32 rtt | f64 packetLostRate |
+//                      i32 level | u8 isHardwareEncode | i32 videoCodecID |
+//                      3 x f64
+//   PLAYER_QUALITY     u16 stream | 13 x f64 | i32 rtt | f64 packetLostRate |
+//                      i32 peerToPeerDelay | f64 peerToPeerPacketLostRate |
+//                      i32 level | i32 delay | i32 avTimestampDiff |
+//                      u8 isHardwareDecode | i32 videoCodecID | 3 x f64
+//   *_SOUND_LEVEL_INFO [u16 stream] | f32 soundLevel | i32 vad
+//   *_AUDIO_SPECTRUM   [u16 stream] | u16 count | count x f32
+//
+// Stream IDs are interned to indexes, a packet carries the strings of the
+// indexes it uses for the first time. The epoch changes whenever the table
+// is reset, which tells the decoder to drop its table too and to skip the
+// packets of older epochs that arrive later.
+//
+// Not thread safe. Packets may be replaced or dropped on the way to dart
+// only if the table is reset right after, so the strings they carried are
+// sent again.
+class ZegoCompactEventCodec {
+public:
+    static const uint8_t kVersion = 1;
+
+    void reset();
+
+    // Key of the packets that replace each other on the latest event lane,
+    // the packets of a type that carry the same set of streams.
+    static std::string latestKey(ZegoCompactEventType type, std::vector<std::string> streamIDs);
+
+    std::vector<uint8_t> encodePublisherQuality(const std::string &streamID,
+                                                const ZEGO::EXPRESS::ZegoPublishStreamQuality &quality);
+
+    std::vector<uint8_t> encodePlayerQuality(const std::string &streamID,
+                                             const ZEGO::EXPRESS::ZegoPlayStreamQuality &quality);
+
+    std::vector<uint8_t> encodeCapturedSoundLevelInfo(const ZEGO::EXPRESS::ZegoSoundLevelInfo &soundLevelInfo);
+
+    std::vector<uint8_t> encodeRemoteSoundLevelInfos(
+        const std::unordered_map<std::string, ZEGO::EXPRESS::ZegoSoundLevelInfo> &soundLevelInfos);
+
+    std::vector<uint8_t> encodeCapturedAudioSpectrum(const ZEGO::EXPRESS::ZegoAudioSpectrum &audioSpectrum);
+
+    std::vector<uint8_t> encodeRemoteAudioSpectrums(
+        const std::unordered_map<std::string, ZEGO::EXPRESS::ZegoAudioSpectrum> &audioSpectrums);
+
+private:
+    class Writer {
+    public:
+        explicit Writer(size_t reserve) { buffer_.reserve(reserve); }
+
+        void u8(uint8_t value) { buffer_.push_back(value); }
+        void u16(uint16_t value) { raw(&value, sizeof(value)); }
+        void i32(int32_t value) { raw(&value, sizeof(value)); }
+        void f32(float value) { raw(&value, sizeof(value)); }
+        void f64(double value) { raw(&value, sizeof(value)); }
+        void bytes(const std::string &value) { raw(value.data(), value.size()); }
+
+        // Windows targets are little endian, values are copied as is.
+        void raw(const void *data, size_t size) {
+            auto bytes = static_cast<const uint8_t *>(data);
+            buffer_.insert(buffer_.end(), bytes, bytes + size);
+        }
+
+        std::vector<uint8_t> &buffer() { return buffer_; }
+
+    private:
+        std::vector<uint8_t> buffer_;
+    };
+
+    // Interns the stream IDs and writes the packet header including the
+    // strings that are new to the decoder.
+    Writer beginPacket(ZegoCompactEventType type, const std::vector<const std::string *> &streamIDs,
+                       std::vector<uint16_t> &indexes, size_t recordSize);
+
+    uint16_t epoch_ = 0;
+    std::unordered_map<std::string, uint16_t> streamIndexes_;
+};
@@ -0,0 +1,102 @@
+#include "ZegoCustomAudioRenderRing.h"
+
+#include <cstring>
+#include <new>
+
+ZegoCustomAudioRenderRing::ZegoCustomAudioRenderRing(uint32_t sampleRate, uint32_t channels,
+                                                     uint32_t intervalMs, uint32_t capacityMs,
+                                                     FetchCallback fetch)
+    : interval_(intervalMs > 0 ? intervalMs : 10), fetch_(std::move(fetch)) {
+  chunkFrames_ = (uint32_t)(sampleRate * interval_.count() / 1000);
+  chunkFrames_ = chunkFrames_ > 0 ? chunkFrames_ : 1;
+  auto chunkCount = capacityMs / (uint32_t)interval_.count();
+  chunkCount = chunkCount > 2 ? chunkCount : 2;
+  auto frameSize = (channels > 0 ? channels : 1) * (uint32_t)sizeof(int16_t);
+  auto capacityFrames = chunkFrames_ * chunkCount;
+
+  void *memory = ::operator new(sizeof(Header) + (size_t)capacityFrames * frameSize,
+                                std::align_val_t(alignof(Header)));
+  header_ = new (memory) Header();
+  header_->version = kVersion;
+  header_->headerSize = sizeof(Header);
+  header_->capacityFrames = capacityFrames;
+  header_->frameSize = frameSize;
+  header_->chunkFrames = chunkFrames_;
+  buffer_ = static_cast<uint8_t *>(memory) + sizeof(Header);
+  memset(buffer_, 0, (size_t)capacityFrames * frameSize);
+}
+
+ZegoCustomAudioRenderRing::~ZegoCustomAudioRenderRing() {
+  stopTimer();
+  header_->~Header();
+  ::operator delete(header_, std::align_val_t(alignof(Header)));
+}
+
+void ZegoCustomAudioRenderRing::startTimer() {
+  std::lock_guard<std::mutex> lock(timerMutex_);
+  if (timerRunning_) {
+    return;
+  }
+  timerRunning_ = true;
+  timerThread_ = std::thread(&ZegoCustomAudioRenderRing::runTimer, this);
+}
+
+void ZegoCustomAudioRenderRing::stopTimer() {
+  {
+    std::lock_guard<std::mutex> lock(timerMutex_);
+    timerRunning_ = false;
+  }
+  timerCondition_.notify_all();
+  if (timerThread_.joinable()) {
+    timerThread_.join();
+  }
+}
+
+uint32_t ZegoCustomAudioRenderRing::fetch(uint32_t chunkCount) {
+  std::lock_guard<std::mutex> lock(fetchMutex_);
+  uint32_t fetched = 0;
+  while (fetched < chunkCount && fetchChunk()) {
+    fetched++;
+  }
+  return fetched;
+}
+
+bool ZegoCustomAudioRenderRing::fetchChunk() {
+  auto writeFrame = header_->writeFrame.load(std::memory_order_relaxed);
+  auto readFrame = header_->readFrame.load(std::memory_order_acquire);
+  if (writeFrame - readFrame + chunkFrames_ > header_->capacityFrames) {
+    header_->skippedFetchCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  auto offset = (size_t)(writeFrame % header_->capacityFrames) * header_->frameSize;
+  if (!fetch_(buffer_ + offset, chunkFrames_ * header_->frameSize)) {
+    header_->failedFetchCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  header_->fetchCount.fetch_add(1, std::memory_order_relaxed);
+  header_->writeFrame.store(writeFrame + chunkFrames_, std::memory_order_release);
+  return true;
+}
+
+void ZegoCustomAudioRenderRing::runTimer() {
+  auto nextTick = std::chrono::steady_clock::now() + interval_;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(timerMutex_);
+      if (timerCondition_.wait_until(lock, nextTick, [this] { return !timerRunning_; })) {
+        break;
+      }
+    }
+    fetch(1);
+
+    // Ticks missed by a stalled thread are caught up while the ring has room,
+    // long stalls start over rather than fetching in a burst.
+    nextTick += interval_;
+    auto now = std::chrono::steady_clock::now();
+    if (now - nextTick > interval_ * 4) {
+      nextTick = now + interval_;
+    }
+  }
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Single-producer/single-consumer ring of custom audio render PCM in native
+// memory that dart reads in place through ffi. Chunks of `intervalMs` are
+// fetched from the SDK straight into the ring, on a timer at the render
+// cadence or when dart asks for them, dart reads and advances `readFrame`.
+//
+// Memory layout, all cursors are sample frames since creation:
+//   0    u32 version | u32 headerSize | u32 capacityFrames | u32 frameSize
+//   16   u32 chunkFrames
+//   64   u64 writeFrame | u64 fetchCount | u64 skippedFetchCount | u64 failedFetchCount
+//   128  u64 readFrame | u64 underrunCount | u64 underrunFrames
+//   headerSize  capacityFrames * frameSize bytes of interleaved 16 bit PCM
+//
+// The capacity is a multiple of the chunk, so chunks never wrap around the
+// end of the ring.
+//
+// Dart loads writeFrame with acquire and stores readFrame with release.
+class ZegoCustomAudioRenderRing {
+ public:
+  static constexpr uint32_t kVersion = 1;
+
+  // Fills `dataLength` bytes of PCM, returns false if nothing was fetched.
+  using FetchCallback = std::function<bool(uint8_t *data, uint32_t dataLength)>;
+
+  ZegoCustomAudioRenderRing(uint32_t sampleRate, uint32_t channels, uint32_t intervalMs,
+                            uint32_t capacityMs, FetchCallback fetch);
+  ~ZegoCustomAudioRenderRing();
+
+  // Prevent copying.
+  ZegoCustomAudioRenderRing(ZegoCustomAudioRenderRing const&) = delete;
+  ZegoCustomAudioRenderRing& operator=(ZegoCustomAudioRenderRing const&) = delete;
+
+  // Fetches a chunk every `intervalMs` until stopped.
+  void startTimer();
+
+  void stopTimer();
+
+  // Fetches up to `chunkCount` chunks now, stops early when the ring is
+  // full. Returns the number of chunks fetched.
+  uint32_t fetch(uint32_t chunkCount);
+
+  // Address of the header, handed to dart.
+  int64_t getAddress() const { return reinterpret_cast<int64_t>(header_); }
+
+ private:
+  struct Header {
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t capacityFrames;
+    uint32_t frameSize;
+    uint32_t chunkFrames;
+
+    alignas(64) std::atomic<uint64_t> writeFrame;
+    std::atomic<uint64_t> fetchCount;
+    // Ticks that found the ring full, the SDK keeps the audio meanwhile.
+    std::atomic<uint64_t> skippedFetchCount;
+    std::atomic<uint64_t> failedFetchCount;
+
+    alignas(64) std::atomic<uint64_t> readFrame;
+    // Written by dart when it reads fewer frames than it asked for.
+    std::atomic<uint64_t> underrunCount;
+    std::atomic<uint64_t> underrunFrames;
+  };
+
+  // Called with fetchMutex_ held.
+  bool fetchChunk();
+
+  void runTimer();
+
+  uint32_t chunkFrames_ = 0;
+  std::chrono::milliseconds interval_;
+  FetchCallback fetch_;
+  Header *header_ = nullptr;
+  uint8_t *buffer_ = nullptr;
+
+  // Serializes the timer and dart, the ring has a single producer.
+  std::mutex fetchMutex_;
+
+  std::mutex timerMutex_;
+  std::condition_variable timerCondition_;
+  std::thread timerThread_;
+  bool timerRunning_ = false;
+};
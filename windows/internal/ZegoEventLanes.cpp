@@ -0,0 +1,68 @@
+#include "ZegoEventLanes.h"
+
+#include <unordered_map>
+
+ZegoEventLane ZegoEventLanes::laneOf(const std::string &method) {
+    static const std::unordered_map<std::string, ZegoEventLane> lanes = {
+        {"onPublisherQualityUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onPlayerQualityUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onNetworkQuality", ZEGO_EVENT_LANE_LATEST},
+        {"onCapturedSoundLevelUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onCapturedSoundLevelInfoUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onRemoteSoundLevelUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onRemoteSoundLevelInfoUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onCapturedAudioSpectrumUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onRemoteAudioSpectrumUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onMediaPlayerSoundLevelUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onMediaPlayerFrequencySpectrumUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onMediaPlayerPlayingProgress", ZEGO_EVENT_LANE_LATEST},
+        {"onMediaPlayerRenderingProgress", ZEGO_EVENT_LANE_LATEST},
+        {"onMixerSoundLevelUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onAutoMixerSoundLevelUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onCurrentPitchValueUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onPerformanceStatusUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onRoomOnlineUserCountUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onNetworkSpeedTestQualityUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onDownloadProgressUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onCapturedDataRecordProgressUpdate", ZEGO_EVENT_LANE_LATEST},
+        {"onCapturedAudioData", ZEGO_EVENT_LANE_BOUNDED},
+        {"onPlaybackAudioData", ZEGO_EVENT_LANE_BOUNDED},
+        {"onMixedAudioData", ZEGO_EVENT_LANE_BOUNDED},
+        {"onPlayerAudioData", ZEGO_EVENT_LANE_BOUNDED},
+        {"onProcessCapturedAudioData", ZEGO_EVENT_LANE_BOUNDED},
+        {"onProcessCapturedAudioDataAfterUsedHeadphoneMonitor", ZEGO_EVENT_LANE_BOUNDED},
+        {"onProcessRemoteAudioData", ZEGO_EVENT_LANE_BOUNDED},
+        {"onProcessPlaybackAudioData", ZEGO_EVENT_LANE_BOUNDED},
+        {"onPlayerRecvSEI", ZEGO_EVENT_LANE_BOUNDED},
+        {"onPlayerRecvMediaSideInfo", ZEGO_EVENT_LANE_BOUNDED},
+        {"onPlayerRecvAudioSideInfo", ZEGO_EVENT_LANE_BOUNDED},
+        {"onMediaPlayerRecvSEI", ZEGO_EVENT_LANE_BOUNDED},
+        {"onReceiveRealTimeSequentialData", ZEGO_EVENT_LANE_BOUNDED},
+    };
+    auto it = lanes.find(method);
+    return it != lanes.end() ? it->second : ZEGO_EVENT_LANE_CRITICAL;
+}
+
+std::string ZegoEventLanes::latestKey(const std::string &method, const flutter::EncodableMap &event) {
+    static const char *const sourceKeys[] = {"roomID", "userID", "streamID", "mediaPlayerIndex",
+                                             "resourceID", "channel", "type"};
+    auto key = method;
+    for (auto sourceKey : sourceKeys) {
+        auto it = event.find(flutter::EncodableValue(sourceKey));
+        if (it == event.end()) {
+            continue;
+        }
+        // The field name keeps e.g. channel 1 and type 1 apart.
+        key.push_back('\n');
+        key.append(sourceKey);
+        key.push_back('=');
+        if (auto value = std::get_if<std::string>(&it->second)) {
+            key.append(*value);
+        } else if (auto index = std::get_if<int32_t>(&it->second)) {
+            key.append(std::to_string(*index));
+        } else if (auto index = std::get_if<int64_t>(&it->second)) {
+            key.append(std::to_string(*index));
+        }
+    }
+    return key;
+}
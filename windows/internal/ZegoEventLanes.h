@@ -0,0 +1,19 @@
+#pragma once
+
+#include <flutter/encodable_value.h>
+
+#include <string>
+
+#include "ZegoPlatformEventQueue.h"
+
+// Sorts the event maps posted to dart into ZegoPlatformEventQueue lanes.
+class ZegoEventLanes {
+public:
+    // Events that are not listed are critical.
+    static ZegoEventLane laneOf(const std::string &method);
+
+    // Latest lane events replace each other per method and source. The key
+    // holds every source field the event carries, so e.g. the uplink and
+    // downlink speed test results or two publish channels are kept apart.
+    static std::string latestKey(const std::string &method, const flutter::EncodableMap &event);
+};
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+
+// Every engine callback forwarded to dart by ZegoExpressEngineEventHandler,
+// in the order they are defined there.
+#define ZEGO_EVENT_METHODS(X) \
+    X(onDebugError) \
+    X(onApiCalledResult) \
+    X(onFatalError) \
+    X(onEngineStateUpdate) \
+    X(onRoomStateUpdate) \
+    X(onRoomStateChanged) \
+    X(onRoomUserUpdate) \
+    X(onRoomOnlineUserCountUpdate) \
+    X(onRoomStreamUpdate) \
+    X(onRoomRosterUpdate) \
+    X(onRoomStreamExtraInfoUpdate) \
+    X(onRoomExtraInfoUpdate) \
+    X(onPublisherStateUpdate) \
+    X(onPublisherQualityUpdate) \
+    X(onPublisherCapturedAudioFirstFrame) \
+    X(onPublisherSendAudioFirstFrame) \
+    X(onPublisherStreamEvent) \
+    X(onVideoObjectSegmentationStateChanged) \
+    X(onPublisherLowFpsWarning) \
+    X(onPublisherDummyCaptureImagePathError) \
+    X(onPlayerStateUpdate) \
+    X(onPlayerQualityUpdate) \
+    X(onPlayerMediaEvent) \
+    X(onPlayerRecvAudioFirstFrame) \
+    X(onPlayerRecvSEI) \
+    X(onPlayerRecvMediaSideInfo) \
+    X(onPlayerRecvAudioSideInfo) \
+    X(onPlayerStreamEvent) \
+    X(onPlayerRenderCameraVideoFirstFrame) \
+    X(onPlayerVideoSuperResolutionUpdate) \
+    X(onMixerRelayCDNStateUpdate) \
+    X(onMixerSoundLevelUpdate) \
+    X(onAudioDeviceStateChanged) \
+    X(onAudioDeviceVolumeChanged) \
+    X(onCapturedSoundLevelUpdate) \
+    X(onRemoteSoundLevelUpdate) \
+    X(onRemoteMicStateUpdate) \
+    X(onAudioEffectPlayStateUpdate) \
+    X(onMediaPlayerStateUpdate) \
+    X(onMediaPlayerNetworkEvent) \
+    X(onMediaPlayerPlayingProgress) \
+    X(onMediaPlayerRecvSEI) \
+    X(onMediaPlayerSoundLevelUpdate) \
+    X(onMediaPlayerFrequencySpectrumUpdate) \
+    X(onMediaPlayerFirstFrameEvent) \
+    X(onMediaPlayerRenderingProgress) \
+    X(onMediaDataPublisherFileOpen) \
+    X(onMediaDataPublisherFileClose) \
+    X(onMediaDataPublisherFileDataBegin) \
+    X(onCapturedAudioData) \
+    X(onPlaybackAudioData) \
+    X(onMixedAudioData) \
+    X(onPlayerAudioData) \
+    X(onCapturedDataRecordStateUpdate) \
+    X(onCapturedDataRecordProgressUpdate) \
+    X(onDownloadProgressUpdate) \
+    X(onCurrentPitchValueUpdate) \
+    X(onNetworkTimeSynchronized) \
+    X(onRequestDumpData) \
+    X(onStartDumpData) \
+    X(onStopDumpData) \
+    X(onUploadDumpData) \
+    X(onRoomTokenWillExpire) \
+    X(onPublisherCapturedVideoFirstFrame) \
+    X(onPublisherSendVideoFirstFrame) \
+    X(onPublisherRenderVideoFirstFrame) \
+    X(onPublisherVideoSizeChanged) \
+    X(onPublisherRelayCDNStateUpdate) \
+    X(onPublisherVideoEncoderChanged) \
+    X(onPlayerRecvVideoFirstFrame) \
+    X(onPlayerRenderVideoFirstFrame) \
+    X(onPlayerVideoSizeChanged) \
+    X(onPlayerLowFpsWarning) \
+    X(onAutoMixerSoundLevelUpdate) \
+    X(onVideoDeviceStateChanged) \
+    X(onCapturedSoundLevelInfoUpdate) \
+    X(onRemoteSoundLevelInfoUpdate) \
+    X(onCapturedAudioSpectrumUpdate) \
+    X(onRemoteAudioSpectrumUpdate) \
+    X(onLocalDeviceExceptionOccurred) \
+    X(onRemoteCameraStateUpdate) \
+    X(onRemoteSpeakerStateUpdate) \
+    X(onAudioVADStateUpdate) \
+    X(onIMRecvBroadcastMessage) \
+    X(onIMRecvBarrageMessage) \
+    X(onIMRecvCustomCommand) \
+    X(onPerformanceStatusUpdate) \
+    X(onNetworkModeChanged) \
+    X(onNetworkSpeedTestError) \
+    X(onNetworkSpeedTestQualityUpdate) \
+    X(onRecvExperimentalAPI) \
+    X(onNetworkQuality) \
+    X(onReceiveRealTimeSequentialData) \
+    X(onRangeAudioMicrophoneStateUpdate) \
+    X(onProcessCapturedAudioData) \
+    X(onProcessCapturedAudioDataAfterUsedHeadphoneMonitor) \
+    X(onProcessRemoteAudioData) \
+    X(onProcessPlaybackAudioData) \
+    X(onExceptionOccurred) \
+    X(onWindowStateChanged) \
+    X(onRectChanged) \
+    X(onAIVoiceChangerInit) \
+    X(onAIVoiceChangerUpdate) \
+    X(onAIVoiceChangerGetSpeakerList)
+
+enum class ZegoEventMethod : size_t {
+#define ZEGO_EVENT_METHOD_ENUM(name) name,
+    ZEGO_EVENT_METHODS(ZEGO_EVENT_METHOD_ENUM)
+#undef ZEGO_EVENT_METHOD_ENUM
+    Count
+};
+
+static const char *const kZegoEventMethodNames[] = {
+#define ZEGO_EVENT_METHOD_NAME(name) #name,
+    ZEGO_EVENT_METHODS(ZEGO_EVENT_METHOD_NAME)
+#undef ZEGO_EVENT_METHOD_NAME
+};
@@ -1,32 +1,406 @@
 #include "ZegoExpressEngineEventHandler.h"
 #include "../ZegoLog.h"
 #include "ZegoExpressEngineMethodHandler.h"
+#include "zego_express_engine/ZegoCustomAudioProcessManager.h"
 #include "ZegoTextureRendererController.h"
+#include "ZegoEventLanes.h"
 #include <flutter/encodable_value.h>
 #include <memory>
+#include <unordered_map>
+
+namespace {
+
+FTMap laneStatsMap(const ZegoPlatformEventQueue::LaneStats &stats) {
+    FTMap retMap;
+    retMap[FTValue("enqueuedCount")] = FTValue((int64_t)stats.enqueuedCount);
+    retMap[FTValue("deliveredCount")] = FTValue((int64_t)stats.deliveredCount);
+    retMap[FTValue("droppedCount")] = FTValue((int64_t)stats.droppedCount);
+    retMap[FTValue("replacedCount")] = FTValue((int64_t)stats.replacedCount);
+    retMap[FTValue("depth")] = FTValue((int64_t)stats.depth);
+    retMap[FTValue("maxDepth")] = FTValue((int64_t)stats.maxDepth);
+    retMap[FTValue("maxQueueDepth")] = FTValue((int64_t)stats.maxQueueDepth);
+    retMap[FTValue("totalLatencyMicroseconds")] = FTValue((int64_t)stats.totalLatencyMicroseconds);
+    retMap[FTValue("maxLatencyMicroseconds")] = FTValue((int64_t)stats.maxLatencyMicroseconds);
+    return retMap;
+}
+
+}  // namespace
 
 std::shared_ptr<ZegoExpressEngineEventHandler> ZegoExpressEngineEventHandler::m_instance = nullptr;
 
 void ZegoExpressEngineEventHandler::setEventSink(
     std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> &&eventSink) {
+    std::lock_guard<std::mutex> lock(eventSinkMutex_);
     eventSink_ = std::move(eventSink);
+    hasEventSink_ = eventSink_ != nullptr;
+}
+
+void ZegoExpressEngineEventHandler::clearEventSink() {
+    std::lock_guard<std::mutex> lock(eventSinkMutex_);
+    hasEventSink_ = false;
+    eventSink_.reset();
+}
+
+void ZegoExpressEngineEventHandler::attachPlatformWindow(HWND window, UINT message) {
+    eventQueue_.attachWindow(window, message);
+}
+
+void ZegoExpressEngineEventHandler::detachPlatformWindow() {
+    eventQueue_.detachWindow();
+    // Deliver whatever is still queued before falling back to direct delivery.
+    eventQueue_.drain();
+}
+
+void ZegoExpressEngineEventHandler::drainEvents() { eventQueue_.drain(); }
+
+ZegoPlatformEventQueue::Stats ZegoExpressEngineEventHandler::getEventQueueStats() {
+    return eventQueue_.getStats();
+}
+
+void ZegoExpressEngineEventHandler::setEventLaneMaxDepth(ZegoEventLane lane, uint32_t maxDepth) {
+    ZF::logInfo("[setEventLaneMaxDepth] lane: %d, maxDepth: %d", lane, maxDepth);
+    eventQueue_.setLaneMaxDepth(lane, maxDepth);
+}
+
+FTMap ZegoExpressEngineEventHandler::getEventLaneStats() {
+    FTMap retMap;
+    retMap[FTValue("critical")] = FTValue(laneStatsMap(eventQueue_.getLaneStats(ZEGO_EVENT_LANE_CRITICAL)));
+    retMap[FTValue("latest")] = FTValue(laneStatsMap(eventQueue_.getLaneStats(ZEGO_EVENT_LANE_LATEST)));
+    retMap[FTValue("bounded")] = FTValue(laneStatsMap(eventQueue_.getLaneStats(ZEGO_EVENT_LANE_BOUNDED)));
+    return retMap;
+}
+
+void ZegoExpressEngineEventHandler::enableCompactEvents(bool enable) {
+    std::lock_guard<std::mutex> lock(compactCodecMutex_);
+    if (enable && !isCompactEventEnabled_) {
+        compactCodec_.reset();
+    }
+    isCompactEventEnabled_ = enable;
+}
+
+void ZegoExpressEngineEventHandler::enableAudioMeterCoalescing(bool enable, uint32_t intervalMs) {
+    ZF::logInfo("[enableAudioMeterCoalescing] enable: %d, intervalMs: %d", enable, intervalMs);
+
+    audioMeterAggregator_.stop();
+    if (!enable) {
+        return;
+    }
+
+    audioMetersPosition_ = 0;
+    audioMeterAggregator_.start(
+        intervalMs,
+        [this]() { return eventQueue_.isDelivered(audioMetersPosition_); },
+        [this](FTMap &&meters) {
+            meters[FTValue("method")] = FTValue("onAudioMetersUpdate");
+            uint64_t position = 0;
+            if (eventQueue_.push(FTValue(std::move(meters)), &position)) {
+                audioMetersPosition_ = position;
+            }
+        });
+}
+
+void ZegoExpressEngineEventHandler::enableIMMessageBuffer(bool enable,
+                                                          const ZegoIMMessageBuffer::Config &config) {
+    ZF::logInfo("[enableIMMessageBuffer] enable: %d, intervalMs: %d, maxBatchSize: %d, maxBacklog: %d, senderRateLimit: %d",
+                enable, config.intervalMs, config.maxBatchSize, config.maxBacklog, config.senderRateLimit);
+
+    imMessageBuffer_.stop();
+    if (!enable) {
+        return;
+    }
+
+    imMessageBatchPosition_ = 0;
+    imMessageBuffer_.start(
+        config,
+        [this]() { return eventQueue_.isDelivered(imMessageBatchPosition_); },
+        [this](FTArray &&messageList) {
+            FTMap retMap;
+            retMap[FTValue("method")] = FTValue("onIMMessageBatch");
+            retMap[FTValue("messageList")] = FTValue(std::move(messageList));
+            uint64_t position = 0;
+            if (eventQueue_.push(FTValue(std::move(retMap)), &position)) {
+                imMessageBatchPosition_ = position;
+            }
+        });
+}
+
+FTMap ZegoExpressEngineEventHandler::getIMMessageBufferStats() {
+    auto stats = imMessageBuffer_.getStats();
+
+    FTMap retMap;
+    retMap[FTValue("receivedCount")] = FTValue((int64_t)stats.receivedCount);
+    retMap[FTValue("deliveredCount")] = FTValue((int64_t)stats.deliveredCount);
+    retMap[FTValue("batchCount")] = FTValue((int64_t)stats.batchCount);
+    retMap[FTValue("duplicateCount")] = FTValue((int64_t)stats.duplicateCount);
+    retMap[FTValue("rateLimitedCount")] = FTValue((int64_t)stats.rateLimitedCount);
+    retMap[FTValue("overflowCount")] = FTValue((int64_t)stats.overflowCount);
+    retMap[FTValue("backlogSize")] = FTValue((int32_t)stats.backlogSize);
+    retMap[FTValue("maxBacklogSize")] = FTValue((int32_t)stats.maxBacklogSize);
+    return retMap;
+}
+
+void ZegoExpressEngineEventHandler::enableRealTimeSequentialDataBatching(bool enable,
+                                                                         uint32_t intervalMs,
+                                                                         uint32_t maxPendingBytes) {
+    ZF::logInfo("[enableRealTimeSequentialDataBatching] enable: %d, intervalMs: %d, maxPendingBytes: %d",
+                enable, intervalMs, maxPendingBytes);
+
+    realTimeSequentialDataBatcher_.stop();
+    if (!enable) {
+        return;
+    }
+
+    realTimeSequentialDataBatchPosition_ = 0;
+    realTimeSequentialDataBatcher_.start(
+        intervalMs, maxPendingBytes,
+        [this]() { return eventQueue_.isDelivered(realTimeSequentialDataBatchPosition_); },
+        [this](int managerIndex, FTMap &&batch) {
+            batch[FTValue("method")] = FTValue("onReceiveRealTimeSequentialDataBatch");
+            batch[FTValue("realTimeSequentialDataManagerIndex")] = FTValue(managerIndex);
+            uint64_t position = 0;
+            if (eventQueue_.push(FTValue(std::move(batch)), &position)) {
+                realTimeSequentialDataBatchPosition_ = position;
+            }
+        });
+}
+
+FTMap ZegoExpressEngineEventHandler::getRealTimeSequentialDataStats() {
+    auto stats = realTimeSequentialDataBatcher_.getStats();
+
+    FTMap retMap;
+    retMap[FTValue("receivedCount")] = FTValue((int64_t)stats.receivedCount);
+    retMap[FTValue("deliveredCount")] = FTValue((int64_t)stats.deliveredCount);
+    retMap[FTValue("droppedCount")] = FTValue((int64_t)stats.droppedCount);
+    retMap[FTValue("batchCount")] = FTValue((int64_t)stats.batchCount);
+    retMap[FTValue("depth")] = FTValue((int32_t)stats.depth);
+    retMap[FTValue("maxDepth")] = FTValue((int32_t)stats.maxDepth);
+    retMap[FTValue("totalLatencyMicroseconds")] = FTValue((int64_t)stats.totalLatencyMicroseconds);
+    retMap[FTValue("maxLatencyMicroseconds")] = FTValue((int64_t)stats.maxLatencyMicroseconds);
+    return retMap;
+}
+
+void ZegoExpressEngineEventHandler::enableSEIBatching(bool enable, const ZegoSEIBatcher::Config &config) {
+    ZF::logInfo("[enableSEIBatching] enable: %d, intervalMs: %d, maxUnitsPerStream: %d, latestOnly: %d",
+                enable, config.intervalMs, config.maxUnitsPerStream, config.latestOnly);
+
+    seiBatcher_.stop();
+    if (!enable) {
+        return;
+    }
+
+    seiBatchPosition_ = 0;
+    seiBatcher_.start(
+        config,
+        [this]() { return eventQueue_.isDelivered(seiBatchPosition_); },
+        [this](FTMap &&batch) {
+            batch[FTValue("method")] = FTValue("onSEIBatch");
+            uint64_t position = 0;
+            if (eventQueue_.push(FTValue(std::move(batch)), &position)) {
+                seiBatchPosition_ = position;
+            }
+        });
+}
+
+FTMap ZegoExpressEngineEventHandler::getSEIBatchStats() {
+    auto stats = seiBatcher_.getStats();
+
+    FTMap retMap;
+    retMap[FTValue("receivedCount")] = FTValue((int64_t)stats.receivedCount);
+    retMap[FTValue("deliveredCount")] = FTValue((int64_t)stats.deliveredCount);
+    retMap[FTValue("droppedCount")] = FTValue((int64_t)stats.droppedCount);
+    retMap[FTValue("replacedCount")] = FTValue((int64_t)stats.replacedCount);
+    retMap[FTValue("batchCount")] = FTValue((int64_t)stats.batchCount);
+    return retMap;
+}
+
+void ZegoExpressEngineEventHandler::postRealTimeSequentialDataSent(int64_t sequence,
+                                                                   int32_t errorCode) {
+    if (!hasEventSink()) {
+        return;
+    }
+    FTMap retMap;
+    retMap[FTValue("method")] = FTValue("onRealTimeSequentialDataSent");
+    retMap[FTValue("sequence")] = FTValue(sequence);
+    retMap[FTValue("errorCode")] = FTValue(errorCode);
+    postEvent(std::move(retMap));
+}
+
+void ZegoExpressEngineEventHandler::setUnsubscribedEvents(const std::vector<std::string> &methods) {
+    ZF::logInfo("[setUnsubscribedEvents] count: %d", (int)methods.size());
+
+    uint64_t mask[kEventMaskWordCount] = {};
+    for (auto const &method : methods) {
+        for (size_t i = 0; i < static_cast<size_t>(ZegoEventMethod::Count); i++) {
+            if (method == kZegoEventMethodNames[i]) {
+                mask[i / 64] |= 1ULL << (i % 64);
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < kEventMaskWordCount; i++) {
+        unsubscribedMask_[i].store(mask[i], std::memory_order_relaxed);
+    }
+}
+
+FTMap ZegoExpressEngineEventHandler::getSuppressedEventCounts() {
+    FTMap countsMap;
+    for (size_t i = 0; i < static_cast<size_t>(ZegoEventMethod::Count); i++) {
+        auto count = suppressedCounts_[i].load(std::memory_order_relaxed);
+        if (count > 0) {
+            countsMap[FTValue(kZegoEventMethodNames[i])] = FTValue((int64_t)count);
+        }
+    }
+    return countsMap;
+}
+
+int64_t ZegoExpressEngineEventHandler::createAudioDataRing(int32_t source,
+                                                           const std::string &streamID,
+                                                           uint32_t capacity, bool notify) {
+    ZF::logInfo("[createAudioDataRing] source: %d, streamID: %s, capacity: %d, notify: %d",
+                source, streamID.c_str(), capacity, notify);
+
+    return audioDataRings_.create(source, streamID, capacity, notify);
 }
 
-void ZegoExpressEngineEventHandler::clearEventSink() { eventSink_.reset(); }
+bool ZegoExpressEngineEventHandler::destroyAudioDataRing(int32_t source,
+                                                        const std::string &streamID) {
+    ZF::logInfo("[destroyAudioDataRing] source: %d, streamID: %s", source, streamID.c_str());
+
+    return audioDataRings_.destroy(source, streamID);
+}
+
+bool ZegoExpressEngineEventHandler::writeAudioDataRing(int32_t source, const std::string &streamID,
+                                                      const unsigned char *data,
+                                                      unsigned int dataLength,
+                                                      EXPRESS::ZegoAudioFrameParam param) {
+    int64_t notifyAddress = 0;
+    if (!audioDataRings_.write(source, streamID, data, dataLength, (uint32_t)param.sampleRate,
+                               (uint32_t)param.channel, notifyAddress)) {
+        return false;
+    }
+
+    if (notifyAddress != 0 && hasEventSink()) {
+        FTMap retMap;
+        retMap[FTValue("method")] = FTValue("onAudioDataRingAvailable");
+        retMap[FTValue("address")] = FTValue(notifyAddress);
+        postEvent(std::move(retMap));
+    }
+    return true;
+}
+
+FTMap ZegoExpressEngineEventHandler::queryStreamQuality(const std::vector<std::string> &streamIDs,
+                                                       uint32_t windowSeconds) {
+    return qualityAggregator_.query(streamIDs, windowSeconds);
+}
+
+bool ZegoExpressEngineEventHandler::enableRoomRoster(bool enable) {
+    ZF::logInfo("[enableRoomRoster] enable: %d", enable);
+
+    std::lock_guard<std::mutex> lock(loggedInRoomsMutex_);
+    // The SDK only reports the users and streams already in a room once,
+    // right after the login, so a roster enabled later would miss them.
+    if (enable && !isRoomRosterEnabled_ && !loggedInRooms_.empty()) {
+        ZF::logInfo("[enableRoomRoster] rejected, logged in rooms: %d", loggedInRooms_.size());
+        return false;
+    }
+
+    isRoomRosterEnabled_ = enable;
+    if (!enable) {
+        roomRoster_.clear();
+    }
+    return true;
+}
+
+void ZegoExpressEngineEventHandler::clearLoggedInRooms() {
+    std::lock_guard<std::mutex> lock(loggedInRoomsMutex_);
+    loggedInRooms_.clear();
+    roomRoster_.clear();
+}
+
+FTMap ZegoExpressEngineEventHandler::getRoomUsers(const std::string &roomID, uint32_t offset,
+                                                 uint32_t limit, const std::string &filter) {
+    return roomRoster_.getUsers(roomID, offset, limit, filter);
+}
+
+FTMap ZegoExpressEngineEventHandler::getRoomStreams(const std::string &roomID, uint32_t offset,
+                                                   uint32_t limit, const std::string &filter) {
+    return roomRoster_.getStreams(roomID, offset, limit, filter);
+}
+
+void ZegoExpressEngineEventHandler::postRoomRosterUpdate(const std::string &roomID,
+                                                        ZegoRoomRosterType rosterType,
+                                                        EXPRESS::ZegoUpdateType updateType,
+                                                        const ZegoRoomRoster::UpdateSummary &summary,
+                                                        const std::string &extendedData) {
+    if (summary.changedCount == 0 || !isSubscribed(ZegoEventMethod::onRoomRosterUpdate)) {
+        return;
+    }
+
+    FTMap retMap;
+    retMap[FTValue("method")] = FTValue("onRoomRosterUpdate");
+    retMap[FTValue("roomID")] = FTValue(roomID);
+    retMap[FTValue("rosterType")] = FTValue((int32_t)rosterType);
+    retMap[FTValue("updateType")] = FTValue(updateType);
+    retMap[FTValue("changedCount")] = FTValue((int32_t)summary.changedCount);
+    retMap[FTValue("totalCount")] = FTValue((int32_t)summary.totalCount);
+    retMap[FTValue("version")] = FTValue((int64_t)summary.version);
+    retMap[FTValue("extendedData")] = FTValue(extendedData.empty() ? "{}" : extendedData);
+
+    postEvent(std::move(retMap));
+}
+
+void ZegoExpressEngineEventHandler::postEvent(FTMap &&event) {
+    auto lane = ZEGO_EVENT_LANE_CRITICAL;
+    std::string key;
+    auto method = event.find(FTValue("method"));
+    if (method != event.end()) {
+        if (auto name = std::get_if<std::string>(&method->second)) {
+            lane = ZegoEventLanes::laneOf(*name);
+            if (lane == ZEGO_EVENT_LANE_LATEST) {
+                key = ZegoEventLanes::latestKey(*name, event);
+            }
+        }
+    }
+
+    // Drops and replacements are counted per lane, see getEventLaneStats.
+    eventQueue_.push(lane, key, FTValue(std::move(event)));
+}
+
+void ZegoExpressEngineEventHandler::postCompactEvent(
+    const std::string &key, const std::function<std::vector<uint8_t>()> &encode) {
+    std::lock_guard<std::mutex> lock(compactCodecMutex_);
+    if (eventQueue_.push(ZEGO_EVENT_LANE_LATEST, key, FTValue(encode()))) {
+        return;
+    }
+
+    // The replaced or dropped packet may have carried strings that pending
+    // packets use. The new epoch makes dart skip the packets queued before,
+    // and this one replaces itself with a packet that carries its strings.
+    compactCodec_.reset();
+    eventQueue_.push(ZEGO_EVENT_LANE_LATEST, key, FTValue(encode()));
+}
+
+void ZegoExpressEngineEventHandler::deliverEvent(const flutter::EncodableValue &event) {
+    std::lock_guard<std::mutex> lock(eventSinkMutex_);
+    if (eventSink_) {
+        eventSink_->Success(event);
+    }
+}
 
 void ZegoExpressEngineEventHandler::onDebugError(int errorCode, const std::string &funcName,
                                                  const std::string &info) {
 
     ZF::logInfo("[onDebugError] errorCode: %d, funcName: %s, info: %s", errorCode, funcName.c_str(), info.c_str());
     
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onDebugError)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onDebugError");
         retMap[FTValue("errorCode")] = FTValue(errorCode);
         retMap[FTValue("funcName")] = FTValue(funcName);
         retMap[FTValue("info")] = FTValue(info);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -35,14 +409,14 @@ void ZegoExpressEngineEventHandler::onApiCalledResult(int errorCode, const std::
 
     ZF::logInfo("[onApiCalledResult] errorCode: %d, funcName: %s, info: %s", errorCode, funcName.c_str(), info.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onApiCalledResult)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onApiCalledResult");
         retMap[FTValue("errorCode")] = FTValue(errorCode);
         retMap[FTValue("funcName")] = FTValue(funcName);
         retMap[FTValue("info")] = FTValue(info);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -50,12 +424,12 @@ void ZegoExpressEngineEventHandler::onFatalError(int errorCode) {
     
     ZF::logInfo("[onFatalError] errorCode: %d", errorCode);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onFatalError)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onFatalError");
         retMap[FTValue("errorCode")] = FTValue(errorCode);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -63,12 +437,12 @@ void ZegoExpressEngineEventHandler::onEngineStateUpdate(EXPRESS::ZegoEngineState
 
     ZF::logInfo("[onEngineStateUpdate] state: %d", state);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onEngineStateUpdate)) {
         flutter::EncodableMap retMap;
         retMap[FTValue("method")] = FTValue("onEngineStateUpdate");
         retMap[FTValue("state")] = FTValue(state);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -78,7 +452,17 @@ void ZegoExpressEngineEventHandler::onRoomStateUpdate(const std::string &roomID,
 
     ZF::logInfo("[onRoomStateUpdate] roomID: %s, state: %d, errorCode: %d, extendedData: %s", roomID.c_str(), state, errorCode, extendedData.c_str());
 
-    if (eventSink_) {
+    {
+        std::lock_guard<std::mutex> lock(loggedInRoomsMutex_);
+        if (state == EXPRESS::ZEGO_ROOM_STATE_DISCONNECTED) {
+            loggedInRooms_.erase(roomID);
+            roomRoster_.removeRoom(roomID);
+        } else {
+            loggedInRooms_.insert(roomID);
+        }
+    }
+
+    if (isSubscribed(ZegoEventMethod::onRoomStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRoomStateUpdate");
         retMap[FTValue("state")] = FTValue(state);
@@ -86,7 +470,7 @@ void ZegoExpressEngineEventHandler::onRoomStateUpdate(const std::string &roomID,
         retMap[FTValue("roomID")] = FTValue(roomID);
         retMap[FTValue("extendedData")] = FTValue(extendedData);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -97,7 +481,7 @@ void ZegoExpressEngineEventHandler::onRoomStateChanged(const std::string &roomID
 
     ZF::logInfo("[onRoomStateChanged] roomID: %s, reason: %d, errorCode: %d, extendedData: %s", roomID.c_str(), reason, errorCode, extendedData.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRoomStateChanged)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRoomStateChanged");
         retMap[FTValue("reason")] = FTValue(reason);
@@ -107,7 +491,7 @@ void ZegoExpressEngineEventHandler::onRoomStateChanged(const std::string &roomID
         std::string extendedData_ = extendedData.empty() ? "{}" : extendedData;
         retMap[FTValue("extendedData")] = FTValue(extendedData_);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -117,7 +501,13 @@ void ZegoExpressEngineEventHandler::onRoomUserUpdate(
 
     ZF::logInfo("[onRoomUserUpdate] roomID: %s, updateType: %d, userListCount: %d", roomID.c_str(), updateType, userList.size());
 
-    if (eventSink_) {
+    if (isRoomRosterEnabled_) {
+        postRoomRosterUpdate(roomID, ZEGO_ROOM_ROSTER_TYPE_USER, updateType,
+                             roomRoster_.updateUsers(roomID, updateType, userList));
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onRoomUserUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRoomUserUpdate");
         retMap[FTValue("updateType")] = FTValue(updateType);
@@ -132,7 +522,7 @@ void ZegoExpressEngineEventHandler::onRoomUserUpdate(
         }
         retMap[FTValue("userList")] = FTValue(userListArray);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -141,13 +531,13 @@ void ZegoExpressEngineEventHandler::onRoomOnlineUserCountUpdate(const std::strin
 
     ZF::logInfo("[onRoomOnlineUserCountUpdate] roomID: %s, count: %d", roomID.c_str(), count);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRoomOnlineUserCountUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRoomOnlineUserCountUpdate");
         retMap[FTValue("count")] = FTValue(count);
         retMap[FTValue("roomID")] = FTValue(roomID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -157,7 +547,13 @@ void ZegoExpressEngineEventHandler::onRoomStreamUpdate(
 
     ZF::logInfo("[onRoomStreamUpdate] roomID: %s, updateType: %d, streamListCount: %d, extendedData :%d", roomID.c_str(), updateType, streamList.size(), extendedData.c_str());
 
-    if (eventSink_) {
+    if (isRoomRosterEnabled_) {
+        postRoomRosterUpdate(roomID, ZEGO_ROOM_ROSTER_TYPE_STREAM, updateType,
+                             roomRoster_.updateStreams(roomID, updateType, streamList), extendedData);
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onRoomStreamUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRoomStreamUpdate");
         retMap[FTValue("updateType")] = FTValue(updateType);
@@ -179,7 +575,7 @@ void ZegoExpressEngineEventHandler::onRoomStreamUpdate(
         }
         retMap[FTValue("streamList")] = FTValue(streamListArray);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -188,7 +584,12 @@ void ZegoExpressEngineEventHandler::onRoomStreamExtraInfoUpdate(
 
     ZF::logInfo("[onRoomStreamExtraInfoUpdate] roomID: %s, streamListCount: %d", roomID.c_str(), streamList.size());
 
-    if (eventSink_) {
+    // Not replaced by the roster, pages read after it see the new extra info.
+    if (isRoomRosterEnabled_) {
+        roomRoster_.updateStreamExtraInfo(roomID, streamList);
+    }
+
+    if (isSubscribed(ZegoEventMethod::onRoomStreamExtraInfoUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRoomStreamExtraInfoUpdate");
         retMap[FTValue("roomID")] = FTValue(roomID);
@@ -208,7 +609,7 @@ void ZegoExpressEngineEventHandler::onRoomStreamExtraInfoUpdate(
         }
         retMap[FTValue("streamList")] = FTValue(streamListArray);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -217,7 +618,7 @@ void ZegoExpressEngineEventHandler::onRoomExtraInfoUpdate(
 
     ZF::logInfo("[onRoomExtraInfoUpdate] roomID: %s, streamListCount: %d", roomID.c_str(), roomExtraInfoList.size());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRoomExtraInfoUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRoomExtraInfoUpdate");
         retMap[FTValue("roomID")] = FTValue(roomID);
@@ -238,7 +639,7 @@ void ZegoExpressEngineEventHandler::onRoomExtraInfoUpdate(
         }
         retMap[FTValue("roomExtraInfoList")] = flutter::EncodableValue(roomExtraInfoListArray);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -248,7 +649,7 @@ void ZegoExpressEngineEventHandler::onPublisherStateUpdate(const std::string &st
                                                            const std::string &extendedData) {
     ZF::logInfo("[onPublisherStateUpdate] streamID: %s, state: %d, errorCode: %d, extendedData: %s", streamID.c_str(), state, errorCode, extendedData.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPublisherStateUpdate");
         retMap[FTValue("streamID")] = FTValue(streamID);
@@ -256,7 +657,7 @@ void ZegoExpressEngineEventHandler::onPublisherStateUpdate(const std::string &st
         retMap[FTValue("errorCode")] = flutter::EncodableValue(errorCode);
         retMap[FTValue("extendedData")] = flutter::EncodableValue(extendedData);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -264,7 +665,16 @@ void ZegoExpressEngineEventHandler::onPublisherQualityUpdate(
     const std::string &streamID, const EXPRESS::ZegoPublishStreamQuality &quality) {
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    qualityAggregator_.addPublisherQuality(streamID, quality);
+
+    if (isSubscribed(ZegoEventMethod::onPublisherQualityUpdate)) {
+        if (isCompactEventEnabled_) {
+            postCompactEvent(
+                ZegoCompactEventCodec::latestKey(ZEGO_COMPACT_EVENT_TYPE_PUBLISHER_QUALITY, {streamID}),
+                [&]() { return compactCodec_.encodePublisherQuality(streamID, quality); });
+            return;
+        }
+
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPublisherQualityUpdate");
         retMap[FTValue("streamID")] = FTValue(streamID);
@@ -288,7 +698,7 @@ void ZegoExpressEngineEventHandler::onPublisherQualityUpdate(
 
         retMap[FTValue("quality")] = FTValue(qualityMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -296,11 +706,11 @@ void ZegoExpressEngineEventHandler::onPublisherCapturedAudioFirstFrame() {
 
     ZF::logInfo("[onPublisherCapturedAudioFirstFrame]");
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherCapturedAudioFirstFrame)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPublisherCapturedAudioFirstFrame");
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -308,12 +718,12 @@ void ZegoExpressEngineEventHandler::onPublisherSendAudioFirstFrame(EXPRESS::Zego
 
     ZF::logInfo("[onPublisherSendAudioFirstFrame] channel: %d", channel);
     
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherSendAudioFirstFrame)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPublisherSendAudioFirstFrame");
         retMap[FTValue("channel")] = FTValue((int)channel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -323,7 +733,7 @@ void ZegoExpressEngineEventHandler::onPublisherStreamEvent(EXPRESS::ZegoStreamEv
 
     ZF::logInfo("[onPublisherStreamEvent] eventID: %d, streamID: %s, extraInfo: %s", eventID, streamID.c_str(), extraInfo.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherStreamEvent)) {
         FTMap retMap;
 
         retMap[FTValue("method")] = FTValue("onPublisherStreamEvent");
@@ -332,7 +742,7 @@ void ZegoExpressEngineEventHandler::onPublisherStreamEvent(EXPRESS::ZegoStreamEv
         retMap[FTValue("streamID")] = flutter::EncodableValue(streamID);
         retMap[FTValue("extraInfo")] = flutter::EncodableValue(extraInfo);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -342,7 +752,7 @@ void ZegoExpressEngineEventHandler::onVideoObjectSegmentationStateChanged(
 
     ZF::logInfo("[onVideoObjectSegmentationStateChanged] state: %d, channel: %d", state, channel);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onVideoObjectSegmentationStateChanged)) {
         FTMap retMap;
 
         retMap[FTValue("method")] = FTValue("onVideoObjectSegmentationStateChanged");
@@ -350,28 +760,28 @@ void ZegoExpressEngineEventHandler::onVideoObjectSegmentationStateChanged(
         retMap[FTValue("channel")] = FTValue((int32_t)channel);
         retMap[FTValue("errorCode")] = FTValue(errorCode);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
 void ZegoExpressEngineEventHandler::onPublisherLowFpsWarning(EXPRESS::ZegoVideoCodecID codecID, EXPRESS::ZegoPublishChannel channel) {
     ZF::logInfo("[onPublisherLowFpsWarning] codecID: %d, channel: %d", codecID, channel);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherLowFpsWarning)) {
         FTMap retMap;
 
         retMap[FTValue("method")] = FTValue("onPublisherLowFpsWarning");
         retMap[FTValue("codecID")] = FTValue((int32_t)codecID);
         retMap[FTValue("channel")] = FTValue((int32_t)channel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
 void ZegoExpressEngineEventHandler::onPublisherDummyCaptureImagePathError(int errorCode, const std::string& path, EXPRESS::ZegoPublishChannel channel) {
     ZF::logInfo("[onPublisherDummyCaptureImagePathError] errorCode: %d, path: %s, channel: %d", errorCode, path.c_str(), channel);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherDummyCaptureImagePathError)) {
         FTMap retMap;
 
         retMap[FTValue("method")] = FTValue("onPublisherDummyCaptureImagePathError");
@@ -379,7 +789,7 @@ void ZegoExpressEngineEventHandler::onPublisherDummyCaptureImagePathError(int er
         retMap[FTValue("path")] = FTValue(path);
         retMap[FTValue("channel")] = FTValue((int32_t)channel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -391,7 +801,7 @@ void ZegoExpressEngineEventHandler::onPlayerStateUpdate(const std::string &strea
 
     ZF::logInfo("[onPlayerStateUpdate] streamID: %s, state: %d, errorCode: %d, extendedData: %s", streamID.c_str(), state, errorCode, extendedData.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPlayerStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerStateUpdate");
         retMap[FTValue("streamID")] = FTValue(streamID);
@@ -399,7 +809,7 @@ void ZegoExpressEngineEventHandler::onPlayerStateUpdate(const std::string &strea
         retMap[FTValue("errorCode")] = flutter::EncodableValue(errorCode);
         retMap[FTValue("extendedData")] = flutter::EncodableValue(extendedData);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -407,7 +817,16 @@ void ZegoExpressEngineEventHandler::onPlayerQualityUpdate(
     const std::string &streamID, const EXPRESS::ZegoPlayStreamQuality &quality) {
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    qualityAggregator_.addPlayerQuality(streamID, quality);
+
+    if (isSubscribed(ZegoEventMethod::onPlayerQualityUpdate)) {
+        if (isCompactEventEnabled_) {
+            postCompactEvent(
+                ZegoCompactEventCodec::latestKey(ZEGO_COMPACT_EVENT_TYPE_PLAYER_QUALITY, {streamID}),
+                [&]() { return compactCodec_.encodePlayerQuality(streamID, quality); });
+            return;
+        }
+
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerQualityUpdate");
         retMap[FTValue("streamID")] = FTValue(streamID);
@@ -441,7 +860,7 @@ void ZegoExpressEngineEventHandler::onPlayerQualityUpdate(
 
         retMap[FTValue("quality")] = FTValue(qualityMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -450,13 +869,13 @@ void ZegoExpressEngineEventHandler::onPlayerMediaEvent(const std::string &stream
 
     ZF::logInfo("[onPlayerMediaEvent] streamID: %s, event: %d", streamID.c_str(), event);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPlayerMediaEvent)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerMediaEvent");
         retMap[FTValue("streamID")] = FTValue(streamID);
         retMap[FTValue("event")] = flutter::EncodableValue(event);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -464,12 +883,12 @@ void ZegoExpressEngineEventHandler::onPlayerRecvAudioFirstFrame(const std::strin
 
     ZF::logInfo("[onPlayerRecvAudioFirstFrame] streamID: %s", streamID.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPlayerRecvAudioFirstFrame)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerRecvAudioFirstFrame");
         retMap[FTValue("streamID")] = FTValue(streamID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -479,7 +898,14 @@ void ZegoExpressEngineEventHandler::onPlayerRecvSEI(const std::string &streamID,
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (seiBatcher_.isRunning()) {
+        if (isSubscribed(ZegoEventMethod::onPlayerRecvSEI)) {
+            seiBatcher_.add(ZEGO_SEI_BATCH_TYPE_PLAYER_SEI, 0, streamID, data, dataLength, 0);
+        }
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onPlayerRecvSEI)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerRecvSEI");
         retMap[FTValue("streamID")] = FTValue(streamID);
@@ -489,14 +915,22 @@ void ZegoExpressEngineEventHandler::onPlayerRecvSEI(const std::string &streamID,
 
         retMap[FTValue("data")] = FTValue(dataArray);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
 void ZegoExpressEngineEventHandler::onPlayerRecvMediaSideInfo(const EXPRESS::ZegoMediaSideInfo & info) {
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (seiBatcher_.isRunning()) {
+        if (isSubscribed(ZegoEventMethod::onPlayerRecvMediaSideInfo)) {
+            seiBatcher_.add(ZEGO_SEI_BATCH_TYPE_PLAYER_MEDIA_SIDE_INFO, 0, info.streamID, info.SEIData,
+                            info.SEIDataLength, (int64_t)info.timestampNs);
+        }
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onPlayerRecvMediaSideInfo)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerRecvMediaSideInfo");
         retMap[FTValue("streamID")] = FTValue(info.streamID);
@@ -507,7 +941,7 @@ void ZegoExpressEngineEventHandler::onPlayerRecvMediaSideInfo(const EXPRESS::Zeg
 
         retMap[FTValue("SEIData")] = FTValue(dataArray);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -517,7 +951,7 @@ void ZegoExpressEngineEventHandler::onPlayerRecvAudioSideInfo(const std::string
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPlayerRecvAudioSideInfo)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerRecvAudioSideInfo");
         retMap[FTValue("streamID")] = FTValue(streamID);
@@ -527,7 +961,7 @@ void ZegoExpressEngineEventHandler::onPlayerRecvAudioSideInfo(const std::string
 
         retMap[FTValue("data")] = FTValue(dataArray);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -537,14 +971,14 @@ void ZegoExpressEngineEventHandler::onPlayerStreamEvent(EXPRESS::ZegoStreamEvent
 
     ZF::logInfo("[onPlayerStreamEvent] eventID: %d, streamID: %s, extraInfo: %s", eventID, streamID.c_str(), extraInfo.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPlayerStreamEvent)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerStreamEvent");
         retMap[FTValue("streamID")] = FTValue(streamID);
         retMap[FTValue("eventID")] = FTValue((int32_t)eventID);
         retMap[FTValue("extraInfo")] = FTValue(extraInfo);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -553,24 +987,24 @@ void ZegoExpressEngineEventHandler::onPlayerRenderCameraVideoFirstFrame(
 
     ZF::logInfo("[onPlayerRenderCameraVideoFirstFrame] streamID: %s", streamID.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPlayerRenderCameraVideoFirstFrame)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerRenderCameraVideoFirstFrame");
         retMap[FTValue("streamID")] = FTValue(streamID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
 // void ZegoExpressEngineEventHandler::onPlayerVideoSuperResolutionUpdate(std::string streamID,EXPRESS::ZegoSuperResolutionState state,int errorCode) {
-//     if (eventSink_) {
+//     if (isSubscribed(ZegoEventMethod::onPlayerVideoSuperResolutionUpdate)) {
 //         FTMap retMap;
 //         retMap[FTValue("method")] = FTValue("onPlayerVideoSuperResolutionUpdate");
 //         retMap[FTValue("streamID")] = FTValue(streamID);
 //         retMap[FTValue("state")] = FTValue((int32_t)state);
 //         retMap[FTValue("errorCode")] = FTValue(errorCode);
 
-//         eventSink_->Success(retMap);
+//         postEvent(std::move(retMap));
 //     }
 // }
 
@@ -579,7 +1013,7 @@ void ZegoExpressEngineEventHandler::onMixerRelayCDNStateUpdate(
 
     ZF::logInfo("[onMixerRelayCDNStateUpdate] taskID: %s, infoListCount: %d", taskID.c_str(), infoList.size());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMixerRelayCDNStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onMixerRelayCDNStateUpdate");
         retMap[FTValue("taskID")] = FTValue(taskID);
@@ -594,7 +1028,7 @@ void ZegoExpressEngineEventHandler::onMixerRelayCDNStateUpdate(
             infoListArray.emplace_back(FTValue(infoMap));
         }
         retMap[FTValue("infoList")] = FTValue(infoListArray);
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -603,7 +1037,7 @@ void ZegoExpressEngineEventHandler::onMixerSoundLevelUpdate(
 
     // Super high frequency callbacks do not log, do not guard sink
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMixerSoundLevelUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onMixerSoundLevelUpdate");
 
@@ -613,7 +1047,7 @@ void ZegoExpressEngineEventHandler::onMixerSoundLevelUpdate(
         }
         retMap[FTValue("soundLevels")] = FTValue(soundLevelsMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -623,7 +1057,7 @@ void ZegoExpressEngineEventHandler::onAudioDeviceStateChanged(
 
     ZF::logInfo("[onAudioDeviceStateChanged] updateType: %d, deviceType: %d, deviceID: %s, deviceName: %s", updateType, deviceType, deviceInfo.deviceID.c_str(), deviceInfo.deviceName.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onAudioDeviceStateChanged)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onAudioDeviceStateChanged");
 
@@ -636,7 +1070,7 @@ void ZegoExpressEngineEventHandler::onAudioDeviceStateChanged(
 
         retMap[FTValue("deviceInfo")] = FTValue(deviceInfoMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -645,7 +1079,7 @@ void ZegoExpressEngineEventHandler::onAudioDeviceVolumeChanged(
 
     ZF::logInfo("[onAudioDeviceVolumeChanged] deviceType: %d, deviceID: %s, volume: %d", deviceType, deviceID.c_str(), volume);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onAudioDeviceVolumeChanged)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onAudioDeviceVolumeChanged");
 
@@ -654,19 +1088,24 @@ void ZegoExpressEngineEventHandler::onAudioDeviceVolumeChanged(
         retMap[FTValue("deviceID")] = FTValue(deviceID);
         retMap[FTValue("volume")] = FTValue(volume);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
 void ZegoExpressEngineEventHandler::onCapturedSoundLevelUpdate(float soundLevel) {
     // Super high frequency callbacks do not log, do not guard sink
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onCapturedSoundLevelUpdate)) {
+        if (audioMeterAggregator_.isRunning()) {
+            audioMeterAggregator_.updateCapturedSoundLevel(soundLevel);
+            return;
+        }
+
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onCapturedSoundLevelUpdate");
         retMap[FTValue("soundLevel")] = FTValue(soundLevel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -674,17 +1113,30 @@ void ZegoExpressEngineEventHandler::onRemoteSoundLevelUpdate(
     const std::unordered_map<std::string, float> &soundLevels) {
     // Super high frequency callbacks do not log, do not guard sink
 
-    if (eventSink_) {
+    ZegoTextureRendererController::getInstance()->updateRemoteSoundLevels(soundLevels);
+
+    if (isSubscribed(ZegoEventMethod::onRemoteSoundLevelUpdate)) {
+        if (audioMeterAggregator_.isRunning()) {
+            audioMeterAggregator_.updateRemoteSoundLevels(soundLevels);
+            return;
+        }
+
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRemoteSoundLevelUpdate");
 
-        FTMap soundLevelsMap;
+        // The sound level of streamIDs[i] is soundLevelData[i]
+        FTArray streamIDs;
+        std::vector<float> soundLevelData;
+        streamIDs.reserve(soundLevels.size());
+        soundLevelData.reserve(soundLevels.size());
         for (auto &soundlevel : soundLevels) {
-            soundLevelsMap[FTValue(soundlevel.first)] = FTValue(soundlevel.second);
+            streamIDs.push_back(FTValue(soundlevel.first));
+            soundLevelData.push_back(soundlevel.second);
         }
-        retMap[FTValue("soundLevels")] = FTValue(soundLevelsMap);
+        retMap[FTValue("streamIDs")] = FTValue(std::move(streamIDs));
+        retMap[FTValue("soundLevelData")] = FTValue(std::move(soundLevelData));
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -700,13 +1152,13 @@ void ZegoExpressEngineEventHandler::onRemoteMicStateUpdate(const std::string &st
                                                            EXPRESS::ZegoRemoteDeviceState state) {
     ZF::logInfo("[onRemoteMicStateUpdate] streamID: %s, state: %d", streamID.c_str(), state);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRemoteMicStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRemoteMicStateUpdate");
         retMap[FTValue("streamID")] = FTValue(streamID);
         retMap[FTValue("state")] = FTValue(state);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -716,7 +1168,7 @@ void ZegoExpressEngineEventHandler::onAudioEffectPlayStateUpdate(
     EXPRESS::ZegoAudioEffectPlayState state, int errorCode) {
     ZF::logInfo("[onAudioEffectPlayStateUpdate] index: %d, audioEffectID: %d, state: %d, errorCode:%d", audioEffectPlayer->getIndex(), audioEffectID, state, errorCode);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onAudioEffectPlayStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onAudioEffectPlayStateUpdate");
         retMap[FTValue("audioEffectPlayerIndex")] = FTValue(audioEffectPlayer->getIndex());
@@ -724,7 +1176,7 @@ void ZegoExpressEngineEventHandler::onAudioEffectPlayStateUpdate(
         retMap[FTValue("state")] = FTValue(state);
         retMap[FTValue("errorCode")] = FTValue(errorCode);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -733,14 +1185,14 @@ void ZegoExpressEngineEventHandler::onMediaPlayerStateUpdate(EXPRESS::IZegoMedia
                                                              int errorCode) {
     ZF::logInfo("[onMediaPlayerStateUpdate] index: %d, state: %d, errorCode:%d", mediaPlayer->getIndex(), state, errorCode);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMediaPlayerStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onMediaPlayerStateUpdate");
         retMap[FTValue("mediaPlayerIndex")] = FTValue(mediaPlayer->getIndex());
         retMap[FTValue("state")] = FTValue(state);
         retMap[FTValue("errorCode")] = FTValue(errorCode);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -749,13 +1201,13 @@ void ZegoExpressEngineEventHandler::onMediaPlayerNetworkEvent(
 
     ZF::logInfo("[onMediaPlayerNetworkEvent] index: %d, networkEvent: %d", mediaPlayer->getIndex(), networkEvent);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMediaPlayerNetworkEvent)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onMediaPlayerNetworkEvent");
         retMap[FTValue("mediaPlayerIndex")] = FTValue(mediaPlayer->getIndex());
         retMap[FTValue("networkEvent")] = FTValue(networkEvent);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -763,14 +1215,14 @@ void ZegoExpressEngineEventHandler::onMediaPlayerPlayingProgress(
     EXPRESS::IZegoMediaPlayer *mediaPlayer, unsigned long long millisecond) {
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMediaPlayerPlayingProgress)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onMediaPlayerPlayingProgress");
         retMap[FTValue("mediaPlayerIndex")] = FTValue(mediaPlayer->getIndex());
         // TODO: convert need test?
         retMap[FTValue("millisecond")] = FTValue((int64_t)millisecond);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -779,7 +1231,15 @@ void ZegoExpressEngineEventHandler::onMediaPlayerRecvSEI(EXPRESS::IZegoMediaPlay
                                                          unsigned int dataLength) {
     // Super high frequency callbacks do not log, do not guard sink
 
-    if (eventSink_) {
+    if (seiBatcher_.isRunning()) {
+        if (isSubscribed(ZegoEventMethod::onMediaPlayerRecvSEI)) {
+            seiBatcher_.add(ZEGO_SEI_BATCH_TYPE_MEDIA_PLAYER_SEI, mediaPlayer->getIndex(), std::string(),
+                            data, dataLength, 0);
+        }
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onMediaPlayerRecvSEI)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onMediaPlayerRecvSEI");
         retMap[FTValue("mediaPlayerIndex")] = FTValue(mediaPlayer->getIndex());
@@ -787,7 +1247,7 @@ void ZegoExpressEngineEventHandler::onMediaPlayerRecvSEI(EXPRESS::IZegoMediaPlay
         std::vector<uint8_t> vec_data(data, data + dataLength);
         retMap[FTValue("data")] = FTValue(vec_data);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -795,14 +1255,14 @@ void ZegoExpressEngineEventHandler::onMediaPlayerSoundLevelUpdate(
     EXPRESS::IZegoMediaPlayer *mediaPlayer, float soundLevel) {
     // Super high frequency callbacks do not log, do not guard sink
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMediaPlayerSoundLevelUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onMediaPlayerSoundLevelUpdate");
         retMap[FTValue("mediaPlayerIndex")] = FTValue(mediaPlayer->getIndex());
 
         retMap[FTValue("soundLevel")] = FTValue(soundLevel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -810,14 +1270,19 @@ void ZegoExpressEngineEventHandler::onMediaPlayerFrequencySpectrumUpdate(
     EXPRESS::IZegoMediaPlayer *mediaPlayer, const EXPRESS::ZegoAudioSpectrum &spectrumList) {
     // Super high frequency callbacks do not log, do not guard sink
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMediaPlayerFrequencySpectrumUpdate)) {
+        if (audioMeterAggregator_.isRunning()) {
+            audioMeterAggregator_.updateMediaPlayerSpectrum(mediaPlayer->getIndex(), spectrumList);
+            return;
+        }
+
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onMediaPlayerFrequencySpectrumUpdate");
         retMap[FTValue("mediaPlayerIndex")] = FTValue(mediaPlayer->getIndex());
 
-        retMap[FTValue("soundLevel")] = FTValue(spectrumList);
+        retMap[FTValue("spectrumList")] = FTValue(spectrumList);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -826,28 +1291,28 @@ void ZegoExpressEngineEventHandler::onMediaPlayerFirstFrameEvent(
 
     ZF::logInfo("[onMediaPlayerFirstFrameEvent] index: %d, event: %d", mediaPlayer->getIndex(), event);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMediaPlayerFirstFrameEvent)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onMediaPlayerFirstFrameEvent");
         retMap[FTValue("mediaPlayerIndex")] = FTValue(mediaPlayer->getIndex());
 
         retMap[FTValue("event")] = FTValue(event);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
 void ZegoExpressEngineEventHandler::onMediaPlayerRenderingProgress(EXPRESS::IZegoMediaPlayer* mediaPlayer, unsigned long long millisecond) {
     ZF::logInfo("[onMediaPlayerRenderingProgress] index: %d, millisecond: %lld", mediaPlayer->getIndex(), millisecond);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMediaPlayerRenderingProgress)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onMediaPlayerRenderingProgress");
         retMap[FTValue("mediaPlayerIndex")] = FTValue(mediaPlayer->getIndex());
 
         retMap[FTValue("millisecond")] = FTValue((int64_t)millisecond);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -856,40 +1321,40 @@ void ZegoExpressEngineEventHandler::onMediaPlayerRenderingProgress(EXPRESS::IZeg
 void ZegoExpressEngineEventHandler::onMediaDataPublisherFileOpen(EXPRESS::IZegoMediaDataPublisher *mediaDataPublisher, const std::string &path) {
     ZF::logInfo("[onMediaDataPublisherFileOpen] index: %d, path: %s", mediaDataPublisher->getIndex(), path.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMediaDataPublisherFileOpen)) {
         FTMap return_map;
         return_map[FTValue("method")] = FTValue("onMediaDataPublisherFileOpen");
         return_map[FTValue("publisherIndex")] = FTValue(mediaDataPublisher->getIndex());
         return_map[FTValue("path")] = FTValue(path);
 
-        eventSink_->Success(return_map);
+        postEvent(std::move(return_map));
     }
 }
 
 void ZegoExpressEngineEventHandler::onMediaDataPublisherFileClose(EXPRESS::IZegoMediaDataPublisher *mediaDataPublisher, int errorCode, const std::string &path) {
     ZF::logInfo("[onMediaDataPublisherFileClose] index: %d, errorCode: %d, path: %s", mediaDataPublisher->getIndex(), errorCode, path.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMediaDataPublisherFileClose)) {
         FTMap return_map;
         return_map[FTValue("method")] = FTValue("onMediaDataPublisherFileClose");
         return_map[FTValue("publisherIndex")] = FTValue(mediaDataPublisher->getIndex());
         return_map[FTValue("errorCode")] = FTValue(errorCode);
         return_map[FTValue("path")] = FTValue(path);
 
-        eventSink_->Success(return_map);
+        postEvent(std::move(return_map));
     }
 }
 
 void ZegoExpressEngineEventHandler::onMediaDataPublisherFileDataBegin(EXPRESS::IZegoMediaDataPublisher *mediaDataPublisher, const std::string &path) {
     ZF::logInfo("[onMediaDataPublisherFileDataBegin] index: %d, path: %s", mediaDataPublisher->getIndex(), path.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onMediaDataPublisherFileDataBegin)) {
         FTMap return_map;
         return_map[FTValue("method")] = FTValue("onMediaDataPublisherFileDataBegin");
         return_map[FTValue("publisherIndex")] = FTValue(mediaDataPublisher->getIndex());
         return_map[FTValue("path")] = FTValue(path);
 
-        eventSink_->Success(return_map);
+        postEvent(std::move(return_map));
     }
 }
 
@@ -898,7 +1363,11 @@ void ZegoExpressEngineEventHandler::onCapturedAudioData(const unsigned char *dat
                                                         EXPRESS::ZegoAudioFrameParam param) {
     // Super high frequency callbacks do not log, do not guard sink
 
-    if (eventSink_) {
+    if (writeAudioDataRing(EXPRESS::ZEGO_AUDIO_DATA_CALLBACK_BIT_MASK_CAPTURED, "", data, dataLength, param)) {
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onCapturedAudioData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onCapturedAudioData");
         std::vector<uint8_t> dataVec(data, data + dataLength);
@@ -909,7 +1378,7 @@ void ZegoExpressEngineEventHandler::onCapturedAudioData(const unsigned char *dat
         paramMap[FTValue("channel")] = FTValue((int32_t)param.channel);
         retMap[FTValue("param")] = FTValue(paramMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -918,7 +1387,11 @@ void ZegoExpressEngineEventHandler::onPlaybackAudioData(const unsigned char *dat
                                                         EXPRESS::ZegoAudioFrameParam param) {
     // Super high frequency callbacks do not log, do not guard sink
 
-    if (eventSink_) {
+    if (writeAudioDataRing(EXPRESS::ZEGO_AUDIO_DATA_CALLBACK_BIT_MASK_PLAYBACK, "", data, dataLength, param)) {
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onPlaybackAudioData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlaybackAudioData");
         std::vector<uint8_t> dataVec(data, data + dataLength);
@@ -929,7 +1402,7 @@ void ZegoExpressEngineEventHandler::onPlaybackAudioData(const unsigned char *dat
         paramMap[FTValue("channel")] = FTValue((int32_t)param.channel);
         retMap[FTValue("param")] = FTValue(paramMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -938,7 +1411,11 @@ void ZegoExpressEngineEventHandler::onMixedAudioData(const unsigned char *data,
                                                      EXPRESS::ZegoAudioFrameParam param) {
     // Super high frequency callbacks do not log, do not guard sink
 
-    if (eventSink_) {
+    if (writeAudioDataRing(EXPRESS::ZEGO_AUDIO_DATA_CALLBACK_BIT_MASK_MIXED, "", data, dataLength, param)) {
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onMixedAudioData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onMixedAudioData");
         std::vector<uint8_t> dataVec(data, data + dataLength);
@@ -949,7 +1426,7 @@ void ZegoExpressEngineEventHandler::onMixedAudioData(const unsigned char *data,
         paramMap[FTValue("channel")] = FTValue((int32_t)param.channel);
         retMap[FTValue("param")] = FTValue(paramMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -959,7 +1436,11 @@ void ZegoExpressEngineEventHandler::onPlayerAudioData(const unsigned char *data,
                                                       const std::string &streamID) {
     // Super high frequency callbacks do not log, do not guard sink
 
-    if (eventSink_) {
+    if (writeAudioDataRing(EXPRESS::ZEGO_AUDIO_DATA_CALLBACK_BIT_MASK_PLAYER, streamID, data, dataLength, param)) {
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onPlayerAudioData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerAudioData");
         std::vector<uint8_t> dataVec(data, data + dataLength);
@@ -971,7 +1452,7 @@ void ZegoExpressEngineEventHandler::onPlayerAudioData(const unsigned char *data,
         retMap[FTValue("param")] = FTValue(paramMap);
         retMap[FTValue("streamID")] = FTValue(streamID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -981,7 +1462,7 @@ void ZegoExpressEngineEventHandler::onCapturedDataRecordStateUpdate(
 
     ZF::logInfo("[onCapturedDataRecordStateUpdate] state: %d, errorCode: %d, filePath: %s, recordType: %d, channel: %d", state, errorCode, config.filePath, config.recordType, channel);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onCapturedDataRecordStateUpdate)) {
         FTMap retMap;
         FTMap configMap;
         retMap[FTValue("method")] = FTValue("onCapturedDataRecordStateUpdate");
@@ -994,7 +1475,7 @@ void ZegoExpressEngineEventHandler::onCapturedDataRecordStateUpdate(
         retMap[FTValue("config")] = FTValue(configMap);
         retMap[FTValue("channel")] = FTValue(channel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1004,7 +1485,7 @@ void ZegoExpressEngineEventHandler::onCapturedDataRecordProgressUpdate(
         
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onCapturedDataRecordProgressUpdate)) {
         FTMap retMap;
         FTMap progressMap;
         FTMap configMap;
@@ -1020,7 +1501,7 @@ void ZegoExpressEngineEventHandler::onCapturedDataRecordProgressUpdate(
         retMap[FTValue("progress")] = FTValue(progressMap);
         retMap[FTValue("channel")] = FTValue(channel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1030,14 +1511,14 @@ void ZegoExpressEngineEventHandler::onDownloadProgressUpdate(
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onDownloadProgressUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onDownloadProgressUpdate");
 
         retMap[FTValue("resourceID")] = FTValue(resourceID);
         retMap[FTValue("progressRate")] = FTValue(progressRate);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1047,7 +1528,7 @@ void ZegoExpressEngineEventHandler::onCurrentPitchValueUpdate(
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onCurrentPitchValueUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onCurrentPitchValueUpdate");
 
@@ -1055,7 +1536,7 @@ void ZegoExpressEngineEventHandler::onCurrentPitchValueUpdate(
         retMap[FTValue("currentDuration")] = FTValue(currentDuration);
         retMap[FTValue("pitchValue")] = FTValue(pitchValue);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1063,58 +1544,58 @@ void ZegoExpressEngineEventHandler::onNetworkTimeSynchronized() {
 
     ZF::logInfo("[onNetworkTimeSynchronized]");
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onNetworkTimeSynchronized)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onNetworkTimeSynchronized");
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
 void ZegoExpressEngineEventHandler::onRequestDumpData() {
     ZF::logInfo("[onRequestDumpData]");
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRequestDumpData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRequestDumpData");
         
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
 void ZegoExpressEngineEventHandler::onStartDumpData(int errorCode) {
     ZF::logInfo("[onStartDumpData]");
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onStartDumpData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onStartDumpData");
         retMap[FTValue("errorCode")] = FTValue(errorCode);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
 void ZegoExpressEngineEventHandler::onStopDumpData(int errorCode, const std::string& dumpDir) {
      ZF::logInfo("[onStopDumpData]");
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onStopDumpData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onStopDumpData");
         retMap[FTValue("errorCode")] = FTValue(errorCode);
         retMap[FTValue("dumpDir")] = FTValue(dumpDir);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
 void ZegoExpressEngineEventHandler::onUploadDumpData(int errorCode) {
      ZF::logInfo("[onUploadDumpData]");
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onUploadDumpData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onUploadDumpData");
         retMap[FTValue("errorCode")] = FTValue(errorCode);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1123,14 +1604,14 @@ void ZegoExpressEngineEventHandler::onRoomTokenWillExpire(const std::string &roo
 
     ZF::logInfo("[onRoomTokenWillExpire] roomID: %s, remainTimeInSecond: %d", roomID.c_str(), remainTimeInSecond);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRoomTokenWillExpire)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRoomTokenWillExpire");
 
         retMap[FTValue("roomID")] = FTValue(roomID);
         retMap[FTValue("remainTimeInSecond")] = FTValue(remainTimeInSecond);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1139,13 +1620,13 @@ void ZegoExpressEngineEventHandler::onPublisherCapturedVideoFirstFrame(
 
     ZF::logInfo("[onPublisherCapturedVideoFirstFrame] channel: %d", channel);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherCapturedVideoFirstFrame)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPublisherCapturedVideoFirstFrame");
 
         retMap[FTValue("channel")] = FTValue((int)channel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1154,13 +1635,13 @@ void ZegoExpressEngineEventHandler::onPublisherSendVideoFirstFrame(
 
     ZF::logInfo("[onPublisherSendVideoFirstFrame] channel: %d", channel);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherSendVideoFirstFrame)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPublisherSendVideoFirstFrame");
 
         retMap[FTValue("channel")] = FTValue((int)channel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1169,13 +1650,13 @@ void ZegoExpressEngineEventHandler::onPublisherRenderVideoFirstFrame(
 
     ZF::logInfo("[onPublisherRenderVideoFirstFrame] channel: %d", channel);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherRenderVideoFirstFrame)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPublisherRenderVideoFirstFrame");
 
         retMap[FTValue("channel")] = FTValue((int)channel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1184,7 +1665,7 @@ void ZegoExpressEngineEventHandler::onPublisherVideoSizeChanged(
 
     ZF::logInfo("[onPublisherVideoSizeChanged] width: %d, height: %d, channel: %d", width, height, channel);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherVideoSizeChanged)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPublisherVideoSizeChanged");
 
@@ -1192,7 +1673,7 @@ void ZegoExpressEngineEventHandler::onPublisherVideoSizeChanged(
         retMap[FTValue("height")] = FTValue(height);
         retMap[FTValue("channel")] = FTValue((int)channel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1201,7 +1682,7 @@ void ZegoExpressEngineEventHandler::onPublisherRelayCDNStateUpdate(
 
     ZF::logInfo("[onPublisherRelayCDNStateUpdate] streamID: %s, infoListCount: %d", streamID.c_str(), infoList.size());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherRelayCDNStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPublisherRelayCDNStateUpdate");
 
@@ -1217,7 +1698,7 @@ void ZegoExpressEngineEventHandler::onPublisherRelayCDNStateUpdate(
         }
         retMap[FTValue("streamInfoList")] = FTValue(infoListArray);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1227,7 +1708,7 @@ void ZegoExpressEngineEventHandler::onPublisherVideoEncoderChanged(
 
     ZF::logInfo("[onPublisherVideoEncoderChanged] fromCodecID: %d, toCodecID: %d, channel: %d", fromCodecID, toCodecID, channel);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPublisherVideoEncoderChanged)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPublisherVideoEncoderChanged");
 
@@ -1235,7 +1716,7 @@ void ZegoExpressEngineEventHandler::onPublisherVideoEncoderChanged(
         retMap[FTValue("toCodecID")] = FTValue((int32_t)toCodecID);
         retMap[FTValue("channel")] = FTValue((int32_t)channel);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1243,13 +1724,13 @@ void ZegoExpressEngineEventHandler::onPlayerRecvVideoFirstFrame(const std::strin
 
     ZF::logInfo("[onPlayerRecvVideoFirstFrame] streamID: %s", streamID.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPlayerRecvVideoFirstFrame)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerRecvVideoFirstFrame");
 
         retMap[FTValue("streamID")] = FTValue(streamID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1257,13 +1738,13 @@ void ZegoExpressEngineEventHandler::onPlayerRenderVideoFirstFrame(const std::str
 
     ZF::logInfo("[onPlayerRenderVideoFirstFrame] streamID: %s", streamID.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPlayerRenderVideoFirstFrame)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerRenderVideoFirstFrame");
 
         retMap[FTValue("streamID")] = FTValue(streamID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1272,7 +1753,7 @@ void ZegoExpressEngineEventHandler::onPlayerVideoSizeChanged(const std::string &
 
     ZF::logInfo("[onPlayerVideoSizeChanged] streamID: %s, width: %d, height: %d", streamID.c_str(), width, height);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPlayerVideoSizeChanged)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerVideoSizeChanged");
 
@@ -1280,7 +1761,7 @@ void ZegoExpressEngineEventHandler::onPlayerVideoSizeChanged(const std::string &
         retMap[FTValue("width")] = FTValue(width);
         retMap[FTValue("height")] = FTValue(height);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1289,14 +1770,14 @@ void ZegoExpressEngineEventHandler::onPlayerLowFpsWarning(EXPRESS::ZegoVideoCode
 
     ZF::logInfo("[onPlayerLowFpsWarning] streamID: %s, codecID: %d", streamID.c_str(), codecID);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPlayerLowFpsWarning)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPlayerLowFpsWarning");
 
         retMap[FTValue("streamID")] = FTValue(streamID);
         retMap[FTValue("codecID")] = FTValue((int32_t)codecID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1305,7 +1786,7 @@ void ZegoExpressEngineEventHandler::onAutoMixerSoundLevelUpdate(
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onAutoMixerSoundLevelUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onAutoMixerSoundLevelUpdate");
 
@@ -1315,7 +1796,7 @@ void ZegoExpressEngineEventHandler::onAutoMixerSoundLevelUpdate(
         }
         retMap[FTValue("soundLevels")] = FTValue(soundLevelsMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1324,7 +1805,7 @@ void ZegoExpressEngineEventHandler::onVideoDeviceStateChanged(
 
     ZF::logInfo("[onVideoDeviceStateChanged] updateType: %d, deviceID: %s, deviceName: %s", updateType, deviceInfo.deviceID.c_str(), deviceInfo.deviceName.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onVideoDeviceStateChanged)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onVideoDeviceStateChanged");
 
@@ -1334,7 +1815,7 @@ void ZegoExpressEngineEventHandler::onVideoDeviceStateChanged(
         deviceInfoMap[FTValue("deviceName")] = FTValue(deviceInfo.deviceName);
         retMap[FTValue("deviceInfo")] = FTValue(deviceInfoMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1343,7 +1824,19 @@ void ZegoExpressEngineEventHandler::onCapturedSoundLevelInfoUpdate(
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onCapturedSoundLevelInfoUpdate)) {
+        if (audioMeterAggregator_.isRunning()) {
+            audioMeterAggregator_.updateCapturedSoundLevelInfo(soundLevelInfo.soundLevel, soundLevelInfo.vad);
+            return;
+        }
+
+        if (isCompactEventEnabled_) {
+            postCompactEvent(
+                ZegoCompactEventCodec::latestKey(ZEGO_COMPACT_EVENT_TYPE_CAPTURED_SOUND_LEVEL_INFO, {}),
+                [&]() { return compactCodec_.encodeCapturedSoundLevelInfo(soundLevelInfo); });
+            return;
+        }
+
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onCapturedSoundLevelInfoUpdate");
 
@@ -1352,7 +1845,7 @@ void ZegoExpressEngineEventHandler::onCapturedSoundLevelInfoUpdate(
         soundLevelInfoMap[FTValue("vad")] = FTValue(soundLevelInfo.vad);
         retMap[FTValue("soundLevelInfo")] = FTValue(soundLevelInfoMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1361,7 +1854,27 @@ void ZegoExpressEngineEventHandler::onRemoteSoundLevelInfoUpdate(
 
     // High frequency callbacks do not log
     
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRemoteSoundLevelInfoUpdate)) {
+        if (audioMeterAggregator_.isRunning()) {
+            for (auto const& soundLevelInfo : soundLevelInfos) {
+                audioMeterAggregator_.updateRemoteSoundLevelInfo(
+                    soundLevelInfo.first, soundLevelInfo.second.soundLevel, soundLevelInfo.second.vad);
+            }
+            return;
+        }
+
+        if (isCompactEventEnabled_) {
+            std::vector<std::string> streamIDs;
+            for (auto const &soundLevelInfo : soundLevelInfos) {
+                streamIDs.push_back(soundLevelInfo.first);
+            }
+            postCompactEvent(
+                ZegoCompactEventCodec::latestKey(ZEGO_COMPACT_EVENT_TYPE_REMOTE_SOUND_LEVEL_INFO,
+                                                 std::move(streamIDs)),
+                [&]() { return compactCodec_.encodeRemoteSoundLevelInfos(soundLevelInfos); });
+            return;
+        }
+
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRemoteSoundLevelInfoUpdate");
 
@@ -1376,7 +1889,7 @@ void ZegoExpressEngineEventHandler::onRemoteSoundLevelInfoUpdate(
 
         retMap[FTValue("soundLevelInfos")] = FTValue(soundLevelInfosMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1385,18 +1898,25 @@ void ZegoExpressEngineEventHandler::onCapturedAudioSpectrumUpdate(
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
-        FTMap retMap;
-        retMap[FTValue("method")] = FTValue("onCapturedAudioSpectrumUpdate");
+    if (isSubscribed(ZegoEventMethod::onCapturedAudioSpectrumUpdate)) {
+        if (audioMeterAggregator_.isRunning()) {
+            audioMeterAggregator_.updateCapturedAudioSpectrum(audioSpectrum);
+            return;
+        }
 
-        FTArray audioSpectrumArray;
-        for (auto audioSpectrum_ : audioSpectrum) {
-            audioSpectrumArray.push_back(FTValue((double)audioSpectrum_));
+        if (isCompactEventEnabled_) {
+            postCompactEvent(
+                ZegoCompactEventCodec::latestKey(ZEGO_COMPACT_EVENT_TYPE_CAPTURED_AUDIO_SPECTRUM, {}),
+                [&]() { return compactCodec_.encodeCapturedAudioSpectrum(audioSpectrum); });
+            return;
         }
 
-        retMap[FTValue("audioSpectrum")] = FTValue(audioSpectrumArray);
+        FTMap retMap;
+        retMap[FTValue("method")] = FTValue("onCapturedAudioSpectrumUpdate");
+        // Sent as a Float32List instead of a list of boxed doubles
+        retMap[FTValue("audioSpectrum")] = FTValue(audioSpectrum);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1405,22 +1925,49 @@ void ZegoExpressEngineEventHandler::onRemoteAudioSpectrumUpdate(
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRemoteAudioSpectrumUpdate)) {
+        if (audioMeterAggregator_.isRunning()) {
+            for (auto const& audioSpectrum : audioSpectrums) {
+                audioMeterAggregator_.updateRemoteAudioSpectrum(audioSpectrum.first, audioSpectrum.second);
+            }
+            return;
+        }
+
+        if (isCompactEventEnabled_) {
+            std::vector<std::string> streamIDs;
+            for (auto const &audioSpectrum : audioSpectrums) {
+                streamIDs.push_back(audioSpectrum.first);
+            }
+            postCompactEvent(
+                ZegoCompactEventCodec::latestKey(ZEGO_COMPACT_EVENT_TYPE_REMOTE_AUDIO_SPECTRUM,
+                                                 std::move(streamIDs)),
+                [&]() { return compactCodec_.encodeRemoteAudioSpectrums(audioSpectrums); });
+            return;
+        }
+
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRemoteAudioSpectrumUpdate");
 
-        FTMap audioSpectrumsMap;
-        for (auto audioSpectrum : audioSpectrums) {
-            FTArray audioSpectrumArray;
-            for (auto audioSpectrum_ : audioSpectrum.second) {
-                audioSpectrumArray.push_back(FTValue((double)audioSpectrum_));
-            }
-            audioSpectrumsMap[FTValue(audioSpectrum.first)] = FTValue(audioSpectrumArray);
+        // All spectrums are packed into one Float32List, the spectrum of
+        // streamIDs[i] is audioSpectrumData[offsets[i], offsets[i + 1])
+        FTArray streamIDs;
+        std::vector<int32_t> offsets;
+        std::vector<float> audioSpectrumData;
+        streamIDs.reserve(audioSpectrums.size());
+        offsets.reserve(audioSpectrums.size() + 1);
+        offsets.push_back(0);
+        for (auto const& audioSpectrum : audioSpectrums) {
+            streamIDs.push_back(FTValue(audioSpectrum.first));
+            audioSpectrumData.insert(audioSpectrumData.end(), audioSpectrum.second.begin(),
+                                     audioSpectrum.second.end());
+            offsets.push_back((int32_t)audioSpectrumData.size());
         }
 
-        retMap[FTValue("audioSpectrums")] = FTValue(audioSpectrumsMap);
+        retMap[FTValue("streamIDs")] = FTValue(std::move(streamIDs));
+        retMap[FTValue("offsets")] = FTValue(std::move(offsets));
+        retMap[FTValue("audioSpectrumData")] = FTValue(std::move(audioSpectrumData));
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1430,7 +1977,7 @@ void ZegoExpressEngineEventHandler::onLocalDeviceExceptionOccurred(
 
     ZF::logInfo("[onLocalDeviceExceptionOccurred] exceptionType: %d, deviceID: %s, deviceType: %d", exceptionType, deviceID.c_str(), deviceType);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onLocalDeviceExceptionOccurred)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onLocalDeviceExceptionOccurred");
 
@@ -1438,7 +1985,7 @@ void ZegoExpressEngineEventHandler::onLocalDeviceExceptionOccurred(
         retMap[FTValue("deviceType")] = FTValue((int32_t)deviceType);
         retMap[FTValue("deviceID")] = FTValue(deviceID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1447,14 +1994,14 @@ void ZegoExpressEngineEventHandler::onRemoteCameraStateUpdate(
 
     ZF::logInfo("[onRemoteCameraStateUpdate] streamID: %s, state: %d", streamID.c_str(), state);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRemoteCameraStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRemoteCameraStateUpdate");
 
         retMap[FTValue("state")] = FTValue((int32_t)state);
         retMap[FTValue("streamID")] = FTValue(streamID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1463,14 +2010,14 @@ void ZegoExpressEngineEventHandler::onRemoteSpeakerStateUpdate(
 
     ZF::logInfo("[onRemoteSpeakerStateUpdate] streamID: %s, state: %d", streamID.c_str(), state);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRemoteSpeakerStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRemoteSpeakerStateUpdate");
 
         retMap[FTValue("state")] = FTValue((int32_t)state);
         retMap[FTValue("streamID")] = FTValue(streamID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1479,14 +2026,14 @@ void ZegoExpressEngineEventHandler::onAudioVADStateUpdate(
 
     ZF::logInfo("[onRemoteSpeakerStateUpdate] type: %d, state: %d", type, state);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onAudioVADStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onAudioVADStateUpdate");
 
         retMap[FTValue("type")] = FTValue((int32_t)type);
         retMap[FTValue("state")] = FTValue((int32_t)state);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1495,7 +2042,14 @@ void ZegoExpressEngineEventHandler::onIMRecvBroadcastMessage(
 
     ZF::logInfo("[onRemoteSpeakerStateUpdate] roomID: %s, messageListCount: %d", roomID.c_str(), messageList.size());
 
-    if (eventSink_) {
+    if (imMessageBuffer_.isRunning()) {
+        if (isSubscribed(ZegoEventMethod::onIMRecvBroadcastMessage)) {
+            imMessageBuffer_.addBroadcastMessages(roomID, messageList);
+        }
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onIMRecvBroadcastMessage)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onIMRecvBroadcastMessage");
 
@@ -1516,7 +2070,7 @@ void ZegoExpressEngineEventHandler::onIMRecvBroadcastMessage(
         }
         retMap[FTValue("messageList")] = FTValue(messageListArray);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1525,7 +2079,14 @@ void ZegoExpressEngineEventHandler::onIMRecvBarrageMessage(
 
     ZF::logInfo("[onIMRecvBarrageMessage] roomID: %s, messageListCount: %d", roomID.c_str(), messageList.size());
 
-    if (eventSink_) {
+    if (imMessageBuffer_.isRunning()) {
+        if (isSubscribed(ZegoEventMethod::onIMRecvBarrageMessage)) {
+            imMessageBuffer_.addBarrageMessages(roomID, messageList);
+        }
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onIMRecvBarrageMessage)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onIMRecvBarrageMessage");
 
@@ -1546,7 +2107,7 @@ void ZegoExpressEngineEventHandler::onIMRecvBarrageMessage(
         }
         retMap[FTValue("messageList")] = FTValue(messageListArray);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1556,7 +2117,14 @@ void ZegoExpressEngineEventHandler::onIMRecvCustomCommand(const std::string &roo
 
     ZF::logInfo("[onIMRecvCustomCommand] roomID: %s, userID: %s, command: %s", roomID.c_str(), fromUser.userID.c_str(), command.c_str());
 
-    if (eventSink_) {
+    if (imMessageBuffer_.isRunning()) {
+        if (isSubscribed(ZegoEventMethod::onIMRecvCustomCommand)) {
+            imMessageBuffer_.addCustomCommand(roomID, fromUser, command);
+        }
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onIMRecvCustomCommand)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onIMRecvCustomCommand");
 
@@ -1567,7 +2135,7 @@ void ZegoExpressEngineEventHandler::onIMRecvCustomCommand(const std::string &roo
         retMap[FTValue("fromUser")] = FTValue(userMap);
         retMap[FTValue("command")] = FTValue(command);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1576,7 +2144,7 @@ void ZegoExpressEngineEventHandler::onPerformanceStatusUpdate(
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onPerformanceStatusUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onPerformanceStatusUpdate");
 
@@ -1588,7 +2156,7 @@ void ZegoExpressEngineEventHandler::onPerformanceStatusUpdate(
         statusMap[FTValue("memoryUsedApp")] = FTValue(status.memoryUsedApp);
         retMap[FTValue("status")] = FTValue(statusMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1596,12 +2164,12 @@ void ZegoExpressEngineEventHandler::onNetworkModeChanged(EXPRESS::ZegoNetworkMod
 
     ZF::logInfo("[onNetworkModeChanged] mode: %d", mode);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onNetworkModeChanged)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onNetworkModeChanged");
         retMap[FTValue("mode")] = FTValue((int32_t)mode);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1610,13 +2178,13 @@ void ZegoExpressEngineEventHandler::onNetworkSpeedTestError(
 
     ZF::logInfo("[onNetworkSpeedTestError] errorCode: %d, type: %d", errorCode, type);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onNetworkSpeedTestError)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onNetworkSpeedTestError");
         retMap[FTValue("errorCode")] = FTValue(errorCode);
         retMap[FTValue("type")] = FTValue((int32_t)type);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1625,7 +2193,7 @@ void ZegoExpressEngineEventHandler::onNetworkSpeedTestQualityUpdate(
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onNetworkSpeedTestQualityUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onNetworkSpeedTestQualityUpdate");
         FTMap qualityMap;
@@ -1637,7 +2205,7 @@ void ZegoExpressEngineEventHandler::onNetworkSpeedTestQualityUpdate(
         retMap[FTValue("quality")] = FTValue(qualityMap);
         retMap[FTValue("type")] = FTValue((int32_t)type);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1645,12 +2213,12 @@ void ZegoExpressEngineEventHandler::onRecvExperimentalAPI(const std::string &con
 
     ZF::logInfo("[onRecvExperimentalAPI] content: %s", content.c_str());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRecvExperimentalAPI)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRecvExperimentalAPI");
         retMap[FTValue("content")] = FTValue(content);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1660,14 +2228,14 @@ void ZegoExpressEngineEventHandler::onNetworkQuality(
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onNetworkQuality)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onNetworkQuality");
         retMap[FTValue("upstreamQuality")] = FTValue((int32_t)upstreamQuality);
         retMap[FTValue("downstreamQuality")] = FTValue((int32_t)downstreamQuality);
         retMap[FTValue("userID")] = FTValue(userID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1677,7 +2245,14 @@ void ZegoExpressEngineEventHandler::onReceiveRealTimeSequentialData(
     
     // High frequency callbacks do not log
     
-    if (eventSink_) {
+    if (realTimeSequentialDataBatcher_.isRunning()) {
+        if (isSubscribed(ZegoEventMethod::onReceiveRealTimeSequentialData)) {
+            realTimeSequentialDataBatcher_.add(manager->getIndex(), data, dataLength, streamID);
+        }
+        return;
+    }
+
+    if (isSubscribed(ZegoEventMethod::onReceiveRealTimeSequentialData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onReceiveRealTimeSequentialData");
         retMap[FTValue("realTimeSequentialDataManagerIndex")] = FTValue(manager->getIndex());
@@ -1688,7 +2263,7 @@ void ZegoExpressEngineEventHandler::onReceiveRealTimeSequentialData(
         retMap[FTValue("data")] = FTValue(dataArray);
         retMap[FTValue("streamID")] = FTValue(streamID);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1698,13 +2273,13 @@ void ZegoExpressEngineEventHandler::onRangeAudioMicrophoneStateUpdate(
 
     ZF::logInfo("[onRangeAudioMicrophoneStateUpdate] index: %d, state: %d, errorCode: %d", 0, state, errorCode);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRangeAudioMicrophoneStateUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRangeAudioMicrophoneStateUpdate");
         retMap[FTValue("state")] = FTValue((int32_t)state);
         retMap[FTValue("errorCode")] = FTValue(errorCode);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1714,7 +2289,11 @@ void ZegoExpressEngineEventHandler::onProcessCapturedAudioData(unsigned char *da
                                                                double timestamp) {
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    ZegoCustomAudioProcessManager::getInstance()->process(
+        ZG_FLUTTER_AUDIO_PROCESS_TYPE_CAPTURED, data, dataLength, (unsigned int)param->channel,
+        (unsigned int)param->sampleRate, "");
+
+    if (isSubscribed(ZegoEventMethod::onProcessCapturedAudioData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onProcessCapturedAudioData");
         std::vector<uint8_t> dataArray(data, data + dataLength);
@@ -1727,7 +2306,7 @@ void ZegoExpressEngineEventHandler::onProcessCapturedAudioData(unsigned char *da
         paramMap[FTValue("channel")] = FTValue((int32_t)param->channel);
         retMap[FTValue("param")] = FTValue(paramMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1737,7 +2316,11 @@ void ZegoExpressEngineEventHandler::onProcessCapturedAudioDataAfterUsedHeadphone
 
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    ZegoCustomAudioProcessManager::getInstance()->process(
+        ZG_FLUTTER_AUDIO_PROCESS_TYPE_CAPTURED_AFTER_HEADPHONE_MONITOR, data, dataLength, (unsigned int)param->channel,
+        (unsigned int)param->sampleRate, "");
+
+    if (isSubscribed(ZegoEventMethod::onProcessCapturedAudioDataAfterUsedHeadphoneMonitor)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onProcessCapturedAudioDataAfterUsedHeadphoneMonitor");
         std::vector<uint8_t> dataArray(data, data + dataLength);
@@ -1750,7 +2333,7 @@ void ZegoExpressEngineEventHandler::onProcessCapturedAudioDataAfterUsedHeadphone
         paramMap[FTValue("channel")] = FTValue((int32_t)param->channel);
         retMap[FTValue("param")] = FTValue(paramMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1761,7 +2344,11 @@ void ZegoExpressEngineEventHandler::onProcessRemoteAudioData(unsigned char *data
                                                              double timestamp) {
     // High frequency callbacks do not log
 
-    if (eventSink_) {
+    ZegoCustomAudioProcessManager::getInstance()->process(
+        ZG_FLUTTER_AUDIO_PROCESS_TYPE_REMOTE, data, dataLength, (unsigned int)param->channel,
+        (unsigned int)param->sampleRate, streamID);
+
+    if (isSubscribed(ZegoEventMethod::onProcessRemoteAudioData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onProcessRemoteAudioData");
         std::vector<uint8_t> dataArray(data, data + dataLength);
@@ -1775,7 +2362,7 @@ void ZegoExpressEngineEventHandler::onProcessRemoteAudioData(unsigned char *data
         paramMap[FTValue("channel")] = FTValue((int32_t)param->channel);
         retMap[FTValue("param")] = FTValue(paramMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1786,7 +2373,11 @@ void ZegoExpressEngineEventHandler::onProcessPlaybackAudioData(unsigned char *da
 
     // High frequency callbacks do not log
     
-    if (eventSink_) {
+    ZegoCustomAudioProcessManager::getInstance()->process(
+        ZG_FLUTTER_AUDIO_PROCESS_TYPE_PLAYBACK, data, dataLength, (unsigned int)param->channel,
+        (unsigned int)param->sampleRate, "");
+
+    if (isSubscribed(ZegoEventMethod::onProcessPlaybackAudioData)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onProcessPlaybackAudioData");
         std::vector<uint8_t> dataArray(data, data + dataLength);
@@ -1799,7 +2390,7 @@ void ZegoExpressEngineEventHandler::onProcessPlaybackAudioData(unsigned char *da
         paramMap[FTValue("channel")] = FTValue((int32_t)param->channel);
         retMap[FTValue("param")] = FTValue(paramMap);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1819,13 +2410,13 @@ void ZegoExpressEngineEventHandler::onExceptionOccurred(
 
     ZF::logInfo("[onExceptionOccurred] index: %d, exceptionType: %d", source->getIndex(), exceptionType);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onExceptionOccurred)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onExceptionOccurred");
         retMap[FTValue("screenCaptureSourceIndex")] = FTValue(source->getIndex());
         retMap[FTValue("exceptionType")] = FTValue(static_cast<int32_t>(exceptionType));
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1835,7 +2426,7 @@ void ZegoExpressEngineEventHandler::onWindowStateChanged(
 
     ZF::logInfo("[onWindowStateChanged] index: %d, windowState: %d", source->getIndex(), windowState);
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onWindowStateChanged)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onWindowStateChanged");
         retMap[FTValue("screenCaptureSourceIndex")] = FTValue(source->getIndex());
@@ -1849,14 +2440,14 @@ void ZegoExpressEngineEventHandler::onWindowStateChanged(
 
         retMap[FTValue("windowRect")] = rectMap;
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
 void ZegoExpressEngineEventHandler::onRectChanged(EXPRESS::IZegoScreenCaptureSource* source, EXPRESS::ZegoRect captureRect) {
     ZF::logInfo("[onRectChanged] index: %d", source->getIndex());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onRectChanged)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onRectChanged");
         retMap[FTValue("screenCaptureSourceIndex")] = FTValue(source->getIndex());
@@ -1869,7 +2460,7 @@ void ZegoExpressEngineEventHandler::onRectChanged(EXPRESS::IZegoScreenCaptureSou
 
         retMap[FTValue("captureRect")] = rectMap;
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1877,13 +2468,13 @@ void ZegoExpressEngineEventHandler::onInit(EXPRESS::IZegoAIVoiceChanger *aiVoice
                                            int errorCode) {
     ZF::logInfo("[onAIVoiceChangerInit] index: %d", aiVoiceChanger->getIndex());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onAIVoiceChangerInit)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onAIVoiceChangerInit");
         retMap[FTValue("aiVoiceChangerIndex")] = FTValue(aiVoiceChanger->getIndex());
         retMap[FTValue("errorCode")] = FTValue(errorCode);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1891,13 +2482,13 @@ void ZegoExpressEngineEventHandler::onUpdate(EXPRESS::IZegoAIVoiceChanger *aiVoi
                                              int errorCode) {
     ZF::logInfo("[onAIVoiceChangerUpdate] index: %d", aiVoiceChanger->getIndex());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onAIVoiceChangerUpdate)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onAIVoiceChangerUpdate");
         retMap[FTValue("aiVoiceChangerIndex")] = FTValue(aiVoiceChanger->getIndex());
         retMap[FTValue("errorCode")] = FTValue(errorCode);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
 
@@ -1906,7 +2497,7 @@ void ZegoExpressEngineEventHandler::onGetSpeakerList(
     const std::vector<EXPRESS::ZegoAIVoiceChangerSpeakerInfo> &speakerList) {
     ZF::logInfo("[onAIVoiceChangerGetSpeakerList] index: %d", aiVoiceChanger->getIndex());
 
-    if (eventSink_) {
+    if (isSubscribed(ZegoEventMethod::onAIVoiceChangerGetSpeakerList)) {
         FTMap retMap;
         retMap[FTValue("method")] = FTValue("onAIVoiceChangerGetSpeakerList");
         retMap[FTValue("aiVoiceChangerIndex")] = FTValue(aiVoiceChanger->getIndex());
@@ -1921,6 +2512,6 @@ void ZegoExpressEngineEventHandler::onGetSpeakerList(
         }
         retMap[FTValue("speakerList")] = FTValue(speakerListArray);
 
-        eventSink_->Success(retMap);
+        postEvent(std::move(retMap));
     }
 }
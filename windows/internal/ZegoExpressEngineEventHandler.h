@@ -1,9 +1,23 @@
 #pragma once
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <flutter/event_channel.h>
 
 #include <ZegoExpressSDK.h>
+#include "ZegoAudioDataRing.h"
+#include "ZegoAudioMeterAggregator.h"
+#include "ZegoCompactEventCodec.h"
+#include "ZegoEventMethods.h"
+#include "ZegoIMMessageBuffer.h"
+#include "ZegoPlatformEventQueue.h"
+#include "ZegoRealTimeSequentialDataBatcher.h"
+#include "ZegoRoomRoster.h"
+#include "ZegoSEIBatcher.h"
+#include "ZegoStreamQualityAggregator.h"
 using namespace ZEGO;
 
 #define FTValue(varName) flutter::EncodableValue(varName)
@@ -26,7 +40,14 @@ class ZegoExpressEngineEventHandler
     , public EXPRESS::IZegoAIVoiceChangerEventHandler
 {
 public:
-    ~ZegoExpressEngineEventHandler(){ std::cout << "event handler destroy" << std::endl;  }
+    ~ZegoExpressEngineEventHandler(){
+        // Their last batches are flushed while the members they use are alive.
+        audioMeterAggregator_.stop();
+        imMessageBuffer_.stop();
+        realTimeSequentialDataBatcher_.stop();
+        seiBatcher_.stop();
+        std::cout << "event handler destroy" << std::endl;
+    }
     ZegoExpressEngineEventHandler() { std::cout << "event handler create" << std::endl; }
 
     static std::shared_ptr<ZegoExpressEngineEventHandler>& getInstance()
@@ -41,6 +62,75 @@ public:
     void setEventSink(std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> &&eventSink);
     void clearEventSink();
 
+    /// Events are delivered on the thread that processes `message` of `window`,
+    /// whose window proc calls `drainEvents`
+    void attachPlatformWindow(HWND window, UINT message);
+    void detachPlatformWindow();
+    void drainEvents();
+
+    ZegoPlatformEventQueue::Stats getEventQueueStats();
+
+    /// Quality and meter events are kept latest only and raw data events are
+    /// dropped oldest first beyond `maxDepth`, state events are never dropped
+    void setEventLaneMaxDepth(ZegoEventLane lane, uint32_t maxDepth);
+    FTMap getEventLaneStats();
+
+    /// Quality, sound level info and spectrum events are sent as packed
+    /// bytes instead of maps, see `ZegoCompactEventCodec`
+    void enableCompactEvents(bool enable);
+
+    /// Sound level and spectrum events are merged into one
+    /// `onAudioMetersUpdate` event every `intervalMs`
+    void enableAudioMeterCoalescing(bool enable, uint32_t intervalMs);
+
+    /// Events of the given methods are dropped before they are serialized,
+    /// unknown method names are ignored
+    void setUnsubscribedEvents(const std::vector<std::string> &methods);
+
+    /// Number of events dropped per unsubscribed method
+    FTMap getSuppressedEventCounts();
+
+    /// PCM of the audio data observer `source` (a `ZegoAudioDataCallbackBitMask`
+    /// bit, the player source per stream) is written into a ring that dart
+    /// reads through ffi instead of being sent as events. Returns the ring
+    /// address handed to dart, or 0 if the source already has a ring.
+    int64_t createAudioDataRing(int32_t source, const std::string &streamID, uint32_t capacity, bool notify);
+    bool destroyAudioDataRing(int32_t source, const std::string &streamID);
+
+    /// p50/p95/max of the publisher and player quality of the given streams
+    /// over the last `windowSeconds`, see `ZegoStreamQualityAggregator`
+    FTMap queryStreamQuality(const std::vector<std::string> &streamIDs, uint32_t windowSeconds);
+
+    /// User and stream updates are applied to a native roster and dart only
+    /// receives an `onRoomRosterUpdate` summary, see `ZegoRoomRoster`.
+    /// Returns false without enabling it while a room is logged in.
+    bool enableRoomRoster(bool enable);
+    /// Forgets the logged in rooms and their roster when the engine is destroyed
+    void clearLoggedInRooms();
+    FTMap getRoomUsers(const std::string &roomID, uint32_t offset, uint32_t limit, const std::string &filter);
+    FTMap getRoomStreams(const std::string &roomID, uint32_t offset, uint32_t limit, const std::string &filter);
+
+    /// Broadcast, barrage and custom command messages are buffered natively
+    /// and delivered as one `onIMMessageBatch` event per interval, see
+    /// `ZegoIMMessageBuffer`
+    void enableIMMessageBuffer(bool enable, const ZegoIMMessageBuffer::Config &config);
+    FTMap getIMMessageBufferStats();
+
+    /// Inbound real-time sequential data is delivered as one packed
+    /// `onReceiveRealTimeSequentialDataBatch` event per manager and interval,
+    /// see `ZegoRealTimeSequentialDataBatcher`
+    void enableRealTimeSequentialDataBatching(bool enable, uint32_t intervalMs, uint32_t maxPendingBytes);
+    FTMap getRealTimeSequentialDataStats();
+
+    /// SEI of played streams and media players is delivered as one packed
+    /// `onSEIBatch` event per interval, see `ZegoSEIBatcher`
+    void enableSEIBatching(bool enable, const ZegoSEIBatcher::Config &config);
+    FTMap getSEIBatchStats();
+
+    /// Completes a real-time sequential data send made through ffi, which
+    /// has no method result to reply to
+    void postRealTimeSequentialDataSent(int64_t sequence, int32_t errorCode);
+
 private:
     static std::shared_ptr<ZegoExpressEngineEventHandler> m_instance;
 
@@ -274,6 +364,84 @@ protected:
                           const std::vector<EXPRESS::ZegoAIVoiceChangerSpeakerInfo> &speakerList) override;
 
 private:
-    std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> eventSink_;
+    inline bool hasEventSink() {
+        return hasEventSink_;
+    }
+
+    // Checks the sink and the subscription mask at the top of each callback.
+    inline bool isSubscribed(ZegoEventMethod method) {
+        if (!hasEventSink_) {
+            return false;
+        }
+        auto index = static_cast<size_t>(method);
+        if (unsubscribedMask_[index / 64].load(std::memory_order_relaxed) & (1ULL << (index % 64))) {
+            suppressedCounts_[index].fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    // Queues the event for delivery on the platform thread.
+    void postEvent(FTMap &&event);
+
+    // Queues the packet of encode on the latest lane under key, see
+    // ZegoCompactEventCodec::latestKey.
+    void postCompactEvent(const std::string &key, const std::function<std::vector<uint8_t>()> &encode);
+
+    void deliverEvent(const flutter::EncodableValue &event);
 
+    void postRoomRosterUpdate(const std::string &roomID, ZegoRoomRosterType rosterType,
+                              EXPRESS::ZegoUpdateType updateType,
+                              const ZegoRoomRoster::UpdateSummary &summary,
+                              const std::string &extendedData = "");
+
+    // Returns true if the frame was taken by an audio data ring.
+    bool writeAudioDataRing(int32_t source, const std::string &streamID, const unsigned char *data,
+                            unsigned int dataLength, EXPRESS::ZegoAudioFrameParam param);
+
+    std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> eventSink_;
+    std::atomic_bool hasEventSink_ = false;
+    std::mutex eventSinkMutex_;
+
+    // Declared before everything that pushes into it, so it outlives them.
+    ZegoPlatformEventQueue eventQueue_{8192, [this](const flutter::EncodableValue &event) {
+        deliverEvent(event);
+    }};
+
+    static constexpr size_t kEventMaskWordCount = (static_cast<size_t>(ZegoEventMethod::Count) + 63) / 64;
+    std::atomic<uint64_t> unsubscribedMask_[kEventMaskWordCount] = {};
+    std::atomic<uint64_t> suppressedCounts_[static_cast<size_t>(ZegoEventMethod::Count)] = {};
+
+    // Held while encoding and queueing, so a packet is queued before the
+    // packets that use the stream IDs it interned.
+    std::mutex compactCodecMutex_;
+    std::atomic_bool isCompactEventEnabled_ = false;
+    ZegoCompactEventCodec compactCodec_;
+
+    ZegoAudioDataRingSet audioDataRings_;
+
+    ZegoStreamQualityAggregator qualityAggregator_;
+
+    std::atomic_bool isRoomRosterEnabled_ = false;
+    ZegoRoomRoster roomRoster_;
+    // Rooms from their first state update until disconnected, held while
+    // enabling the roster.
+    std::mutex loggedInRoomsMutex_;
+    std::set<std::string> loggedInRooms_;
+
+    ZegoAudioMeterAggregator audioMeterAggregator_;
+    // Queue position of the last audio meters event.
+    std::atomic<uint64_t> audioMetersPosition_ = 0;
+
+    ZegoIMMessageBuffer imMessageBuffer_;
+    // Queue position of the last message batch event.
+    std::atomic<uint64_t> imMessageBatchPosition_ = 0;
+
+    ZegoRealTimeSequentialDataBatcher realTimeSequentialDataBatcher_;
+    // Queue position of the last real-time sequential data batch event.
+    std::atomic<uint64_t> realTimeSequentialDataBatchPosition_ = 0;
+
+    ZegoSEIBatcher seiBatcher_;
+    // Queue position of the last SEI batch event.
+    std::atomic<uint64_t> seiBatchPosition_ = 0;
 };
\ No newline at end of file
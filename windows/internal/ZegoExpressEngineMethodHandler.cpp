@@ -1,5 +1,6 @@
 #include "ZegoExpressEngineMethodHandler.h"
 #include "ZegoExpressEngineEventHandler.h"
+#include "ZegoTaskExecutor.h"
 #include "ZegoTextureRendererController.h"
 
 #include <flutter/encodable_value.h>
@@ -16,6 +17,15 @@
 #include "zego_express_engine/ZegoMediaPlayerVideoManager.h"
 #include "zego_express_engine/ZegoMediaPlayerBlockDataManager.h"
 
+// Value of `key` in the arguments of a method call, null if dart did not
+// pass it.
+static const flutter::EncodableValue &getArgument(const flutter::EncodableMap &argument,
+                                                  const char *key) {
+    static const flutter::EncodableValue nullValue;
+    auto it = argument.find(FTValue(key));
+    return it != argument.end() ? it->second : nullValue;
+}
+
 void ZegoExpressEngineMethodHandler::initApiCalledCallback() {
     EXPRESS::ZegoExpressSDK::setApiCalledCallback(ZegoExpressEngineEventHandler::getInstance());
 }
@@ -24,24 +34,77 @@ bool ZegoExpressEngineMethodHandler::isEngineCreated() {
     return EXPRESS::ZegoExpressSDK::getEngine();
 }
 
+EXPRESS::IZegoRealTimeSequentialDataManager *
+ZegoExpressEngineMethodHandler::getRealTimeSequentialDataManager(int index) {
+    auto it = dataManagerMap_.find(index);
+    return it != dataManagerMap_.end() ? it->second : nullptr;
+}
+
+bool ZegoExpressEngineMethodHandler::fetchCustomAudioRenderRing(int64_t address,
+                                                                uint32_t chunkCount,
+                                                                uint32_t &fetchedCount) {
+    std::lock_guard<std::mutex> lock(customAudioRenderRingMutex_);
+    if (!customAudioRenderRing_ || customAudioRenderRing_->getAddress() != address) {
+        return false;
+    }
+    fetchedCount = customAudioRenderRing_->fetch(chunkCount);
+    return true;
+}
+
+void ZegoExpressEngineMethodHandler::runOnQueue(
+    ZegoTaskQueue queue, std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result,
+    std::function<flutter::EncodableValue()> task) {
+    if (!ZegoTaskExecutor::getInstance().isPlatformAttached()) {
+        // The reply could not get back to the platform thread.
+        result->Success(task());
+        return;
+    }
+
+    auto sharedPtrResult =
+        std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
+    queuedCallCounts_[queue]++;
+    ZegoTaskExecutor::getInstance().post(queue, [=]() {
+        // Replies even if the task throws, later calls wait for the reply.
+        std::function<void()> reply;
+        try {
+            auto value = task();
+            reply = [=]() { sharedPtrResult->Success(value); };
+        } catch (std::exception &e) {
+            std::string message = e.what();
+            ZF::logInfo("[runOnQueue] queue: %d, exception: %s", queue, message.c_str());
+            reply = [=]() { sharedPtrResult->Error("method_call_error", message); };
+        }
+        ZegoTaskExecutor::getInstance().postToPlatform([=]() {
+            reply();
+            if (--queuedCallCounts_[queue] == 0 && queuedCallsDone_) {
+                queuedCallsDone_();
+            }
+        });
+    });
+}
+
+void ZegoExpressEngineMethodHandler::setQueuedCallsDoneCallback(std::function<void()> callback) {
+    queuedCallsDone_ = std::move(callback);
+}
+
 void ZegoExpressEngineMethodHandler::getVersion(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->Success(EXPRESS::ZegoExpressSDK::getVersion());
 }
 
 void ZegoExpressEngineMethodHandler::isFeatureSupported(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto featureType = std::get<int32_t>(argument[FTValue("featureType")]);
+    auto featureType = std::get<int32_t>(getArgument(argument, "featureType"));
     result->Success(
         EXPRESS::ZegoExpressSDK::isFeatureSupported((EXPRESS::ZegoFeatureType)featureType));
 }
 
 void ZegoExpressEngineMethodHandler::setPluginVersion(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    std::string version = std::get<std::string>(argument[FTValue("version")]);
+    std::string version = std::get<std::string>(getArgument(argument, "version"));
 
     version = "*** Plugin Version: " + version;
 
@@ -51,9 +114,9 @@ void ZegoExpressEngineMethodHandler::setPluginVersion(
 }
 
 void ZegoExpressEngineMethodHandler::getAssetAbsolutePath(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    std::string assetPath = std::get<std::string>(argument[FTValue("assetPath")]);
+    std::string assetPath = std::get<std::string>(getArgument(argument, "assetPath"));
     wchar_t exePath[MAX_PATH] = {0};
     ::GetModuleFileName(NULL, exePath, MAX_PATH);
     std::wstring exePathStrW{exePath};
@@ -70,7 +133,7 @@ void ZegoExpressEngineMethodHandler::getAssetAbsolutePath(
 }
 
 void ZegoExpressEngineMethodHandler::createEngine(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     initApiCalledCallback();
 
@@ -79,10 +142,10 @@ void ZegoExpressEngineMethodHandler::createEngine(
                              {"thirdparty_framework_info", "flutter"}};
     EXPRESS::ZegoExpressSDK::setEngineConfig(config);
     // TODO: need to write getValue utils
-    unsigned int appID = argument[FTValue("appID")].LongValue();
-    std::string appSign = std::get<std::string>(argument[FTValue("appSign")]);
-    bool isTestEnv = std::get<bool>(argument[FTValue("isTestEnv")]);
-    int scenario = std::get<int32_t>(argument[FTValue("scenario")]);
+    unsigned int appID = getArgument(argument, "appID").LongValue();
+    std::string appSign = std::get<std::string>(getArgument(argument, "appSign"));
+    bool isTestEnv = std::get<bool>(getArgument(argument, "isTestEnv"));
+    int scenario = std::get<int32_t>(getArgument(argument, "scenario"));
 
     auto engine = EXPRESS::ZegoExpressSDK::createEngine(
         appID, appSign, isTestEnv, (EXPRESS::ZegoScenario)scenario,
@@ -98,9 +161,9 @@ void ZegoExpressEngineMethodHandler::createEngine(
 }
 
 void ZegoExpressEngineMethodHandler::createEngineWithProfile(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    FTMap profileMap = std::get<FTMap>(argument[FTValue("profile")]);
+    FTMap profileMap = std::get<FTMap>(getArgument(argument, "profile"));
     if (profileMap.size() > 0) {
 
         initApiCalledCallback();
@@ -130,14 +193,20 @@ void ZegoExpressEngineMethodHandler::createEngineWithProfile(
 }
 
 void ZegoExpressEngineMethodHandler::destroyEngine(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     auto engine = EXPRESS::ZegoExpressSDK::getEngine();
 
     if (engine) {
+        // Queued device and publish calls still use the engine.
+        ZegoTaskExecutor::getInstance().flush();
+        // Queued plugin log lines go to the SDK log before it is closed.
+        ZF::flushLog();
         ZegoTextureRendererController::getInstance()->uninit();
+        ZegoExpressEngineEventHandler::getInstance()->clearLoggedInRooms();
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
+        std::unique_lock<std::shared_mutex> lock(engineMutex_);
         EXPRESS::ZegoExpressSDK::destroyEngine(engine, [=]() { sharedPtrResult->Success(); });
     } else {
         result->Success();
@@ -145,9 +214,9 @@ void ZegoExpressEngineMethodHandler::destroyEngine(
 }
 
 void ZegoExpressEngineMethodHandler::setEngineConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    FTMap configMap = std::get<FTMap>(argument[FTValue("config")]);
+    FTMap configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoEngineConfig config;
 
     if (configMap.size() > 0) {
@@ -176,9 +245,9 @@ void ZegoExpressEngineMethodHandler::setEngineConfig(
 }
 
 void ZegoExpressEngineMethodHandler::setLogConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    FTMap configMap = std::get<FTMap>(argument[FTValue("config")]);
+    FTMap configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoLogConfig config;
     if (configMap.size() > 0) {
         config.logPath = std::get<std::string>(configMap[FTValue("logPath")]);
@@ -191,9 +260,9 @@ void ZegoExpressEngineMethodHandler::setLogConfig(
 }
 
 void ZegoExpressEngineMethodHandler::setLocalProxyConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto proxyListArray = std::get<FTArray>(argument[FTValue("proxyList")]);
+    auto proxyListArray = std::get<FTArray>(getArgument(argument, "proxyList"));
     std::vector<EXPRESS::ZegoProxyInfo> proxyList;
     for (auto proxy_ : proxyListArray) {
         EXPRESS::ZegoProxyInfo proxy;
@@ -205,7 +274,7 @@ void ZegoExpressEngineMethodHandler::setLocalProxyConfig(
         proxy.password = std::get<std::string>(proxyMap[FTValue("password")]);
         proxyList.push_back(proxy);
     }
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::setLocalProxyConfig(proxyList, enable);
 
@@ -213,9 +282,9 @@ void ZegoExpressEngineMethodHandler::setLocalProxyConfig(
 }
 
 void ZegoExpressEngineMethodHandler::setCloudProxyConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto proxyListArray = std::get<FTArray>(argument[FTValue("proxyList")]);
+    auto proxyListArray = std::get<FTArray>(getArgument(argument, "proxyList"));
     std::vector<EXPRESS::ZegoProxyInfo> proxyList;
     for (auto proxy_ : proxyListArray) {
         EXPRESS::ZegoProxyInfo proxy;
@@ -227,9 +296,9 @@ void ZegoExpressEngineMethodHandler::setCloudProxyConfig(
         proxy.password = std::get<std::string>(proxyMap[FTValue("password")]);
         proxyList.push_back(proxy);
     }
-    auto token = std::get<std::string>(argument[FTValue("token")]);
+    auto token = std::get<std::string>(getArgument(argument, "token"));
 
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::setCloudProxyConfig(proxyList, token, enable);
 
@@ -237,28 +306,28 @@ void ZegoExpressEngineMethodHandler::setCloudProxyConfig(
 }
 
 void ZegoExpressEngineMethodHandler::setRoomMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mode = (EXPRESS::ZegoRoomMode)std::get<int32_t>(argument[FTValue("mode")]);
+    auto mode = (EXPRESS::ZegoRoomMode)std::get<int32_t>(getArgument(argument, "mode"));
     EXPRESS::ZegoExpressSDK::setRoomMode(mode);
 
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::setLicense(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto license = std::get<std::string>(argument[FTValue("license")]);
+    auto license = std::get<std::string>(getArgument(argument, "license"));
     EXPRESS::ZegoExpressSDK::setLicense(license);
 
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::setGeoFence(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto type = (EXPRESS::ZegoGeoFenceType)std::get<int32_t>(argument[FTValue("type")]);
-    auto areaList_ = std::get<FTArray>(argument[FTValue("areaList")]);
+    auto type = (EXPRESS::ZegoGeoFenceType)std::get<int32_t>(getArgument(argument, "type"));
+    auto areaList_ = std::get<FTArray>(getArgument(argument, "areaList"));
     std::vector<int> areaList;
     for (auto area : areaList_) {
         areaList.push_back(std::get<int32_t>(area));
@@ -269,48 +338,48 @@ void ZegoExpressEngineMethodHandler::setGeoFence(
 }
 
 void ZegoExpressEngineMethodHandler::setRoomScenario(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto scenario = (EXPRESS::ZegoScenario)std::get<int32_t>(argument[FTValue("scenario")]);
+    auto scenario = (EXPRESS::ZegoScenario)std::get<int32_t>(getArgument(argument, "scenario"));
     EXPRESS::ZegoExpressSDK::getEngine()->setRoomScenario(scenario);
 
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::uploadLog(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::getEngine()->uploadLog();
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::submitLog(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::submitLog();
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::enableDebugAssistant(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
     EXPRESS::ZegoExpressSDK::getEngine()->enableDebugAssistant(enable);
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::callExperimentalAPI(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto params = std::get<std::string>(argument[FTValue("params")]);
+    auto params = std::get<std::string>(getArgument(argument, "params"));
     EXPRESS::ZegoExpressSDK::getEngine()->callExperimentalAPI(params);
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::setDummyCaptureImagePath(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto filePath = std::get<std::string>(argument[FTValue("filePath")]);
+    auto filePath = std::get<std::string>(getArgument(argument, "filePath"));
     const std::string flutterAssertTaget = "flutter-asset://";
     if (filePath.compare(0, flutterAssertTaget.size(), flutterAssertTaget) == 0) {
         filePath.replace(0, flutterAssertTaget.size(), "");
@@ -327,23 +396,23 @@ void ZegoExpressEngineMethodHandler::setDummyCaptureImagePath(
             return;
         }
     }
-    auto channel = (EXPRESS::ZegoPublishChannel)std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = (EXPRESS::ZegoPublishChannel)std::get<int32_t>(getArgument(argument, "channel"));
     EXPRESS::ZegoExpressSDK::getEngine()->setDummyCaptureImagePath(filePath, channel);
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::loginRoom(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto roomID = std::get<std::string>(argument[FTValue("roomID")]);
-    auto userMap = std::get<flutter::EncodableMap>(argument[FTValue("user")]);
+    auto roomID = std::get<std::string>(getArgument(argument, "roomID"));
+    auto userMap = std::get<flutter::EncodableMap>(getArgument(argument, "user"));
 
     EXPRESS::ZegoUser user{std::get<std::string>(userMap[FTValue("userID")]),
                            std::get<std::string>(userMap[FTValue("userName")])};
 
     flutter::EncodableMap configMap;
-    if (std::holds_alternative<flutter::EncodableMap>(argument[FTValue("config")])) {
-        configMap = std::get<flutter::EncodableMap>(argument[FTValue("config")]);
+    if (std::holds_alternative<flutter::EncodableMap>(getArgument(argument, "config"))) {
+        configMap = std::get<flutter::EncodableMap>(getArgument(argument, "config"));
     }
 
     EXPRESS::ZegoRoomConfig config;
@@ -369,12 +438,12 @@ void ZegoExpressEngineMethodHandler::loginRoom(
 }
 
 void ZegoExpressEngineMethodHandler::logoutRoom(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     auto sharedPtrResult =
         std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
-    if (!argument[FTValue("roomID")].IsNull()) {
-        auto roomID = std::get<std::string>(argument[FTValue("roomID")]);
+    if (!getArgument(argument, "roomID").IsNull()) {
+        auto roomID = std::get<std::string>(getArgument(argument, "roomID"));
 
         EXPRESS::ZegoExpressSDK::getEngine()->logoutRoom(
             roomID, [=](int errorCode, std::string extendedData) {
@@ -407,14 +476,14 @@ void ZegoExpressEngineMethodHandler::logoutRoom(
 }
 
 void ZegoExpressEngineMethodHandler::switchRoom(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto fromRoomID = std::get<std::string>(argument[FTValue("fromRoomID")]);
-    auto toRoomID = std::get<std::string>(argument[FTValue("toRoomID")]);
+    auto fromRoomID = std::get<std::string>(getArgument(argument, "fromRoomID"));
+    auto toRoomID = std::get<std::string>(getArgument(argument, "toRoomID"));
 
     std::unique_ptr<EXPRESS::ZegoRoomConfig> configPtr = nullptr;
-    if (std::holds_alternative<flutter::EncodableMap>(argument[FTValue("config")])) {
-        auto configMap = std::get<flutter::EncodableMap>(argument[FTValue("config")]);
+    if (std::holds_alternative<flutter::EncodableMap>(getArgument(argument, "config"))) {
+        auto configMap = std::get<flutter::EncodableMap>(getArgument(argument, "config"));
 
         if (configMap.size() > 0) {
             configPtr = std::make_unique<EXPRESS::ZegoRoomConfig>();
@@ -432,10 +501,10 @@ void ZegoExpressEngineMethodHandler::switchRoom(
 }
 
 void ZegoExpressEngineMethodHandler::renewToken(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto roomID = std::get<std::string>(argument[FTValue("roomID")]);
-    auto token = std::get<std::string>(argument[FTValue("token")]);
+    auto roomID = std::get<std::string>(getArgument(argument, "roomID"));
+    auto token = std::get<std::string>(getArgument(argument, "token"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->renewToken(roomID, token);
 
@@ -443,11 +512,11 @@ void ZegoExpressEngineMethodHandler::renewToken(
 }
 
 void ZegoExpressEngineMethodHandler::setRoomExtraInfo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto roomID = std::get<std::string>(argument[FTValue("roomID")]);
-    auto key = std::get<std::string>(argument[FTValue("key")]);
-    auto value = std::get<std::string>(argument[FTValue("value")]);
+    auto roomID = std::get<std::string>(getArgument(argument, "roomID"));
+    auto key = std::get<std::string>(getArgument(argument, "key"));
+    auto value = std::get<std::string>(getArgument(argument, "value"));
 
     auto sharedPtrResult =
         std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -460,13 +529,13 @@ void ZegoExpressEngineMethodHandler::setRoomExtraInfo(
 }
 
 void ZegoExpressEngineMethodHandler::startPublishingStream(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
-    if (std::holds_alternative<flutter::EncodableMap>(argument[FTValue("config")])) {
-        auto configMap = std::get<flutter::EncodableMap>(argument[FTValue("config")]);
+    if (std::holds_alternative<flutter::EncodableMap>(getArgument(argument, "config"))) {
+        auto configMap = std::get<flutter::EncodableMap>(getArgument(argument, "config"));
 
         if (configMap.size() > 0) {
             EXPRESS::ZegoPublisherConfig config;
@@ -477,33 +546,41 @@ void ZegoExpressEngineMethodHandler::startPublishingStream(
             config.streamCensorshipMode = (EXPRESS::ZegoStreamCensorshipMode)std::get<int32_t>(
                 configMap[FTValue("streamCensorshipMode")]);
 
-            EXPRESS::ZegoExpressSDK::getEngine()->startPublishingStream(
-                streamID, config, (EXPRESS::ZegoPublishChannel)channel);
+            runOnQueue(ZEGO_TASK_QUEUE_PUBLISH, std::move(result), [=]() {
+                EXPRESS::ZegoExpressSDK::getEngine()->startPublishingStream(
+                    streamID, config, (EXPRESS::ZegoPublishChannel)channel);
+                return FTValue();
+            });
         } else {
-            EXPRESS::ZegoExpressSDK::getEngine()->startPublishingStream(
-                streamID, (EXPRESS::ZegoPublishChannel)channel);
+            runOnQueue(ZEGO_TASK_QUEUE_PUBLISH, std::move(result), [=]() {
+                EXPRESS::ZegoExpressSDK::getEngine()->startPublishingStream(
+                    streamID, (EXPRESS::ZegoPublishChannel)channel);
+                return FTValue();
+            });
         }
+        return;
     }
 
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::stopPublishingStream(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
-
-    EXPRESS::ZegoExpressSDK::getEngine()->stopPublishingStream(
-        (EXPRESS::ZegoPublishChannel)channel);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
-    result->Success();
+    runOnQueue(ZEGO_TASK_QUEUE_PUBLISH, std::move(result), [=]() {
+        EXPRESS::ZegoExpressSDK::getEngine()->stopPublishingStream(
+            (EXPRESS::ZegoPublishChannel)channel);
+        return FTValue();
+    });
 }
 
 void ZegoExpressEngineMethodHandler::setStreamExtraInfo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto extraInfo = std::get<std::string>(argument[FTValue("extraInfo")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto extraInfo = std::get<std::string>(getArgument(argument, "extraInfo"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     auto sharedPtrResult =
         std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -519,13 +596,13 @@ void ZegoExpressEngineMethodHandler::setStreamExtraInfo(
 }
 
 void ZegoExpressEngineMethodHandler::startPreview(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     flutter::EncodableMap canvasMap;
-    if (std::holds_alternative<flutter::EncodableMap>(argument[FTValue("canvas")])) {
-        canvasMap = std::get<flutter::EncodableMap>(argument[FTValue("canvas")]);
+    if (std::holds_alternative<flutter::EncodableMap>(getArgument(argument, "canvas"))) {
+        canvasMap = std::get<flutter::EncodableMap>(getArgument(argument, "canvas"));
     }
 
     EXPRESS::ZegoCanvas canvas;
@@ -545,9 +622,9 @@ void ZegoExpressEngineMethodHandler::startPreview(
 }
 
 void ZegoExpressEngineMethodHandler::stopPreview(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
     ZegoTextureRendererController::getInstance()->removeCapturedRenderer(
         (EXPRESS::ZegoPublishChannel)channel);
     EXPRESS::ZegoExpressSDK::getEngine()->stopPreview((EXPRESS::ZegoPublishChannel)channel);
@@ -555,9 +632,9 @@ void ZegoExpressEngineMethodHandler::stopPreview(
 }
 
 void ZegoExpressEngineMethodHandler::setVideoConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoVideoConfig config;
     config.bitrate = std::get<int32_t>(configMap[FTValue("bitrate")]);
     config.captureHeight = std::get<int32_t>(configMap[FTValue("captureHeight")]);
@@ -570,16 +647,16 @@ void ZegoExpressEngineMethodHandler::setVideoConfig(
     config.fps = std::get<int32_t>(configMap[FTValue("fps")]);
     config.keyFrameInterval = std::get<int32_t>(configMap[FTValue("keyFrameInterval")]);
 
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
     EXPRESS::ZegoExpressSDK::getEngine()->setVideoConfig(config,
                                                          (EXPRESS::ZegoPublishChannel)channel);
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::getVideoConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
     auto config =
         EXPRESS::ZegoExpressSDK::getEngine()->getVideoConfig((EXPRESS::ZegoPublishChannel)channel);
 
@@ -597,12 +674,12 @@ void ZegoExpressEngineMethodHandler::getVideoConfig(
 }
 
 void ZegoExpressEngineMethodHandler::setPublishDualStreamConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     std::vector<EXPRESS::ZegoPublishDualStreamConfig> configList;
-    auto configListMap = std::get<FTArray>(argument[FTValue("configList")]);
+    auto configListMap = std::get<FTArray>(getArgument(argument, "configList"));
     for (auto config_ : configListMap) {
         FTMap configMap = std::get<FTMap>(config_);
         EXPRESS::ZegoPublishDualStreamConfig config;
@@ -622,12 +699,12 @@ void ZegoExpressEngineMethodHandler::setPublishDualStreamConfig(
 }
 
 void ZegoExpressEngineMethodHandler::setVideoMirrorMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     auto mirrorMode =
-        (EXPRESS::ZegoVideoMirrorMode)std::get<int32_t>(argument[FTValue("mirrorMode")]);
+        (EXPRESS::ZegoVideoMirrorMode)std::get<int32_t>(getArgument(argument, "mirrorMode"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setVideoMirrorMode(mirrorMode,
                                                              (EXPRESS::ZegoPublishChannel)channel);
@@ -636,11 +713,11 @@ void ZegoExpressEngineMethodHandler::setVideoMirrorMode(
 }
 
 void ZegoExpressEngineMethodHandler::setAudioConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
-    auto configMap = std::get<flutter::EncodableMap>(argument[FTValue("config")]);
+    auto configMap = std::get<flutter::EncodableMap>(getArgument(argument, "config"));
     EXPRESS::ZegoAudioConfig config;
     config.bitrate = std::get<int32_t>(configMap[FTValue("bitrate")]);
     config.channel = (EXPRESS::ZegoAudioChannel)std::get<int32_t>(configMap[FTValue("channel")]);
@@ -653,9 +730,9 @@ void ZegoExpressEngineMethodHandler::setAudioConfig(
 }
 
 void ZegoExpressEngineMethodHandler::getAudioConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     auto config =
         EXPRESS::ZegoExpressSDK::getEngine()->getAudioConfig((EXPRESS::ZegoPublishChannel)channel);
@@ -668,10 +745,10 @@ void ZegoExpressEngineMethodHandler::getAudioConfig(
 }
 
 void ZegoExpressEngineMethodHandler::setPublishStreamEncryptionKey(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto key = std::get<std::string>(argument[FTValue("key")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto key = std::get<std::string>(getArgument(argument, "key"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setPublishStreamEncryptionKey(
         key, (EXPRESS::ZegoPublishChannel)channel);
@@ -680,9 +757,9 @@ void ZegoExpressEngineMethodHandler::setPublishStreamEncryptionKey(
 }
 
 void ZegoExpressEngineMethodHandler::takePublishStreamSnapshot(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     auto sharedPtrResult =
         std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -701,10 +778,10 @@ void ZegoExpressEngineMethodHandler::takePublishStreamSnapshot(
 }
 
 void ZegoExpressEngineMethodHandler::mutePublishStreamAudio(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mute = std::get<bool>(argument[FTValue("mute")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto mute = std::get<bool>(getArgument(argument, "mute"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->mutePublishStreamAudio(
         mute, (EXPRESS::ZegoPublishChannel)channel);
@@ -713,10 +790,10 @@ void ZegoExpressEngineMethodHandler::mutePublishStreamAudio(
 }
 
 void ZegoExpressEngineMethodHandler::mutePublishStreamVideo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mute = std::get<bool>(argument[FTValue("mute")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto mute = std::get<bool>(getArgument(argument, "mute"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->mutePublishStreamVideo(
         mute, (EXPRESS::ZegoPublishChannel)channel);
@@ -725,9 +802,9 @@ void ZegoExpressEngineMethodHandler::mutePublishStreamVideo(
 }
 
 void ZegoExpressEngineMethodHandler::setCaptureVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto volume = std::get<int32_t>(argument[FTValue("volume")]);
+    auto volume = std::get<int32_t>(getArgument(argument, "volume"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setCaptureVolume(volume);
 
@@ -735,9 +812,9 @@ void ZegoExpressEngineMethodHandler::setCaptureVolume(
 }
 
 void ZegoExpressEngineMethodHandler::setAudioCaptureStereoMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mode = std::get<int32_t>(argument[FTValue("mode")]);
+    auto mode = std::get<int32_t>(getArgument(argument, "mode"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setAudioCaptureStereoMode(
         (EXPRESS::ZegoAudioCaptureStereoMode)mode);
@@ -746,10 +823,10 @@ void ZegoExpressEngineMethodHandler::setAudioCaptureStereoMode(
 }
 
 void ZegoExpressEngineMethodHandler::sendSEI(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto byteData = std::get<std::vector<uint8_t>>(argument[FTValue("data")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto byteData = std::get<std::vector<uint8_t>>(getArgument(argument, "data"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->sendSEI(byteData.data(), (unsigned int)byteData.size(),
                                                   (EXPRESS::ZegoPublishChannel)channel);
@@ -758,11 +835,11 @@ void ZegoExpressEngineMethodHandler::sendSEI(
 }
 
 void ZegoExpressEngineMethodHandler::sendAudioSideInfo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto byteData = std::get<std::vector<uint8_t>>(argument[FTValue("data")]);
-    auto timeStampMs = std::get<double>(argument[FTValue("timeStampMs")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto byteData = std::get<std::vector<uint8_t>>(getArgument(argument, "data"));
+    auto timeStampMs = std::get<double>(getArgument(argument, "timeStampMs"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->sendAudioSideInfo(
         byteData.data(), (unsigned int)byteData.size(), timeStampMs,
@@ -772,9 +849,9 @@ void ZegoExpressEngineMethodHandler::sendAudioSideInfo(
 }
 
 void ZegoExpressEngineMethodHandler::enableHardwareEncoder(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableHardwareEncoder(enable);
 
@@ -782,9 +859,9 @@ void ZegoExpressEngineMethodHandler::enableHardwareEncoder(
 }
 
 void ZegoExpressEngineMethodHandler::setCapturePipelineScaleMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mode = std::get<int32_t>(argument[FTValue("mode")]);
+    auto mode = std::get<int32_t>(getArgument(argument, "mode"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setCapturePipelineScaleMode(
         (EXPRESS::ZegoCapturePipelineScaleMode)mode);
@@ -793,9 +870,9 @@ void ZegoExpressEngineMethodHandler::setCapturePipelineScaleMode(
 }
 
 void ZegoExpressEngineMethodHandler::enableH265EncodeFallback(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableH265EncodeFallback(enable);
 
@@ -803,16 +880,16 @@ void ZegoExpressEngineMethodHandler::enableH265EncodeFallback(
 }
 
 void ZegoExpressEngineMethodHandler::isVideoEncoderSupported(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto codecID = std::get<int32_t>(argument[FTValue("codecID")]);
+    auto codecID = std::get<int32_t>(getArgument(argument, "codecID"));
     if (codecID > 4) {
         codecID = (int32_t)EXPRESS::ZegoVideoCodecID::ZEGO_VIDEO_CODEC_ID_UNKNOWN;
     }
 
     int ret = 0;
-    if (!argument[FTValue("codecBackend")].IsNull()) {
-        auto codecBackend = std::get<int32_t>(argument[FTValue("codecBackend")]);
+    if (!getArgument(argument, "codecBackend").IsNull()) {
+        auto codecBackend = std::get<int32_t>(getArgument(argument, "codecBackend"));
         ret = EXPRESS::ZegoExpressSDK::getEngine()->isVideoEncoderSupported(
             (EXPRESS::ZegoVideoCodecID)codecID, (EXPRESS::ZegoVideoCodecBackend)codecBackend);
     } else {
@@ -826,10 +903,10 @@ void ZegoExpressEngineMethodHandler::isVideoEncoderSupported(
 }
 
 void ZegoExpressEngineMethodHandler::setLowlightEnhancement(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mode = std::get<int32_t>(argument[FTValue("mode")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto mode = std::get<int32_t>(getArgument(argument, "mode"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setLowlightEnhancement(
         (EXPRESS::ZegoLowlightEnhancementMode)mode, (EXPRESS::ZegoPublishChannel)channel);
@@ -838,22 +915,22 @@ void ZegoExpressEngineMethodHandler::setLowlightEnhancement(
 }
 
 void ZegoExpressEngineMethodHandler::setVideoSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto source = std::get<int32_t>(argument[FTValue("source")]);
+    auto source = std::get<int32_t>(getArgument(argument, "source"));
 
     bool hasInstanceID = false;
     int instanceID = -1;
-    if (!argument[FTValue("instanceID")].IsNull()) {
+    if (!getArgument(argument, "instanceID").IsNull()) {
         hasInstanceID = true;
-        instanceID = std::get<int32_t>(argument[FTValue("instanceID")]);
+        instanceID = std::get<int32_t>(getArgument(argument, "instanceID"));
     }
 
     bool hasChannel = false;
     int channel = 0;
-    if (!argument[FTValue("channel")].IsNull()) {
+    if (!getArgument(argument, "channel").IsNull()) {
         hasChannel = true;
-        channel = std::get<int32_t>(argument[FTValue("channel")]);
+        channel = std::get<int32_t>(getArgument(argument, "channel"));
     }
 
     ZegoTextureRendererController::getInstance()->setVideoSourceChannel((EXPRESS::ZegoPublishChannel)channel, (EXPRESS::ZegoVideoSourceType)source);
@@ -877,15 +954,15 @@ void ZegoExpressEngineMethodHandler::setVideoSource(
 }
 
 void ZegoExpressEngineMethodHandler::setAudioSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto source = std::get<int32_t>(argument[FTValue("source")]);
+    auto source = std::get<int32_t>(getArgument(argument, "source"));
 
     bool hasConfig = false;
     EXPRESS::ZegoAudioSourceMixConfig config;
-    if (!argument[FTValue("config")].IsNull()) {
+    if (!getArgument(argument, "config").IsNull()) {
         hasConfig = true;
-        auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+        auto configMap = std::get<FTMap>(getArgument(argument, "config"));
 
         auto audioEffectPlayerIndexList =
             std::get<FTArray>(configMap[FTValue("audioEffectPlayerIndexList")]);
@@ -920,9 +997,9 @@ void ZegoExpressEngineMethodHandler::setAudioSource(
 
     bool hasChannel = false;
     int channel = -1;
-    if (!argument[FTValue("channel")].IsNull()) {
+    if (!getArgument(argument, "channel").IsNull()) {
         hasChannel = true;
-        channel = std::get<int32_t>(argument[FTValue("channel")]);
+        channel = std::get<int32_t>(getArgument(argument, "channel"));
     }
 
     int ret = -1;
@@ -950,20 +1027,20 @@ void ZegoExpressEngineMethodHandler::setAudioSource(
 }
 
 void ZegoExpressEngineMethodHandler::enableVideoObjectSegmentation(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoObjectSegmentationConfig config;
-    if (!argument[FTValue("config")].IsNull()) {
-        auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    if (!getArgument(argument, "config").IsNull()) {
+        auto configMap = std::get<FTMap>(getArgument(argument, "config"));
 
         auto type = std::get<int32_t>(configMap[FTValue("objectSegmentationType")]);
         config.objectSegmentationType = (EXPRESS::ZegoObjectSegmentationType)type;
 
-        if (!argument[FTValue("backgroundConfig")].IsNull()) {
-            auto backgroundConfigMap = std::get<FTMap>(argument[FTValue("backgroundConfig")]);
+        if (!getArgument(argument, "backgroundConfig").IsNull()) {
+            auto backgroundConfigMap = std::get<FTMap>(getArgument(argument, "backgroundConfig"));
 
             EXPRESS::ZegoBackgroundConfig backgroundConfig;
             backgroundConfig.processType = (EXPRESS::ZegoBackgroundProcessType)std::get<int32_t>(backgroundConfigMap[FTValue("processType")]);
@@ -984,11 +1061,11 @@ void ZegoExpressEngineMethodHandler::enableVideoObjectSegmentation(
 }
 
 void ZegoExpressEngineMethodHandler::enableAlphaChannelVideoEncoder(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto alphaLayout = std::get<int32_t>(argument[FTValue("alphaLayout")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto alphaLayout = std::get<int32_t>(getArgument(argument, "alphaLayout"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableAlphaChannelVideoEncoder(
         enable, (EXPRESS::ZegoAlphaLayoutType)alphaLayout, (EXPRESS::ZegoPublishChannel)channel);
@@ -997,13 +1074,13 @@ void ZegoExpressEngineMethodHandler::enableAlphaChannelVideoEncoder(
 }
 
 void ZegoExpressEngineMethodHandler::startPlayingStream(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
     flutter::EncodableMap canvasMap;
-    if (std::holds_alternative<flutter::EncodableMap>(argument[FTValue("canvas")])) {
-        canvasMap = std::get<flutter::EncodableMap>(argument[FTValue("canvas")]);
+    if (std::holds_alternative<flutter::EncodableMap>(getArgument(argument, "canvas"))) {
+        canvasMap = std::get<flutter::EncodableMap>(getArgument(argument, "canvas"));
     }
 
     EXPRESS::ZegoCanvas canvas;
@@ -1018,8 +1095,8 @@ void ZegoExpressEngineMethodHandler::startPlayingStream(
     }
 
     flutter::EncodableMap configMap;
-    if (std::holds_alternative<flutter::EncodableMap>(argument[FTValue("config")])) {
-        configMap = std::get<flutter::EncodableMap>(argument[FTValue("config")]);
+    if (std::holds_alternative<flutter::EncodableMap>(getArgument(argument, "config"))) {
+        configMap = std::get<flutter::EncodableMap>(getArgument(argument, "config"));
     }
 
     if (configMap.size() > 0) {
@@ -1067,21 +1144,22 @@ void ZegoExpressEngineMethodHandler::startPlayingStream(
 }
 
 void ZegoExpressEngineMethodHandler::stopPlayingStream(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
     ZegoTextureRendererController::getInstance()->removeRemoteRenderer(streamID);
+    ZegoTextureRendererController::getInstance()->removeVideoHealthStream(streamID);
     EXPRESS::ZegoExpressSDK::getEngine()->stopPlayingStream(streamID);
 
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::setPlayStreamCrossAppInfo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
-    flutter::EncodableMap infoMap = std::get<flutter::EncodableMap>(argument[FTValue("info")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+    flutter::EncodableMap infoMap = std::get<flutter::EncodableMap>(getArgument(argument, "info"));
     EXPRESS::ZegoCrossAppInfo info;
     info.appID = infoMap[FTValue("appID")].LongValue();
     info.token = std::get<std::string>(infoMap[FTValue("token")]);
@@ -1091,9 +1169,9 @@ void ZegoExpressEngineMethodHandler::setPlayStreamCrossAppInfo(
 }
 
 void ZegoExpressEngineMethodHandler::takePlayStreamSnapshot(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
     auto sharedPtrResult =
         std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -1111,10 +1189,10 @@ void ZegoExpressEngineMethodHandler::takePlayStreamSnapshot(
 }
 
 void ZegoExpressEngineMethodHandler::setPlayVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
-    auto volume = std::get<int32_t>(argument[FTValue("volume")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+    auto volume = std::get<int32_t>(getArgument(argument, "volume"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setPlayVolume(streamID, volume);
 
@@ -1122,9 +1200,9 @@ void ZegoExpressEngineMethodHandler::setPlayVolume(
 }
 
 void ZegoExpressEngineMethodHandler::setAllPlayStreamVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto volume = std::get<int32_t>(argument[FTValue("volume")]);
+    auto volume = std::get<int32_t>(getArgument(argument, "volume"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setAllPlayStreamVolume(volume);
 
@@ -1132,10 +1210,10 @@ void ZegoExpressEngineMethodHandler::setAllPlayStreamVolume(
 }
 
 void ZegoExpressEngineMethodHandler::mutePlayStreamAudio(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
-    auto mute = std::get<bool>(argument[FTValue("mute")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+    auto mute = std::get<bool>(getArgument(argument, "mute"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->mutePlayStreamAudio(streamID, mute);
 
@@ -1143,9 +1221,9 @@ void ZegoExpressEngineMethodHandler::mutePlayStreamAudio(
 }
 
 void ZegoExpressEngineMethodHandler::muteAllPlayStreamAudio(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mute = std::get<bool>(argument[FTValue("mute")]);
+    auto mute = std::get<bool>(getArgument(argument, "mute"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->muteAllPlayStreamAudio(mute);
 
@@ -1153,9 +1231,9 @@ void ZegoExpressEngineMethodHandler::muteAllPlayStreamAudio(
 }
 
 void ZegoExpressEngineMethodHandler::muteAllPlayAudioStreams(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mute = std::get<bool>(argument[FTValue("mute")]);
+    auto mute = std::get<bool>(getArgument(argument, "mute"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->muteAllPlayAudioStreams(mute);
 
@@ -1163,9 +1241,9 @@ void ZegoExpressEngineMethodHandler::muteAllPlayAudioStreams(
 }
 
 void ZegoExpressEngineMethodHandler::enableHardwareDecoder(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableHardwareDecoder(enable);
 
@@ -1173,9 +1251,9 @@ void ZegoExpressEngineMethodHandler::enableHardwareDecoder(
 }
 
 void ZegoExpressEngineMethodHandler::muteMicrophone(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mute = std::get<bool>(argument[FTValue("mute")]);
+    auto mute = std::get<bool>(getArgument(argument, "mute"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->muteMicrophone(mute);
 
@@ -1183,7 +1261,7 @@ void ZegoExpressEngineMethodHandler::muteMicrophone(
 }
 
 void ZegoExpressEngineMethodHandler::isMicrophoneMuted(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     auto isMuted = EXPRESS::ZegoExpressSDK::getEngine()->isMicrophoneMuted();
 
@@ -1191,9 +1269,9 @@ void ZegoExpressEngineMethodHandler::isMicrophoneMuted(
 }
 
 void ZegoExpressEngineMethodHandler::muteSpeaker(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mute = std::get<bool>(argument[FTValue("mute")]);
+    auto mute = std::get<bool>(getArgument(argument, "mute"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->muteSpeaker(mute);
 
@@ -1201,7 +1279,7 @@ void ZegoExpressEngineMethodHandler::muteSpeaker(
 }
 
 void ZegoExpressEngineMethodHandler::isSpeakerMuted(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     auto isMuted = EXPRESS::ZegoExpressSDK::getEngine()->isSpeakerMuted();
 
@@ -1209,9 +1287,9 @@ void ZegoExpressEngineMethodHandler::isSpeakerMuted(
 }
 
 void ZegoExpressEngineMethodHandler::getAudioDeviceList(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto type = std::get<int32_t>(argument[FTValue("type")]);
+    auto type = std::get<int32_t>(getArgument(argument, "type"));
 
     FTArray deviceListArray;
     auto deviceList = EXPRESS::ZegoExpressSDK::getEngine()->getAudioDeviceList(
@@ -1228,9 +1306,9 @@ void ZegoExpressEngineMethodHandler::getAudioDeviceList(
 }
 
 void ZegoExpressEngineMethodHandler::getDefaultAudioDeviceID(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto type = std::get<int32_t>(argument[FTValue("type")]);
+    auto type = std::get<int32_t>(getArgument(argument, "type"));
     auto deviceID = EXPRESS::ZegoExpressSDK::getEngine()->getDefaultAudioDeviceID(
         (EXPRESS::ZegoAudioDeviceType)type);
 
@@ -1238,22 +1316,24 @@ void ZegoExpressEngineMethodHandler::getDefaultAudioDeviceID(
 }
 
 void ZegoExpressEngineMethodHandler::useAudioDevice(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto type = std::get<int32_t>(argument[FTValue("type")]);
-    auto deviceID = std::get<std::string>(argument[FTValue("deviceID")]);
-    EXPRESS::ZegoExpressSDK::getEngine()->useAudioDevice((EXPRESS::ZegoAudioDeviceType)type,
-                                                         deviceID);
+    auto type = std::get<int32_t>(getArgument(argument, "type"));
+    auto deviceID = std::get<std::string>(getArgument(argument, "deviceID"));
 
-    result->Success();
+    runOnQueue(ZEGO_TASK_QUEUE_DEVICE, std::move(result), [=]() {
+        EXPRESS::ZegoExpressSDK::getEngine()->useAudioDevice((EXPRESS::ZegoAudioDeviceType)type,
+                                                             deviceID);
+        return FTValue();
+    });
 }
 
 void ZegoExpressEngineMethodHandler::startSoundLevelMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     flutter::EncodableMap configMap;
-    if (std::holds_alternative<flutter::EncodableMap>(argument[FTValue("config")])) {
-        configMap = std::get<flutter::EncodableMap>(argument[FTValue("config")]);
+    if (std::holds_alternative<flutter::EncodableMap>(getArgument(argument, "config"))) {
+        configMap = std::get<flutter::EncodableMap>(getArgument(argument, "config"));
     }
 
     if (configMap.size() > 0) {
@@ -1266,7 +1346,7 @@ void ZegoExpressEngineMethodHandler::startSoundLevelMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::stopSoundLevelMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::getEngine()->stopSoundLevelMonitor();
 
@@ -1274,9 +1354,9 @@ void ZegoExpressEngineMethodHandler::stopSoundLevelMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::enableHeadphoneMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableHeadphoneMonitor(enable);
 
@@ -1284,9 +1364,9 @@ void ZegoExpressEngineMethodHandler::enableHeadphoneMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::setHeadphoneMonitorVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    int volume = std::get<int32_t>(argument[FTValue("volume")]);
+    int volume = std::get<int32_t>(getArgument(argument, "volume"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setHeadphoneMonitorVolume(volume);
 
@@ -1294,9 +1374,9 @@ void ZegoExpressEngineMethodHandler::setHeadphoneMonitorVolume(
 }
 
 void ZegoExpressEngineMethodHandler::enableAEC(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableAEC(enable);
 
@@ -1304,9 +1384,9 @@ void ZegoExpressEngineMethodHandler::enableAEC(
 }
 
 void ZegoExpressEngineMethodHandler::setAECMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mode = std::get<int32_t>(argument[FTValue("mode")]);
+    auto mode = std::get<int32_t>(getArgument(argument, "mode"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setAECMode((EXPRESS::ZegoAECMode)mode);
 
@@ -1314,9 +1394,9 @@ void ZegoExpressEngineMethodHandler::setAECMode(
 }
 
 void ZegoExpressEngineMethodHandler::enableAGC(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableAGC(enable);
 
@@ -1324,9 +1404,9 @@ void ZegoExpressEngineMethodHandler::enableAGC(
 }
 
 void ZegoExpressEngineMethodHandler::enableANS(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableANS(enable);
 
@@ -1334,9 +1414,9 @@ void ZegoExpressEngineMethodHandler::enableANS(
 }
 
 void ZegoExpressEngineMethodHandler::enableTransientANS(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableTransientANS(enable);
 
@@ -1344,9 +1424,9 @@ void ZegoExpressEngineMethodHandler::enableTransientANS(
 }
 
 void ZegoExpressEngineMethodHandler::setANSMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    int mode = std::get<int32_t>(argument[FTValue("mode")]);
+    int mode = std::get<int32_t>(getArgument(argument, "mode"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setANSMode((EXPRESS::ZegoANSMode)mode);
 
@@ -1354,11 +1434,11 @@ void ZegoExpressEngineMethodHandler::setANSMode(
 }
 
 void ZegoExpressEngineMethodHandler::enableSpeechEnhance(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    int level = std::get<int32_t>(argument[FTValue("level")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    int level = std::get<int32_t>(getArgument(argument, "level"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableSpeechEnhance(enable, level);
 
@@ -1366,10 +1446,10 @@ void ZegoExpressEngineMethodHandler::enableSpeechEnhance(
 }
 
 void ZegoExpressEngineMethodHandler::setAudioEqualizerGain(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto bandIndex = std::get<int32_t>(argument[FTValue("bandIndex")]);
-    auto bandGain = std::get<double>(argument[FTValue("bandGain")]);
+    auto bandIndex = std::get<int32_t>(getArgument(argument, "bandIndex"));
+    auto bandGain = std::get<double>(getArgument(argument, "bandGain"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setAudioEqualizerGain(bandIndex, (float)bandGain);
 
@@ -1377,9 +1457,9 @@ void ZegoExpressEngineMethodHandler::setAudioEqualizerGain(
 }
 
 void ZegoExpressEngineMethodHandler::setVoiceChangerPreset(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto preset = std::get<int32_t>(argument[FTValue("preset")]);
+    auto preset = std::get<int32_t>(getArgument(argument, "preset"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setVoiceChangerPreset(
         (EXPRESS::ZegoVoiceChangerPreset)preset);
@@ -1388,9 +1468,9 @@ void ZegoExpressEngineMethodHandler::setVoiceChangerPreset(
 }
 
 void ZegoExpressEngineMethodHandler::setVoiceChangerParam(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto paramMap = std::get<flutter::EncodableMap>(argument[FTValue("param")]);
+    auto paramMap = std::get<flutter::EncodableMap>(getArgument(argument, "param"));
     EXPRESS::ZegoVoiceChangerParam param;
     param.pitch = (float)std::get<double>(paramMap[FTValue("pitch")]);
 
@@ -1400,9 +1480,9 @@ void ZegoExpressEngineMethodHandler::setVoiceChangerParam(
 }
 
 void ZegoExpressEngineMethodHandler::setReverbPreset(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto preset = std::get<int32_t>(argument[FTValue("preset")]);
+    auto preset = std::get<int32_t>(getArgument(argument, "preset"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setReverbPreset((EXPRESS::ZegoReverbPreset)preset);
 
@@ -1410,9 +1490,9 @@ void ZegoExpressEngineMethodHandler::setReverbPreset(
 }
 
 void ZegoExpressEngineMethodHandler::setReverbAdvancedParam(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto paramMap = std::get<flutter::EncodableMap>(argument[FTValue("param")]);
+    auto paramMap = std::get<flutter::EncodableMap>(getArgument(argument, "param"));
     EXPRESS::ZegoReverbAdvancedParam param;
     param.damping = (float)std::get<double>(paramMap[FTValue("damping")]);
     param.roomSize = (float)std::get<double>(paramMap[FTValue("roomSize")]);
@@ -1431,9 +1511,9 @@ void ZegoExpressEngineMethodHandler::setReverbAdvancedParam(
 }
 
 void ZegoExpressEngineMethodHandler::setReverbEchoParam(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto paramMap = std::get<flutter::EncodableMap>(argument[FTValue("param")]);
+    auto paramMap = std::get<flutter::EncodableMap>(getArgument(argument, "param"));
     EXPRESS::ZegoReverbEchoParam param;
     param.inGain = (float)std::get<double>(paramMap[FTValue("inGain")]);
     param.outGain = (float)std::get<double>(paramMap[FTValue("outGain")]);
@@ -1454,10 +1534,10 @@ void ZegoExpressEngineMethodHandler::setReverbEchoParam(
 }
 
 void ZegoExpressEngineMethodHandler::enableVirtualStereo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto angle = std::get<int32_t>(argument[FTValue("angle")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto angle = std::get<int32_t>(getArgument(argument, "angle"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableVirtualStereo(enable, angle);
 
@@ -1465,11 +1545,11 @@ void ZegoExpressEngineMethodHandler::enableVirtualStereo(
 }
 
 void ZegoExpressEngineMethodHandler::enablePlayStreamVirtualStereo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto angle = std::get<int32_t>(argument[FTValue("angle")]);
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto angle = std::get<int32_t>(getArgument(argument, "angle"));
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enablePlayStreamVirtualStereo(enable, angle, streamID);
 
@@ -1477,11 +1557,11 @@ void ZegoExpressEngineMethodHandler::enablePlayStreamVirtualStereo(
 }
 
 void ZegoExpressEngineMethodHandler::setElectronicEffects(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto mode = std::get<int32_t>(argument[FTValue("mode")]);
-    auto tonal = std::get<int32_t>(argument[FTValue("tonal")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto mode = std::get<int32_t>(getArgument(argument, "mode"));
+    auto tonal = std::get<int32_t>(getArgument(argument, "tonal"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setElectronicEffects(
         enable, (ZEGO::EXPRESS::ZegoElectronicEffectsMode)mode, tonal);
@@ -1490,10 +1570,10 @@ void ZegoExpressEngineMethodHandler::setElectronicEffects(
 }
 
 void ZegoExpressEngineMethodHandler::startAudioDataObserver(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto bitmask = std::get<int32_t>(argument[FTValue("observerBitMask")]);
-    auto param = std::get<FTMap>(argument[FTValue("param")]);
+    auto bitmask = std::get<int32_t>(getArgument(argument, "observerBitMask"));
+    auto param = std::get<FTMap>(getArgument(argument, "param"));
 
     EXPRESS::ZegoAudioFrameParam nativeParam;
     nativeParam.sampleRate =
@@ -1505,7 +1585,7 @@ void ZegoExpressEngineMethodHandler::startAudioDataObserver(
 }
 
 void ZegoExpressEngineMethodHandler::stopAudioDataObserver(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::getEngine()->stopAudioDataObserver();
 
@@ -1513,7 +1593,7 @@ void ZegoExpressEngineMethodHandler::stopAudioDataObserver(
 }
 
 void ZegoExpressEngineMethodHandler::createAudioEffectPlayer(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     auto player = EXPRESS::ZegoExpressSDK::getEngine()->createAudioEffectPlayer();
     if (player) {
@@ -1530,9 +1610,9 @@ void ZegoExpressEngineMethodHandler::createAudioEffectPlayer(
 }
 
 void ZegoExpressEngineMethodHandler::destroyAudioEffectPlayer(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
@@ -1547,17 +1627,17 @@ void ZegoExpressEngineMethodHandler::destroyAudioEffectPlayer(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerStart(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
-        std::string path = std::get<std::string>(argument[FTValue("path")]);
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
+        std::string path = std::get<std::string>(getArgument(argument, "path"));
 
-        FTMap configMap = std::get<FTMap>(argument[FTValue("config")]);
+        FTMap configMap = std::get<FTMap>(getArgument(argument, "config"));
         std::unique_ptr<EXPRESS::ZegoAudioEffectPlayConfig> configPtr = nullptr;
 
         if (configMap.size() > 0) {
@@ -1576,14 +1656,14 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerStart(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerStop(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
         player->stop(audioEffectID);
 
         result->Success();
@@ -1594,14 +1674,14 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerStop(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerPause(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
         player->pause(audioEffectID);
 
         result->Success();
@@ -1612,14 +1692,14 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerPause(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerResume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
         player->resume(audioEffectID);
 
         result->Success();
@@ -1630,9 +1710,9 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerResume(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerStopAll(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
@@ -1646,9 +1726,9 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerStopAll(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerPauseAll(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
@@ -1662,9 +1742,9 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerPauseAll(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerResumeAll(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
@@ -1678,15 +1758,15 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerResumeAll(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerSeekTo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
-        unsigned long long millisecond = argument[FTValue("millisecond")].LongValue();
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
+        unsigned long long millisecond = getArgument(argument, "millisecond").LongValue();
 
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -1702,15 +1782,15 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerSeekTo(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerSetVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
-        int volume = std::get<int32_t>(argument[FTValue("volume")]);
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
+        int volume = std::get<int32_t>(getArgument(argument, "volume"));
         player->setVolume(audioEffectID, volume);
 
         result->Success();
@@ -1721,13 +1801,13 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerSetVolume(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerSetVolumeAll(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
-        int volume = std::get<int32_t>(argument[FTValue("volume")]);
+        int volume = std::get<int32_t>(getArgument(argument, "volume"));
         player->setVolumeAll(volume);
 
         result->Success();
@@ -1738,14 +1818,14 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerSetVolumeAll(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerGetTotalDuration(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
         auto totalDuration = player->getTotalDuration(audioEffectID);
 
         result->Success(FTValue((int64_t)totalDuration));
@@ -1756,14 +1836,14 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerGetTotalDuration(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerGetCurrentProgress(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
         auto currentProgress = player->getCurrentProgress(audioEffectID);
 
         result->Success(FTValue((int64_t)currentProgress));
@@ -1775,15 +1855,15 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerGetCurrentProgress(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerLoadResource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
-        std::string path = std::get<std::string>(argument[FTValue("path")]);
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
+        std::string path = std::get<std::string>(getArgument(argument, "path"));
 
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -1799,14 +1879,14 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerLoadResource(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerUnloadResource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
         player->unloadResource(audioEffectID);
 
         result->Success();
@@ -1817,15 +1897,15 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerUnloadResource(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerSetPlaySpeed(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
-        auto speed = std::get<double>(argument[FTValue("speed")]);
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
+        auto speed = std::get<double>(getArgument(argument, "speed"));
         player->setPlaySpeed(audioEffectID, speed);
 
         result->Success();
@@ -1836,15 +1916,15 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerSetPlaySpeed(
 }
 
 void ZegoExpressEngineMethodHandler::audioEffectPlayerUpdatePosition(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto player = audioEffectPlayerMap_[index];
     if (player) {
 
         unsigned int audioEffectID =
-            (unsigned int)std::get<int32_t>(argument[FTValue("audioEffectID")]);
-        auto position = std::get<std::vector<float>>(argument[FTValue("position")]);
+            (unsigned int)std::get<int32_t>(getArgument(argument, "audioEffectID"));
+        auto position = std::get<std::vector<float>>(getArgument(argument, "position"));
         player->updatePosition(audioEffectID, position.data());
 
         result->Success();
@@ -1855,7 +1935,7 @@ void ZegoExpressEngineMethodHandler::audioEffectPlayerUpdatePosition(
 }
 
 void ZegoExpressEngineMethodHandler::createMediaPlayer(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     auto mediaPlayer = EXPRESS::ZegoExpressSDK::getEngine()->createMediaPlayer();
     if (mediaPlayer) {
@@ -1873,9 +1953,9 @@ void ZegoExpressEngineMethodHandler::createMediaPlayer(
 }
 
 void ZegoExpressEngineMethodHandler::destroyMediaPlayer(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -1890,13 +1970,13 @@ void ZegoExpressEngineMethodHandler::destroyMediaPlayer(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerLoadResource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        std::string path = std::get<std::string>(argument[FTValue("path")]);
+        std::string path = std::get<std::string>(getArgument(argument, "path"));
 
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -1914,15 +1994,15 @@ void ZegoExpressEngineMethodHandler::mediaPlayerLoadResource(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerLoadResourceFromMediaData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        uint64_t startPosition = argument[FTValue("startPosition")].LongValue();
+        uint64_t startPosition = getArgument(argument, "startPosition").LongValue();
 
-        auto mediaData = std::get<std::vector<uint8_t>>(argument[FTValue("mediaData")]);
+        auto mediaData = std::get<std::vector<uint8_t>>(getArgument(argument, "mediaData"));
 
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -1942,14 +2022,14 @@ void ZegoExpressEngineMethodHandler::mediaPlayerLoadResourceFromMediaData(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerLoadResourceWithPosition(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        std::string path = std::get<std::string>(argument[FTValue("path")]);
-        uint64_t startPosition = argument[FTValue("startPosition")].LongValue();
+        std::string path = std::get<std::string>(getArgument(argument, "path"));
+        uint64_t startPosition = getArgument(argument, "startPosition").LongValue();
 
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -1968,9 +2048,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerLoadResourceWithPosition(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerStart(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -1981,9 +2061,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerStart(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerStop(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -1994,9 +2074,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerStop(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerPause(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2007,9 +2087,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerPause(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerResume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2020,13 +2100,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerResume(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSeekTo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        unsigned long long millisecond = argument[FTValue("millisecond")].LongValue();
+        unsigned long long millisecond = getArgument(argument, "millisecond").LongValue();
 
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -2042,13 +2122,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSeekTo(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerEnableRepeat(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        bool enable = std::get<bool>(argument[FTValue("enable")]);
+        bool enable = std::get<bool>(getArgument(argument, "enable"));
 
         mediaPlayer->enableRepeat(enable);
     }
@@ -2057,13 +2137,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerEnableRepeat(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerEnableAux(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        bool enable = std::get<bool>(argument[FTValue("enable")]);
+        bool enable = std::get<bool>(getArgument(argument, "enable"));
 
         mediaPlayer->enableAux(enable);
     }
@@ -2072,13 +2152,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerEnableAux(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerMuteLocal(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        bool mute = std::get<bool>(argument[FTValue("mute")]);
+        bool mute = std::get<bool>(getArgument(argument, "mute"));
 
         mediaPlayer->muteLocal(mute);
     }
@@ -2087,13 +2167,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerMuteLocal(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        int volume = std::get<int32_t>(argument[FTValue("volume")]);
+        int volume = std::get<int32_t>(getArgument(argument, "volume"));
 
         mediaPlayer->setVolume(volume);
     }
@@ -2102,13 +2182,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetVolume(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetPlayVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        int volume = std::get<int32_t>(argument[FTValue("volume")]);
+        int volume = std::get<int32_t>(getArgument(argument, "volume"));
 
         mediaPlayer->setPlayVolume(volume);
     }
@@ -2117,13 +2197,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetPlayVolume(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetPublishVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        int volume = std::get<int32_t>(argument[FTValue("volume")]);
+        int volume = std::get<int32_t>(getArgument(argument, "volume"));
 
         mediaPlayer->setPublishVolume(volume);
     }
@@ -2132,13 +2212,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetPublishVolume(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetProgressInterval(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        int millsecond = std::get<int32_t>(argument[FTValue("millisecond")]);
+        int millsecond = std::get<int32_t>(getArgument(argument, "millisecond"));
 
         mediaPlayer->setProgressInterval((unsigned long long)millsecond);
     }
@@ -2147,9 +2227,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetProgressInterval(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerGetPlayVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2161,9 +2241,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerGetPlayVolume(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerGetPublishVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2175,9 +2255,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerGetPublishVolume(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerGetTotalDuration(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2190,9 +2270,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerGetTotalDuration(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerGetCurrentProgress(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2205,9 +2285,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerGetCurrentProgress(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerGetAudioTrackCount(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2219,13 +2299,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerGetAudioTrackCount(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetAudioTrackIndex(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto trackIndex = std::get<int32_t>(argument[FTValue("trackIndex")]);
+        auto trackIndex = std::get<int32_t>(getArgument(argument, "trackIndex"));
         mediaPlayer->setAudioTrackIndex(trackIndex);
     }
 
@@ -2233,16 +2313,16 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetAudioTrackIndex(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetVoiceChangerParam(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        FTMap paramMap = std::get<FTMap>(argument[FTValue("param")]);
+        FTMap paramMap = std::get<FTMap>(getArgument(argument, "param"));
         auto pitch = std::get<double>(paramMap[FTValue("pitch")]);
 
-        auto audioChannel = std::get<int32_t>(argument[FTValue("audioChannel")]);
+        auto audioChannel = std::get<int32_t>(getArgument(argument, "audioChannel"));
 
         EXPRESS::ZegoVoiceChangerParam param;
         param.pitch = (float)pitch;
@@ -2254,9 +2334,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetVoiceChangerParam(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerGetCurrentState(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2268,13 +2348,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerGetCurrentState(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetPlaySpeed(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto speed = std::get<double>(argument[FTValue("speed")]);
+        auto speed = std::get<double>(getArgument(argument, "speed"));
         mediaPlayer->setPlaySpeed(speed);
     }
 
@@ -2282,14 +2362,14 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetPlaySpeed(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerEnableSoundLevelMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto enable = std::get<bool>(argument[FTValue("enable")]);
-        auto millisecond = argument[FTValue("millisecond")].LongValue();
+        auto enable = std::get<bool>(getArgument(argument, "enable"));
+        auto millisecond = getArgument(argument, "millisecond").LongValue();
         mediaPlayer->enableSoundLevelMonitor(enable, millisecond);
     }
 
@@ -2297,14 +2377,14 @@ void ZegoExpressEngineMethodHandler::mediaPlayerEnableSoundLevelMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerEnableFrequencySpectrumMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto enable = std::get<bool>(argument[FTValue("enable")]);
-        auto millisecond = argument[FTValue("millisecond")].LongValue();
+        auto enable = std::get<bool>(getArgument(argument, "enable"));
+        auto millisecond = getArgument(argument, "millisecond").LongValue();
         mediaPlayer->enableFrequencySpectrumMonitor(enable, millisecond);
     }
 
@@ -2312,14 +2392,14 @@ void ZegoExpressEngineMethodHandler::mediaPlayerEnableFrequencySpectrumMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetNetWorkResourceMaxCache(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto time = argument[FTValue("time")].LongValue();
-        auto size = argument[FTValue("size")].LongValue();
+        auto time = getArgument(argument, "time").LongValue();
+        auto size = getArgument(argument, "size").LongValue();
         mediaPlayer->setNetWorkResourceMaxCache(time, size);
     }
 
@@ -2327,13 +2407,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetNetWorkResourceMaxCache(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetNetWorkBufferThreshold(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto threshold = argument[FTValue("threshold")].LongValue();
+        auto threshold = getArgument(argument, "threshold").LongValue();
         mediaPlayer->setNetWorkBufferThreshold(threshold);
     }
 
@@ -2341,9 +2421,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetNetWorkBufferThreshold(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerGetNetWorkResourceCache(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2360,16 +2440,16 @@ void ZegoExpressEngineMethodHandler::mediaPlayerGetNetWorkResourceCache(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerEnableAccurateSeek(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto enable = std::get<bool>(argument[FTValue("enable")]);
-        FTMap configMap = std::get<FTMap>(argument[FTValue("config")]);
+        auto enable = std::get<bool>(getArgument(argument, "enable"));
+        FTMap configMap = std::get<FTMap>(getArgument(argument, "config"));
         EXPRESS::ZegoAccurateSeekConfig config;
-        config.timeout = argument[FTValue("config")].LongValue();
+        config.timeout = getArgument(argument, "config").LongValue();
         mediaPlayer->enableAccurateSeek(enable, &config);
 
         result->Success();
@@ -2380,14 +2460,14 @@ void ZegoExpressEngineMethodHandler::mediaPlayerEnableAccurateSeek(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerLoadCopyrightedMusicResourceWithPosition(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        std::string resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
-        uint64_t startPosition = argument[FTValue("startPosition")].LongValue();
+        std::string resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
+        uint64_t startPosition = getArgument(argument, "startPosition").LongValue();
 
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -2407,9 +2487,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerLoadCopyrightedMusicResourceWith
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerClearView(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2423,13 +2503,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerClearView(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetActiveAudioChannel(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto audioChannel = std::get<int32_t>(argument[FTValue("audioChannel")]);
+        auto audioChannel = std::get<int32_t>(getArgument(argument, "audioChannel"));
         mediaPlayer->setActiveAudioChannel((EXPRESS::ZegoMediaPlayerAudioChannel)audioChannel);
 
         result->Success();
@@ -2440,15 +2520,15 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetActiveAudioChannel(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetPlayerCanvas(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
 
         flutter::EncodableMap canvasMap =
-            std::get<flutter::EncodableMap>(argument[FTValue("canvas")]);
+            std::get<flutter::EncodableMap>(getArgument(argument, "canvas"));
 
         EXPRESS::ZegoCanvas canvas;
         auto viewMode = (EXPRESS::ZegoViewMode)std::get<int32_t>(canvasMap[FTValue("viewMode")]);
@@ -2468,18 +2548,18 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetPlayerCanvas(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerTakeSnapshot(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto pFrame =
+        auto frame =
             ZegoTextureRendererController::getInstance()->getMediaPlayerFrame(mediaPlayer);
         auto size = ZegoTextureRendererController::getInstance()->getMediaPlayerSize(mediaPlayer);
         FTMap resultMap;
-        if (pFrame && size != std::pair(0, 0)) {
-            auto tmpData = makeBtimap(pFrame, size);
+        if (!frame.empty() && size != std::pair(0, 0)) {
+            auto tmpData = makeBtimap(&frame, size);
             std::vector<uint8_t> raw_image(tmpData.second, tmpData.second + tmpData.first);
             delete[] tmpData.second;
 
@@ -2496,13 +2576,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerTakeSnapshot(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetAudioTrackMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    // auto index = std::get<int32_t>(argument[FTValue("index")]);
+    // auto index = std::get<int32_t>(getArgument(argument, "index"));
     // auto mediaPlayer = mediaPlayerMap_[index];
 
     // if (mediaPlayer) {
-    //     auto mode = std::get<int32_t>(argument[FTValue("mode")]);
+    //     auto mode = std::get<int32_t>(getArgument(argument, "mode"));
     //     mediaPlayer->setAudioTrackMode((EXPRESS::ZegoMediaPlayerAudioTrackMode)mode);
 
     //     result->Success();
@@ -2515,13 +2595,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetAudioTrackMode(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetAudioTrackPublishIndex(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    // auto index = std::get<int32_t>(argument[FTValue("index")]);
+    // auto index = std::get<int32_t>(getArgument(argument, "index"));
     // auto mediaPlayer = mediaPlayerMap_[index];
 
     // if (mediaPlayer) {
-    //     auto index_ = std::get<int32_t>(argument[FTValue("index_")]);
+    //     auto index_ = std::get<int32_t>(getArgument(argument, "index_"));
     //     mediaPlayer->setAudioTrackPublishIndex(index_);
 
     //     result->Success();
@@ -2534,14 +2614,14 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetAudioTrackPublishIndex(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerEnableVideoData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto enable = std::get<bool>(argument[FTValue("enable")]);
+        auto enable = std::get<bool>(getArgument(argument, "enable"));
         if (enable) {
             ZegoTextureRendererController::getInstance()->setMediaPlayerVideoHandler(
                 ZegoMediaPlayerVideoManager::getInstance()->getHandler());
@@ -2556,15 +2636,15 @@ void ZegoExpressEngineMethodHandler::mediaPlayerEnableVideoData(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerEnableBlockData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto enable = std::get<bool>(argument[FTValue("enable")]);
-        unsigned int blockSize = argument[FTValue("blockSize")].LongValue();
+        auto enable = std::get<bool>(getArgument(argument, "enable"));
+        unsigned int blockSize = getArgument(argument, "blockSize").LongValue();
         if (enable) {
             mediaPlayer->setBlockDataHandler(ZegoMediaPlayerBlockDataManager::getInstance()->getHandler(), blockSize);
         } else {
@@ -2578,13 +2658,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerEnableBlockData(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerLoadResourceWithConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto resourceMap = std::get<FTMap>(argument[FTValue("resource")]);
+        auto resourceMap = std::get<FTMap>(getArgument(argument, "resource"));
         EXPRESS::ZegoMediaPlayerResource resource;
         resource.resourceID = std::get<std::string>(resourceMap[FTValue("resourceID")]);
         resource.loadType =
@@ -2613,13 +2693,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerLoadResourceWithConfig(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerUpdatePosition(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto position = std::get<std::vector<float>>(argument[FTValue("position")]);
+        auto position = std::get<std::vector<float>>(getArgument(argument, "position"));
         mediaPlayer->updatePosition(position.data());
 
         result->Success();
@@ -2630,9 +2710,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerUpdatePosition(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerGetMediaInfo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2652,14 +2732,14 @@ void ZegoExpressEngineMethodHandler::mediaPlayerGetMediaInfo(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetHttpHeader(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto headersMap = std::get<FTMap>(argument[FTValue("headers")]);
+        auto headersMap = std::get<FTMap>(getArgument(argument, "headers"));
         std::unordered_map<std::string, std::string> headers;
         for (auto &header : headersMap) {
             std::string key = std::get<std::string>(header.first);
@@ -2677,9 +2757,9 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetHttpHeader(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerGetCurrentRenderingProgress(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
@@ -2693,14 +2773,14 @@ void ZegoExpressEngineMethodHandler::mediaPlayerGetCurrentRenderingProgress(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerEnableLiveAudioEffect(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto enable = std::get<bool>(argument[FTValue("enable")]);
-        auto mode = std::get<int32_t>(argument[FTValue("mode")]);
+        auto enable = std::get<bool>(getArgument(argument, "enable"));
+        auto mode = std::get<int32_t>(getArgument(argument, "mode"));
 
         mediaPlayer->enableLiveAudioEffect(enable, (EXPRESS::ZegoLiveAudioEffectMode) mode);
 
@@ -2712,13 +2792,13 @@ void ZegoExpressEngineMethodHandler::mediaPlayerEnableLiveAudioEffect(
 }
 
 void ZegoExpressEngineMethodHandler::mediaPlayerSetPlayMediaStreamType(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto mediaPlayer = mediaPlayerMap_[index];
 
     if (mediaPlayer) {
-        auto streamType = std::get<int32_t>(argument[FTValue("streamType")]);
+        auto streamType = std::get<int32_t>(getArgument(argument, "streamType"));
 
         mediaPlayer->setPlayMediaStreamType((EXPRESS::ZegoMediaStreamType)streamType);
 
@@ -2730,10 +2810,10 @@ void ZegoExpressEngineMethodHandler::mediaPlayerSetPlayMediaStreamType(
 }
 
 void ZegoExpressEngineMethodHandler::createMediaDataPublisher(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    FTMap config_map = std::get<FTMap>(argument[FTValue("config")]);
+    FTMap config_map = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoMediaDataPublisherConfig config{};
     config.channel = std::get<int32_t>(config_map[FTValue("channel")]);
     config.mode =
@@ -2751,9 +2831,9 @@ void ZegoExpressEngineMethodHandler::createMediaDataPublisher(
 }
 
 void ZegoExpressEngineMethodHandler::destroyMediaDataPublisher(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto publisher = mediaDataPublisherMap_[index];
     if (publisher) {
         EXPRESS::ZegoExpressSDK::getEngine()->destroyMediaDataPublisher(publisher);
@@ -2766,13 +2846,13 @@ void ZegoExpressEngineMethodHandler::destroyMediaDataPublisher(
 }
 
 void ZegoExpressEngineMethodHandler::mediaDataPublisherAddMediaFilePath(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto publisher = mediaDataPublisherMap_[index];
     if (publisher) {
-        bool is_clear = std::get<bool>(argument[FTValue("isClear")]);
-        std::string path = std::get<std::string>(argument[FTValue("path")]);
+        bool is_clear = std::get<bool>(getArgument(argument, "isClear"));
+        std::string path = std::get<std::string>(getArgument(argument, "path"));
         publisher->addMediaFilePath(path, is_clear);
         result->Success();
     } else {
@@ -2782,9 +2862,9 @@ void ZegoExpressEngineMethodHandler::mediaDataPublisherAddMediaFilePath(
 }
 
 void ZegoExpressEngineMethodHandler::mediaDataPublisherGetCurrentDuration(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto publisher = mediaDataPublisherMap_[index];
     if (publisher) {
         auto duration = publisher->getCurrentDuration();
@@ -2796,9 +2876,9 @@ void ZegoExpressEngineMethodHandler::mediaDataPublisherGetCurrentDuration(
 }
 
 void ZegoExpressEngineMethodHandler::mediaDataPublisherGetTotalDuration(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto publisher = mediaDataPublisherMap_[index];
     if (publisher) {
         auto duration = publisher->getTotalDuration();
@@ -2810,9 +2890,9 @@ void ZegoExpressEngineMethodHandler::mediaDataPublisherGetTotalDuration(
 }
 
 void ZegoExpressEngineMethodHandler::mediaDataPublisherReset(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto publisher = mediaDataPublisherMap_[index];
     if (publisher) {
         publisher->reset();
@@ -2824,12 +2904,12 @@ void ZegoExpressEngineMethodHandler::mediaDataPublisherReset(
 }
 
 void ZegoExpressEngineMethodHandler::mediaDataPublisherSeekTo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto publisher = mediaDataPublisherMap_[index];
     if (publisher) {
-        unsigned long long millisecond = argument[FTValue("millisecond")].LongValue();
+        unsigned long long millisecond = getArgument(argument, "millisecond").LongValue();
         publisher->seekTo(millisecond);
         result->Success();
     } else {
@@ -2839,12 +2919,12 @@ void ZegoExpressEngineMethodHandler::mediaDataPublisherSeekTo(
 }
 
 void ZegoExpressEngineMethodHandler::mediaDataPublisherSetVideoSendDelayTime(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto publisher = mediaDataPublisherMap_[index];
     if (publisher) {
-        int delay_time = std::get<int32_t>(argument[FTValue("delay_time")]);
+        int delay_time = std::get<int32_t>(getArgument(argument, "delay_time"));
         publisher->setVideoSendDelayTime(delay_time);
         result->Success();
     } else {
@@ -2854,13 +2934,13 @@ void ZegoExpressEngineMethodHandler::mediaDataPublisherSetVideoSendDelayTime(
 }
 
 void ZegoExpressEngineMethodHandler::startMixerTask(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
     EXPRESS::ZegoMixerTask task;
-    auto taskAudioConfig = std::get<flutter::EncodableMap>(argument[FTValue("audioConfig")]);
-    auto taskVideoConfig = std::get<flutter::EncodableMap>(argument[FTValue("videoConfig")]);
-    FTMap advancedConfigMap = std::get<FTMap>(argument[FTValue("advancedConfig")]);
+    auto taskAudioConfig = std::get<flutter::EncodableMap>(getArgument(argument, "audioConfig"));
+    auto taskVideoConfig = std::get<flutter::EncodableMap>(getArgument(argument, "videoConfig"));
+    FTMap advancedConfigMap = std::get<FTMap>(getArgument(argument, "advancedConfig"));
 
     for (auto &cfg : advancedConfigMap) {
         std::string key = std::get<std::string>(cfg.first);
@@ -2868,29 +2948,29 @@ void ZegoExpressEngineMethodHandler::startMixerTask(
         task.advancedConfig[key] = value;
     }
 
-    task.taskID = std::get<std::string>(argument[FTValue("taskID")]);
+    task.taskID = std::get<std::string>(getArgument(argument, "taskID"));
 
-    auto inputFlutterList = std::get<flutter::EncodableList>(argument[FTValue("inputList")]);
-    auto outputFlutterList = std::get<flutter::EncodableList>(argument[FTValue("outputList")]);
+    auto inputFlutterList = std::get<flutter::EncodableList>(getArgument(argument, "inputList"));
+    auto outputFlutterList = std::get<flutter::EncodableList>(getArgument(argument, "outputList"));
 
-    task.backgroundImageURL = std::get<std::string>(argument[FTValue("backgroundImageURL")]);
-    task.enableSoundLevel = std::get<bool>(argument[FTValue("enableSoundLevel")]);
+    task.backgroundImageURL = std::get<std::string>(getArgument(argument, "backgroundImageURL"));
+    task.enableSoundLevel = std::get<bool>(getArgument(argument, "enableSoundLevel"));
 
     // backgroundColor
-    task.backgroundColor = std::get<int32_t>(argument[FTValue("backgroundColor")]);
+    task.backgroundColor = std::get<int32_t>(getArgument(argument, "backgroundColor"));
 
     // streamAlignmentMode
     task.streamAlignmentMode = (EXPRESS::ZegoStreamAlignmentMode)std::get<int32_t>(
-        argument[FTValue("streamAlignmentMode")]);
+        getArgument(argument, "streamAlignmentMode"));
 
     // userData
-    auto userData = std::get<std::vector<uint8_t>>(argument[FTValue("userData")]);
+    auto userData = std::get<std::vector<uint8_t>>(getArgument(argument, "userData"));
     task.userData = userData.data();
     task.userDataLength = userData.size();
 
     // minPlayStreamBufferLength
     task.minPlayStreamBufferLength =
-        std::get<int32_t>(argument[FTValue("minPlayStreamBufferLength")]);
+        std::get<int32_t>(getArgument(argument, "minPlayStreamBufferLength"));
 
     task.audioConfig.bitrate = std::get<int32_t>(taskAudioConfig[FTValue("bitrate")]);
     task.audioConfig.channel =
@@ -2989,8 +3069,8 @@ void ZegoExpressEngineMethodHandler::startMixerTask(
 
     // Water mark
     EXPRESS::ZegoWatermark watermark;
-    if (!argument[FTValue("watermark")].IsNull()) {
-        auto watermarkMap = std::get<flutter::EncodableMap>(argument[FTValue("watermark")]);
+    if (!getArgument(argument, "watermark").IsNull()) {
+        auto watermarkMap = std::get<flutter::EncodableMap>(getArgument(argument, "watermark"));
         std::string imageURL = std::get<std::string>(watermarkMap[FTValue("imageURL")]);
         if (!imageURL.empty()) {    
             watermark.imageURL = imageURL;
@@ -3007,8 +3087,8 @@ void ZegoExpressEngineMethodHandler::startMixerTask(
 
     // whiteboard
     EXPRESS::ZegoMixerWhiteboard whiteboard;
-    if (!argument[FTValue("whiteboard")].IsNull()) {
-        auto whiteboardMap = std::get<flutter::EncodableMap>(argument[FTValue("whiteboard")]);
+    if (!getArgument(argument, "whiteboard").IsNull()) {
+        auto whiteboardMap = std::get<flutter::EncodableMap>(getArgument(argument, "whiteboard"));
         int64_t whiteboardID = whiteboardMap[FTValue("whiteboardID")].LongValue();
         if (whiteboardID != 0) {
             whiteboard.whiteboardID = whiteboardID;
@@ -3044,14 +3124,14 @@ void ZegoExpressEngineMethodHandler::startMixerTask(
 }
 
 void ZegoExpressEngineMethodHandler::stopMixerTask(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoMixerTask task;
-    auto taskAudioConfig = std::get<flutter::EncodableMap>(argument[FTValue("audioConfig")]);
-    auto taskVideoConfig = std::get<flutter::EncodableMap>(argument[FTValue("videoConfig")]);
-    auto taskWatermark = std::get<flutter::EncodableMap>(argument[FTValue("watermark")]);
+    auto taskAudioConfig = std::get<flutter::EncodableMap>(getArgument(argument, "audioConfig"));
+    auto taskVideoConfig = std::get<flutter::EncodableMap>(getArgument(argument, "videoConfig"));
+    auto taskWatermark = std::get<flutter::EncodableMap>(getArgument(argument, "watermark"));
 
-    task.taskID = std::get<std::string>(argument[FTValue("taskID")]);
+    task.taskID = std::get<std::string>(getArgument(argument, "taskID"));
 
     task.audioConfig.bitrate = std::get<int32_t>(taskAudioConfig[FTValue("bitrate")]);
     task.audioConfig.channel =
@@ -3064,8 +3144,8 @@ void ZegoExpressEngineMethodHandler::stopMixerTask(
     task.videoConfig.height = std::get<int32_t>(taskVideoConfig[FTValue("height")]);
     task.videoConfig.width = std::get<int32_t>(taskVideoConfig[FTValue("width")]);
 
-    auto inputFlutterList = std::get<flutter::EncodableList>(argument[FTValue("inputList")]);
-    auto outputFlutterList = std::get<flutter::EncodableList>(argument[FTValue("outputList")]);
+    auto inputFlutterList = std::get<flutter::EncodableList>(getArgument(argument, "inputList"));
+    auto outputFlutterList = std::get<flutter::EncodableList>(getArgument(argument, "outputList"));
 
     for (auto &inputIter : inputFlutterList) {
         EXPRESS::ZegoMixerInput input;
@@ -3110,10 +3190,10 @@ void ZegoExpressEngineMethodHandler::stopMixerTask(
     }
 
     task.watermark = nullptr;
-    task.backgroundImageURL = std::get<std::string>(argument[FTValue("backgroundImageURL")]);
-    task.enableSoundLevel = std::get<bool>(argument[FTValue("enableSoundLevel")]);
+    task.backgroundImageURL = std::get<std::string>(getArgument(argument, "backgroundImageURL"));
+    task.enableSoundLevel = std::get<bool>(getArgument(argument, "enableSoundLevel"));
 
-    FTMap advancedConfigMap = std::get<FTMap>(argument[FTValue("advancedConfig")]);
+    FTMap advancedConfigMap = std::get<FTMap>(getArgument(argument, "advancedConfig"));
     for (auto &cfg : advancedConfigMap) {
         std::string key = std::get<std::string>(cfg.first);
         std::string value = std::get<std::string>(cfg.second);
@@ -3132,10 +3212,10 @@ void ZegoExpressEngineMethodHandler::stopMixerTask(
 }
 
 void ZegoExpressEngineMethodHandler::setSEIConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoSEIConfig config;
-    FTMap configMap = std::get<FTMap>(argument[FTValue("config")]);
+    FTMap configMap = std::get<FTMap>(getArgument(argument, "config"));
 
     config.type = (EXPRESS::ZegoSEIType)std::get<int32_t>(configMap[FTValue("type")]);
 
@@ -3144,23 +3224,24 @@ void ZegoExpressEngineMethodHandler::setSEIConfig(
 }
 
 void ZegoExpressEngineMethodHandler::setAudioDeviceVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto deviceType = std::get<int32_t>(argument[FTValue("deviceType")]);
-    auto deviceID = std::get<std::string>(argument[FTValue("deviceID")]);
-    auto volume = std::get<int32_t>(argument[FTValue("volume")]);
+    auto deviceType = std::get<int32_t>(getArgument(argument, "deviceType"));
+    auto deviceID = std::get<std::string>(getArgument(argument, "deviceID"));
+    auto volume = std::get<int32_t>(getArgument(argument, "volume"));
 
-    EXPRESS::ZegoExpressSDK::getEngine()->setAudioDeviceVolume(
-        (EXPRESS::ZegoAudioDeviceType)deviceType, deviceID.c_str(), volume);
-
-    result->Success();
+    runOnQueue(ZEGO_TASK_QUEUE_DEVICE, std::move(result), [=]() {
+        EXPRESS::ZegoExpressSDK::getEngine()->setAudioDeviceVolume(
+            (EXPRESS::ZegoAudioDeviceType)deviceType, deviceID.c_str(), volume);
+        return FTValue();
+    });
 }
 
 void ZegoExpressEngineMethodHandler::setSpeakerVolumeInAPP(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto deviceID = std::get<std::string>(argument[FTValue("deviceID")]);
-    auto volume = std::get<int32_t>(argument[FTValue("volume")]);
+    auto deviceID = std::get<std::string>(getArgument(argument, "deviceID"));
+    auto volume = std::get<int32_t>(getArgument(argument, "volume"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setSpeakerVolumeInAPP(deviceID, volume);
 
@@ -3168,9 +3249,9 @@ void ZegoExpressEngineMethodHandler::setSpeakerVolumeInAPP(
 }
 
 void ZegoExpressEngineMethodHandler::getSpeakerVolumeInAPP(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto deviceID = std::get<std::string>(argument[FTValue("deviceID")]);
+    auto deviceID = std::get<std::string>(getArgument(argument, "deviceID"));
 
     int volume = EXPRESS::ZegoExpressSDK::getEngine()->getSpeakerVolumeInAPP(deviceID.c_str());
 
@@ -3178,10 +3259,10 @@ void ZegoExpressEngineMethodHandler::getSpeakerVolumeInAPP(
 }
 
 void ZegoExpressEngineMethodHandler::startAudioDeviceVolumeMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto deviceType = std::get<int32_t>(argument[FTValue("deviceType")]);
-    auto deviceID = std::get<std::string>(argument[FTValue("deviceID")]);
+    auto deviceType = std::get<int32_t>(getArgument(argument, "deviceType"));
+    auto deviceID = std::get<std::string>(getArgument(argument, "deviceID"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->startAudioDeviceVolumeMonitor(
         (EXPRESS::ZegoAudioDeviceType)deviceType, deviceID);
@@ -3190,10 +3271,10 @@ void ZegoExpressEngineMethodHandler::startAudioDeviceVolumeMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::stopAudioDeviceVolumeMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto deviceType = std::get<int32_t>(argument[FTValue("deviceType")]);
-    auto deviceID = std::get<std::string>(argument[FTValue("deviceID")]);
+    auto deviceType = std::get<int32_t>(getArgument(argument, "deviceType"));
+    auto deviceID = std::get<std::string>(getArgument(argument, "deviceID"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->stopAudioDeviceVolumeMonitor(
         (EXPRESS::ZegoAudioDeviceType)deviceType, deviceID);
@@ -3202,11 +3283,11 @@ void ZegoExpressEngineMethodHandler::stopAudioDeviceVolumeMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::muteAudioDevice(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto deviceType = std::get<int32_t>(argument[FTValue("deviceType")]);
-    auto deviceID = std::get<std::string>(argument[FTValue("deviceID")]);
-    auto mute = std::get<bool>(argument[FTValue("mute")]);
+    auto deviceType = std::get<int32_t>(getArgument(argument, "deviceType"));
+    auto deviceID = std::get<std::string>(getArgument(argument, "deviceID"));
+    auto mute = std::get<bool>(getArgument(argument, "mute"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->muteAudioDevice((EXPRESS::ZegoAudioDeviceType)deviceType,
                                                           deviceID.c_str(), mute);
@@ -3215,10 +3296,10 @@ void ZegoExpressEngineMethodHandler::muteAudioDevice(
 }
 
 void ZegoExpressEngineMethodHandler::isAudioDeviceMuted(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto deviceType = std::get<int32_t>(argument[FTValue("deviceType")]);
-    auto deviceID = std::get<std::string>(argument[FTValue("deviceID")]);
+    auto deviceType = std::get<int32_t>(getArgument(argument, "deviceType"));
+    auto deviceID = std::get<std::string>(getArgument(argument, "deviceID"));
 
     auto ret = EXPRESS::ZegoExpressSDK::getEngine()->isAudioDeviceMuted(
         (EXPRESS::ZegoAudioDeviceType)deviceType, deviceID);
@@ -3227,16 +3308,16 @@ void ZegoExpressEngineMethodHandler::isAudioDeviceMuted(
 }
 
 void ZegoExpressEngineMethodHandler::setAudioDeviceMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::getAudioDeviceVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto deviceType = std::get<int32_t>(argument[FTValue("deviceType")]);
-    auto deviceID = std::get<std::string>(argument[FTValue("deviceID")]);
+    auto deviceType = std::get<int32_t>(getArgument(argument, "deviceType"));
+    auto deviceID = std::get<std::string>(getArgument(argument, "deviceID"));
 
     auto volume = EXPRESS::ZegoExpressSDK::getEngine()->getAudioDeviceVolume(
         (EXPRESS::ZegoAudioDeviceType)deviceType, deviceID.c_str());
@@ -3245,26 +3326,22 @@ void ZegoExpressEngineMethodHandler::getAudioDeviceVolume(
 }
 
 void ZegoExpressEngineMethodHandler::enableAudioCaptureDevice(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
-    auto sharedPtrResult =
-        std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
-    std::thread tmpThread([=]() {
+    runOnQueue(ZEGO_TASK_QUEUE_DEVICE, std::move(result), [=]() {
         EXPRESS::ZegoExpressSDK::getEngine()->enableAudioCaptureDevice(enable);
-        sharedPtrResult->Success();
+        return FTValue();
     });
-
-    tmpThread.detach();
 }
 
 void ZegoExpressEngineMethodHandler::enableTrafficControl(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto property = std::get<int32_t>(argument[FTValue("property")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto property = std::get<int32_t>(getArgument(argument, "property"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableTrafficControl(enable, property, 
         (EXPRESS::ZegoPublishChannel)channel);
@@ -3272,16 +3349,16 @@ void ZegoExpressEngineMethodHandler::enableTrafficControl(
 }
 
 void ZegoExpressEngineMethodHandler::startRecordingCapturedData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoDataRecordConfig config;
 
-    FTMap configMap = std::get<FTMap>(argument[FTValue("config")]);
+    FTMap configMap = std::get<FTMap>(getArgument(argument, "config"));
 
     config.filePath = std::get<std::string>(configMap[FTValue("filePath")]);
     config.recordType =
         (EXPRESS::ZegoDataRecordType)std::get<int32_t>(configMap[FTValue("recordType")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->startRecordingCapturedData(
         config, (EXPRESS::ZegoPublishChannel)channel);
@@ -3289,9 +3366,9 @@ void ZegoExpressEngineMethodHandler::startRecordingCapturedData(
 }
 
 void ZegoExpressEngineMethodHandler::stopRecordingCapturedData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->stopRecordingCapturedData(
         (EXPRESS::ZegoPublishChannel)channel);
@@ -3299,24 +3376,25 @@ void ZegoExpressEngineMethodHandler::stopRecordingCapturedData(
 }
 
 void ZegoExpressEngineMethodHandler::enableCamera(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
-    EXPRESS::ZegoExpressSDK::getEngine()->enableCamera(enable,
-                                                       (EXPRESS::ZegoPublishChannel)channel);
-
-    result->Success();
+    runOnQueue(ZEGO_TASK_QUEUE_DEVICE, std::move(result), [=]() {
+        EXPRESS::ZegoExpressSDK::getEngine()->enableCamera(enable,
+                                                           (EXPRESS::ZegoPublishChannel)channel);
+        return FTValue();
+    });
 }
 
 void ZegoExpressEngineMethodHandler::enableCameraAdaptiveFPS(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto minFPS = std::get<int32_t>(argument[FTValue("minFPS")]);
-    auto maxFPS = std::get<int32_t>(argument[FTValue("maxFPS")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto minFPS = std::get<int32_t>(getArgument(argument, "minFPS"));
+    auto maxFPS = std::get<int32_t>(getArgument(argument, "maxFPS"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableCameraAdaptiveFPS(
         enable, minFPS, maxFPS, (EXPRESS::ZegoPublishChannel)channel);
@@ -3325,19 +3403,20 @@ void ZegoExpressEngineMethodHandler::enableCameraAdaptiveFPS(
 }
 
 void ZegoExpressEngineMethodHandler::useVideoDevice(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto deviceID = std::get<std::string>(argument[FTValue("deviceID")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto deviceID = std::get<std::string>(getArgument(argument, "deviceID"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
-    EXPRESS::ZegoExpressSDK::getEngine()->useVideoDevice(deviceID,
-                                                         (EXPRESS::ZegoPublishChannel)channel);
-
-    result->Success();
+    runOnQueue(ZEGO_TASK_QUEUE_DEVICE, std::move(result), [=]() {
+        EXPRESS::ZegoExpressSDK::getEngine()->useVideoDevice(deviceID,
+                                                             (EXPRESS::ZegoPublishChannel)channel);
+        return FTValue();
+    });
 }
 
 void ZegoExpressEngineMethodHandler::getVideoDeviceList(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
     FTArray deviceListArray;
@@ -3354,7 +3433,7 @@ void ZegoExpressEngineMethodHandler::getVideoDeviceList(
 }
 
 void ZegoExpressEngineMethodHandler::getDefaultVideoDeviceID(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
     auto deviceID = EXPRESS::ZegoExpressSDK::getEngine()->getDefaultVideoDeviceID();
@@ -3362,42 +3441,42 @@ void ZegoExpressEngineMethodHandler::getDefaultVideoDeviceID(
 }
 
 void ZegoExpressEngineMethodHandler::enableMixSystemPlayout(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
     EXPRESS::ZegoExpressSDK::getEngine()->enableMixSystemPlayout(enable);
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::setMixSystemPlayoutVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    auto volume = std::get<int32_t>(argument[FTValue("volume")]);
+    auto volume = std::get<int32_t>(getArgument(argument, "volume"));
     EXPRESS::ZegoExpressSDK::getEngine()->setMixSystemPlayoutVolume(volume);
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::enableMixEnginePlayout(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
     EXPRESS::ZegoExpressSDK::getEngine()->enableMixEnginePlayout(enable);
     result->Success();
 }
 
 void ZegoExpressEngineMethodHandler::startAudioVADStableStateMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    auto type = std::get<int32_t>(argument[FTValue("type")]);
-    if (argument[FTValue("millisecond")].IsNull()) {
+    auto type = std::get<int32_t>(getArgument(argument, "type"));
+    if (getArgument(argument, "millisecond").IsNull()) {
         EXPRESS::ZegoExpressSDK::getEngine()->startAudioVADStableStateMonitor(
             (EXPRESS::ZegoAudioVADStableStateMonitorType)type);
     } else {
-        auto millisecond = std::get<int32_t>(argument[FTValue("millisecond")]);
+        auto millisecond = std::get<int32_t>(getArgument(argument, "millisecond"));
         EXPRESS::ZegoExpressSDK::getEngine()->startAudioVADStableStateMonitor(
             (EXPRESS::ZegoAudioVADStableStateMonitorType)type, millisecond);
     }
@@ -3406,10 +3485,10 @@ void ZegoExpressEngineMethodHandler::startAudioVADStableStateMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::stopAudioVADStableStateMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    auto type = std::get<int32_t>(argument[FTValue("type")]);
+    auto type = std::get<int32_t>(getArgument(argument, "type"));
     EXPRESS::ZegoExpressSDK::getEngine()->stopAudioVADStableStateMonitor(
         (EXPRESS::ZegoAudioVADStableStateMonitorType)type);
 
@@ -3417,10 +3496,10 @@ void ZegoExpressEngineMethodHandler::stopAudioVADStableStateMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::getCurrentAudioDevice(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    auto deviceType = std::get<int32_t>(argument[FTValue("deviceType")]);
+    auto deviceType = std::get<int32_t>(getArgument(argument, "deviceType"));
     auto deviceInfo = EXPRESS::ZegoExpressSDK::getEngine()->getCurrentAudioDevice(
         (EXPRESS::ZegoAudioDeviceType)deviceType);
 
@@ -3431,7 +3510,7 @@ void ZegoExpressEngineMethodHandler::getCurrentAudioDevice(
 }
 
 void ZegoExpressEngineMethodHandler::createCopyrightedMusic(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     auto tmpCopyrightedMusic = EXPRESS::ZegoExpressSDK::getEngine()->createCopyrightedMusic();
     if (tmpCopyrightedMusic != nullptr) {
@@ -3444,7 +3523,7 @@ void ZegoExpressEngineMethodHandler::createCopyrightedMusic(
 }
 
 void ZegoExpressEngineMethodHandler::destroyCopyrightedMusic(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
         EXPRESS::ZegoExpressSDK::getEngine()->destroyCopyrightedMusic(copyrightedMusic_);
@@ -3457,7 +3536,7 @@ void ZegoExpressEngineMethodHandler::destroyCopyrightedMusic(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicClearCache(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
         copyrightedMusic_->clearCache();
@@ -3469,10 +3548,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicClearCache(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicDownload(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
         copyrightedMusic_->download(resourceID, [=](int errorCode) {
@@ -3487,10 +3566,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicDownload(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetAverageScore(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto ret = copyrightedMusic_->getAverageScore(resourceID);
         result->Success(FTValue(ret));
     } else {
@@ -3500,7 +3579,7 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetAverageScore(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetCacheSize(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
         auto ret = copyrightedMusic_->getCacheSize();
@@ -3512,10 +3591,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetCacheSize(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetCurrentPitch(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto ret = copyrightedMusic_->getCurrentPitch(resourceID);
         result->Success(FTValue(ret));
     } else {
@@ -3525,10 +3604,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetCurrentPitch(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetDuration(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto ret = copyrightedMusic_->getDuration(resourceID);
         result->Success(FTValue((int64_t)ret));
     } else {
@@ -3538,10 +3617,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetDuration(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetKrcLyricByToken(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto krcToken = std::get<std::string>(argument[FTValue("krcToken")]);
+        auto krcToken = std::get<std::string>(getArgument(argument, "krcToken"));
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
         copyrightedMusic_->getKrcLyricByToken(krcToken, [=](int errorCode, std::string lyrics) {
@@ -3558,13 +3637,13 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetKrcLyricByToken(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetLrcLyric(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto songID = std::get<std::string>(argument[FTValue("songID")]);
+        auto songID = std::get<std::string>(getArgument(argument, "songID"));
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
-        if (argument[FTValue("vendorID")].IsNull()) {
+        if (getArgument(argument, "vendorID").IsNull()) {
             copyrightedMusic_->getLrcLyric(songID, [=](int errorCode, std::string lyrics) {
                 FTMap retMap;
                 retMap[FTValue("errorCode")] = FTValue(errorCode);
@@ -3572,7 +3651,7 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetLrcLyric(
                 sharedPtrResult->Success(retMap);
             });
         } else {
-            int vendorID = std::get<int>(argument[FTValue("vendorID")]);
+            int vendorID = std::get<int>(getArgument(argument, "vendorID"));
             copyrightedMusic_->getLrcLyric(songID, (EXPRESS::ZegoCopyrightedMusicVendorID)vendorID,
                                            [=](int errorCode, std::string lyrics) {
                                                FTMap retMap;
@@ -3589,10 +3668,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetLrcLyric(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetMusicByToken(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto shareToken = std::get<std::string>(argument[FTValue("shareToken")]);
+        auto shareToken = std::get<std::string>(getArgument(argument, "shareToken"));
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
         copyrightedMusic_->getMusicByToken(shareToken, [=](int errorCode, std::string resource) {
@@ -3608,10 +3687,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetMusicByToken(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetPreviousScore(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto ret = copyrightedMusic_->getPreviousScore(resourceID);
         result->Success(FTValue(ret));
     } else {
@@ -3621,10 +3700,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetPreviousScore(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetStandardPitch(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
         copyrightedMusic_->getStandardPitch(resourceID, [=](int errorCode, std::string pitch) {
@@ -3640,10 +3719,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetStandardPitch(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetTotalScore(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto ret = copyrightedMusic_->getTotalScore(resourceID);
         result->Success(FTValue(ret));
     } else {
@@ -3653,10 +3732,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetTotalScore(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicInitCopyrightedMusic(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+        auto configMap = std::get<FTMap>(getArgument(argument, "config"));
         EXPRESS::ZegoCopyrightedMusicConfig config;
         auto userMap = std::get<FTMap>(configMap[FTValue("user")]);
         config.user.userID = std::get<std::string>(userMap[FTValue("userID")]);
@@ -3676,10 +3755,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicInitCopyrightedMusic(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicPauseScore(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto ret = copyrightedMusic_->pauseScore(resourceID);
         result->Success(FTValue(ret));
     } else {
@@ -3689,16 +3768,16 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicPauseScore(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicQueryCache(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto songID = std::get<std::string>(argument[FTValue("songID")]);
-        auto type = std::get<int32_t>(argument[FTValue("type")]);
+        auto songID = std::get<std::string>(getArgument(argument, "songID"));
+        auto type = std::get<int32_t>(getArgument(argument, "type"));
         bool ret = false;
-        if (argument[FTValue("vendorID")].IsNull()) {
+        if (getArgument(argument, "vendorID").IsNull()) {
             ret = copyrightedMusic_->queryCache(songID, (EXPRESS::ZegoCopyrightedMusicType)type);
         } else {
-            int vendorID = std::get<int>(argument[FTValue("vendorID")]);
+            int vendorID = std::get<int>(getArgument(argument, "vendorID"));
             ret = copyrightedMusic_->queryCache(songID, (EXPRESS::ZegoCopyrightedMusicType)type,
                                                 (EXPRESS::ZegoCopyrightedMusicVendorID)vendorID);
         }
@@ -3710,10 +3789,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicQueryCache(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicQueryCacheWithConfig(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+        auto configMap = std::get<FTMap>(getArgument(argument, "config"));
         EXPRESS::ZegoCopyrightedMusicQueryCacheConfig config;
         
         config.songID = std::get<std::string>(configMap[FTValue("songID")]);
@@ -3730,10 +3809,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicQueryCacheWithConfig(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicRequestAccompaniment(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+        auto configMap = std::get<FTMap>(getArgument(argument, "config"));
         EXPRESS::ZegoCopyrightedMusicRequestConfig config;
         config.songID = std::get<std::string>(configMap[FTValue("songID")]);
         config.mode =
@@ -3759,10 +3838,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicRequestAccompaniment(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicRequestAccompanimentClip(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+        auto configMap = std::get<FTMap>(getArgument(argument, "config"));
         EXPRESS::ZegoCopyrightedMusicRequestConfig config;
         config.songID = std::get<std::string>(configMap[FTValue("songID")]);
         config.mode =
@@ -3789,10 +3868,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicRequestAccompanimentClip(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicRequestSong(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+        auto configMap = std::get<FTMap>(getArgument(argument, "config"));
         EXPRESS::ZegoCopyrightedMusicRequestConfig config;
         config.songID = std::get<std::string>(configMap[FTValue("songID")]);
         config.mode =
@@ -3818,10 +3897,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicRequestSong(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicResetScore(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto ret = copyrightedMusic_->resetScore(resourceID);
         result->Success(FTValue(ret));
     } else {
@@ -3831,10 +3910,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicResetScore(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicResumeScore(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto ret = copyrightedMusic_->resumeScore(resourceID);
         result->Success(FTValue(ret));
     } else {
@@ -3844,11 +3923,11 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicResumeScore(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicSendExtendedRequest(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto command = std::get<std::string>(argument[FTValue("command")]);
-        auto params = std::get<std::string>(argument[FTValue("params")]);
+        auto command = std::get<std::string>(getArgument(argument, "command"));
+        auto params = std::get<std::string>(getArgument(argument, "params"));
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
         copyrightedMusic_->sendExtendedRequest(
@@ -3867,11 +3946,11 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicSendExtendedRequest(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicStartScore(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
-        auto pitchValueInterval = std::get<int32_t>(argument[FTValue("pitchValueInterval")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
+        auto pitchValueInterval = std::get<int32_t>(getArgument(argument, "pitchValueInterval"));
         auto ret = copyrightedMusic_->startScore(resourceID, pitchValueInterval);
         result->Success(FTValue(ret));
     } else {
@@ -3881,10 +3960,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicStartScore(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicStopScore(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto ret = copyrightedMusic_->stopScore(resourceID);
         result->Success(FTValue(ret));
     } else {
@@ -3894,10 +3973,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicStopScore(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetFullScore(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto resourceID = std::get<std::string>(argument[FTValue("resourceID")]);
+        auto resourceID = std::get<std::string>(getArgument(argument, "resourceID"));
         auto ret = copyrightedMusic_->getFullScore(resourceID);
         result->Success(FTValue(ret));
     } else {
@@ -3907,17 +3986,17 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetFullScore(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicGetSharedResource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+        auto configMap = std::get<FTMap>(getArgument(argument, "config"));
         EXPRESS::ZegoCopyrightedMusicGetSharedConfig config;
         config.songID = std::get<std::string>(configMap[FTValue("songID")]);
         config.vendorID = (EXPRESS::ZegoCopyrightedMusicVendorID)std::get<int32_t>(
             configMap[FTValue("vendorID")]);
         config.roomID = std::get<std::string>(configMap[FTValue("roomID")]);
-        auto type =
-            (EXPRESS::ZegoCopyrightedMusicResourceType)std::get<int32_t>(argument[FTValue("type")]);
+        auto type = (EXPRESS::ZegoCopyrightedMusicResourceType)std::get<int32_t>(
+            getArgument(argument, "type"));
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
         copyrightedMusic_->getSharedResource(config, type,
@@ -3935,10 +4014,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicGetSharedResource(
 }
 
 void ZegoExpressEngineMethodHandler::copyrightedMusicRequestResource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (copyrightedMusic_) {
-        auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+        auto configMap = std::get<FTMap>(getArgument(argument, "config"));
         EXPRESS::ZegoCopyrightedMusicRequestConfig config;
         config.songID = std::get<std::string>(configMap[FTValue("songID")]);
         config.mode =
@@ -3948,8 +4027,8 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicRequestResource(
         config.roomID = std::get<std::string>(configMap[FTValue("roomID")]);
         config.masterID = std::get<std::string>(configMap[FTValue("masterID")]);
         config.sceneID = std::get<int32_t>(configMap[FTValue("sceneID")]);
-        auto type =
-            (EXPRESS::ZegoCopyrightedMusicResourceType)std::get<int32_t>(argument[FTValue("type")]);
+        auto type = (EXPRESS::ZegoCopyrightedMusicResourceType)std::get<int32_t>(
+            getArgument(argument, "type"));
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
         copyrightedMusic_->requestResource(config, type, [=](int errorCode, std::string resource) {
@@ -3965,10 +4044,10 @@ void ZegoExpressEngineMethodHandler::copyrightedMusicRequestResource(
 }
 
 void ZegoExpressEngineMethodHandler::createTextureRenderer(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto width = std::get<int32_t>(argument[FTValue("width")]);
-    auto height = std::get<int32_t>(argument[FTValue("height")]);
+    auto width = std::get<int32_t>(getArgument(argument, "width"));
+    auto height = std::get<int32_t>(getArgument(argument, "height"));
 
     auto textureID = ZegoTextureRendererController::getInstance()->createTextureRenderer(
         registrar_->texture_registrar(), width, height);
@@ -3977,20 +4056,464 @@ void ZegoExpressEngineMethodHandler::createTextureRenderer(
 }
 
 void ZegoExpressEngineMethodHandler::destroyTextureRenderer(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto textureID = argument[FTValue("textureID")].LongValue();
+    auto textureID = getArgument(argument, "textureID").LongValue();
     bool state = ZegoTextureRendererController::getInstance()->destroyTextureRenderer(textureID);
 
     result->Success(FTValue(state));
 }
 
+void ZegoExpressEngineMethodHandler::setTextureRendererMaxFps(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto textureID = getArgument(argument, "textureID").LongValue();
+    auto fps = std::get<int32_t>(getArgument(argument, "fps"));
+
+    bool state = ZegoTextureRendererController::getInstance()->setMaxRenderFps(
+        textureID, fps > 0 ? (uint32_t)fps : 0);
+
+    result->Success(FTValue(state));
+}
+
+void ZegoExpressEngineMethodHandler::setTextureRendererFpsPolicy(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto policy = std::get<int32_t>(getArgument(argument, "policy"));
+    auto throttledFps = std::get<int32_t>(getArgument(argument, "throttledFps"));
+
+    ZegoTextureRendererController::getInstance()->setRenderFpsPolicy(
+        (ZegoTextureRenderFpsPolicy)policy, throttledFps > 0 ? (uint32_t)throttledFps : 0);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::enableTextureRendererPrepWorker(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+
+    ZegoTextureRendererController::getInstance()->enableRenderPrepWorker(enable);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::enableTextureRendererSingleCopy(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+
+    ZegoTextureRendererController::getInstance()->enableSingleCopy(enable);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::enableTextureRendererFrameBatching(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto interval = std::get<int32_t>(getArgument(argument, "interval"));
+
+    ZegoTextureRendererController::getInstance()->enableFrameBatching(
+        enable, interval > 0 ? (uint32_t)interval : 0);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::getTextureRendererStats(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto textureID = getArgument(argument, "textureID").LongValue();
+
+    result->Success(
+        FTValue(ZegoTextureRendererController::getInstance()->getRendererStats(textureID)));
+}
+
+void ZegoExpressEngineMethodHandler::enableVideoHealthAnalyzer(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto freezeThreshold = std::get<int32_t>(getArgument(argument, "freezeThreshold"));
+    auto sampleInterval = std::get<int32_t>(getArgument(argument, "sampleInterval"));
+
+    ZegoTextureRendererController::getInstance()->enableVideoHealthAnalyzer(
+        enable, freezeThreshold > 0 ? (uint32_t)freezeThreshold : 0,
+        sampleInterval > 0 ? (uint32_t)sampleInterval : 0);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::getVideoHealthSummary(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+
+    result->Success(
+        FTValue(ZegoTextureRendererController::getInstance()->getVideoHealthSummary(streamID)));
+}
+
+void ZegoExpressEngineMethodHandler::getEventQueueStats(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto stats = ZegoExpressEngineEventHandler::getInstance()->getEventQueueStats();
+
+    FTMap retMap;
+    retMap[FTValue("enqueuedCount")] = FTValue((int64_t)stats.enqueuedCount);
+    retMap[FTValue("deliveredCount")] = FTValue((int64_t)stats.deliveredCount);
+    retMap[FTValue("droppedCount")] = FTValue((int64_t)stats.droppedCount);
+    retMap[FTValue("drainCount")] = FTValue((int64_t)stats.drainCount);
+    retMap[FTValue("depth")] = FTValue((int64_t)stats.depth);
+    retMap[FTValue("maxDepth")] = FTValue((int64_t)stats.maxDepth);
+    retMap[FTValue("totalLatencyMicroseconds")] = FTValue((int64_t)stats.totalLatencyMicroseconds);
+    retMap[FTValue("maxLatencyMicroseconds")] = FTValue((int64_t)stats.maxLatencyMicroseconds);
+
+    result->Success(retMap);
+}
+
+void ZegoExpressEngineMethodHandler::enableCompactEventEncoding(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+
+    ZegoExpressEngineEventHandler::getInstance()->enableCompactEvents(enable);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::enableAudioMeterCoalescing(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto interval = std::get<int32_t>(getArgument(argument, "interval"));
+
+    ZegoExpressEngineEventHandler::getInstance()->enableAudioMeterCoalescing(
+        enable, interval > 0 ? (uint32_t)interval : 0);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::setUnsubscribedEvents(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto methodList = std::get<flutter::EncodableList>(getArgument(argument, "methods"));
+
+    std::vector<std::string> methods;
+    for (auto &method : methodList) {
+        methods.push_back(std::get<std::string>(method));
+    }
+    ZegoExpressEngineEventHandler::getInstance()->setUnsubscribedEvents(methods);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::getSuppressedEventCounts(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    result->Success(FTValue(ZegoExpressEngineEventHandler::getInstance()->getSuppressedEventCounts()));
+}
+
+void ZegoExpressEngineMethodHandler::createAudioDataRing(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto source = std::get<int32_t>(getArgument(argument, "source"));
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+    auto capacity = std::get<int32_t>(getArgument(argument, "capacity"));
+    auto notify = std::get<bool>(getArgument(argument, "notify"));
+
+    auto address = ZegoExpressEngineEventHandler::getInstance()->createAudioDataRing(
+        source, streamID, capacity > 0 ? (uint32_t)capacity : 0, notify);
+    if (address == 0) {
+        result->Error("createAudioDataRing_Ring_already_exists",
+                      "Invoke `createAudioDataRing` but the source already has a ring, destroy it first");
+        return;
+    }
+
+    result->Success(FTValue(address));
+}
+
+void ZegoExpressEngineMethodHandler::destroyAudioDataRing(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto source = std::get<int32_t>(getArgument(argument, "source"));
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+
+    ZegoExpressEngineEventHandler::getInstance()->destroyAudioDataRing(source, streamID);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::queryStreamQuality(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto streamIDList = std::get<flutter::EncodableList>(getArgument(argument, "streamIDs"));
+    auto window = std::get<int32_t>(getArgument(argument, "window"));
+
+    std::vector<std::string> streamIDs;
+    for (auto &streamID : streamIDList) {
+        streamIDs.push_back(std::get<std::string>(streamID));
+    }
+
+    result->Success(FTValue(ZegoExpressEngineEventHandler::getInstance()->queryStreamQuality(
+        streamIDs, window > 0 ? (uint32_t)window : 0)));
+}
+
+void ZegoExpressEngineMethodHandler::enableRoomRoster(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+
+    if (!ZegoExpressEngineEventHandler::getInstance()->enableRoomRoster(enable)) {
+        result->Error("enableRoomRoster_Logged_in",
+                      "The room roster must be enabled before loginRoom");
+        return;
+    }
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::getRoomUsers(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto roomID = std::get<std::string>(getArgument(argument, "roomID"));
+    auto offset = std::get<int32_t>(getArgument(argument, "offset"));
+    auto limit = std::get<int32_t>(getArgument(argument, "limit"));
+    auto filter = std::get<std::string>(getArgument(argument, "filter"));
+
+    result->Success(FTValue(ZegoExpressEngineEventHandler::getInstance()->getRoomUsers(
+        roomID, offset > 0 ? (uint32_t)offset : 0, limit > 0 ? (uint32_t)limit : 0, filter)));
+}
+
+void ZegoExpressEngineMethodHandler::getRoomStreams(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto roomID = std::get<std::string>(getArgument(argument, "roomID"));
+    auto offset = std::get<int32_t>(getArgument(argument, "offset"));
+    auto limit = std::get<int32_t>(getArgument(argument, "limit"));
+    auto filter = std::get<std::string>(getArgument(argument, "filter"));
+
+    result->Success(FTValue(ZegoExpressEngineEventHandler::getInstance()->getRoomStreams(
+        roomID, offset > 0 ? (uint32_t)offset : 0, limit > 0 ? (uint32_t)limit : 0, filter)));
+}
+
+void ZegoExpressEngineMethodHandler::enableIMMessageBuffer(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto interval = std::get<int32_t>(getArgument(argument, "interval"));
+    auto maxBatchSize = std::get<int32_t>(getArgument(argument, "maxBatchSize"));
+    auto maxBacklog = std::get<int32_t>(getArgument(argument, "maxBacklog"));
+    auto senderRateLimit = std::get<int32_t>(getArgument(argument, "senderRateLimit"));
+
+    ZegoIMMessageBuffer::Config config;
+    config.intervalMs = interval > 0 ? (uint32_t)interval : 0;
+    config.maxBatchSize = maxBatchSize > 0 ? (uint32_t)maxBatchSize : 0;
+    config.maxBacklog = maxBacklog > 0 ? (uint32_t)maxBacklog : 0;
+    config.senderRateLimit = senderRateLimit > 0 ? (uint32_t)senderRateLimit : 0;
+    ZegoExpressEngineEventHandler::getInstance()->enableIMMessageBuffer(enable, config);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::getIMMessageBufferStats(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    result->Success(FTValue(ZegoExpressEngineEventHandler::getInstance()->getIMMessageBufferStats()));
+}
+
+void ZegoExpressEngineMethodHandler::enableRealTimeSequentialDataBatching(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto interval = std::get<int32_t>(getArgument(argument, "interval"));
+    auto maxPendingBytes = std::get<int32_t>(getArgument(argument, "maxPendingBytes"));
+
+    ZegoExpressEngineEventHandler::getInstance()->enableRealTimeSequentialDataBatching(
+        enable, interval > 0 ? (uint32_t)interval : 0,
+        maxPendingBytes > 0 ? (uint32_t)maxPendingBytes : 0);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::getRealTimeSequentialDataStats(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    result->Success(
+        FTValue(ZegoExpressEngineEventHandler::getInstance()->getRealTimeSequentialDataStats()));
+}
+
+void ZegoExpressEngineMethodHandler::enableSEIBatching(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto interval = std::get<int32_t>(getArgument(argument, "interval"));
+    auto maxUnitsPerStream = std::get<int32_t>(getArgument(argument, "maxUnitsPerStream"));
+    auto latestOnly = std::get<bool>(getArgument(argument, "latestOnly"));
+
+    ZegoSEIBatcher::Config config;
+    config.intervalMs = interval > 0 ? (uint32_t)interval : 0;
+    config.maxUnitsPerStream = maxUnitsPerStream > 0 ? (uint32_t)maxUnitsPerStream : 0;
+    config.latestOnly = latestOnly;
+    ZegoExpressEngineEventHandler::getInstance()->enableSEIBatching(enable, config);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::getSEIBatchStats(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    result->Success(FTValue(ZegoExpressEngineEventHandler::getInstance()->getSEIBatchStats()));
+}
+
+void ZegoExpressEngineMethodHandler::setEventLaneMaxDepth(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto lane = std::get<int32_t>(getArgument(argument, "lane"));
+    auto maxDepth = std::get<int32_t>(getArgument(argument, "maxDepth"));
+
+    ZegoExpressEngineEventHandler::getInstance()->setEventLaneMaxDepth((ZegoEventLane)lane,
+                                                                       (uint32_t)maxDepth);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::getEventLaneStats(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    result->Success(FTValue(ZegoExpressEngineEventHandler::getInstance()->getEventLaneStats()));
+}
+
+void ZegoExpressEngineMethodHandler::getTaskQueueStats(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto queueStatsMap = [](const ZegoTaskExecutor::QueueStats &stats) {
+        FTMap retMap;
+        retMap[FTValue("postedCount")] = FTValue((int64_t)stats.postedCount);
+        retMap[FTValue("completedCount")] = FTValue((int64_t)stats.completedCount);
+        retMap[FTValue("depth")] = FTValue((int64_t)stats.depth);
+        retMap[FTValue("maxDepth")] = FTValue((int64_t)stats.maxDepth);
+        retMap[FTValue("totalWaitMicroseconds")] = FTValue((int64_t)stats.totalWaitMicroseconds);
+        retMap[FTValue("maxWaitMicroseconds")] = FTValue((int64_t)stats.maxWaitMicroseconds);
+        retMap[FTValue("totalRunMicroseconds")] = FTValue((int64_t)stats.totalRunMicroseconds);
+        retMap[FTValue("maxRunMicroseconds")] = FTValue((int64_t)stats.maxRunMicroseconds);
+        return retMap;
+    };
+
+    auto &executor = ZegoTaskExecutor::getInstance();
+    FTMap retMap;
+    retMap[FTValue("device")] = FTValue(queueStatsMap(executor.getStats(ZEGO_TASK_QUEUE_DEVICE)));
+    retMap[FTValue("publish")] = FTValue(queueStatsMap(executor.getStats(ZEGO_TASK_QUEUE_PUBLISH)));
+
+    result->Success(retMap);
+}
+
+void ZegoExpressEngineMethodHandler::getMethodCallStats(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    result->Success(FTValue(ZegoMethodCallStats::getInstance().getStats()));
+}
+
+void ZegoExpressEngineMethodHandler::setMethodCallStatsLogInterval(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto interval = std::get<int32_t>(getArgument(argument, "interval"));
+
+    ZegoMethodCallStats::getInstance().setLogDumpInterval(interval > 0 ? (uint32_t)interval : 0);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::setPluginLogLevel(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto level = std::get<int32_t>(getArgument(argument, "level"));
+
+    ZF::setLogLevel((ZF::LogLevel)level);
+
+    result->Success();
+}
+
+void ZegoExpressEngineMethodHandler::getPluginLogStats(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto stats = ZF::getLogStats();
+
+    FTMap retMap;
+    retMap[FTValue("writtenCount")] = FTValue((int64_t)stats.writtenCount);
+    retMap[FTValue("repeatedCount")] = FTValue((int64_t)stats.repeatedCount);
+    retMap[FTValue("droppedCount")] = FTValue((int64_t)stats.droppedCount);
+    retMap[FTValue("filteredCount")] = FTValue((int64_t)stats.filteredCount);
+
+    result->Success(retMap);
+}
+
+void ZegoExpressEngineMethodHandler::createCustomAudioRenderRing(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto sampleRate = std::get<int32_t>(getArgument(argument, "sampleRate"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
+    auto intervalMs = std::get<int32_t>(getArgument(argument, "interval"));
+    auto capacityMs = std::get<int32_t>(getArgument(argument, "capacity"));
+    auto autoFetch = std::get<bool>(getArgument(argument, "autoFetch"));
+    ZF::logInfo("[createCustomAudioRenderRing] sampleRate: %d, channel: %d, interval: %d, "
+                "capacity: %d, autoFetch: %d",
+                sampleRate, channel, intervalMs, capacityMs, autoFetch);
+
+    if (customAudioRenderRing_) {
+        // Dart may still read the memory of the current ring.
+        result->Error("createCustomAudioRenderRing_Ring_already_exists",
+                      "Invoke `createCustomAudioRenderRing` but a ring exists, destroy it first");
+        return;
+    }
+
+    EXPRESS::ZegoAudioFrameParam param;
+    param.sampleRate = (EXPRESS::ZegoAudioSampleRate)sampleRate;
+    param.channel = (EXPRESS::ZegoAudioChannel)channel;
+    auto fetch = [this, param](uint8_t *data, uint32_t dataLength) {
+        std::shared_lock<std::shared_mutex> lock(engineMutex_);
+        auto engine = EXPRESS::ZegoExpressSDK::getEngine();
+        if (!engine) {
+            return false;
+        }
+        engine->fetchCustomAudioRenderPCMData(data, dataLength, param);
+        return true;
+    };
+    // The channel is the number of channels, unknown is taken as mono.
+    auto ring = std::make_unique<ZegoCustomAudioRenderRing>(
+        sampleRate > 0 ? (uint32_t)sampleRate : 0, channel > 0 ? (uint32_t)channel : 1,
+        intervalMs > 0 ? (uint32_t)intervalMs : 0, capacityMs > 0 ? (uint32_t)capacityMs : 0,
+        std::move(fetch));
+    auto address = ring->getAddress();
+    if (autoFetch) {
+        ring->startTimer();
+    }
+    {
+        std::lock_guard<std::mutex> lock(customAudioRenderRingMutex_);
+        customAudioRenderRing_ = std::move(ring);
+    }
+
+    result->Success(FTValue(address));
+}
+
+void ZegoExpressEngineMethodHandler::destroyCustomAudioRenderRing(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    ZF::logInfo("[destroyCustomAudioRenderRing]");
+
+    if (customAudioRenderRing_) {
+        customAudioRenderRing_->stopTimer();
+        std::lock_guard<std::mutex> lock(customAudioRenderRingMutex_);
+        customAudioRenderRing_.reset();
+    }
+
+    result->Success();
+}
+
 void ZegoExpressEngineMethodHandler::setMinVideoBitrateForTrafficControl(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto bitrate = std::get<int32_t>(argument[FTValue("bitrate")]);
-    auto mode = std::get<int32_t>(argument[FTValue("mode")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto bitrate = std::get<int32_t>(getArgument(argument, "bitrate"));
+    auto mode = std::get<int32_t>(getArgument(argument, "mode"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setMinVideoBitrateForTrafficControl(
         bitrate, (EXPRESS::ZegoTrafficControlMinVideoBitrateMode)mode,
@@ -4000,10 +4523,10 @@ void ZegoExpressEngineMethodHandler::setMinVideoBitrateForTrafficControl(
 }
 
 void ZegoExpressEngineMethodHandler::setMinVideoFpsForTrafficControl(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto fps = std::get<int32_t>(argument[FTValue("fps")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto fps = std::get<int32_t>(getArgument(argument, "fps"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setMinVideoFpsForTrafficControl(
         fps, (EXPRESS::ZegoPublishChannel)channel);
@@ -4012,11 +4535,11 @@ void ZegoExpressEngineMethodHandler::setMinVideoFpsForTrafficControl(
 }
 
 void ZegoExpressEngineMethodHandler::setMinVideoResolutionForTrafficControl(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto width = std::get<int32_t>(argument[FTValue("width")]);
-    auto height = std::get<int32_t>(argument[FTValue("height")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto width = std::get<int32_t>(getArgument(argument, "width"));
+    auto height = std::get<int32_t>(getArgument(argument, "height"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setMinVideoResolutionForTrafficControl(
         width, height, (EXPRESS::ZegoPublishChannel)channel);
@@ -4025,10 +4548,10 @@ void ZegoExpressEngineMethodHandler::setMinVideoResolutionForTrafficControl(
 }
 
 void ZegoExpressEngineMethodHandler::setTrafficControlFocusOn(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mode = std::get<int32_t>(argument[FTValue("mode")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto mode = std::get<int32_t>(getArgument(argument, "mode"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setTrafficControlFocusOn(
         (EXPRESS::ZegoTrafficControlFocusOnMode)mode, (EXPRESS::ZegoPublishChannel)channel);
@@ -4037,10 +4560,10 @@ void ZegoExpressEngineMethodHandler::setTrafficControlFocusOn(
 }
 
 void ZegoExpressEngineMethodHandler::addPublishCdnUrl(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
-    auto targetURL = std::get<std::string>(argument[FTValue("targetURL")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+    auto targetURL = std::get<std::string>(getArgument(argument, "targetURL"));
 
     auto sharedPtrResult =
         std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -4052,10 +4575,10 @@ void ZegoExpressEngineMethodHandler::addPublishCdnUrl(
 }
 
 void ZegoExpressEngineMethodHandler::removePublishCdnUrl(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
-    auto targetURL = std::get<std::string>(argument[FTValue("targetURL")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+    auto targetURL = std::get<std::string>(getArgument(argument, "targetURL"));
 
     auto sharedPtrResult =
         std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -4068,10 +4591,10 @@ void ZegoExpressEngineMethodHandler::removePublishCdnUrl(
 }
 
 void ZegoExpressEngineMethodHandler::enablePublishDirectToCDN(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoCDNConfig config;
     if (configMap.size() > 0) {
         config.url = std::get<std::string>(configMap[FTValue("url")]);
@@ -4081,7 +4604,7 @@ void ZegoExpressEngineMethodHandler::enablePublishDirectToCDN(
         config.httpdns = (EXPRESS::ZegoHttpDNSType)std::get<int32_t>(configMap[FTValue("httpdns")]);
     }
 
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enablePublishDirectToCDN(
         enable, &config, (EXPRESS::ZegoPublishChannel)channel);
@@ -4090,9 +4613,9 @@ void ZegoExpressEngineMethodHandler::enablePublishDirectToCDN(
 }
 
 void ZegoExpressEngineMethodHandler::setPublishWatermark(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto watermarkMap = std::get<FTMap>(argument[FTValue("watermark")]);
+    auto watermarkMap = std::get<FTMap>(getArgument(argument, "watermark"));
     EXPRESS::ZegoWatermark *watermark = nullptr;
     EXPRESS::ZegoWatermark watermarkTemp;
     if (watermarkMap.size() > 0) {
@@ -4124,8 +4647,8 @@ void ZegoExpressEngineMethodHandler::setPublishWatermark(
         }
         watermark = &watermarkTemp;
     }
-    auto isPreviewVisible = std::get<bool>(argument[FTValue("isPreviewVisible")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto isPreviewVisible = std::get<bool>(getArgument(argument, "isPreviewVisible"));
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
     EXPRESS::ZegoExpressSDK::getEngine()->setPublishWatermark(watermark, isPreviewVisible,
                                                               (EXPRESS::ZegoPublishChannel)channel);
 
@@ -4133,10 +4656,10 @@ void ZegoExpressEngineMethodHandler::setPublishWatermark(
 }
 
 void ZegoExpressEngineMethodHandler::setPlayStreamDecryptionKey(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto key = std::get<std::string>(argument[FTValue("key")]);
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+    auto key = std::get<std::string>(getArgument(argument, "key"));
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setPlayStreamDecryptionKey(streamID, key);
 
@@ -4144,10 +4667,10 @@ void ZegoExpressEngineMethodHandler::setPlayStreamDecryptionKey(
 }
 
 void ZegoExpressEngineMethodHandler::setPlayStreamVideoType(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
-    auto streamType = std::get<int32_t>(argument[FTValue("streamType")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+    auto streamType = std::get<int32_t>(getArgument(argument, "streamType"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setPlayStreamVideoType(
         streamID, (EXPRESS::ZegoVideoStreamType)streamType);
@@ -4156,11 +4679,11 @@ void ZegoExpressEngineMethodHandler::setPlayStreamVideoType(
 }
 
 void ZegoExpressEngineMethodHandler::setPlayStreamBufferIntervalRange(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
-    auto minBufferInterval = std::get<int32_t>(argument[FTValue("minBufferInterval")]);
-    auto maxBufferInterval = std::get<int32_t>(argument[FTValue("maxBufferInterval")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+    auto minBufferInterval = std::get<int32_t>(getArgument(argument, "minBufferInterval"));
+    auto maxBufferInterval = std::get<int32_t>(getArgument(argument, "maxBufferInterval"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setPlayStreamBufferIntervalRange(
         streamID, minBufferInterval, maxBufferInterval);
@@ -4169,9 +4692,9 @@ void ZegoExpressEngineMethodHandler::setPlayStreamBufferIntervalRange(
 }
 
 void ZegoExpressEngineMethodHandler::setPlayStreamFocusOn(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setPlayStreamFocusOn(streamID);
 
@@ -4179,10 +4702,10 @@ void ZegoExpressEngineMethodHandler::setPlayStreamFocusOn(
 }
 
 void ZegoExpressEngineMethodHandler::mutePlayStreamVideo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
-    auto mute = std::get<bool>(argument[FTValue("mute")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+    auto mute = std::get<bool>(getArgument(argument, "mute"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->mutePlayStreamVideo(streamID, mute);
 
@@ -4190,9 +4713,9 @@ void ZegoExpressEngineMethodHandler::mutePlayStreamVideo(
 }
 
 void ZegoExpressEngineMethodHandler::muteAllPlayStreamVideo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mute = std::get<bool>(argument[FTValue("mute")]);
+    auto mute = std::get<bool>(getArgument(argument, "mute"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->muteAllPlayStreamVideo(mute);
 
@@ -4200,9 +4723,9 @@ void ZegoExpressEngineMethodHandler::muteAllPlayStreamVideo(
 }
 
 void ZegoExpressEngineMethodHandler::muteAllPlayVideoStreams(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mute = std::get<bool>(argument[FTValue("mute")]);
+    auto mute = std::get<bool>(getArgument(argument, "mute"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->muteAllPlayVideoStreams(mute);
     
@@ -4210,9 +4733,9 @@ void ZegoExpressEngineMethodHandler::muteAllPlayVideoStreams(
 }
 
 void ZegoExpressEngineMethodHandler::enableCheckPoc(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableCheckPoc(enable);
 
@@ -4220,16 +4743,16 @@ void ZegoExpressEngineMethodHandler::enableCheckPoc(
 }
 
 void ZegoExpressEngineMethodHandler::isVideoDecoderSupported(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto codecID = std::get<int32_t>(argument[FTValue("codecID")]);
+    auto codecID = std::get<int32_t>(getArgument(argument, "codecID"));
     if (codecID > 4) {
         codecID = 100;
     }
 
     int ret = 0;
-    if (!argument[FTValue("codecBackend")].IsNull()) {
-        auto codecBackend = std::get<int32_t>(argument[FTValue("codecBackend")]);
+    if (!getArgument(argument, "codecBackend").IsNull()) {
+        auto codecBackend = std::get<int32_t>(getArgument(argument, "codecBackend"));
         ret = EXPRESS::ZegoExpressSDK::getEngine()->isVideoDecoderSupported(
             (EXPRESS::ZegoVideoCodecID)codecID, (EXPRESS::ZegoVideoCodecBackend)codecBackend);
     } else {
@@ -4243,9 +4766,9 @@ void ZegoExpressEngineMethodHandler::isVideoDecoderSupported(
 }
 
 void ZegoExpressEngineMethodHandler::setPlayStreamsAlignmentProperty(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto mode = std::get<int32_t>(argument[FTValue("mode")]);
+    auto mode = std::get<int32_t>(getArgument(argument, "mode"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->setPlayStreamsAlignmentProperty(
         (EXPRESS::ZegoStreamAlignmentMode)mode);
@@ -4254,10 +4777,10 @@ void ZegoExpressEngineMethodHandler::setPlayStreamsAlignmentProperty(
 }
 
 void ZegoExpressEngineMethodHandler::enableVideoSuperResolution(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    // auto enable = std::get<bool>(argument[FTValue("enable")]);
-    // auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+    // auto enable = std::get<bool>(getArgument(argument, "enable"));
+    // auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
     // EXPRESS::ZegoExpressSDK::getEngine()->enableVideoSuperResolution(streamID, enable);
 
@@ -4267,28 +4790,28 @@ void ZegoExpressEngineMethodHandler::enableVideoSuperResolution(
 }
 
 void ZegoExpressEngineMethodHandler::initVideoSuperResolution(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::uninitVideoSuperResolution(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::updatePlayingCanvas(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
-    auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+    auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
     flutter::EncodableMap canvasMap;
-    if (std::holds_alternative<flutter::EncodableMap>(argument[FTValue("canvas")])) {
-        canvasMap = std::get<flutter::EncodableMap>(argument[FTValue("canvas")]);
+    if (std::holds_alternative<flutter::EncodableMap>(getArgument(argument, "canvas"))) {
+        canvasMap = std::get<flutter::EncodableMap>(getArgument(argument, "canvas"));
     }
 
     EXPRESS::ZegoCanvas canvas;
@@ -4318,13 +4841,13 @@ void ZegoExpressEngineMethodHandler::updatePlayingCanvas(
 }
 
 void ZegoExpressEngineMethodHandler::startAutoMixerTask(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoAutoMixerTask task;
-    task.taskID = std::get<std::string>(argument[FTValue("taskID")]);
-    task.roomID = std::get<std::string>(argument[FTValue("roomID")]);
+    task.taskID = std::get<std::string>(getArgument(argument, "taskID"));
+    task.roomID = std::get<std::string>(getArgument(argument, "roomID"));
     // MixerOutput
-    auto outputList = std::get<FTArray>(argument[FTValue("outputList")]);
+    auto outputList = std::get<FTArray>(getArgument(argument, "outputList"));
     if (outputList.size() > 0) {
         for (auto output_ : outputList) {
             FTMap outputMap = std::get<FTMap>(output_);
@@ -4351,7 +4874,7 @@ void ZegoExpressEngineMethodHandler::startAutoMixerTask(
         }
     }
     // AudioConfig
-    auto audioConfigMap = std::get<FTMap>(argument[FTValue("audioConfig")]);
+    auto audioConfigMap = std::get<FTMap>(getArgument(argument, "audioConfig"));
     if (audioConfigMap.size() > 0) {
         task.audioConfig.bitrate = std::get<int32_t>(audioConfigMap[FTValue("bitrate")]);
         task.audioConfig.channel =
@@ -4360,7 +4883,7 @@ void ZegoExpressEngineMethodHandler::startAutoMixerTask(
             (EXPRESS::ZegoAudioCodecID)std::get<int32_t>(audioConfigMap[FTValue("codecID")]);
     }
     // Enable SoundLevel
-    task.enableSoundLevel = std::get<bool>(argument[FTValue("enableSoundLevel")]);
+    task.enableSoundLevel = std::get<bool>(getArgument(argument, "enableSoundLevel"));
 
     auto sharedPtrResult =
         std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -4374,13 +4897,13 @@ void ZegoExpressEngineMethodHandler::startAutoMixerTask(
 }
 
 void ZegoExpressEngineMethodHandler::stopAutoMixerTask(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoAutoMixerTask task;
-    task.taskID = std::get<std::string>(argument[FTValue("taskID")]);
-    task.roomID = std::get<std::string>(argument[FTValue("roomID")]);
+    task.taskID = std::get<std::string>(getArgument(argument, "taskID"));
+    task.roomID = std::get<std::string>(getArgument(argument, "roomID"));
     // MixerOutput
-    auto outputList = std::get<FTArray>(argument[FTValue("outputList")]);
+    auto outputList = std::get<FTArray>(getArgument(argument, "outputList"));
     if (outputList.size() > 0) {
         for (auto output_ : outputList) {
             FTMap outputMap = std::get<FTMap>(output_);
@@ -4421,75 +4944,75 @@ void ZegoExpressEngineMethodHandler::stopAutoMixerTask(
 }
 
 void ZegoExpressEngineMethodHandler::setAudioRouteToSpeaker(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::getAudioRouteType(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::useFrontCamera(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::isCameraFocusSupported(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::setCameraFocusMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::setCameraFocusPointInPreview(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::setCameraExposureMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::setCameraExposurePointInPreview(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::setCameraExposureCompensation(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::setCameraZoomFactor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::getCameraMaxZoomFactor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::startAudioSpectrumMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto millisecond = argument[FTValue("millisecond")].LongValue();
+    auto millisecond = getArgument(argument, "millisecond").LongValue();
 
     EXPRESS::ZegoExpressSDK::getEngine()->startAudioSpectrumMonitor(millisecond);
 
@@ -4497,7 +5020,7 @@ void ZegoExpressEngineMethodHandler::startAudioSpectrumMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::stopAudioSpectrumMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::getEngine()->stopAudioSpectrumMonitor();
 
@@ -4505,13 +5028,13 @@ void ZegoExpressEngineMethodHandler::stopAudioSpectrumMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::enableHeadphoneAEC(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::startEffectsEnv(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::getEngine()->startEffectsEnv();
 
@@ -4519,7 +5042,7 @@ void ZegoExpressEngineMethodHandler::startEffectsEnv(
 }
 
 void ZegoExpressEngineMethodHandler::stopEffectsEnv(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::getEngine()->stopEffectsEnv();
 
@@ -4527,9 +5050,9 @@ void ZegoExpressEngineMethodHandler::stopEffectsEnv(
 }
 
 void ZegoExpressEngineMethodHandler::enableEffectsBeauty(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableEffectsBeauty(enable);
 
@@ -4537,9 +5060,9 @@ void ZegoExpressEngineMethodHandler::enableEffectsBeauty(
 }
 
 void ZegoExpressEngineMethodHandler::setEffectsBeautyParam(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto paramMap = std::get<FTMap>(argument[FTValue("param")]);
+    auto paramMap = std::get<FTMap>(getArgument(argument, "param"));
     EXPRESS::ZegoEffectsBeautyParam param;
     param.rosyIntensity = std::get<int32_t>(paramMap[FTValue("rosyIntensity")]);
     param.sharpenIntensity = std::get<int32_t>(paramMap[FTValue("sharpenIntensity")]);
@@ -4552,23 +5075,23 @@ void ZegoExpressEngineMethodHandler::setEffectsBeautyParam(
 }
 
 void ZegoExpressEngineMethodHandler::enableBeautify(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->Error("Not recommended", "Not recommended, please use startEffectsEnv instead");
 }
 
 void ZegoExpressEngineMethodHandler::setBeautifyOption(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->Error("Not recommended",
                   "Not recommended, please use startEffectsEnv and setEffectsBeautyParam instead");
 }
 
 void ZegoExpressEngineMethodHandler::sendBroadcastMessage(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto roomID = std::get<std::string>(argument[FTValue("roomID")]);
-    auto message = std::get<std::string>(argument[FTValue("message")]);
+    auto roomID = std::get<std::string>(getArgument(argument, "roomID"));
+    auto message = std::get<std::string>(getArgument(argument, "message"));
 
     auto sharedPtrResult =
         std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -4582,10 +5105,10 @@ void ZegoExpressEngineMethodHandler::sendBroadcastMessage(
 }
 
 void ZegoExpressEngineMethodHandler::sendBarrageMessage(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto roomID = std::get<std::string>(argument[FTValue("roomID")]);
-    auto message = std::get<std::string>(argument[FTValue("message")]);
+    auto roomID = std::get<std::string>(getArgument(argument, "roomID"));
+    auto message = std::get<std::string>(getArgument(argument, "message"));
 
     auto sharedPtrResult =
         std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -4599,11 +5122,11 @@ void ZegoExpressEngineMethodHandler::sendBarrageMessage(
 }
 
 void ZegoExpressEngineMethodHandler::sendCustomCommand(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto roomID = std::get<std::string>(argument[FTValue("roomID")]);
-    auto command = std::get<std::string>(argument[FTValue("command")]);
-    auto toUserListArray = std::get<FTArray>(argument[FTValue("toUserList")]);
+    auto roomID = std::get<std::string>(getArgument(argument, "roomID"));
+    auto command = std::get<std::string>(getArgument(argument, "command"));
+    auto toUserListArray = std::get<FTArray>(getArgument(argument, "toUserList"));
     std::vector<ZEGO::EXPRESS::ZegoUser> toUserList;
     for (auto user_ : toUserListArray) {
         ZEGO::EXPRESS::ZegoUser user;
@@ -4624,17 +5147,17 @@ void ZegoExpressEngineMethodHandler::sendCustomCommand(
 }
 
 void ZegoExpressEngineMethodHandler::enableCustomVideoCapture(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoCustomVideoCaptureConfig config;
     if (configMap.size() > 0) {
         config.bufferType =
             (EXPRESS::ZegoVideoBufferType)std::get<int32_t>(configMap[FTValue("bufferType")]);
     }
 
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     if (enable) {
         EXPRESS::ZegoExpressSDK::getEngine()->setCustomVideoCaptureHandler(
@@ -4650,17 +5173,17 @@ void ZegoExpressEngineMethodHandler::enableCustomVideoCapture(
 }
 
 void ZegoExpressEngineMethodHandler::enableCustomVideoProcessing(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoCustomVideoProcessConfig config;
     if (configMap.size() > 0) {
         config.bufferType =
             (EXPRESS::ZegoVideoBufferType)std::get<int32_t>(configMap[FTValue("bufferType")]);
     }
 
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     if (enable) {
         EXPRESS::ZegoExpressSDK::getEngine()->setCustomVideoProcessHandler(
@@ -4676,11 +5199,11 @@ void ZegoExpressEngineMethodHandler::enableCustomVideoProcessing(
 }
 
 void ZegoExpressEngineMethodHandler::enableCustomVideoRender(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
 
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoCustomVideoRenderConfig config;
     if (configMap.size() > 0) {
         config.bufferType =
@@ -4714,10 +5237,10 @@ void ZegoExpressEngineMethodHandler::enableCustomVideoRender(
 }
 
 void ZegoExpressEngineMethodHandler::enableCustomAudioCaptureProcessing(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoCustomAudioProcessConfig config;
     config.samples = std::get<int32_t>(configMap[FTValue("samples")]);
     config.sampleRate =
@@ -4730,10 +5253,10 @@ void ZegoExpressEngineMethodHandler::enableCustomAudioCaptureProcessing(
 }
 
 void ZegoExpressEngineMethodHandler::enableCustomAudioCaptureProcessingAfterHeadphoneMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoCustomAudioProcessConfig config;
     config.samples = std::get<int32_t>(configMap[FTValue("samples")]);
     config.sampleRate =
@@ -4747,16 +5270,16 @@ void ZegoExpressEngineMethodHandler::enableCustomAudioCaptureProcessingAfterHead
 }
 
 void ZegoExpressEngineMethodHandler::enableAlignedAudioAuxData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     result->NotImplemented();
 }
 
 void ZegoExpressEngineMethodHandler::enableCustomAudioRemoteProcessing(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoCustomAudioProcessConfig config;
     config.samples = std::get<int32_t>(configMap[FTValue("samples")]);
     config.sampleRate =
@@ -4769,10 +5292,10 @@ void ZegoExpressEngineMethodHandler::enableCustomAudioRemoteProcessing(
 }
 
 void ZegoExpressEngineMethodHandler::enableCustomAudioPlaybackProcessing(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoCustomAudioProcessConfig config;
     config.samples = std::get<int32_t>(configMap[FTValue("samples")]);
     config.sampleRate =
@@ -4785,14 +5308,14 @@ void ZegoExpressEngineMethodHandler::enableCustomAudioPlaybackProcessing(
 }
 
 void ZegoExpressEngineMethodHandler::enableCustomAudioIO(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto enable = std::get<bool>(argument[FTValue("enable")]);
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto enable = std::get<bool>(getArgument(argument, "enable"));
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoCustomAudioConfig config;
     config.sourceType =
         (EXPRESS::ZegoAudioSourceType)std::get<int32_t>(configMap[FTValue("sourceType")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->enableCustomAudioIO(enable, &config,
                                                               (EXPRESS::ZegoPublishChannel)channel);
@@ -4801,19 +5324,19 @@ void ZegoExpressEngineMethodHandler::enableCustomAudioIO(
 }
 
 void ZegoExpressEngineMethodHandler::sendCustomAudioCaptureAACData(
-    flutter::EncodableMap &argument,
-    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto byteData = std::get<std::vector<uint8_t>>(argument[FTValue("data")]);
-    auto dataLength = argument[FTValue("dataLength")].LongValue();
-    auto configLength = argument[FTValue("configLength")].LongValue();
-    auto referenceTimeMillisecond = argument[FTValue("configLength")].LongValue();
-    auto samples = argument[FTValue("samples")].LongValue();
-    auto paramMap = std::get<FTMap>(argument[FTValue("param")]);
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto byteData = std::get<std::vector<uint8_t>>(getArgument(argument, "data"));
+    auto dataLength = getArgument(argument, "dataLength").LongValue();
+    auto configLength = getArgument(argument, "configLength").LongValue();
+    auto referenceTimeMillisecond = getArgument(argument, "configLength").LongValue();
+    auto samples = getArgument(argument, "samples").LongValue();
+    auto paramMap = std::get<FTMap>(getArgument(argument, "param"));
     EXPRESS::ZegoAudioFrameParam param;
     param.channel = (EXPRESS::ZegoAudioChannel)std::get<int32_t>(paramMap[FTValue("channel")]);
     param.sampleRate =
         (EXPRESS::ZegoAudioSampleRate)std::get<int32_t>(paramMap[FTValue("sampleRate")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->sendCustomAudioCaptureAACData(
         byteData.data(), dataLength, configLength, referenceTimeMillisecond, samples, param,
@@ -4823,16 +5346,16 @@ void ZegoExpressEngineMethodHandler::sendCustomAudioCaptureAACData(
 }
 
 void ZegoExpressEngineMethodHandler::sendCustomAudioCapturePCMData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto byteData = std::get<std::vector<uint8_t>>(argument[FTValue("data")]);
-    auto dataLength = argument[FTValue("dataLength")].LongValue();
-    auto paramMap = std::get<FTMap>(argument[FTValue("param")]);
+    auto byteData = std::get<std::vector<uint8_t>>(getArgument(argument, "data"));
+    auto dataLength = getArgument(argument, "dataLength").LongValue();
+    auto paramMap = std::get<FTMap>(getArgument(argument, "param"));
     EXPRESS::ZegoAudioFrameParam param;
     param.channel = (EXPRESS::ZegoAudioChannel)std::get<int32_t>(paramMap[FTValue("channel")]);
     param.sampleRate =
         (EXPRESS::ZegoAudioSampleRate)std::get<int32_t>(paramMap[FTValue("sampleRate")]);
-    auto channel = std::get<int32_t>(argument[FTValue("channel")]);
+    auto channel = std::get<int32_t>(getArgument(argument, "channel"));
 
     EXPRESS::ZegoExpressSDK::getEngine()->sendCustomAudioCapturePCMData(
         byteData.data(), dataLength, param, (EXPRESS::ZegoPublishChannel)channel);
@@ -4841,11 +5364,11 @@ void ZegoExpressEngineMethodHandler::sendCustomAudioCapturePCMData(
 }
 
 void ZegoExpressEngineMethodHandler::fetchCustomAudioRenderPCMData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto byteData = std::get<std::vector<uint8_t>>(argument[FTValue("data")]);
-    auto dataLength = argument[FTValue("dataLength")].LongValue();
-    auto paramMap = std::get<FTMap>(argument[FTValue("param")]);
+    auto byteData = std::get<std::vector<uint8_t>>(getArgument(argument, "data"));
+    auto dataLength = getArgument(argument, "dataLength").LongValue();
+    auto paramMap = std::get<FTMap>(getArgument(argument, "param"));
     EXPRESS::ZegoAudioFrameParam param;
     param.channel = (EXPRESS::ZegoAudioChannel)std::get<int32_t>(paramMap[FTValue("channel")]);
     param.sampleRate =
@@ -4854,13 +5377,14 @@ void ZegoExpressEngineMethodHandler::fetchCustomAudioRenderPCMData(
     EXPRESS::ZegoExpressSDK::getEngine()->fetchCustomAudioRenderPCMData(byteData.data(), dataLength,
                                                                         param);
 
-    result->Success();
+    // Dart copies the fetched PCM back into the buffer of the caller.
+    result->Success(FTValue(std::move(byteData)));
 }
 
 void ZegoExpressEngineMethodHandler::startPerformanceMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto millisecond = argument[FTValue("millisecond")].LongValue();
+    auto millisecond = getArgument(argument, "millisecond").LongValue();
 
     EXPRESS::ZegoExpressSDK::getEngine()->startPerformanceMonitor(millisecond);
 
@@ -4868,7 +5392,7 @@ void ZegoExpressEngineMethodHandler::startPerformanceMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::stopPerformanceMonitor(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::getEngine()->stopPerformanceMonitor();
 
@@ -4876,9 +5400,9 @@ void ZegoExpressEngineMethodHandler::stopPerformanceMonitor(
 }
 
 void ZegoExpressEngineMethodHandler::startNetworkProbe(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoNetworkProbeConfig config;
     config.enableTraceroute = std::get<bool>(configMap[FTValue("enableTraceroute")]);
 
@@ -4923,7 +5447,7 @@ void ZegoExpressEngineMethodHandler::startNetworkProbe(
 }
 
 void ZegoExpressEngineMethodHandler::stopNetworkProbe(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::getEngine()->stopNetworkProbe();
 
@@ -4931,16 +5455,16 @@ void ZegoExpressEngineMethodHandler::stopNetworkProbe(
 }
 
 void ZegoExpressEngineMethodHandler::startNetworkSpeedTest(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+    auto configMap = std::get<FTMap>(getArgument(argument, "config"));
     EXPRESS::ZegoNetworkSpeedTestConfig config;
     config.testUplink = std::get<bool>(configMap[FTValue("testUplink")]);
     config.expectedUplinkBitrate = std::get<int32_t>(configMap[FTValue("expectedUplinkBitrate")]);
     config.testDownlink = std::get<bool>(configMap[FTValue("testDownlink")]);
     config.expectedDownlinkBitrate =
         std::get<int32_t>(configMap[FTValue("expectedDownlinkBitrate")]);
-    auto interval = argument[FTValue("interval")].LongValue();
+    auto interval = getArgument(argument, "interval").LongValue();
 
     EXPRESS::ZegoExpressSDK::getEngine()->startNetworkSpeedTest(config, interval);
 
@@ -4948,7 +5472,7 @@ void ZegoExpressEngineMethodHandler::startNetworkSpeedTest(
 }
 
 void ZegoExpressEngineMethodHandler::stopNetworkSpeedTest(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::getEngine()->stopNetworkSpeedTest();
 
@@ -4956,7 +5480,7 @@ void ZegoExpressEngineMethodHandler::stopNetworkSpeedTest(
 }
 
 void ZegoExpressEngineMethodHandler::getNetworkTimeInfo(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::getEngine()->getNetworkTimeInfo();
 
@@ -4964,9 +5488,9 @@ void ZegoExpressEngineMethodHandler::getNetworkTimeInfo(
 }
 
 void ZegoExpressEngineMethodHandler::startDumpData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-        auto configMap = std::get<FTMap>(argument[FTValue("config")]);
+        auto configMap = std::get<FTMap>(getArgument(argument, "config"));
         EXPRESS::ZegoDumpDataConfig config;
         config.dataType = (EXPRESS::ZegoDumpDataType)std::get<int32_t>(configMap[FTValue("dataType")]);
 
@@ -4976,7 +5500,7 @@ void ZegoExpressEngineMethodHandler::startDumpData(
     }
 
 void ZegoExpressEngineMethodHandler::stopDumpData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
         
         EXPRESS::ZegoExpressSDK::getEngine()->stopDumpData();
@@ -4985,7 +5509,7 @@ void ZegoExpressEngineMethodHandler::stopDumpData(
     }
 
 void ZegoExpressEngineMethodHandler::uploadDumpData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
         EXPRESS::ZegoExpressSDK::getEngine()->uploadDumpData();
@@ -4994,7 +5518,7 @@ void ZegoExpressEngineMethodHandler::uploadDumpData(
     }
 
 void ZegoExpressEngineMethodHandler::removeDumpData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
 
         EXPRESS::ZegoExpressSDK::getEngine()->removeDumpData();
@@ -5003,7 +5527,7 @@ void ZegoExpressEngineMethodHandler::removeDumpData(
     }
 
 void ZegoExpressEngineMethodHandler::createRangeAudio(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     rangeAudio_ = EXPRESS::ZegoExpressSDK::getEngine()->createRangeAudio();
     if (rangeAudio_) {
@@ -5015,7 +5539,7 @@ void ZegoExpressEngineMethodHandler::createRangeAudio(
 }
 
 void ZegoExpressEngineMethodHandler::destroyRangeAudio(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     EXPRESS::ZegoExpressSDK::getEngine()->destroyRangeAudio(rangeAudio_);
     rangeAudio_ = nullptr;
@@ -5023,10 +5547,10 @@ void ZegoExpressEngineMethodHandler::destroyRangeAudio(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioEnableMicrophone(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto enable = std::get<bool>(argument[FTValue("enable")]);
+        auto enable = std::get<bool>(getArgument(argument, "enable"));
 
         rangeAudio_->enableMicrophone(enable);
 
@@ -5038,10 +5562,10 @@ void ZegoExpressEngineMethodHandler::rangeAudioEnableMicrophone(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioEnableSpatializer(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto enable = std::get<bool>(argument[FTValue("enable")]);
+        auto enable = std::get<bool>(getArgument(argument, "enable"));
         rangeAudio_->enableSpatializer(enable);
 
         result->Success();
@@ -5052,10 +5576,10 @@ void ZegoExpressEngineMethodHandler::rangeAudioEnableSpatializer(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioEnableSpeaker(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto enable = std::get<bool>(argument[FTValue("enable")]);
+        auto enable = std::get<bool>(getArgument(argument, "enable"));
 
         rangeAudio_->enableSpeaker(enable);
 
@@ -5067,10 +5591,10 @@ void ZegoExpressEngineMethodHandler::rangeAudioEnableSpeaker(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioSetAudioReceiveRange(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto paramMap = std::get<FTMap>(argument[FTValue("param")]);
+        auto paramMap = std::get<FTMap>(getArgument(argument, "param"));
 
         EXPRESS::ZegoReceiveRangeParam param;
         param.min = (float)std::get<double>(paramMap[FTValue("min")]);
@@ -5086,10 +5610,10 @@ void ZegoExpressEngineMethodHandler::rangeAudioSetAudioReceiveRange(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioSetMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto mode = std::get<int32_t>(argument[FTValue("mode")]);
+        auto mode = std::get<int32_t>(getArgument(argument, "mode"));
 
         rangeAudio_->setRangeAudioMode((EXPRESS::ZegoRangeAudioMode)mode);
 
@@ -5101,10 +5625,10 @@ void ZegoExpressEngineMethodHandler::rangeAudioSetMode(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioSetTeamID(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto teamID = std::get<std::string>(argument[FTValue("teamID")]);
+        auto teamID = std::get<std::string>(getArgument(argument, "teamID"));
 
         rangeAudio_->setTeamID(teamID);
 
@@ -5116,11 +5640,11 @@ void ZegoExpressEngineMethodHandler::rangeAudioSetTeamID(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioUpdateAudioSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto userID = std::get<std::string>(argument[FTValue("userID")]);
-        auto position = std::get<std::vector<float>>(argument[FTValue("position")]);
+        auto userID = std::get<std::string>(getArgument(argument, "userID"));
+        auto position = std::get<std::vector<float>>(getArgument(argument, "position"));
 
         rangeAudio_->updateAudioSource(userID, position.data());
 
@@ -5132,13 +5656,13 @@ void ZegoExpressEngineMethodHandler::rangeAudioUpdateAudioSource(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioUpdateSelfPosition(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto position = std::get<std::vector<float>>(argument[FTValue("position")]);
-        auto axisForward = std::get<std::vector<float>>(argument[FTValue("axisForward")]);
-        auto axisRight = std::get<std::vector<float>>(argument[FTValue("axisRight")]);
-        auto axisUp = std::get<std::vector<float>>(argument[FTValue("axisUp")]);
+        auto position = std::get<std::vector<float>>(getArgument(argument, "position"));
+        auto axisForward = std::get<std::vector<float>>(getArgument(argument, "axisForward"));
+        auto axisRight = std::get<std::vector<float>>(getArgument(argument, "axisRight"));
+        auto axisUp = std::get<std::vector<float>>(getArgument(argument, "axisUp"));
 
         rangeAudio_->updateSelfPosition(position.data(), axisForward.data(), axisRight.data(),
                                         axisUp.data());
@@ -5151,11 +5675,11 @@ void ZegoExpressEngineMethodHandler::rangeAudioUpdateSelfPosition(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioMuteUser(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto userID = std::get<std::string>(argument[FTValue("userID")]);
-        auto mute = std::get<bool>(argument[FTValue("mute")]);
+        auto userID = std::get<std::string>(getArgument(argument, "userID"));
+        auto mute = std::get<bool>(getArgument(argument, "mute"));
 
         rangeAudio_->muteUser(userID, mute);
 
@@ -5167,10 +5691,10 @@ void ZegoExpressEngineMethodHandler::rangeAudioMuteUser(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioSetPositionUpdateFrequency(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto frequency = std::get<int32_t>(argument[FTValue("frequency")]);
+        auto frequency = std::get<int32_t>(getArgument(argument, "frequency"));
 
         rangeAudio_->setPositionUpdateFrequency(frequency);
 
@@ -5183,10 +5707,10 @@ void ZegoExpressEngineMethodHandler::rangeAudioSetPositionUpdateFrequency(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioSetRangeAudioVolume(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto volume = std::get<int32_t>(argument[FTValue("volume")]);
+        auto volume = std::get<int32_t>(getArgument(argument, "volume"));
 
         rangeAudio_->setRangeAudioVolume(volume);
 
@@ -5198,11 +5722,11 @@ void ZegoExpressEngineMethodHandler::rangeAudioSetRangeAudioVolume(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioSetStreamVocalRange(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
-        auto paramMap = std::get<FTMap>(argument[FTValue("param")]);
+        auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
+        auto paramMap = std::get<FTMap>(getArgument(argument, "param"));
 
         EXPRESS::ZegoVocalRangeParam param;
         param.min = (float)std::get<double>(paramMap[FTValue("min")]);
@@ -5218,12 +5742,12 @@ void ZegoExpressEngineMethodHandler::rangeAudioSetStreamVocalRange(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioUpdateStreamPosition(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
-        auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+        auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
-        auto position = std::get<std::vector<float>>(argument[FTValue("position")]);
+        auto position = std::get<std::vector<float>>(getArgument(argument, "position"));
 
         rangeAudio_->updateStreamPosition(streamID, position.data());
 
@@ -5235,14 +5759,14 @@ void ZegoExpressEngineMethodHandler::rangeAudioUpdateStreamPosition(
 }
 
 void ZegoExpressEngineMethodHandler::rangeAudioSetRangeAudioCustomMode(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     if (rangeAudio_) {
         auto speakMode =
-            (EXPRESS::ZegoRangeAudioSpeakMode)std::get<int>(argument[FTValue("speakMode")]);
+            (EXPRESS::ZegoRangeAudioSpeakMode)std::get<int>(getArgument(argument, "speakMode"));
 
         auto listenMode =
-            (EXPRESS::ZegoRangeAudioListenMode)std::get<int>(argument[FTValue("listenMode")]);
+            (EXPRESS::ZegoRangeAudioListenMode)std::get<int>(getArgument(argument, "listenMode"));
 
         rangeAudio_->setRangeAudioCustomMode(speakMode, listenMode);
 
@@ -5255,14 +5779,15 @@ void ZegoExpressEngineMethodHandler::rangeAudioSetRangeAudioCustomMode(
 }
 
 void ZegoExpressEngineMethodHandler::createRealTimeSequentialDataManager(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto roomID = std::get<std::string>(argument[FTValue("roomID")]);
+    auto roomID = std::get<std::string>(getArgument(argument, "roomID"));
 
     auto dataManager =
         EXPRESS::ZegoExpressSDK::getEngine()->createRealTimeSequentialDataManager(roomID);
     if (dataManager) {
         dataManager->setEventHandler(ZegoExpressEngineEventHandler::getInstance());
+        std::unique_lock<std::shared_mutex> lock(engineMutex_);
         dataManagerMap_[dataManager->getIndex()] = dataManager;
         result->Success(FTValue(dataManager->getIndex()));
     } else {
@@ -5271,10 +5796,11 @@ void ZegoExpressEngineMethodHandler::createRealTimeSequentialDataManager(
 }
 
 void ZegoExpressEngineMethodHandler::destroyRealTimeSequentialDataManager(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     if (dataManagerMap_.find(index) != dataManagerMap_.end()) {
+        std::unique_lock<std::shared_mutex> lock(engineMutex_);
         EXPRESS::ZegoExpressSDK::getEngine()->destroyRealTimeSequentialDataManager(
             dataManagerMap_[index]);
         dataManagerMap_.erase(index);
@@ -5284,12 +5810,12 @@ void ZegoExpressEngineMethodHandler::destroyRealTimeSequentialDataManager(
 }
 
 void ZegoExpressEngineMethodHandler::dataManagerSendRealTimeSequentialData(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     if (dataManagerMap_.find(index) != dataManagerMap_.end()) {
-        auto byteData = std::get<std::vector<uint8_t>>(argument[FTValue("data")]);
-        auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+        auto &byteData = std::get<std::vector<uint8_t>>(getArgument(argument, "data"));
+        auto &streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
         auto sharedPtrResult =
             std::shared_ptr<flutter::MethodResult<flutter::EncodableValue>>(std::move(result));
@@ -5306,12 +5832,66 @@ void ZegoExpressEngineMethodHandler::dataManagerSendRealTimeSequentialData(
     }
 }
 
+void ZegoExpressEngineMethodHandler::dataManagerSendRealTimeSequentialDataBatch(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
+    if (dataManagerMap_.find(index) != dataManagerMap_.end()) {
+        auto &streamIDs = std::get<flutter::EncodableList>(getArgument(argument, "streamIDs"));
+        auto &offsets = std::get<std::vector<int32_t>>(getArgument(argument, "offsets"));
+        auto &byteData = std::get<std::vector<uint8_t>>(getArgument(argument, "data"));
+
+        // Completed by the last send callback.
+        struct BatchState {
+            std::vector<int32_t> errorCodes;
+            std::atomic<size_t> remaining;
+            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result;
+        };
+        auto count = streamIDs.size() < offsets.size() ? streamIDs.size() : offsets.size();
+        if (count == 0) {
+            FTMap retMap;
+            retMap[FTValue("errorCodes")] = FTValue(std::vector<int32_t>());
+            result->Success(retMap);
+            return;
+        }
+
+        auto state = std::make_shared<BatchState>();
+        state->errorCodes.resize(count);
+        state->remaining = count;
+        state->result = std::move(result);
+
+        auto dataManager = dataManagerMap_[index];
+        for (size_t i = 0; i < count; i++) {
+            // Record i spans from offsets[i] to the next offset or the end of data.
+            size_t begin = (size_t)offsets[i];
+            size_t end = i + 1 < count ? (size_t)offsets[i + 1] : byteData.size();
+            end = end > byteData.size() ? byteData.size() : end;
+            begin = begin > end ? end : begin;
+
+            dataManager->sendRealTimeSequentialData(
+                byteData.data() + begin, (unsigned int)(end - begin),
+                std::get<std::string>(streamIDs[i]), [state, i](int errorCode) {
+                    state->errorCodes[i] = errorCode;
+                    if (--state->remaining == 0) {
+                        FTMap retMap;
+                        retMap[FTValue("errorCodes")] = FTValue(std::move(state->errorCodes));
+                        state->result->Success(retMap);
+                    }
+                });
+        }
+    } else {
+        result->Error(
+            "dataManagerSendRealTimeSequentialDataBatch_Can_not_find_instance",
+            "Invoke `dataManagerSendRealTimeSequentialDataBatch` but can't find specific instance");
+    }
+}
+
 void ZegoExpressEngineMethodHandler::dataManagerStartBroadcasting(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     if (dataManagerMap_.find(index) != dataManagerMap_.end()) {
-        auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+        auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
         dataManagerMap_[index]->startBroadcasting(streamID);
 
@@ -5323,11 +5903,11 @@ void ZegoExpressEngineMethodHandler::dataManagerStartBroadcasting(
 }
 
 void ZegoExpressEngineMethodHandler::dataManagerStartSubscribing(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     if (dataManagerMap_.find(index) != dataManagerMap_.end()) {
-        auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+        auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
         dataManagerMap_[index]->startSubscribing(streamID);
 
@@ -5339,11 +5919,11 @@ void ZegoExpressEngineMethodHandler::dataManagerStartSubscribing(
 }
 
 void ZegoExpressEngineMethodHandler::dataManagerStopBroadcasting(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     if (dataManagerMap_.find(index) != dataManagerMap_.end()) {
-        auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+        auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
         dataManagerMap_[index]->stopBroadcasting(streamID);
 
@@ -5355,11 +5935,11 @@ void ZegoExpressEngineMethodHandler::dataManagerStopBroadcasting(
 }
 
 void ZegoExpressEngineMethodHandler::dataManagerStopSubscribing(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     if (dataManagerMap_.find(index) != dataManagerMap_.end()) {
-        auto streamID = std::get<std::string>(argument[FTValue("streamID")]);
+        auto streamID = std::get<std::string>(getArgument(argument, "streamID"));
 
         dataManagerMap_[index]->stopSubscribing(streamID);
 
@@ -5371,12 +5951,12 @@ void ZegoExpressEngineMethodHandler::dataManagerStopSubscribing(
 }
 
 void ZegoExpressEngineMethodHandler::getScreenCaptureSources(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto thumbnailWidth = std::get<int32_t>(argument[FTValue("thumbnailWidth")]);
-    auto thumbnailHeight = std::get<int32_t>(argument[FTValue("thumbnailHeight")]);
-    auto iconWidth = std::get<int32_t>(argument[FTValue("iconWidth")]);
-    auto iconHeight = std::get<int32_t>(argument[FTValue("iconHeight")]);
+    auto thumbnailWidth = std::get<int32_t>(getArgument(argument, "thumbnailWidth"));
+    auto thumbnailHeight = std::get<int32_t>(getArgument(argument, "thumbnailHeight"));
+    auto iconWidth = std::get<int32_t>(getArgument(argument, "iconWidth"));
+    auto iconHeight = std::get<int32_t>(getArgument(argument, "iconHeight"));
 
     auto infos = EXPRESS::ZegoExpressSDK::getEngine()->getScreenCaptureSources(
         thumbnailWidth, thumbnailHeight, iconWidth, iconHeight);
@@ -5418,11 +5998,11 @@ void ZegoExpressEngineMethodHandler::getScreenCaptureSources(
 }
 
 void ZegoExpressEngineMethodHandler::createScreenCaptureSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    void *sourceId =
-        reinterpret_cast<void *>(static_cast<intptr_t>(argument[FTValue("sourceId")].LongValue()));
-    auto sourceType = std::get<int32_t>(argument[FTValue("sourceType")]);
+    void *sourceId = reinterpret_cast<void *>(
+        static_cast<intptr_t>(getArgument(argument, "sourceId").LongValue()));
+    auto sourceType = std::get<int32_t>(getArgument(argument, "sourceType"));
     auto screenCaptureSource = EXPRESS::ZegoExpressSDK::getEngine()->createScreenCaptureSource(
         sourceId, (EXPRESS::ZegoScreenCaptureSourceType)sourceType);
     if (screenCaptureSource) {
@@ -5438,9 +6018,9 @@ void ZegoExpressEngineMethodHandler::createScreenCaptureSource(
 }
 
 void ZegoExpressEngineMethodHandler::destroyScreenCaptureSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto screenCaptureSource = screenCaptureSourceMap_[index];
 
     if (screenCaptureSource) {
@@ -5453,13 +6033,13 @@ void ZegoExpressEngineMethodHandler::destroyScreenCaptureSource(
 }
 
 void ZegoExpressEngineMethodHandler::enableCursorVisibleScreenCaptureSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto screenCaptureSource = screenCaptureSourceMap_[index];
 
     if (screenCaptureSource) {
-        auto visible = std::get<bool>(argument[FTValue("visible")]);
+        auto visible = std::get<bool>(getArgument(argument, "visible"));
         screenCaptureSource->enableCursorVisible(visible);
     }
 
@@ -5467,13 +6047,13 @@ void ZegoExpressEngineMethodHandler::enableCursorVisibleScreenCaptureSource(
 }
 
 void ZegoExpressEngineMethodHandler::enableWindowActivateScreenCaptureSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto screenCaptureSource = screenCaptureSourceMap_[index];
 
     if (screenCaptureSource) {
-        auto active = std::get<bool>(argument[FTValue("active")]);
+        auto active = std::get<bool>(getArgument(argument, "active"));
         screenCaptureSource->enableWindowActivate(active);
     }
 
@@ -5481,13 +6061,13 @@ void ZegoExpressEngineMethodHandler::enableWindowActivateScreenCaptureSource(
 }
 
 void ZegoExpressEngineMethodHandler::setExcludeWindowListScreenCaptureSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto screenCaptureSource = screenCaptureSourceMap_[index];
 
     if (screenCaptureSource) {
-        auto list = std::get<FTArray>(argument[FTValue("list")]);
+        auto list = std::get<FTArray>(getArgument(argument, "list"));
         intptr_t *c_list = new intptr_t[list.size()];
         intptr_t *tmpPtr = c_list;
         for (auto win : list) {
@@ -5503,13 +6083,13 @@ void ZegoExpressEngineMethodHandler::setExcludeWindowListScreenCaptureSource(
 }
 
 void ZegoExpressEngineMethodHandler::updateCaptureRegionScreenCaptureSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto screenCaptureSource = screenCaptureSourceMap_[index];
 
     if (screenCaptureSource) {
-        auto rectMap = std::get<FTMap>(argument[FTValue("rect")]);
+        auto rectMap = std::get<FTMap>(getArgument(argument, "rect"));
         EXPRESS::ZegoRect rect;
         rect.x = std::get<double>(rectMap[FTValue("x")]);
         rect.y = std::get<double>(rectMap[FTValue("y")]);
@@ -5522,13 +6102,13 @@ void ZegoExpressEngineMethodHandler::updateCaptureRegionScreenCaptureSource(
 }
 
 void ZegoExpressEngineMethodHandler::updatePublishRegionScreenCaptureSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto screenCaptureSource = screenCaptureSourceMap_[index];
 
     if (screenCaptureSource) {
-        auto rectMap = std::get<FTMap>(argument[FTValue("rect")]);
+        auto rectMap = std::get<FTMap>(getArgument(argument, "rect"));
         EXPRESS::ZegoRect rect;
         rect.x = std::get<double>(rectMap[FTValue("x")]);
         rect.y = std::get<double>(rectMap[FTValue("y")]);
@@ -5541,15 +6121,15 @@ void ZegoExpressEngineMethodHandler::updatePublishRegionScreenCaptureSource(
 }
 
 void ZegoExpressEngineMethodHandler::updateCaptureSourceScreenCaptureSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto screenCaptureSource = screenCaptureSourceMap_[index];
 
     if (screenCaptureSource) {
         void *sourceId = reinterpret_cast<void *>(
-            static_cast<intptr_t>(argument[FTValue("sourceId")].LongValue()));
-        auto sourceType = std::get<int32_t>(argument[FTValue("sourceType")]);
+            static_cast<intptr_t>(getArgument(argument, "sourceId").LongValue()));
+        auto sourceType = std::get<int32_t>(getArgument(argument, "sourceType"));
         screenCaptureSource->updateCaptureSource(sourceId,
                                                  (EXPRESS::ZegoScreenCaptureSourceType)sourceType);
     }
@@ -5558,9 +6138,9 @@ void ZegoExpressEngineMethodHandler::updateCaptureSourceScreenCaptureSource(
 }
 
 void ZegoExpressEngineMethodHandler::startCaptureScreenCaptureSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto screenCaptureSource = screenCaptureSourceMap_[index];
 
     if (screenCaptureSource) {
@@ -5571,9 +6151,9 @@ void ZegoExpressEngineMethodHandler::startCaptureScreenCaptureSource(
 }
 
 void ZegoExpressEngineMethodHandler::stopCaptureScreenCaptureSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto screenCaptureSource = screenCaptureSourceMap_[index];
 
     if (screenCaptureSource) {
@@ -5584,9 +6164,9 @@ void ZegoExpressEngineMethodHandler::stopCaptureScreenCaptureSource(
 }
 
 void ZegoExpressEngineMethodHandler::getCaptureSourceRectScreenCaptureSource(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto screenCaptureSource = screenCaptureSourceMap_[index];
 
     if (screenCaptureSource) {
@@ -5603,7 +6183,7 @@ void ZegoExpressEngineMethodHandler::getCaptureSourceRectScreenCaptureSource(
 }
 
 void ZegoExpressEngineMethodHandler::createAIVoiceChanger(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
     auto aiVoiceChanger = EXPRESS::ZegoExpressSDK::getEngine()->createAIVoiceChanger();
     if (aiVoiceChanger) {
@@ -5620,9 +6200,9 @@ void ZegoExpressEngineMethodHandler::createAIVoiceChanger(
 
 
 void ZegoExpressEngineMethodHandler::destroyAIVoiceChanger(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto aiVoiceChanger = aiVoiceChangerMap_[index];
 
     if (aiVoiceChanger) {
@@ -5636,9 +6216,9 @@ void ZegoExpressEngineMethodHandler::destroyAIVoiceChanger(
 }
 
 void ZegoExpressEngineMethodHandler::aiVoiceChangerInitEngine(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto aiVoiceChanger = aiVoiceChangerMap_[index];
 
     if (aiVoiceChanger) {
@@ -5649,9 +6229,9 @@ void ZegoExpressEngineMethodHandler::aiVoiceChangerInitEngine(
 }
 
 void ZegoExpressEngineMethodHandler::aiVoiceChangerUpdate(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto aiVoiceChanger = aiVoiceChangerMap_[index];
 
     if (aiVoiceChanger) {
@@ -5662,13 +6242,13 @@ void ZegoExpressEngineMethodHandler::aiVoiceChangerUpdate(
 }
 
 void ZegoExpressEngineMethodHandler::aiVoiceChangerSetSpeaker(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto aiVoiceChanger = aiVoiceChangerMap_[index];
 
     if (aiVoiceChanger) {
-        auto speakerID = std::get<int32_t>(argument[FTValue("speakerID")]);
+        auto speakerID = std::get<int32_t>(getArgument(argument, "speakerID"));
         aiVoiceChanger->setSpeaker(speakerID);
     }
 
@@ -5676,9 +6256,9 @@ void ZegoExpressEngineMethodHandler::aiVoiceChangerSetSpeaker(
 }
 
 void ZegoExpressEngineMethodHandler::aiVoiceChangerGetSpeakerList(
-    flutter::EncodableMap &argument,
+    const flutter::EncodableMap &argument,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
-    auto index = std::get<int32_t>(argument[FTValue("index")]);
+    auto index = std::get<int32_t>(getArgument(argument, "index"));
     auto aiVoiceChanger = aiVoiceChangerMap_[index];
 
     if (aiVoiceChanger) {
@@ -5,6 +5,14 @@
 #include <flutter/method_channel.h>
 #include <flutter/plugin_registrar_windows.h>
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+#include "ZegoCustomAudioRenderRing.h"
+#include "ZegoTaskExecutor.h"
+
 using namespace ZEGO;
 
 class ZegoExpressEngineMethodHandler {
@@ -22,958 +30,1096 @@ class ZegoExpressEngineMethodHandler {
 
     bool isEngineCreated();
 
+    // Held shared by the ffi entry points while they call the engine, and
+    // exclusively while the engine is destroyed or a data manager is added
+    // or removed.
+    std::shared_mutex &getEngineMutex() { return engineMutex_; }
+
+    // Called with the engine mutex held.
+    EXPRESS::IZegoRealTimeSequentialDataManager *getRealTimeSequentialDataManager(int index);
+
+    // Fetches into the ring of createCustomAudioRenderRing at address,
+    // returns false if that ring is not the current one.
+    bool fetchCustomAudioRenderRing(int64_t address, uint32_t chunkCount, uint32_t &fetchedCount);
+
+    // Whether a call run on `queue` has not replied yet, later method calls
+    // that depend on the queue wait for it to keep the order of dart calls.
+    // Called on the platform thread.
+    bool hasQueuedCalls(ZegoTaskQueue queue) const { return queuedCallCounts_[queue] > 0; }
+
+    // Called on the platform thread once the last queued call of a queue
+    // replied.
+    void setQueuedCallsDoneCallback(std::function<void()> callback);
+
   public:
-    void getVersion(flutter::EncodableMap &argument,
+    void getVersion(const flutter::EncodableMap &argument,
                     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void isFeatureSupported(flutter::EncodableMap &argument,
+    void isFeatureSupported(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setPluginVersion(flutter::EncodableMap &argument,
+    void setPluginVersion(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    getAssetAbsolutePath(flutter::EncodableMap &argument,
+    getAssetAbsolutePath(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void createEngine(flutter::EncodableMap &argument,
+    void createEngine(const flutter::EncodableMap &argument,
                       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    createEngineWithProfile(flutter::EncodableMap &argument,
+    createEngineWithProfile(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void destroyEngine(flutter::EncodableMap &argument,
+    void destroyEngine(const flutter::EncodableMap &argument,
                        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setEngineConfig(flutter::EncodableMap &argument,
+    void setEngineConfig(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setLogConfig(flutter::EncodableMap &argument,
+    void setLogConfig(const flutter::EncodableMap &argument,
                       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setLocalProxyConfig(flutter::EncodableMap &argument,
+    void setLocalProxyConfig(const flutter::EncodableMap &argument,
                       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setCloudProxyConfig(flutter::EncodableMap &argument,
+    void setCloudProxyConfig(const flutter::EncodableMap &argument,
                       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setRoomMode(flutter::EncodableMap &argument,
+    void setRoomMode(const flutter::EncodableMap &argument,
                      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setLicense(flutter::EncodableMap &argument,
+    void setLicense(const flutter::EncodableMap &argument,
                      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);                     
-    void setGeoFence(flutter::EncodableMap &argument,
+    void setGeoFence(const flutter::EncodableMap &argument,
                      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setRoomScenario(flutter::EncodableMap &argument,
+    void setRoomScenario(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void uploadLog(flutter::EncodableMap &argument,
+    void uploadLog(const flutter::EncodableMap &argument,
                    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void submitLog(flutter::EncodableMap &argument,
+    void submitLog(const flutter::EncodableMap &argument,
                    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    enableDebugAssistant(flutter::EncodableMap &argument,
+    enableDebugAssistant(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    callExperimentalAPI(flutter::EncodableMap &argument,
+    callExperimentalAPI(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setDummyCaptureImagePath(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
-    void loginRoom(flutter::EncodableMap &argument,
+    void loginRoom(const flutter::EncodableMap &argument,
                    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void logoutRoom(flutter::EncodableMap &argument,
+    void logoutRoom(const flutter::EncodableMap &argument,
                     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void switchRoom(flutter::EncodableMap &argument,
+    void switchRoom(const flutter::EncodableMap &argument,
                     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void renewToken(flutter::EncodableMap &argument,
+    void renewToken(const flutter::EncodableMap &argument,
                     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setRoomExtraInfo(flutter::EncodableMap &argument,
+    void setRoomExtraInfo(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     void
-    startPublishingStream(flutter::EncodableMap &argument,
+    startPublishingStream(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    stopPublishingStream(flutter::EncodableMap &argument,
+    stopPublishingStream(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setStreamExtraInfo(flutter::EncodableMap &argument,
+    void setStreamExtraInfo(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void startPreview(flutter::EncodableMap &argument,
+    void startPreview(const flutter::EncodableMap &argument,
                       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void stopPreview(flutter::EncodableMap &argument,
+    void stopPreview(const flutter::EncodableMap &argument,
                      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setVideoConfig(flutter::EncodableMap &argument,
+    void setVideoConfig(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void getVideoConfig(flutter::EncodableMap &argument,
+    void getVideoConfig(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setPublishDualStreamConfig(flutter::EncodableMap &argument,
+    void setPublishDualStreamConfig(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setVideoMirrorMode(flutter::EncodableMap &argument,
+    void setVideoMirrorMode(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setAudioConfig(flutter::EncodableMap &argument,
+    void setAudioConfig(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void getAudioConfig(flutter::EncodableMap &argument,
+    void getAudioConfig(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setPublishStreamEncryptionKey(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void takePublishStreamSnapshot(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     void setMinVideoBitrateForTrafficControl(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setMinVideoFpsForTrafficControl(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setMinVideoResolutionForTrafficControl(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setTrafficControlFocusOn(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void addPublishCdnUrl(flutter::EncodableMap &argument,
+    void addPublishCdnUrl(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    removePublishCdnUrl(flutter::EncodableMap &argument,
+    removePublishCdnUrl(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enablePublishDirectToCDN(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setPublishWatermark(flutter::EncodableMap &argument,
+    setPublishWatermark(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setPlayStreamDecryptionKey(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setPlayStreamVideoType(flutter::EncodableMap &argument,
+    setPlayStreamVideoType(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setPlayStreamBufferIntervalRange(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setPlayStreamFocusOn(flutter::EncodableMap &argument,
+    setPlayStreamFocusOn(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    mutePlayStreamVideo(flutter::EncodableMap &argument,
+    mutePlayStreamVideo(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    muteAllPlayStreamVideo(flutter::EncodableMap &argument,
+    muteAllPlayStreamVideo(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    muteAllPlayVideoStreams(flutter::EncodableMap &argument,
+    muteAllPlayVideoStreams(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void enableCheckPoc(flutter::EncodableMap &argument,
+    void enableCheckPoc(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    isVideoDecoderSupported(flutter::EncodableMap &argument,
+    isVideoDecoderSupported(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setPlayStreamsAlignmentProperty(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableVideoSuperResolution(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void initVideoSuperResolution(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void uninitVideoSuperResolution(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void updatePlayingCanvas(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
-    void startAutoMixerTask(flutter::EncodableMap &argument,
+    void startAutoMixerTask(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void stopAutoMixerTask(flutter::EncodableMap &argument,
+    void stopAutoMixerTask(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setAudioRouteToSpeaker(flutter::EncodableMap &argument,
+    setAudioRouteToSpeaker(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void getAudioRouteType(flutter::EncodableMap &argument,
+    void getAudioRouteType(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void useFrontCamera(flutter::EncodableMap &argument,
+    void useFrontCamera(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    isCameraFocusSupported(flutter::EncodableMap &argument,
+    isCameraFocusSupported(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setCameraFocusMode(flutter::EncodableMap &argument,
+    void setCameraFocusMode(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setCameraFocusPointInPreview(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setCameraExposureMode(flutter::EncodableMap &argument,
+    setCameraExposureMode(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setCameraExposurePointInPreview(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setCameraExposureCompensation(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setCameraZoomFactor(flutter::EncodableMap &argument,
+    setCameraZoomFactor(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    getCameraMaxZoomFactor(flutter::EncodableMap &argument,
+    getCameraMaxZoomFactor(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void startAudioSpectrumMonitor(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void stopAudioSpectrumMonitor(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void enableHeadphoneAEC(flutter::EncodableMap &argument,
+    void enableHeadphoneAEC(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void startEffectsEnv(flutter::EncodableMap &argument,
+    void startEffectsEnv(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void stopEffectsEnv(flutter::EncodableMap &argument,
+    void stopEffectsEnv(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    enableEffectsBeauty(flutter::EncodableMap &argument,
+    enableEffectsBeauty(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setEffectsBeautyParam(flutter::EncodableMap &argument,
+    setEffectsBeautyParam(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void enableBeautify(flutter::EncodableMap &argument,
+    void enableBeautify(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setBeautifyOption(flutter::EncodableMap &argument,
+    void setBeautifyOption(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     void
-    sendBroadcastMessage(flutter::EncodableMap &argument,
+    sendBroadcastMessage(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void sendBarrageMessage(flutter::EncodableMap &argument,
+    void sendBarrageMessage(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void sendCustomCommand(flutter::EncodableMap &argument,
+    void sendCustomCommand(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableCustomVideoCapture(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableCustomVideoProcessing(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableCustomVideoRender(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableCustomAudioCaptureProcessing(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableCustomAudioCaptureProcessingAfterHeadphoneMonitor(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableAlignedAudioAuxData(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableCustomAudioRemoteProcessing(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableCustomAudioPlaybackProcessing(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    enableCustomAudioIO(flutter::EncodableMap &argument,
+    enableCustomAudioIO(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void sendCustomAudioCaptureAACData(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void sendCustomAudioCapturePCMData(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void fetchCustomAudioRenderPCMData(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     void
-    startPerformanceMonitor(flutter::EncodableMap &argument,
+    startPerformanceMonitor(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    stopPerformanceMonitor(flutter::EncodableMap &argument,
+    stopPerformanceMonitor(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void startNetworkProbe(flutter::EncodableMap &argument,
+    void startNetworkProbe(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void stopNetworkProbe(flutter::EncodableMap &argument,
+    void stopNetworkProbe(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    startNetworkSpeedTest(flutter::EncodableMap &argument,
+    startNetworkSpeedTest(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    stopNetworkSpeedTest(flutter::EncodableMap &argument,
+    stopNetworkSpeedTest(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void getNetworkTimeInfo(flutter::EncodableMap &argument,
+    void getNetworkTimeInfo(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
-    void startDumpData(flutter::EncodableMap &argument,
+    void startDumpData(const flutter::EncodableMap &argument,
                        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void stopDumpData(flutter::EncodableMap &argument,
+    void stopDumpData(const flutter::EncodableMap &argument,
                        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void uploadDumpData(flutter::EncodableMap &argument,
+    void uploadDumpData(const flutter::EncodableMap &argument,
                        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void removeDumpData(flutter::EncodableMap &argument,
+    void removeDumpData(const flutter::EncodableMap &argument,
                        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
         
 
     void
-    mutePublishStreamAudio(flutter::EncodableMap &argument,
+    mutePublishStreamAudio(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    mutePublishStreamVideo(flutter::EncodableMap &argument,
+    mutePublishStreamVideo(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setCaptureVolume(flutter::EncodableMap &argument,
+    void setCaptureVolume(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setAudioCaptureStereoMode(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void sendSEI(flutter::EncodableMap &argument,
+    void sendSEI(const flutter::EncodableMap &argument,
                  std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void sendAudioSideInfo(flutter::EncodableMap &argument,
+    void sendAudioSideInfo(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    enableHardwareEncoder(flutter::EncodableMap &argument,
+    enableHardwareEncoder(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setCapturePipelineScaleMode(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableH265EncodeFallback(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    isVideoEncoderSupported(flutter::EncodableMap &argument,
+    isVideoEncoderSupported(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setLowlightEnhancement(flutter::EncodableMap &argument,
+    setLowlightEnhancement(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setVideoSource(flutter::EncodableMap &argument,
+    void setVideoSource(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setAudioSource(flutter::EncodableMap &argument,
+    void setAudioSource(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void enableVideoObjectSegmentation(flutter::EncodableMap &argument,
+    void enableVideoObjectSegmentation(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void enableAlphaChannelVideoEncoder(flutter::EncodableMap &argument,
+    void enableAlphaChannelVideoEncoder(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
-    void startPlayingStream(flutter::EncodableMap &argument,
+    void startPlayingStream(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void stopPlayingStream(flutter::EncodableMap &argument,
+    void stopPlayingStream(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setPlayStreamCrossAppInfo(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    takePlayStreamSnapshot(flutter::EncodableMap &argument,
+    takePlayStreamSnapshot(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setPlayVolume(flutter::EncodableMap &argument,
+    void setPlayVolume(const flutter::EncodableMap &argument,
                        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setAllPlayStreamVolume(flutter::EncodableMap &argument,
+    setAllPlayStreamVolume(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    mutePlayStreamAudio(flutter::EncodableMap &argument,
+    mutePlayStreamAudio(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    muteAllPlayStreamAudio(flutter::EncodableMap &argument,
+    muteAllPlayStreamAudio(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    muteAllPlayAudioStreams(flutter::EncodableMap &argument,
+    muteAllPlayAudioStreams(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    enableHardwareDecoder(flutter::EncodableMap &argument,
+    enableHardwareDecoder(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
-    void muteMicrophone(flutter::EncodableMap &argument,
+    void muteMicrophone(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void isMicrophoneMuted(flutter::EncodableMap &argument,
+    void isMicrophoneMuted(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void muteSpeaker(flutter::EncodableMap &argument,
+    void muteSpeaker(const flutter::EncodableMap &argument,
                      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void isSpeakerMuted(flutter::EncodableMap &argument,
+    void isSpeakerMuted(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void getAudioDeviceList(flutter::EncodableMap &argument,
+    void getAudioDeviceList(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    getDefaultAudioDeviceID(flutter::EncodableMap &argument,
+    getDefaultAudioDeviceID(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void useAudioDevice(flutter::EncodableMap &argument,
+    void useAudioDevice(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     void
-    startSoundLevelMonitor(flutter::EncodableMap &argument,
+    startSoundLevelMonitor(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    stopSoundLevelMonitor(flutter::EncodableMap &argument,
+    stopSoundLevelMonitor(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     void
-    enableHeadphoneMonitor(flutter::EncodableMap &argument,
+    enableHeadphoneMonitor(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setHeadphoneMonitorVolume(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
-    void enableAEC(flutter::EncodableMap &argument,
+    void enableAEC(const flutter::EncodableMap &argument,
                    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setAECMode(flutter::EncodableMap &argument,
+    void setAECMode(const flutter::EncodableMap &argument,
                     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void enableAGC(flutter::EncodableMap &argument,
+    void enableAGC(const flutter::EncodableMap &argument,
                    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void enableANS(flutter::EncodableMap &argument,
+    void enableANS(const flutter::EncodableMap &argument,
                    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void enableTransientANS(flutter::EncodableMap &argument,
+    void enableTransientANS(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setANSMode(flutter::EncodableMap &argument,
+    void setANSMode(const flutter::EncodableMap &argument,
                     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void enableSpeechEnhance(flutter::EncodableMap &argument,
+    void enableSpeechEnhance(const flutter::EncodableMap &argument,
                     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     void
-    setAudioEqualizerGain(flutter::EncodableMap &argument,
+    setAudioEqualizerGain(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setVoiceChangerPreset(flutter::EncodableMap &argument,
+    setVoiceChangerPreset(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setVoiceChangerParam(flutter::EncodableMap &argument,
+    setVoiceChangerParam(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setReverbPreset(flutter::EncodableMap &argument,
+    void setReverbPreset(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setReverbAdvancedParam(flutter::EncodableMap &argument,
+    setReverbAdvancedParam(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setReverbEchoParam(flutter::EncodableMap &argument,
+    void setReverbEchoParam(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    enableVirtualStereo(flutter::EncodableMap &argument,
+    enableVirtualStereo(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enablePlayStreamVirtualStereo(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setElectronicEffects(flutter::EncodableMap &argument,
+    setElectronicEffects(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     /* Custom Audio IO */
     void
-    startAudioDataObserver(flutter::EncodableMap &argument,
+    startAudioDataObserver(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    stopAudioDataObserver(flutter::EncodableMap &argument,
+    stopAudioDataObserver(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     /* Audio Effects Player */
     void
-    createAudioEffectPlayer(flutter::EncodableMap &argument,
+    createAudioEffectPlayer(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void destroyAudioEffectPlayer(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    audioEffectPlayerStart(flutter::EncodableMap &argument,
+    audioEffectPlayerStart(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    audioEffectPlayerStop(flutter::EncodableMap &argument,
+    audioEffectPlayerStop(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    audioEffectPlayerPause(flutter::EncodableMap &argument,
+    audioEffectPlayerPause(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    audioEffectPlayerResume(flutter::EncodableMap &argument,
+    audioEffectPlayerResume(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void audioEffectPlayerStopAll(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void audioEffectPlayerPauseAll(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void audioEffectPlayerResumeAll(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    audioEffectPlayerSeekTo(flutter::EncodableMap &argument,
+    audioEffectPlayerSeekTo(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void audioEffectPlayerSetVolume(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void audioEffectPlayerSetVolumeAll(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void audioEffectPlayerGetTotalDuration(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void audioEffectPlayerGetCurrentProgress(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void audioEffectPlayerLoadResource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void audioEffectPlayerUnloadResource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void audioEffectPlayerSetPlaySpeed(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void audioEffectPlayerUpdatePosition(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     /* Media Player */
-    void createMediaPlayer(flutter::EncodableMap &argument,
+    void createMediaPlayer(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void destroyMediaPlayer(flutter::EncodableMap &argument,
+    void destroyMediaPlayer(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    mediaPlayerLoadResource(flutter::EncodableMap &argument,
+    mediaPlayerLoadResource(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerLoadResourceFromMediaData(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerLoadResourceWithPosition(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void mediaPlayerStart(flutter::EncodableMap &argument,
+    void mediaPlayerStart(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void mediaPlayerStop(flutter::EncodableMap &argument,
+    void mediaPlayerStop(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void mediaPlayerPause(flutter::EncodableMap &argument,
+    void mediaPlayerPause(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void mediaPlayerResume(flutter::EncodableMap &argument,
+    void mediaPlayerResume(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void mediaPlayerSeekTo(flutter::EncodableMap &argument,
+    void mediaPlayerSeekTo(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    mediaPlayerEnableRepeat(flutter::EncodableMap &argument,
+    mediaPlayerEnableRepeat(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    mediaPlayerEnableAux(flutter::EncodableMap &argument,
+    mediaPlayerEnableAux(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    mediaPlayerMuteLocal(flutter::EncodableMap &argument,
+    mediaPlayerMuteLocal(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    mediaPlayerSetVolume(flutter::EncodableMap &argument,
+    mediaPlayerSetVolume(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetPlayVolume(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetPublishVolume(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetProgressInterval(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerGetPlayVolume(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerGetPublishVolume(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerGetTotalDuration(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerGetCurrentProgress(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerGetAudioTrackCount(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetAudioTrackIndex(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetVoiceChangerParam(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerGetCurrentState(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    mediaPlayerSetPlaySpeed(flutter::EncodableMap &argument,
+    mediaPlayerSetPlaySpeed(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     void mediaPlayerEnableSoundLevelMonitor(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerEnableFrequencySpectrumMonitor(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetNetWorkResourceMaxCache(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetNetWorkBufferThreshold(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerGetNetWorkResourceCache(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerEnableAccurateSeek(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerLoadCopyrightedMusicResourceWithPosition(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    mediaPlayerClearView(flutter::EncodableMap &argument,
+    mediaPlayerClearView(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetActiveAudioChannel(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetPlayerCanvas(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    mediaPlayerTakeSnapshot(flutter::EncodableMap &argument,
+    mediaPlayerTakeSnapshot(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetAudioTrackMode(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetAudioTrackPublishIndex(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerEnableVideoData(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerEnableBlockData(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerLoadResourceWithConfig(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerUpdatePosition(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerGetMediaInfo(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetHttpHeader(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerGetCurrentRenderingProgress(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerEnableLiveAudioEffect(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaPlayerSetPlayMediaStreamType(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     /* Media Data Publisher */
     void createMediaDataPublisher(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void destroyMediaDataPublisher(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaDataPublisherAddMediaFilePath(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaDataPublisherGetCurrentDuration(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaDataPublisherGetTotalDuration(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaDataPublisherReset(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaDataPublisherSeekTo(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void mediaDataPublisherSetVideoSendDelayTime(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
-    void startMixerTask(flutter::EncodableMap &argument,
+    void startMixerTask(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void stopMixerTask(flutter::EncodableMap &argument,
+    void stopMixerTask(const flutter::EncodableMap &argument,
                        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setSEIConfig(flutter::EncodableMap &argument,
+    void setSEIConfig(const flutter::EncodableMap &argument,
                       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setAudioDeviceVolume(flutter::EncodableMap &argument,
+    setAudioDeviceVolume(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    setSpeakerVolumeInAPP(flutter::EncodableMap &argument,
+    setSpeakerVolumeInAPP(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    getSpeakerVolumeInAPP(flutter::EncodableMap &argument,
+    getSpeakerVolumeInAPP(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void startAudioDeviceVolumeMonitor(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void stopAudioDeviceVolumeMonitor(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void muteAudioDevice(flutter::EncodableMap &argument,
+    void muteAudioDevice(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void isAudioDeviceMuted(flutter::EncodableMap &argument,
+    void isAudioDeviceMuted(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void setAudioDeviceMode(flutter::EncodableMap &argument,
+    void setAudioDeviceMode(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    getAudioDeviceVolume(flutter::EncodableMap &argument,
+    getAudioDeviceVolume(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableAudioCaptureDevice(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    enableTrafficControl(flutter::EncodableMap &argument,
+    enableTrafficControl(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void startRecordingCapturedData(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void stopRecordingCapturedData(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
-    void enableCamera(flutter::EncodableMap &argument,
+    void enableCamera(const flutter::EncodableMap &argument,
                       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    enableCameraAdaptiveFPS(flutter::EncodableMap &argument,
+    enableCameraAdaptiveFPS(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
-    void useVideoDevice(flutter::EncodableMap &argument,
+    void useVideoDevice(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void getVideoDeviceList(flutter::EncodableMap &argument,
+    void getVideoDeviceList(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    getDefaultVideoDeviceID(flutter::EncodableMap &argument,
+    getDefaultVideoDeviceID(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    enableMixSystemPlayout(flutter::EncodableMap &argument,
+    enableMixSystemPlayout(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setMixSystemPlayoutVolume(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    enableMixEnginePlayout(flutter::EncodableMap &argument,
+    enableMixEnginePlayout(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void startAudioVADStableStateMonitor(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void stopAudioVADStableStateMonitor(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    getCurrentAudioDevice(flutter::EncodableMap &argument,
+    getCurrentAudioDevice(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     /* Copyrighted Music*/
     void
-    createCopyrightedMusic(flutter::EncodableMap &argument,
+    createCopyrightedMusic(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    destroyCopyrightedMusic(flutter::EncodableMap &argument,
+    destroyCopyrightedMusic(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicClearCache(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicDownload(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetAverageScore(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetCacheSize(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetCurrentPitch(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetDuration(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetKrcLyricByToken(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetLrcLyric(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetMusicByToken(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetPreviousScore(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetStandardPitch(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetTotalScore(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicInitCopyrightedMusic(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicPauseScore(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicQueryCache(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicQueryCacheWithConfig(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicRequestAccompaniment(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicRequestAccompanimentClip(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicRequestSong(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicResetScore(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicResumeScore(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicSendExtendedRequest(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicStartScore(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicStopScore(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetFullScore(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicGetSharedResource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void copyrightedMusicRequestResource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     // rangeAudio
-    void createRangeAudio(flutter::EncodableMap &argument,
+    void createRangeAudio(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void destroyRangeAudio(flutter::EncodableMap &argument,
+    void destroyRangeAudio(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void rangeAudioEnableMicrophone(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void rangeAudioEnableSpatializer(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    rangeAudioEnableSpeaker(flutter::EncodableMap &argument,
+    rangeAudioEnableSpeaker(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void rangeAudioSetAudioReceiveRange(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void rangeAudioSetMode(flutter::EncodableMap &argument,
+    void rangeAudioSetMode(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    rangeAudioSetTeamID(flutter::EncodableMap &argument,
+    rangeAudioSetTeamID(const flutter::EncodableMap &argument,
                         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void rangeAudioUpdateAudioSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void rangeAudioUpdateSelfPosition(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
-    void rangeAudioMuteUser(flutter::EncodableMap &argument,
+    void rangeAudioMuteUser(const flutter::EncodableMap &argument,
                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void rangeAudioSetPositionUpdateFrequency(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void rangeAudioSetRangeAudioVolume(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void rangeAudioSetStreamVocalRange(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void rangeAudioUpdateStreamPosition(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void rangeAudioSetRangeAudioCustomMode(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     // RealTimeSequentialDataManager
     void createRealTimeSequentialDataManager(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void destroyRealTimeSequentialDataManager(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void dataManagerSendRealTimeSequentialData(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void dataManagerSendRealTimeSequentialDataBatch(
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void dataManagerStartBroadcasting(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void dataManagerStartSubscribing(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void dataManagerStopBroadcasting(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void dataManagerStopSubscribing(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     // ScreenCapture
     void getScreenCaptureSources(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void createScreenCaptureSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void destroyScreenCaptureSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableCursorVisibleScreenCaptureSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void enableWindowActivateScreenCaptureSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void setExcludeWindowListScreenCaptureSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void updateCaptureRegionScreenCaptureSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void updatePublishRegionScreenCaptureSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void updateCaptureSourceScreenCaptureSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void startCaptureScreenCaptureSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void stopCaptureScreenCaptureSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void getCaptureSourceRectScreenCaptureSource(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     // AIVoiceChanger
     void createAIVoiceChanger(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    destroyAIVoiceChanger(flutter::EncodableMap &argument,
+    destroyAIVoiceChanger(const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void aiVoiceChangerGetSpeakerList(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void aiVoiceChangerInitEngine(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void aiVoiceChangerSetSpeaker(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
     aiVoiceChangerUpdate(
-        flutter::EncodableMap &argument,
+        const flutter::EncodableMap &argument,
         std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
     void
-    createTextureRenderer(flutter::EncodableMap &argument,
+    createTextureRenderer(const flutter::EncodableMap &argument,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
     void
-    destroyTextureRenderer(flutter::EncodableMap &argument,
+    destroyTextureRenderer(const flutter::EncodableMap &argument,
                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void
+    setTextureRendererMaxFps(const flutter::EncodableMap &argument,
+                             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void setTextureRendererFpsPolicy(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void enableTextureRendererPrepWorker(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void enableTextureRendererSingleCopy(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void enableTextureRendererFrameBatching(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void
+    getTextureRendererStats(const flutter::EncodableMap &argument,
+                            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void enableVideoHealthAnalyzer(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void
+    getVideoHealthSummary(const flutter::EncodableMap &argument,
+                          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void
+    getEventQueueStats(const flutter::EncodableMap &argument,
+                       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void enableCompactEventEncoding(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void enableAudioMeterCoalescing(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void setUnsubscribedEvents(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void getSuppressedEventCounts(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void createAudioDataRing(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void destroyAudioDataRing(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void queryStreamQuality(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void enableRoomRoster(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void getRoomUsers(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void getRoomStreams(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void enableIMMessageBuffer(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void getIMMessageBufferStats(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void enableRealTimeSequentialDataBatching(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void getRealTimeSequentialDataStats(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void enableSEIBatching(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void getSEIBatchStats(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void setEventLaneMaxDepth(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void getEventLaneStats(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void getMethodCallStats(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void setMethodCallStatsLogInterval(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void getTaskQueueStats(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void setPluginLogLevel(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void getPluginLogStats(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void createCustomAudioRenderRing(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+    void destroyCustomAudioRenderRing(
+        const flutter::EncodableMap &argument,
+        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
   private:
     ZegoExpressEngineMethodHandler() = default;
 
+    // Runs the blocking `task` on `queue` and replies with its return value
+    // on the platform thread. Without a window it runs on the platform
+    // thread right away.
+    void runOnQueue(ZegoTaskQueue queue,
+                    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result,
+                    std::function<flutter::EncodableValue()> task);
+
+    // Calls of runOnQueue that have not replied yet per queue, counted on the
+    // platform thread only.
+    uint32_t queuedCallCounts_[ZEGO_TASK_QUEUE_COUNT] = {};
+    std::function<void()> queuedCallsDone_;
+
   private:
     std::unordered_map<int, EXPRESS::IZegoAudioEffectPlayer *> audioEffectPlayerMap_;
     std::unordered_map<int, EXPRESS::IZegoMediaPlayer *> mediaPlayerMap_;
@@ -985,4 +1131,9 @@ class ZegoExpressEngineMethodHandler {
     EXPRESS::IZegoRangeAudio *rangeAudio_ = nullptr;
 
     flutter::PluginRegistrarWindows *registrar_;
+    std::shared_mutex engineMutex_;
+    // Guards the ring against ffi fetches, its timer is stopped before the
+    // mutex is taken to destroy it.
+    std::mutex customAudioRenderRingMutex_;
+    std::unique_ptr<ZegoCustomAudioRenderRing> customAudioRenderRing_;
 };
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "ZegoIMMessageBuffer.h"
+
+namespace {
+
+// Number of recent message IDs remembered for deduplication.
+constexpr size_t kDedupWindow = 4096;
+
+// Senders idle for this long are forgotten by the rate limiter.
+constexpr std::chrono::seconds kSenderIdleTimeout(10);
+
+}  // namespace
+
+ZegoIMMessageBuffer::~ZegoIMMessageBuffer() {
+  stop();
+}
+
+void ZegoIMMessageBuffer::start(const Config &config, ReadyCallback ready, EmitCallback emit) {
+  stop();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  config_ = config;
+  config_.intervalMs = config.intervalMs > 0 ? config.intervalMs : 33;
+  config_.maxBatchSize = config.maxBatchSize > 0 ? config.maxBatchSize : 200;
+  config_.maxBacklog = config.maxBacklog > 0 ? config.maxBacklog : 2000;
+  emit_ = std::move(emit);
+  stats_ = Stats();
+  startTicking(config_.intervalMs, std::move(ready));
+}
+
+void ZegoIMMessageBuffer::stop() {
+  stopTicking();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  emit_ = nullptr;
+  recentIDs_.clear();
+  recentIDSet_.clear();
+  senderBuckets_.clear();
+}
+
+void ZegoIMMessageBuffer::addBroadcastMessages(
+    const std::string &roomID,
+    const std::vector<ZEGO::EXPRESS::ZegoBroadcastMessageInfo> &messageList) {
+  auto now = Clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto const &info : messageList) {
+    stats_.receivedCount++;
+    if (!accept("0:" + std::to_string(info.messageID), info.fromUser.userID, now)) {
+      continue;
+    }
+    push({ZEGO_IM_MESSAGE_TYPE_BROADCAST, roomID, flutter::EncodableValue((int64_t)info.messageID),
+          info.sendTime, info.fromUser, info.message});
+  }
+}
+
+void ZegoIMMessageBuffer::addBarrageMessages(
+    const std::string &roomID,
+    const std::vector<ZEGO::EXPRESS::ZegoBarrageMessageInfo> &messageList) {
+  auto now = Clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto const &info : messageList) {
+    stats_.receivedCount++;
+    if (!accept("1:" + info.messageID, info.fromUser.userID, now)) {
+      continue;
+    }
+    push({ZEGO_IM_MESSAGE_TYPE_BARRAGE, roomID, flutter::EncodableValue(info.messageID),
+          info.sendTime, info.fromUser, info.message});
+  }
+}
+
+void ZegoIMMessageBuffer::addCustomCommand(const std::string &roomID,
+                                           const ZEGO::EXPRESS::ZegoUser &fromUser,
+                                           const std::string &command) {
+  auto now = Clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.receivedCount++;
+  // Custom commands carry no message ID, they are only rate limited.
+  if (!accept(std::string(), fromUser.userID, now)) {
+    return;
+  }
+  push({ZEGO_IM_MESSAGE_TYPE_CUSTOM_COMMAND, roomID, flutter::EncodableValue(), 0, fromUser, command});
+}
+
+ZegoIMMessageBuffer::Stats ZegoIMMessageBuffer::getStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Stats stats = stats_;
+  stats.backlogSize = (uint32_t)backlog_.size();
+  return stats;
+}
+
+bool ZegoIMMessageBuffer::accept(const std::string &dedupKey, const std::string &userID,
+                                 Clock::time_point now) {
+  if (!dedupKey.empty()) {
+    if (recentIDSet_.count(dedupKey)) {
+      stats_.duplicateCount++;
+      return false;
+    }
+    recentIDSet_.insert(dedupKey);
+    recentIDs_.push_back(dedupKey);
+    if (recentIDs_.size() > kDedupWindow) {
+      recentIDSet_.erase(recentIDs_.front());
+      recentIDs_.pop_front();
+    }
+  }
+
+  if (config_.senderRateLimit == 0) {
+    return true;
+  }
+
+  // Token bucket per sender, refilled at the limit with one second of burst.
+  double rate = (double)config_.senderRateLimit;
+  auto inserted = senderBuckets_.emplace(userID, SenderBucket{rate, now});
+  auto &bucket = inserted.first->second;
+  if (!inserted.second) {
+    double elapsed = std::chrono::duration<double>(now - bucket.lastTime).count();
+    bucket.tokens += elapsed * rate;
+    bucket.tokens = bucket.tokens > rate ? rate : bucket.tokens;
+    bucket.lastTime = now;
+  }
+
+  // The current sender was just refilled, so pruning keeps bucket valid.
+  if (now - lastBucketPruneTime_ > kSenderIdleTimeout) {
+    lastBucketPruneTime_ = now;
+    for (auto it = senderBuckets_.begin(); it != senderBuckets_.end();) {
+      if (now - it->second.lastTime > kSenderIdleTimeout) {
+        it = senderBuckets_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  if (bucket.tokens < 1) {
+    stats_.rateLimitedCount++;
+    return false;
+  }
+  bucket.tokens -= 1;
+  return true;
+}
+
+void ZegoIMMessageBuffer::push(Message &&message) {
+  if (backlog_.size() >= config_.maxBacklog) {
+    backlog_.pop_front();
+    stats_.overflowCount++;
+  }
+  backlog_.push_back(std::move(message));
+  if (backlog_.size() > stats_.maxBacklogSize) {
+    stats_.maxBacklogSize = (uint32_t)backlog_.size();
+  }
+}
+
+std::function<void()> ZegoIMMessageBuffer::takeBatch(bool isStopping) {
+  // The last batch takes the whole backlog.
+  auto messageList = encodeBatch(isStopping ? backlog_.size() : config_.maxBatchSize);
+  if (!emit_) {
+    return nullptr;
+  }
+  return [emit = emit_, messageList = std::move(messageList)]() mutable { emit(std::move(messageList)); };
+}
+
+flutter::EncodableList ZegoIMMessageBuffer::encodeBatch(size_t maxBatchSize) {
+  flutter::EncodableList messageList;
+  size_t count = backlog_.size() < maxBatchSize ? backlog_.size() : maxBatchSize;
+  messageList.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    auto &message = backlog_.front();
+
+    flutter::EncodableMap userMap;
+    userMap[flutter::EncodableValue("userID")] = flutter::EncodableValue(std::move(message.fromUser.userID));
+    userMap[flutter::EncodableValue("userName")] = flutter::EncodableValue(std::move(message.fromUser.userName));
+
+    flutter::EncodableMap messageMap;
+    messageMap[flutter::EncodableValue("type")] = flutter::EncodableValue((int32_t)message.type);
+    messageMap[flutter::EncodableValue("roomID")] = flutter::EncodableValue(std::move(message.roomID));
+    messageMap[flutter::EncodableValue("messageID")] = std::move(message.messageID);
+    messageMap[flutter::EncodableValue("sendTime")] = flutter::EncodableValue((int64_t)message.sendTime);
+    messageMap[flutter::EncodableValue("fromUser")] = flutter::EncodableValue(std::move(userMap));
+    messageMap[flutter::EncodableValue("message")] = flutter::EncodableValue(std::move(message.message));
+    messageList.emplace_back(std::move(messageMap));
+
+    backlog_.pop_front();
+  }
+  if (count > 0) {
+    stats_.deliveredCount += count;
+    stats_.batchCount++;
+  }
+  return messageList;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <flutter/encodable_value.h>
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <ZegoExpressSDK.h>
+
+#include "ZegoBatchTicker.h"
+
+enum ZegoIMMessageType {
+  ZEGO_IM_MESSAGE_TYPE_BROADCAST = 0,
+  ZEGO_IM_MESSAGE_TYPE_BARRAGE,
+  ZEGO_IM_MESSAGE_TYPE_CUSTOM_COMMAND
+};
+
+// Buffers broadcast, barrage and custom command messages of all rooms and
+// emits them as a single batch per tick. Messages are deduplicated by
+// message ID, optionally rate limited per sender, and the backlog is
+// bounded by dropping the oldest messages. Like the audio meter
+// aggregator, a tick is skipped while the previous batch has not been
+// delivered yet.
+class ZegoIMMessageBuffer : public ZegoTickBatcher {
+ public:
+  struct Config {
+    uint32_t intervalMs = 33;
+    uint32_t maxBatchSize = 200;
+    uint32_t maxBacklog = 2000;
+    // Messages per second accepted from one sender, 0 for no limit.
+    uint32_t senderRateLimit = 0;
+  };
+
+  struct Stats {
+    uint64_t receivedCount = 0;
+    uint64_t deliveredCount = 0;
+    uint64_t batchCount = 0;
+    uint64_t duplicateCount = 0;
+    uint64_t rateLimitedCount = 0;
+    uint64_t overflowCount = 0;
+    uint32_t backlogSize = 0;
+    uint32_t maxBacklogSize = 0;
+  };
+
+  using EmitCallback = std::function<void(flutter::EncodableList &&messageList)>;
+
+  ZegoIMMessageBuffer() = default;
+  ~ZegoIMMessageBuffer();
+
+  // Prevent copying.
+  ZegoIMMessageBuffer(ZegoIMMessageBuffer const&) = delete;
+  ZegoIMMessageBuffer& operator=(ZegoIMMessageBuffer const&) = delete;
+
+  void start(const Config &config, ReadyCallback ready, EmitCallback emit);
+
+  // Emits the remaining backlog as a last batch.
+  void stop();
+
+  void addBroadcastMessages(const std::string &roomID,
+                            const std::vector<ZEGO::EXPRESS::ZegoBroadcastMessageInfo> &messageList);
+
+  void addBarrageMessages(const std::string &roomID,
+                          const std::vector<ZEGO::EXPRESS::ZegoBarrageMessageInfo> &messageList);
+
+  void addCustomCommand(const std::string &roomID, const ZEGO::EXPRESS::ZegoUser &fromUser,
+                        const std::string &command);
+
+  Stats getStats();
+
+ protected:
+  bool hasPending() override { return !backlog_.empty(); }
+
+  std::function<void()> takeBatch(bool isStopping) override;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Message {
+    ZegoIMMessageType type;
+    std::string roomID;
+    flutter::EncodableValue messageID;
+    uint64_t sendTime = 0;
+    ZEGO::EXPRESS::ZegoUser fromUser;
+    std::string message;
+  };
+
+  struct SenderBucket {
+    double tokens = 0;
+    Clock::time_point lastTime;
+  };
+
+  // Returns false if the message is a duplicate or over its sender's rate.
+  bool accept(const std::string &dedupKey, const std::string &userID, Clock::time_point now);
+
+  void push(Message &&message);
+
+  // Encodes at most maxBatchSize messages from the front of the backlog.
+  flutter::EncodableList encodeBatch(size_t maxBatchSize);
+
+  Config config_;
+  EmitCallback emit_;
+
+  std::deque<Message> backlog_;
+  // Recent message IDs, oldest first, bounding the dedup set.
+  std::deque<std::string> recentIDs_;
+  std::unordered_set<std::string> recentIDSet_;
+  std::unordered_map<std::string, SenderBucket> senderBuckets_;
+  Clock::time_point lastBucketPruneTime_;
+  Stats stats_;
+};
@@ -0,0 +1,137 @@
+#include "ZegoMethodCallStats.h"
+
+#include "../ZegoLog.h"
+
+ZegoMethodCallStats::~ZegoMethodCallStats() {
+  setLogDumpInterval(0);
+}
+
+void ZegoMethodCallStats::init(std::vector<std::string> methodNames) {
+  if (methods_) {
+    return;
+  }
+  methods_ = std::make_unique<MethodStats[]>(methodNames.size());
+  methodNames_ = std::move(methodNames);
+}
+
+void ZegoMethodCallStats::recordHandler(size_t methodIndex,
+                                        std::chrono::steady_clock::duration duration) {
+  if (methodIndex < methodNames_.size()) {
+    record(methods_[methodIndex].handler, duration);
+  }
+}
+
+void ZegoMethodCallStats::recordReply(size_t methodIndex,
+                                      std::chrono::steady_clock::duration duration) {
+  if (methodIndex < methodNames_.size()) {
+    record(methods_[methodIndex].reply, duration);
+  }
+}
+
+flutter::EncodableMap ZegoMethodCallStats::getStats() {
+  flutter::EncodableMap stats;
+  for (size_t i = 0; i < methodNames_.size(); i++) {
+    auto &method = methods_[i];
+    if (method.handler.count.load(std::memory_order_relaxed) == 0) {
+      continue;
+    }
+    flutter::EncodableMap methodStats;
+    methodStats[flutter::EncodableValue("handler")] = flutter::EncodableValue(encode(method.handler));
+    methodStats[flutter::EncodableValue("reply")] = flutter::EncodableValue(encode(method.reply));
+    stats[flutter::EncodableValue(methodNames_[i])] = flutter::EncodableValue(std::move(methodStats));
+  }
+  return stats;
+}
+
+void ZegoMethodCallStats::setLogDumpInterval(uint32_t intervalSeconds) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    dumping_ = false;
+  }
+  condition_.notify_all();
+  if (dumpThread_.joinable()) {
+    dumpThread_.join();
+  }
+
+  if (intervalSeconds == 0 || !methods_) {
+    return;
+  }
+  dumping_ = true;
+  dumpThread_ = std::thread(&ZegoMethodCallStats::runLogDump, this,
+                            std::chrono::seconds(intervalSeconds));
+}
+
+void ZegoMethodCallStats::record(Histogram &histogram,
+                                 std::chrono::steady_clock::duration duration) {
+  auto microseconds =
+      (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+
+  int bucket = 0;
+  while (bucket < kBucketCount - 1 && microseconds >= (1ULL << bucket)) {
+    bucket++;
+  }
+
+  histogram.count.fetch_add(1, std::memory_order_relaxed);
+  histogram.totalMicroseconds.fetch_add(microseconds, std::memory_order_relaxed);
+  histogram.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  auto maxMicroseconds = histogram.maxMicroseconds.load(std::memory_order_relaxed);
+  while (microseconds > maxMicroseconds &&
+         !histogram.maxMicroseconds.compare_exchange_weak(maxMicroseconds, microseconds,
+                                                          std::memory_order_relaxed)) {
+  }
+}
+
+flutter::EncodableMap ZegoMethodCallStats::encode(const Histogram &histogram) {
+  std::vector<int64_t> buckets(kBucketCount);
+  for (int i = 0; i < kBucketCount; i++) {
+    buckets[i] = (int64_t)histogram.buckets[i].load(std::memory_order_relaxed);
+  }
+
+  flutter::EncodableMap map;
+  map[flutter::EncodableValue("count")] =
+      flutter::EncodableValue((int64_t)histogram.count.load(std::memory_order_relaxed));
+  map[flutter::EncodableValue("totalMicroseconds")] =
+      flutter::EncodableValue((int64_t)histogram.totalMicroseconds.load(std::memory_order_relaxed));
+  map[flutter::EncodableValue("maxMicroseconds")] =
+      flutter::EncodableValue((int64_t)histogram.maxMicroseconds.load(std::memory_order_relaxed));
+  map[flutter::EncodableValue("buckets")] = flutter::EncodableValue(std::move(buckets));
+  return map;
+}
+
+void ZegoMethodCallStats::runLogDump(std::chrono::seconds interval) {
+  auto nextTick = std::chrono::steady_clock::now() + interval;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (condition_.wait_until(lock, nextTick, [this] { return !dumping_; })) {
+        break;
+      }
+    }
+    nextTick += interval;
+    dumpToLog();
+  }
+}
+
+void ZegoMethodCallStats::dumpToLog() {
+  for (size_t i = 0; i < methodNames_.size(); i++) {
+    auto &method = methods_[i];
+    auto count = method.handler.count.load(std::memory_order_relaxed);
+    if (count == method.dumpedCount) {
+      continue;
+    }
+    method.dumpedCount = count;
+
+    auto replyCount = method.reply.count.load(std::memory_order_relaxed);
+    ZF::logInfo(
+        "[MethodCallStats][%s] count: %llu, handler avg: %lluus, max: %lluus, reply avg: %lluus, "
+        "max: %lluus",
+        methodNames_[i].c_str(), (unsigned long long)count,
+        (unsigned long long)(method.handler.totalMicroseconds.load(std::memory_order_relaxed) / count),
+        (unsigned long long)method.handler.maxMicroseconds.load(std::memory_order_relaxed),
+        (unsigned long long)(replyCount > 0
+                                 ? method.reply.totalMicroseconds.load(std::memory_order_relaxed) /
+                                       replyCount
+                                 : 0),
+        (unsigned long long)method.reply.maxMicroseconds.load(std::memory_order_relaxed));
+  }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <flutter/encodable_value.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Call counts and log-bucket latency histograms of every method the plugin
+// dispatches, indexed by the position of the method in the dispatch table.
+// Two durations are recorded per call: the synchronous run of the handler
+// and the time until it replies, which is later for asynchronous methods.
+// Recording is lock-free, the table is fixed once `init` is called.
+class ZegoMethodCallStats {
+ public:
+  // Bucket i counts durations below 2^i microseconds (and from 2^(i-1)),
+  // the last bucket also counts everything above.
+  static constexpr int kBucketCount = 24;
+
+  static ZegoMethodCallStats &getInstance() {
+    static ZegoMethodCallStats instance;
+    return instance;
+  }
+
+  ~ZegoMethodCallStats();
+
+  // Prevent copying.
+  ZegoMethodCallStats(ZegoMethodCallStats const&) = delete;
+  ZegoMethodCallStats& operator=(ZegoMethodCallStats const&) = delete;
+
+  // Called once before the first call is dispatched.
+  void init(std::vector<std::string> methodNames);
+
+  void recordHandler(size_t methodIndex, std::chrono::steady_clock::duration duration);
+
+  void recordReply(size_t methodIndex, std::chrono::steady_clock::duration duration);
+
+  // Stats of the methods that have been called, keyed by method name.
+  flutter::EncodableMap getStats();
+
+  // Logs the methods called since the previous dump every `intervalSeconds`,
+  // 0 stops dumping.
+  void setLogDumpInterval(uint32_t intervalSeconds);
+
+ private:
+  struct Histogram {
+    std::atomic<uint64_t> count = 0;
+    std::atomic<uint64_t> totalMicroseconds = 0;
+    std::atomic<uint64_t> maxMicroseconds = 0;
+    std::atomic<uint64_t> buckets[kBucketCount] = {};
+  };
+
+  struct MethodStats {
+    Histogram handler;
+    Histogram reply;
+    // Call count at the previous dump, used by the dump thread only.
+    uint64_t dumpedCount = 0;
+  };
+
+  ZegoMethodCallStats() = default;
+
+  static void record(Histogram &histogram, std::chrono::steady_clock::duration duration);
+
+  static flutter::EncodableMap encode(const Histogram &histogram);
+
+  void runLogDump(std::chrono::seconds interval);
+
+  void dumpToLog();
+
+  std::vector<std::string> methodNames_;
+  std::unique_ptr<MethodStats[]> methods_;
+
+  std::atomic_bool dumping_ = false;
+  std::thread dumpThread_;
+  std::condition_variable condition_;
+  std::mutex mutex_;
+};
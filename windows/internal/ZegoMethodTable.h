@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// FNV-1a
+constexpr uint32_t zegoMethodNameHash(std::string_view name) {
+  uint32_t hash = 2166136261u;
+  for (auto c : name) {
+    hash ^= (uint8_t)c;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// At most a quarter full, so a lookup almost always hits the first slot.
+constexpr size_t zegoMethodTableSize(size_t count) {
+  size_t size = 1;
+  while (size < count * 4) {
+    size <<= 1;
+  }
+  return size;
+}
+
+// Open addressing table over a fixed list of entries that have a `name`,
+// built at compile time so the dispatch needs neither static
+// initialization nor allocation. A lookup compares 32-bit hashes and then
+// does a single string compare. The table only holds indexes, lookups take
+// the same list it was built from.
+template <size_t Count>
+struct ZegoMethodTable {
+  static constexpr size_t kSize = zegoMethodTableSize(Count);
+
+  uint32_t hashes[kSize] = {};
+  // Index into the entries plus one, 0 for an empty slot.
+  uint16_t indexes[kSize] = {};
+  uint32_t maxProbeCount = 0;
+  bool hasDuplicate = false;
+
+  template <typename Entry>
+  constexpr explicit ZegoMethodTable(const Entry (&entries)[Count]) {
+    static_assert(Count < UINT16_MAX, "Too many entries for the indexes");
+    for (size_t i = 0; i < Count; i++) {
+      auto hash = zegoMethodNameHash(entries[i].name);
+      auto slot = hash & (kSize - 1);
+      uint32_t probeCount = 1;
+      while (indexes[slot] != 0) {
+        if (hashes[slot] == hash && entries[indexes[slot] - 1].name == entries[i].name) {
+          hasDuplicate = true;
+        }
+        slot = (slot + 1) & (kSize - 1);
+        probeCount++;
+      }
+      hashes[slot] = hash;
+      indexes[slot] = (uint16_t)(i + 1);
+      maxProbeCount = probeCount > maxProbeCount ? probeCount : maxProbeCount;
+    }
+  }
+
+  // Returns the entry named `name`, or nullptr.
+  template <typename Entry>
+  constexpr const Entry* find(const Entry (&entries)[Count], std::string_view name) const {
+    auto hash = zegoMethodNameHash(name);
+    auto slot = hash & (kSize - 1);
+    for (uint32_t i = 0; i < maxProbeCount; i++) {
+      auto index = indexes[slot];
+      if (index == 0) {
+        return nullptr;
+      }
+      if (hashes[slot] == hash && entries[index - 1].name == name) {
+        return &entries[index - 1];
+      }
+      slot = (slot + 1) & (kSize - 1);
+    }
+    return nullptr;
+  }
+};
@@ -0,0 +1,322 @@
+#include "ZegoPlatformEventQueue.h"
+
+namespace {
+
+constexpr uint32_t kDefaultLaneMaxDepth[ZEGO_EVENT_LANE_COUNT] = {0, 256, 1024};
+
+// Tickets of spilled critical events, counted separately from the ring.
+constexpr uint64_t kSpillTicketBit = 1ULL << 63;
+
+}  // namespace
+
+ZegoPlatformEventQueue::ZegoPlatformEventQueue(uint32_t capacity, DeliverCallback deliver)
+    : deliver_(std::move(deliver)) {
+  uint64_t size = 2;
+  while (size < capacity) {
+    size <<= 1;
+  }
+  mask_ = size - 1;
+  cells_ = std::make_unique<Cell[]>(size);
+  for (uint64_t i = 0; i < size; i++) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  for (int lane = 0; lane < ZEGO_EVENT_LANE_COUNT; lane++) {
+    lanes_[lane].maxQueueDepth = kDefaultLaneMaxDepth[lane];
+  }
+}
+
+ZegoPlatformEventQueue::~ZegoPlatformEventQueue() {
+  detachWindow();
+}
+
+void ZegoPlatformEventQueue::attachWindow(HWND window, UINT message) {
+  message_ = message;
+  window_ = window;
+}
+
+void ZegoPlatformEventQueue::detachWindow() {
+  window_ = nullptr;
+  drainPending_ = false;
+}
+
+bool ZegoPlatformEventQueue::push(flutter::EncodableValue &&event, uint64_t *position) {
+  if (!window_.load()) {
+    if (deliver_) {
+      deliver_(event);
+    }
+    if (position) {
+      // Already delivered.
+      *position = 0;
+    }
+    return true;
+  }
+
+  auto pos = enqueuePos_.load(std::memory_order_relaxed);
+  Cell *cell = nullptr;
+  while (spillDepth_.load(std::memory_order_acquire) == 0) {
+    cell = &cells_[pos & mask_];
+    auto sequence = cell->sequence.load(std::memory_order_acquire);
+    auto diff = (int64_t)sequence - (int64_t)pos;
+    if (diff == 0) {
+      if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // The ring is full.
+      cell = nullptr;
+      break;
+    } else {
+      pos = enqueuePos_.load(std::memory_order_relaxed);
+    }
+    cell = nullptr;
+  }
+
+  if (!cell) {
+    auto &lane = lanes_[ZEGO_EVENT_LANE_CRITICAL];
+    {
+      std::lock_guard<std::mutex> lock(lane.mutex);
+      lane.events.push_back({std::string(), std::chrono::steady_clock::now(), std::move(event)});
+      lane.stats.enqueuedCount++;
+      auto depth = (uint32_t)lane.events.size();
+      lane.stats.maxDepth = depth > lane.stats.maxDepth ? depth : lane.stats.maxDepth;
+      spillDepth_ = depth;
+      if (position) {
+        *position = kSpillTicketBit | lane.stats.enqueuedCount;
+      }
+    }
+    requestDrain();
+    return true;
+  }
+
+  cell->event = std::move(event);
+  cell->enqueueTime = std::chrono::steady_clock::now();
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  if (position) {
+    *position = pos + 1;
+  }
+
+  auto depth = (uint32_t)(pos + 1 - dequeuePos_.load(std::memory_order_relaxed));
+  auto maxDepth = maxDepth_.load(std::memory_order_relaxed);
+  while (depth > maxDepth && !maxDepth_.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed)) {
+  }
+
+  requestDrain();
+  return true;
+}
+
+bool ZegoPlatformEventQueue::push(ZegoEventLane lane, const std::string &key,
+                                  flutter::EncodableValue &&event) {
+  if (lane == ZEGO_EVENT_LANE_CRITICAL) {
+    return push(std::move(event));
+  }
+  if (!window_.load()) {
+    if (deliver_) {
+      deliver_(event);
+    }
+    return true;
+  }
+
+  auto &pending = lanes_[lane];
+  bool kept = true;
+  {
+    std::lock_guard<std::mutex> lock(pending.mutex);
+    pending.stats.enqueuedCount++;
+    auto now = std::chrono::steady_clock::now();
+
+    if (lane == ZEGO_EVENT_LANE_LATEST) {
+      auto existing = pending.keys.find(key);
+      if (existing != pending.keys.end()) {
+        // Keeps its place in the lane, the latency counts from the newest.
+        existing->second->event = std::move(event);
+        existing->second->enqueueTime = now;
+        pending.stats.replacedCount++;
+        return false;
+      }
+    }
+
+    if (pending.events.size() >= pending.maxQueueDepth) {
+      if (lane == ZEGO_EVENT_LANE_LATEST) {
+        pending.keys.erase(pending.events.front().key);
+      }
+      pending.events.pop_front();
+      pending.stats.droppedCount++;
+      kept = false;
+    }
+
+    pending.events.push_back({lane == ZEGO_EVENT_LANE_LATEST ? key : std::string(), now, std::move(event)});
+    if (lane == ZEGO_EVENT_LANE_LATEST) {
+      pending.keys[key] = std::prev(pending.events.end());
+    }
+    auto depth = (uint32_t)pending.events.size();
+    pending.stats.maxDepth = depth > pending.stats.maxDepth ? depth : pending.stats.maxDepth;
+  }
+
+  requestDrain();
+  return kept;
+}
+
+bool ZegoPlatformEventQueue::isDelivered(uint64_t position) {
+  if (position & kSpillTicketBit) {
+    return spillDeliveredCount_.load(std::memory_order_acquire) >= (position & ~kSpillTicketBit);
+  }
+  return dequeuePos_.load(std::memory_order_acquire) >= position;
+}
+
+void ZegoPlatformEventQueue::drain() {
+  drainPending_ = false;
+
+  // Events queued during the drain wait for the drain they requested.
+  auto delivered = drainRing(enqueuePos_.load(std::memory_order_acquire));
+
+  if (spillDepth_.load(std::memory_order_acquire) > 0) {
+    // Ring events pushed before the spilled ones go first.
+    delivered += drainRing(enqueuePos_.load(std::memory_order_acquire));
+    auto spilled = drainLane(lanes_[ZEGO_EVENT_LANE_CRITICAL]);
+    spillDeliveredCount_ += spilled;
+    delivered += spilled;
+  }
+  delivered += drainLane(lanes_[ZEGO_EVENT_LANE_LATEST]);
+  delivered += drainLane(lanes_[ZEGO_EVENT_LANE_BOUNDED]);
+
+  if (delivered > 0) {
+    drainCount_++;
+  }
+}
+
+uint64_t ZegoPlatformEventQueue::drainRing(uint64_t end) {
+  auto pos = dequeuePos_.load(std::memory_order_relaxed);
+  uint64_t delivered = 0;
+  while (pos != end) {
+    auto &cell = cells_[pos & mask_];
+    if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+      // Claimed but not yet published, its producer requests another drain.
+      break;
+    }
+
+    auto event = std::move(cell.event);
+    auto latency = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - cell.enqueueTime).count();
+    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+    pos++;
+    dequeuePos_.store(pos, std::memory_order_release);
+
+    totalLatencyMicroseconds_ += latency;
+    if (latency > maxLatencyMicroseconds_) {
+      maxLatencyMicroseconds_ = latency;
+    }
+    if (deliver_) {
+      deliver_(event);
+    }
+    delivered++;
+  }
+
+  if (delivered > 0) {
+    deliveredCount_ += delivered;
+  }
+  return delivered;
+}
+
+uint64_t ZegoPlatformEventQueue::drainLane(Lane &lane) {
+  std::list<PendingEvent> events;
+  {
+    std::lock_guard<std::mutex> lock(lane.mutex);
+    if (lane.events.empty()) {
+      return 0;
+    }
+    if (&lane == &lanes_[ZEGO_EVENT_LANE_CRITICAL]) {
+      // A producer that got into the ring before the spill started may
+      // still be ahead of the spilled events. Its publish requests another
+      // drain, which delivers the spill once the ring is empty.
+      if (dequeuePos_.load(std::memory_order_relaxed) != enqueuePos_.load(std::memory_order_acquire)) {
+        return 0;
+      }
+      // Producers go back to the ring.
+      spillDepth_ = 0;
+    }
+    events.swap(lane.events);
+    lane.keys.clear();
+  }
+
+  auto now = std::chrono::steady_clock::now();
+  uint64_t totalLatency = 0;
+  uint64_t maxLatency = 0;
+  for (auto &pending : events) {
+    auto latency = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        now - pending.enqueueTime).count();
+    totalLatency += latency;
+    maxLatency = latency > maxLatency ? latency : maxLatency;
+    if (deliver_) {
+      deliver_(pending.event);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(lane.mutex);
+  lane.stats.deliveredCount += events.size();
+  lane.stats.totalLatencyMicroseconds += totalLatency;
+  lane.stats.maxLatencyMicroseconds =
+      maxLatency > lane.stats.maxLatencyMicroseconds ? maxLatency : lane.stats.maxLatencyMicroseconds;
+  return events.size();
+}
+
+void ZegoPlatformEventQueue::setLaneMaxDepth(ZegoEventLane lane, uint32_t maxDepth) {
+  if (lane == ZEGO_EVENT_LANE_CRITICAL || lane >= ZEGO_EVENT_LANE_COUNT) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(lanes_[lane].mutex);
+  lanes_[lane].maxQueueDepth = maxDepth > 0 ? maxDepth : kDefaultLaneMaxDepth[lane];
+}
+
+ZegoPlatformEventQueue::Stats ZegoPlatformEventQueue::getStats() {
+  Stats stats;
+  stats.drainCount = drainCount_;
+  for (int lane = 0; lane < ZEGO_EVENT_LANE_COUNT; lane++) {
+    auto laneStats = getLaneStats((ZegoEventLane)lane);
+    stats.enqueuedCount += laneStats.enqueuedCount;
+    stats.deliveredCount += laneStats.deliveredCount;
+    stats.droppedCount += laneStats.droppedCount + laneStats.replacedCount;
+    stats.depth += laneStats.depth;
+    stats.maxDepth = laneStats.maxDepth > stats.maxDepth ? laneStats.maxDepth : stats.maxDepth;
+    stats.totalLatencyMicroseconds += laneStats.totalLatencyMicroseconds;
+    stats.maxLatencyMicroseconds = laneStats.maxLatencyMicroseconds > stats.maxLatencyMicroseconds
+                                       ? laneStats.maxLatencyMicroseconds
+                                       : stats.maxLatencyMicroseconds;
+  }
+  return stats;
+}
+
+ZegoPlatformEventQueue::LaneStats ZegoPlatformEventQueue::getLaneStats(ZegoEventLane lane) {
+  LaneStats stats;
+  if (lane >= ZEGO_EVENT_LANE_COUNT) {
+    return stats;
+  }
+  {
+    std::lock_guard<std::mutex> lock(lanes_[lane].mutex);
+    stats = lanes_[lane].stats;
+    stats.depth = (uint32_t)lanes_[lane].events.size();
+    stats.maxQueueDepth = lanes_[lane].maxQueueDepth;
+  }
+
+  if (lane == ZEGO_EVENT_LANE_CRITICAL) {
+    // The ring and its spill list together.
+    auto enqueued = enqueuePos_.load();
+    stats.enqueuedCount += enqueued;
+    stats.deliveredCount += deliveredCount_;
+    stats.depth += (uint32_t)(enqueued - dequeuePos_.load());
+    stats.maxDepth = maxDepth_ > stats.maxDepth ? maxDepth_.load() : stats.maxDepth;
+    stats.totalLatencyMicroseconds += totalLatencyMicroseconds_;
+    stats.maxLatencyMicroseconds = maxLatencyMicroseconds_ > stats.maxLatencyMicroseconds
+                                       ? maxLatencyMicroseconds_.load()
+                                       : stats.maxLatencyMicroseconds;
+  }
+  return stats;
+}
+
+void ZegoPlatformEventQueue::requestDrain() {
+  auto window = window_.load();
+  if (window && !drainPending_.exchange(true)) {
+    if (!PostMessage(window, message_, 0, 0)) {
+      // The next event tries again.
+      drainPending_ = false;
+    }
+  }
+}
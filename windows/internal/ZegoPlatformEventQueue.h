@@ -0,0 +1,159 @@
+#pragma once
+
+#include <flutter/encodable_value.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <windows.h>
+
+enum ZegoEventLane {
+  // State and other low frequency events, never dropped and kept in order.
+  ZEGO_EVENT_LANE_CRITICAL = 0,
+  // Quality and meter events, a pending event is replaced by a newer one
+  // with the same key.
+  ZEGO_EVENT_LANE_LATEST,
+  // Raw data events, the oldest pending event is dropped when full.
+  ZEGO_EVENT_LANE_BOUNDED,
+  ZEGO_EVENT_LANE_COUNT
+};
+
+// Bounded lock-free multi-producer single-consumer queue for events that are
+// produced on SDK threads and delivered to dart on the flutter platform
+// thread. Producers post a window message to the platform thread only when
+// no drain is pending, so a burst of events costs a single wakeup.
+//
+// Events are sorted into priority lanes that are drained in order. The
+// critical lane is the lock-free ring and spills into an unbounded list
+// when the ring is full. The latest and bounded lanes are short mutex
+// protected lists with a configurable max depth.
+class ZegoPlatformEventQueue {
+ public:
+  struct Stats {
+    uint64_t enqueuedCount = 0;
+    uint64_t deliveredCount = 0;
+    uint64_t droppedCount = 0;
+    uint64_t drainCount = 0;
+    uint32_t depth = 0;
+    uint32_t maxDepth = 0;
+    uint64_t totalLatencyMicroseconds = 0;
+    uint64_t maxLatencyMicroseconds = 0;
+  };
+
+  struct LaneStats {
+    uint64_t enqueuedCount = 0;
+    uint64_t deliveredCount = 0;
+    // Dropped from a full lane.
+    uint64_t droppedCount = 0;
+    // Replaced by a newer event with the same key, latest lane only.
+    uint64_t replacedCount = 0;
+    uint32_t depth = 0;
+    uint32_t maxDepth = 0;
+    // Configured limit, 0 for the unbounded critical lane.
+    uint32_t maxQueueDepth = 0;
+    uint64_t totalLatencyMicroseconds = 0;
+    uint64_t maxLatencyMicroseconds = 0;
+  };
+
+  using DeliverCallback = std::function<void(const flutter::EncodableValue &event)>;
+
+  // capacity is rounded up to a power of two.
+  ZegoPlatformEventQueue(uint32_t capacity, DeliverCallback deliver);
+  ~ZegoPlatformEventQueue();
+
+  // Prevent copying.
+  ZegoPlatformEventQueue(ZegoPlatformEventQueue const&) = delete;
+  ZegoPlatformEventQueue& operator=(ZegoPlatformEventQueue const&) = delete;
+
+  // Drains are requested by posting message to window, whose window proc
+  // must call drain. Without a window events bypass the queue and are
+  // delivered on the calling thread.
+  void attachWindow(HWND window, UINT message);
+
+  void detachWindow();
+
+  // Called on any thread. Queues the event on the critical lane, which
+  // never drops. position receives a ticket for isDelivered.
+  bool push(flutter::EncodableValue &&event, uint64_t *position = nullptr);
+
+  // Called on any thread. Queues the event on lane, key identifies the
+  // events that replace each other on the latest lane. Returns false if an
+  // older event was dropped or replaced to make room.
+  bool push(ZegoEventLane lane, const std::string &key, flutter::EncodableValue &&event);
+
+  // Whether the event pushed at position has been delivered.
+  bool isDelivered(uint64_t position);
+
+  // Called on the platform thread only. Delivers the events that are queued
+  // when the drain starts, lane by lane.
+  void drain();
+
+  // Max pending events of the latest and bounded lanes, 0 restores the
+  // default. The critical lane is unbounded.
+  void setLaneMaxDepth(ZegoEventLane lane, uint32_t maxDepth);
+
+  // Covers queued events only, not those delivered without a window.
+  Stats getStats();
+
+  LaneStats getLaneStats(ZegoEventLane lane);
+
+ private:
+  struct Cell {
+    std::atomic<uint64_t> sequence;
+    std::chrono::steady_clock::time_point enqueueTime;
+    flutter::EncodableValue event;
+  };
+
+  struct PendingEvent {
+    std::string key;
+    std::chrono::steady_clock::time_point enqueueTime;
+    flutter::EncodableValue event;
+  };
+
+  // Latest or bounded lane, or the spill list of the critical lane.
+  struct Lane {
+    std::mutex mutex;
+    std::list<PendingEvent> events;
+    // Pending event per key, latest lane only.
+    std::unordered_map<std::string, std::list<PendingEvent>::iterator> keys;
+    uint32_t maxQueueDepth = 0;
+    LaneStats stats;
+  };
+
+  void requestDrain();
+
+  // Delivers the published ring events up to end.
+  uint64_t drainRing(uint64_t end);
+
+  // Delivers the events of lane that are queued when the drain starts.
+  uint64_t drainLane(Lane &lane);
+
+  DeliverCallback deliver_;
+  std::unique_ptr<Cell[]> cells_;
+  uint64_t mask_ = 0;
+  std::atomic<uint64_t> enqueuePos_ = 0;
+  std::atomic<uint64_t> dequeuePos_ = 0;
+
+  std::atomic<HWND> window_ = nullptr;
+  UINT message_ = 0;
+  std::atomic_bool drainPending_ = false;
+
+  std::atomic<uint64_t> deliveredCount_ = 0;
+  std::atomic<uint64_t> drainCount_ = 0;
+  std::atomic<uint32_t> maxDepth_ = 0;
+  std::atomic<uint64_t> totalLatencyMicroseconds_ = 0;
+  std::atomic<uint64_t> maxLatencyMicroseconds_ = 0;
+
+  // The critical lane holds the events that did not fit into the ring. Once
+  // it is used, later critical events follow through it until it is
+  // drained, and it is only drained while the ring is empty, to keep order.
+  Lane lanes_[ZEGO_EVENT_LANE_COUNT];
+  std::atomic<uint32_t> spillDepth_ = 0;
+  // Number of spilled events delivered, for the spill tickets of isDelivered.
+  std::atomic<uint64_t> spillDeliveredCount_ = 0;
+};
@@ -0,0 +1,103 @@
+#include "ZegoRealTimeSequentialDataBatcher.h"
+
+#include <cstring>
+
+ZegoRealTimeSequentialDataBatcher::~ZegoRealTimeSequentialDataBatcher() {
+  stop();
+}
+
+void ZegoRealTimeSequentialDataBatcher::start(uint32_t intervalMs, uint32_t maxPendingBytes,
+                                              ReadyCallback ready, EmitCallback emit) {
+  stop();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  maxPendingBytes_ = maxPendingBytes > 0 ? maxPendingBytes : 1 << 20;
+  emit_ = std::move(emit);
+  stats_ = Stats();
+  startTicking(intervalMs > 0 ? intervalMs : 16, std::move(ready));
+}
+
+void ZegoRealTimeSequentialDataBatcher::stop() {
+  stopTicking();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  pending_.clear();
+  emit_ = nullptr;
+}
+
+void ZegoRealTimeSequentialDataBatcher::add(int managerIndex, const unsigned char *data,
+                                            unsigned int dataLength, const std::string &streamID) {
+  auto now = Clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.receivedCount++;
+
+  auto &batch = pending_[managerIndex];
+  if (batch.data.size() + dataLength > maxPendingBytes_) {
+    stats_.droppedCount++;
+    return;
+  }
+
+  batch.streamIDs.emplace_back(streamID);
+  batch.offsets.push_back((int32_t)batch.data.size());
+  batch.times.push_back(now);
+  if (dataLength > 0) {
+    size_t offset = batch.data.size();
+    batch.data.resize(offset + dataLength);
+    std::memcpy(batch.data.data() + offset, data, dataLength);
+  }
+
+  depth_++;
+  if (depth_ > stats_.maxDepth) {
+    stats_.maxDepth = depth_;
+  }
+}
+
+ZegoRealTimeSequentialDataBatcher::Stats ZegoRealTimeSequentialDataBatcher::getStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Stats stats = stats_;
+  stats.depth = depth_;
+  return stats;
+}
+
+std::function<void()> ZegoRealTimeSequentialDataBatcher::takeBatch(bool isStopping) {
+  auto batches = encodeBatches(Clock::now());
+  if (!emit_) {
+    return nullptr;
+  }
+  return [emit = emit_, batches = std::move(batches)]() mutable {
+    for (auto &batch : batches) {
+      emit(batch.first, std::move(batch.second));
+    }
+  };
+}
+
+std::vector<std::pair<int, flutter::EncodableMap>> ZegoRealTimeSequentialDataBatcher::encodeBatches(
+    Clock::time_point now) {
+  std::vector<std::pair<int, flutter::EncodableMap>> batches;
+  for (auto &entry : pending_) {
+    auto &pending = entry.second;
+    if (pending.offsets.empty()) {
+      continue;
+    }
+
+    for (auto const &time : pending.times) {
+      auto latency =
+          (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(now - time).count();
+      stats_.totalLatencyMicroseconds += latency;
+      stats_.maxLatencyMicroseconds =
+          latency > stats_.maxLatencyMicroseconds ? latency : stats_.maxLatencyMicroseconds;
+    }
+    stats_.deliveredCount += pending.offsets.size();
+    stats_.batchCount++;
+
+    flutter::EncodableMap batch;
+    batch[flutter::EncodableValue("streamIDs")] = flutter::EncodableValue(std::move(pending.streamIDs));
+    batch[flutter::EncodableValue("offsets")] = flutter::EncodableValue(std::move(pending.offsets));
+    batch[flutter::EncodableValue("data")] = flutter::EncodableValue(std::move(pending.data));
+    batches.emplace_back(entry.first, std::move(batch));
+
+    pending = PendingBatch();
+  }
+  depth_ = 0;
+  return batches;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <flutter/encodable_value.h>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ZegoBatchTicker.h"
+
+// Collects inbound real-time sequential data of every manager into one
+// contiguous buffer per manager and emits it as a single packed batch per
+// tick: `streamIDs`, the start `offsets` of each record and all payloads
+// in `data`. The buffers are moved into the event, so a record is copied
+// once on receive. A tick is skipped while the previous batch has not been
+// delivered yet, records keep accumulating up to `maxPendingBytes` per
+// manager and newer records are dropped beyond that.
+class ZegoRealTimeSequentialDataBatcher : public ZegoTickBatcher {
+ public:
+  struct Stats {
+    uint64_t receivedCount = 0;
+    uint64_t deliveredCount = 0;
+    uint64_t droppedCount = 0;
+    uint64_t batchCount = 0;
+    uint32_t depth = 0;
+    uint32_t maxDepth = 0;
+    uint64_t totalLatencyMicroseconds = 0;
+    uint64_t maxLatencyMicroseconds = 0;
+  };
+
+  using EmitCallback = std::function<void(int managerIndex, flutter::EncodableMap &&batch)>;
+
+  ZegoRealTimeSequentialDataBatcher() = default;
+  ~ZegoRealTimeSequentialDataBatcher();
+
+  // Prevent copying.
+  ZegoRealTimeSequentialDataBatcher(ZegoRealTimeSequentialDataBatcher const&) = delete;
+  ZegoRealTimeSequentialDataBatcher& operator=(ZegoRealTimeSequentialDataBatcher const&) = delete;
+
+  void start(uint32_t intervalMs, uint32_t maxPendingBytes, ReadyCallback ready, EmitCallback emit);
+
+  // Emits the pending records as a last batch.
+  void stop();
+
+  void add(int managerIndex, const unsigned char *data, unsigned int dataLength,
+           const std::string &streamID);
+
+  Stats getStats();
+
+ protected:
+  bool hasPending() override { return depth_ > 0; }
+
+  std::function<void()> takeBatch(bool isStopping) override;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct PendingBatch {
+    flutter::EncodableList streamIDs;
+    std::vector<int32_t> offsets;
+    std::vector<uint8_t> data;
+    // Receive time of every record, for the latency counters.
+    std::vector<Clock::time_point> times;
+  };
+
+  // Encodes the pending records of every manager and resets them.
+  std::vector<std::pair<int, flutter::EncodableMap>> encodeBatches(Clock::time_point now);
+
+  size_t maxPendingBytes_ = 1 << 20;
+  EmitCallback emit_;
+
+  std::unordered_map<int, PendingBatch> pending_;
+  uint32_t depth_ = 0;
+  Stats stats_;
+};
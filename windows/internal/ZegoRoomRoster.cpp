@@ -0,0 +1,217 @@
+#include "ZegoRoomRoster.h"
+
+namespace {
+
+// Holes are only compacted away past this many, so small rooms never
+// rebuild their index.
+constexpr size_t kMinCompactHoles = 64;
+
+flutter::EncodableValue encodeUser(const ZEGO::EXPRESS::ZegoUser &user) {
+  flutter::EncodableMap userMap;
+  userMap[flutter::EncodableValue("userID")] = flutter::EncodableValue(user.userID);
+  userMap[flutter::EncodableValue("userName")] = flutter::EncodableValue(user.userName);
+  return flutter::EncodableValue(std::move(userMap));
+}
+
+flutter::EncodableValue encodeStream(const ZEGO::EXPRESS::ZegoStream &stream) {
+  flutter::EncodableMap streamMap;
+  streamMap[flutter::EncodableValue("streamID")] = flutter::EncodableValue(stream.streamID);
+  streamMap[flutter::EncodableValue("extraInfo")] = flutter::EncodableValue(stream.extraInfo);
+  streamMap[flutter::EncodableValue("user")] = encodeUser(stream.user);
+  return flutter::EncodableValue(std::move(streamMap));
+}
+
+}  // namespace
+
+template <typename T>
+bool ZegoRoomRoster::OrderedIndex<T>::add(const std::string &key, const T &item) {
+  auto position = positions.find(key);
+  if (position != positions.end()) {
+    items[position->second] = item;
+    return false;
+  }
+  positions[key] = items.size();
+  items.push_back(item);
+  keys.push_back(key);
+  alive.push_back(true);
+  return true;
+}
+
+template <typename T>
+bool ZegoRoomRoster::OrderedIndex<T>::remove(const std::string &key) {
+  auto position = positions.find(key);
+  if (position == positions.end()) {
+    return false;
+  }
+  alive[position->second] = false;
+  positions.erase(position);
+
+  size_t holes = items.size() - positions.size();
+  if (holes > kMinCompactHoles && holes > positions.size()) {
+    compact();
+  }
+  return true;
+}
+
+template <typename T>
+T *ZegoRoomRoster::OrderedIndex<T>::find(const std::string &key) {
+  auto position = positions.find(key);
+  return position == positions.end() ? nullptr : &items[position->second];
+}
+
+template <typename T>
+void ZegoRoomRoster::OrderedIndex<T>::compact() {
+  size_t next = 0;
+  for (size_t i = 0; i < items.size(); i++) {
+    if (!alive[i]) {
+      continue;
+    }
+    if (next != i) {
+      items[next] = std::move(items[i]);
+      keys[next] = std::move(keys[i]);
+    }
+    positions[keys[next]] = next;
+    next++;
+  }
+  items.resize(next);
+  keys.resize(next);
+  alive.assign(next, true);
+}
+
+template <typename T>
+flutter::EncodableList ZegoRoomRoster::OrderedIndex<T>::page(
+    uint32_t offset, uint32_t limit, const std::function<bool(const T &)> &matches,
+    const std::function<flutter::EncodableValue(const T &)> &encode,
+    uint32_t &matchedCount) const {
+  flutter::EncodableList list;
+  matchedCount = 0;
+  for (size_t i = 0; i < items.size(); i++) {
+    if (!alive[i] || (matches && !matches(items[i]))) {
+      continue;
+    }
+    if (matchedCount >= offset && list.size() < limit) {
+      list.push_back(encode(items[i]));
+    }
+    matchedCount++;
+  }
+  return list;
+}
+
+ZegoRoomRoster::UpdateSummary ZegoRoomRoster::updateUsers(
+    const std::string &roomID, ZEGO::EXPRESS::ZegoUpdateType updateType,
+    const std::vector<ZEGO::EXPRESS::ZegoUser> &userList) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &room = rooms_[roomID];
+
+  UpdateSummary summary;
+  for (auto const &user : userList) {
+    bool changed = updateType == ZEGO::EXPRESS::ZEGO_UPDATE_TYPE_ADD ? room.users.add(user.userID, user)
+                                                                     : room.users.remove(user.userID);
+    summary.changedCount += changed ? 1 : 0;
+  }
+  summary.totalCount = (uint32_t)room.users.size();
+  summary.version = ++room.version;
+  return summary;
+}
+
+ZegoRoomRoster::UpdateSummary ZegoRoomRoster::updateStreams(
+    const std::string &roomID, ZEGO::EXPRESS::ZegoUpdateType updateType,
+    const std::vector<ZEGO::EXPRESS::ZegoStream> &streamList) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &room = rooms_[roomID];
+
+  UpdateSummary summary;
+  for (auto const &stream : streamList) {
+    bool changed = updateType == ZEGO::EXPRESS::ZEGO_UPDATE_TYPE_ADD ? room.streams.add(stream.streamID, stream)
+                                                                     : room.streams.remove(stream.streamID);
+    summary.changedCount += changed ? 1 : 0;
+  }
+  summary.totalCount = (uint32_t)room.streams.size();
+  summary.version = ++room.version;
+  return summary;
+}
+
+ZegoRoomRoster::UpdateSummary ZegoRoomRoster::updateStreamExtraInfo(
+    const std::string &roomID, const std::vector<ZEGO::EXPRESS::ZegoStream> &streamList) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  UpdateSummary summary;
+  auto room = rooms_.find(roomID);
+  if (room == rooms_.end()) {
+    return summary;
+  }
+
+  for (auto const &stream : streamList) {
+    auto item = room->second.streams.find(stream.streamID);
+    if (item && item->extraInfo != stream.extraInfo) {
+      item->extraInfo = stream.extraInfo;
+      summary.changedCount++;
+    }
+  }
+  summary.totalCount = (uint32_t)room->second.streams.size();
+  summary.version = ++room->second.version;
+  return summary;
+}
+
+flutter::EncodableMap ZegoRoomRoster::getUsers(const std::string &roomID, uint32_t offset,
+                                               uint32_t limit, const std::string &filter) {
+  std::function<bool(const ZEGO::EXPRESS::ZegoUser &)> matches;
+  if (!filter.empty()) {
+    matches = [&filter](const ZEGO::EXPRESS::ZegoUser &user) {
+      return user.userID.find(filter) != std::string::npos ||
+             user.userName.find(filter) != std::string::npos;
+    };
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  uint32_t totalCount = 0;
+  uint64_t version = 0;
+  flutter::EncodableList userList;
+  auto room = rooms_.find(roomID);
+  if (room != rooms_.end()) {
+    userList = room->second.users.page(offset, limit, matches, encodeUser, totalCount);
+    version = room->second.version;
+  }
+
+  flutter::EncodableMap result;
+  result[flutter::EncodableValue("totalCount")] = flutter::EncodableValue((int32_t)totalCount);
+  result[flutter::EncodableValue("version")] = flutter::EncodableValue((int64_t)version);
+  result[flutter::EncodableValue("userList")] = flutter::EncodableValue(std::move(userList));
+  return result;
+}
+
+flutter::EncodableMap ZegoRoomRoster::getStreams(const std::string &roomID, uint32_t offset,
+                                                 uint32_t limit, const std::string &filter) {
+  std::function<bool(const ZEGO::EXPRESS::ZegoStream &)> matches;
+  if (!filter.empty()) {
+    matches = [&filter](const ZEGO::EXPRESS::ZegoStream &stream) {
+      return stream.streamID.find(filter) != std::string::npos ||
+             stream.user.userID.find(filter) != std::string::npos;
+    };
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  uint32_t totalCount = 0;
+  uint64_t version = 0;
+  flutter::EncodableList streamList;
+  auto room = rooms_.find(roomID);
+  if (room != rooms_.end()) {
+    streamList = room->second.streams.page(offset, limit, matches, encodeStream, totalCount);
+    version = room->second.version;
+  }
+
+  flutter::EncodableMap result;
+  result[flutter::EncodableValue("totalCount")] = flutter::EncodableValue((int32_t)totalCount);
+  result[flutter::EncodableValue("version")] = flutter::EncodableValue((int64_t)version);
+  result[flutter::EncodableValue("streamList")] = flutter::EncodableValue(std::move(streamList));
+  return result;
+}
+
+void ZegoRoomRoster::removeRoom(const std::string &roomID) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  rooms_.erase(roomID);
+}
+
+void ZegoRoomRoster::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  rooms_.clear();
+}
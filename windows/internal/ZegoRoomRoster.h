@@ -0,0 +1,101 @@
+#pragma once
+
+#include <flutter/encodable_value.h>
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ZegoExpressSDK.h>
+
+enum ZegoRoomRosterType {
+  ZEGO_ROOM_ROSTER_TYPE_USER = 0,
+  ZEGO_ROOM_ROSTER_TYPE_STREAM
+};
+
+// Users and streams of every logged in room, indexed by ID and kept in
+// join order, so dart can page through them instead of receiving every
+// delta list.
+class ZegoRoomRoster {
+ public:
+  struct UpdateSummary {
+    uint32_t changedCount = 0;
+    uint32_t totalCount = 0;
+    // Incremented by every update of the room, for detecting stale pages.
+    uint64_t version = 0;
+  };
+
+  ZegoRoomRoster() = default;
+
+  // Prevent copying.
+  ZegoRoomRoster(ZegoRoomRoster const&) = delete;
+  ZegoRoomRoster& operator=(ZegoRoomRoster const&) = delete;
+
+  UpdateSummary updateUsers(const std::string &roomID, ZEGO::EXPRESS::ZegoUpdateType updateType,
+                            const std::vector<ZEGO::EXPRESS::ZegoUser> &userList);
+
+  UpdateSummary updateStreams(const std::string &roomID, ZEGO::EXPRESS::ZegoUpdateType updateType,
+                              const std::vector<ZEGO::EXPRESS::ZegoStream> &streamList);
+
+  // Replaces the extra info of the streams already in the roster, others
+  // are ignored. `changedCount` is the number of extra infos that changed.
+  UpdateSummary updateStreamExtraInfo(const std::string &roomID,
+                                      const std::vector<ZEGO::EXPRESS::ZegoStream> &streamList);
+
+  // Returns `{"totalCount", "version", "userList"}` with at most `limit`
+  // users from `offset` in join order, only users whose ID or name
+  // contains `filter` if it is not empty.
+  flutter::EncodableMap getUsers(const std::string &roomID, uint32_t offset, uint32_t limit,
+                                 const std::string &filter);
+
+  // Same as `getUsers` for streams, `filter` matches the stream ID and the
+  // user ID.
+  flutter::EncodableMap getStreams(const std::string &roomID, uint32_t offset, uint32_t limit,
+                                   const std::string &filter);
+
+  void removeRoom(const std::string &roomID);
+
+  void clear();
+
+ private:
+  // Insertion-ordered items with an index by key. Removed items leave a
+  // hole that is compacted away once holes outnumber the items.
+  template <typename T>
+  struct OrderedIndex {
+    std::vector<T> items;
+    std::vector<std::string> keys;
+    std::vector<bool> alive;
+    std::unordered_map<std::string, size_t> positions;
+
+    // Returns true if the key was not present.
+    bool add(const std::string &key, const T &item);
+
+    // Returns true if the key was present.
+    bool remove(const std::string &key);
+
+    // Returns the item of key, or nullptr.
+    T *find(const std::string &key);
+
+    size_t size() const { return positions.size(); }
+
+    void compact();
+
+    // Encodes at most `limit` matching items from `offset`, `matchedCount`
+    // is set to the number of all matching items.
+    flutter::EncodableList page(uint32_t offset, uint32_t limit,
+                                const std::function<bool(const T &)> &matches,
+                                const std::function<flutter::EncodableValue(const T &)> &encode,
+                                uint32_t &matchedCount) const;
+  };
+
+  struct Room {
+    OrderedIndex<ZEGO::EXPRESS::ZegoUser> users;
+    OrderedIndex<ZEGO::EXPRESS::ZegoStream> streams;
+    uint64_t version = 0;
+  };
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, Room> rooms_;
+};
@@ -0,0 +1,114 @@
+#include "ZegoSEIBatcher.h"
+
+#include <cstring>
+
+ZegoSEIBatcher::~ZegoSEIBatcher() {
+  stop();
+}
+
+void ZegoSEIBatcher::start(const Config &config, ReadyCallback ready, EmitCallback emit) {
+  stop();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  config_ = config;
+  config_.intervalMs = config.intervalMs > 0 ? config.intervalMs : 50;
+  config_.maxUnitsPerStream = config.latestOnly ? 1 : config.maxUnitsPerStream > 0 ? config.maxUnitsPerStream : 64;
+  emit_ = std::move(emit);
+  stats_ = Stats();
+  startTicking(config_.intervalMs, std::move(ready));
+}
+
+void ZegoSEIBatcher::stop() {
+  stopTicking();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  emit_ = nullptr;
+}
+
+void ZegoSEIBatcher::add(ZegoSEIBatchType type, int source, const std::string &streamID,
+                         const unsigned char *data, unsigned int dataLength, int64_t timestamp) {
+  Unit unit;
+  unit.data.assign(data, data + dataLength);
+  unit.timestamp = timestamp;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.receivedCount++;
+
+  auto &ring = rings_[RingKey((int)type, source, streamID)];
+  if (ring.size() >= config_.maxUnitsPerStream) {
+    ring.pop_front();
+    pendingCount_--;
+    if (config_.latestOnly) {
+      stats_.replacedCount++;
+    } else {
+      stats_.droppedCount++;
+    }
+  }
+  ring.push_back(std::move(unit));
+  pendingCount_++;
+}
+
+ZegoSEIBatcher::Stats ZegoSEIBatcher::getStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+std::function<void()> ZegoSEIBatcher::takeBatch(bool isStopping) {
+  auto batch = encodeBatch();
+  if (!emit_) {
+    return nullptr;
+  }
+  return [emit = emit_, batch = std::move(batch)]() mutable { emit(std::move(batch)); };
+}
+
+flutter::EncodableMap ZegoSEIBatcher::encodeBatch() {
+  std::vector<int32_t> types;
+  std::vector<int32_t> sources;
+  flutter::EncodableList streamIDs;
+  std::vector<int64_t> timestamps;
+  std::vector<int32_t> offsets;
+  std::vector<uint8_t> data;
+
+  types.reserve(pendingCount_);
+  sources.reserve(pendingCount_);
+  streamIDs.reserve(pendingCount_);
+  timestamps.reserve(pendingCount_);
+  offsets.reserve(pendingCount_);
+  size_t dataLength = 0;
+  for (auto const &ring : rings_) {
+    for (auto const &unit : ring.second) {
+      dataLength += unit.data.size();
+    }
+  }
+  data.resize(dataLength);
+
+  size_t offset = 0;
+  for (auto const &ring : rings_) {
+    for (auto const &unit : ring.second) {
+      types.push_back(std::get<0>(ring.first));
+      sources.push_back(std::get<1>(ring.first));
+      streamIDs.emplace_back(std::get<2>(ring.first));
+      timestamps.push_back(unit.timestamp);
+      offsets.push_back((int32_t)offset);
+      if (!unit.data.empty()) {
+        std::memcpy(data.data() + offset, unit.data.data(), unit.data.size());
+        offset += unit.data.size();
+      }
+    }
+  }
+
+  stats_.deliveredCount += pendingCount_;
+  stats_.batchCount++;
+  // Streams that stopped sending leave no ring behind.
+  rings_.clear();
+  pendingCount_ = 0;
+
+  flutter::EncodableMap batch;
+  batch[flutter::EncodableValue("types")] = flutter::EncodableValue(std::move(types));
+  batch[flutter::EncodableValue("sources")] = flutter::EncodableValue(std::move(sources));
+  batch[flutter::EncodableValue("streamIDs")] = flutter::EncodableValue(std::move(streamIDs));
+  batch[flutter::EncodableValue("timestamps")] = flutter::EncodableValue(std::move(timestamps));
+  batch[flutter::EncodableValue("offsets")] = flutter::EncodableValue(std::move(offsets));
+  batch[flutter::EncodableValue("data")] = flutter::EncodableValue(std::move(data));
+  return batch;
+}
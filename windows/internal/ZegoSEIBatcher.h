@@ -0,0 +1,86 @@
+#pragma once
+
+#include <flutter/encodable_value.h>
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "ZegoBatchTicker.h"
+
+enum ZegoSEIBatchType {
+  ZEGO_SEI_BATCH_TYPE_PLAYER_SEI = 0,
+  ZEGO_SEI_BATCH_TYPE_PLAYER_MEDIA_SIDE_INFO,
+  ZEGO_SEI_BATCH_TYPE_MEDIA_PLAYER_SEI
+};
+
+// Keeps received SEI units in a bounded ring per stream and media player
+// and emits all of them as one packed batch per tick: a `types`, `sources`
+// (media player index), `streamIDs` and `timestamps` entry per unit, the
+// start `offsets` of each unit and all payloads in `data`. With
+// `latestOnly` a ring only holds the newest unit. A tick is skipped while
+// the previous batch has not been delivered yet.
+class ZegoSEIBatcher : public ZegoTickBatcher {
+ public:
+  struct Config {
+    uint32_t intervalMs = 50;
+    // Units kept per stream, the oldest are dropped first.
+    uint32_t maxUnitsPerStream = 64;
+    bool latestOnly = false;
+  };
+
+  struct Stats {
+    uint64_t receivedCount = 0;
+    uint64_t deliveredCount = 0;
+    uint64_t droppedCount = 0;
+    // Units replaced by a newer one of the same stream with `latestOnly`.
+    uint64_t replacedCount = 0;
+    uint64_t batchCount = 0;
+  };
+
+  using EmitCallback = std::function<void(flutter::EncodableMap &&batch)>;
+
+  ZegoSEIBatcher() = default;
+  ~ZegoSEIBatcher();
+
+  // Prevent copying.
+  ZegoSEIBatcher(ZegoSEIBatcher const&) = delete;
+  ZegoSEIBatcher& operator=(ZegoSEIBatcher const&) = delete;
+
+  void start(const Config &config, ReadyCallback ready, EmitCallback emit);
+
+  // Emits the pending units as a last batch.
+  void stop();
+
+  // `source` is the media player index for media player SEI, 0 otherwise.
+  // `timestamp` is 0 if the callback carries no frame timestamp.
+  void add(ZegoSEIBatchType type, int source, const std::string &streamID,
+           const unsigned char *data, unsigned int dataLength, int64_t timestamp);
+
+  Stats getStats();
+
+ protected:
+  bool hasPending() override { return pendingCount_ > 0; }
+
+  std::function<void()> takeBatch(bool isStopping) override;
+
+ private:
+  struct Unit {
+    std::vector<uint8_t> data;
+    int64_t timestamp = 0;
+  };
+
+  using RingKey = std::tuple<int, int, std::string>;
+
+  flutter::EncodableMap encodeBatch();
+
+  Config config_;
+  EmitCallback emit_;
+
+  std::map<RingKey, std::deque<Unit>> rings_;
+  size_t pendingCount_ = 0;
+  Stats stats_;
+};
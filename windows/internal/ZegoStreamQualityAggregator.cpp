@@ -0,0 +1,166 @@
+#include "ZegoStreamQualityAggregator.h"
+
+#include <algorithm>
+
+namespace {
+
+const char *const kMetricNames[ZEGO_STREAM_QUALITY_METRIC_COUNT] = {
+    "rtt", "packetLostRate", "delay", "fps", "kbps", "mos", "videoBreakRate", "audioBreakRate"};
+
+constexpr uint32_t kPublisherMetrics = (1 << ZEGO_STREAM_QUALITY_METRIC_RTT) |
+                                       (1 << ZEGO_STREAM_QUALITY_METRIC_PACKET_LOST_RATE) |
+                                       (1 << ZEGO_STREAM_QUALITY_METRIC_FPS) |
+                                       (1 << ZEGO_STREAM_QUALITY_METRIC_KBPS);
+
+constexpr uint32_t kPlayerMetrics = (1 << ZEGO_STREAM_QUALITY_METRIC_COUNT) - 1;
+
+// Streams without a sample for this long are dropped.
+constexpr std::chrono::minutes kStaleTimeout(30);
+
+}  // namespace
+
+void ZegoStreamQualityAggregator::addPublisherQuality(
+    const std::string &streamID, const ZEGO::EXPRESS::ZegoPublishStreamQuality &quality) {
+  Sample sample = {Clock::now(), {}};
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_RTT] = (float)quality.rtt;
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_PACKET_LOST_RATE] = (float)quality.packetLostRate;
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_FPS] = (float)quality.videoSendFPS;
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_KBPS] = (float)(quality.videoKBPS + quality.audioKBPS);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  addSample(publisherHistories_, streamID, sample, kPublisherMetrics);
+}
+
+void ZegoStreamQualityAggregator::addPlayerQuality(
+    const std::string &streamID, const ZEGO::EXPRESS::ZegoPlayStreamQuality &quality) {
+  Sample sample = {Clock::now(), {}};
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_RTT] = (float)quality.rtt;
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_PACKET_LOST_RATE] = (float)quality.packetLostRate;
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_DELAY] = (float)quality.delay;
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_FPS] = (float)quality.videoRenderFPS;
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_KBPS] = (float)(quality.videoKBPS + quality.audioKBPS);
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_MOS] = (float)quality.mos;
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_VIDEO_BREAK_RATE] = (float)quality.videoBreakRate;
+  sample.values[ZEGO_STREAM_QUALITY_METRIC_AUDIO_BREAK_RATE] = (float)quality.audioBreakRate;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  addSample(playerHistories_, streamID, sample, kPlayerMetrics);
+}
+
+flutter::EncodableMap ZegoStreamQualityAggregator::query(const std::vector<std::string> &streamIDs,
+                                                         uint32_t windowSeconds) {
+  auto since = Clock::now() - std::chrono::seconds(windowSeconds);
+  flutter::EncodableMap result;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto addStream = [&](const std::string &streamID) {
+    flutter::EncodableMap streamMap;
+    auto publisher = publisherHistories_.find(streamID);
+    if (publisher != publisherHistories_.end()) {
+      streamMap[flutter::EncodableValue("publisher")] =
+          flutter::EncodableValue(summarize(publisher->second, since));
+    }
+    auto player = playerHistories_.find(streamID);
+    if (player != playerHistories_.end()) {
+      streamMap[flutter::EncodableValue("player")] =
+          flutter::EncodableValue(summarize(player->second, since));
+    }
+    if (!streamMap.empty()) {
+      result[flutter::EncodableValue(streamID)] = flutter::EncodableValue(std::move(streamMap));
+    }
+  };
+
+  if (streamIDs.empty()) {
+    for (auto const &history : publisherHistories_) {
+      addStream(history.first);
+    }
+    for (auto const &history : playerHistories_) {
+      if (publisherHistories_.find(history.first) == publisherHistories_.end()) {
+        addStream(history.first);
+      }
+    }
+  } else {
+    for (auto const &streamID : streamIDs) {
+      addStream(streamID);
+    }
+  }
+  return result;
+}
+
+void ZegoStreamQualityAggregator::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  publisherHistories_.clear();
+  playerHistories_.clear();
+}
+
+void ZegoStreamQualityAggregator::addSample(HistoryMap &histories, const std::string &streamID,
+                                            const Sample &sample, uint32_t metricMask) {
+  pruneStale(sample.time);
+
+  auto &history = histories[streamID];
+  history.metricMask = metricMask;
+  history.lastTime = sample.time;
+  if (history.samples.size() < kCapacity) {
+    history.samples.push_back(sample);
+  } else {
+    history.samples[history.next] = sample;
+  }
+  history.next = (history.next + 1) % kCapacity;
+}
+
+flutter::EncodableMap ZegoStreamQualityAggregator::summarize(const StreamHistory &history,
+                                                             Clock::time_point since) {
+  std::vector<const Sample *> window;
+  window.reserve(history.samples.size());
+  for (auto const &sample : history.samples) {
+    if (sample.time >= since) {
+      window.push_back(&sample);
+    }
+  }
+
+  flutter::EncodableMap summary;
+  summary[flutter::EncodableValue("sampleCount")] = flutter::EncodableValue((int32_t)window.size());
+  if (window.empty()) {
+    return summary;
+  }
+
+  std::vector<float> values(window.size());
+  for (int metric = 0; metric < ZEGO_STREAM_QUALITY_METRIC_COUNT; metric++) {
+    if (!(history.metricMask & (1 << metric))) {
+      continue;
+    }
+    for (size_t i = 0; i < window.size(); i++) {
+      values[i] = window[i]->values[metric];
+    }
+
+    // Percentiles by rank, nth_element only partially sorts.
+    size_t p50 = (values.size() - 1) * 50 / 100;
+    size_t p95 = (values.size() - 1) * 95 / 100;
+    std::nth_element(values.begin(), values.begin() + p95, values.end());
+    double p95Value = values[p95];
+    double maxValue = *std::max_element(values.begin() + p95, values.end());
+    std::nth_element(values.begin(), values.begin() + p50, values.begin() + p95);
+    double p50Value = p50 < p95 ? values[p50] : p95Value;
+
+    summary[flutter::EncodableValue(kMetricNames[metric])] =
+        flutter::EncodableValue(std::vector<double>{p50Value, p95Value, maxValue});
+  }
+  return summary;
+}
+
+void ZegoStreamQualityAggregator::pruneStale(Clock::time_point now) {
+  if (now - lastPruneTime_ < std::chrono::minutes(1)) {
+    return;
+  }
+  lastPruneTime_ = now;
+
+  for (auto *histories : {&publisherHistories_, &playerHistories_}) {
+    for (auto it = histories->begin(); it != histories->end();) {
+      if (now - it->second.lastTime > kStaleTimeout) {
+        it = histories->erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
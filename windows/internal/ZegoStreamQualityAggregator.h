@@ -0,0 +1,83 @@
+#pragma once
+
+#include <flutter/encodable_value.h>
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ZegoExpressSDK.h>
+
+enum ZegoStreamQualityMetric {
+  ZEGO_STREAM_QUALITY_METRIC_RTT = 0,
+  ZEGO_STREAM_QUALITY_METRIC_PACKET_LOST_RATE,
+  ZEGO_STREAM_QUALITY_METRIC_DELAY,
+  ZEGO_STREAM_QUALITY_METRIC_FPS,
+  ZEGO_STREAM_QUALITY_METRIC_KBPS,
+  ZEGO_STREAM_QUALITY_METRIC_MOS,
+  ZEGO_STREAM_QUALITY_METRIC_VIDEO_BREAK_RATE,
+  ZEGO_STREAM_QUALITY_METRIC_AUDIO_BREAK_RATE,
+  ZEGO_STREAM_QUALITY_METRIC_COUNT
+};
+
+// Keeps the recent quality samples of every published and played stream
+// in a fixed ring per stream and computes p50/p95/max over a time window
+// on demand, so dart does not need every quality event to show them.
+class ZegoStreamQualityAggregator {
+ public:
+  // Enough for 30 minutes at the default 3 second quality interval.
+  static constexpr size_t kCapacity = 600;
+
+  ZegoStreamQualityAggregator() = default;
+
+  // Prevent copying.
+  ZegoStreamQualityAggregator(ZegoStreamQualityAggregator const&) = delete;
+  ZegoStreamQualityAggregator& operator=(ZegoStreamQualityAggregator const&) = delete;
+
+  void addPublisherQuality(const std::string &streamID,
+                           const ZEGO::EXPRESS::ZegoPublishStreamQuality &quality);
+
+  void addPlayerQuality(const std::string &streamID,
+                        const ZEGO::EXPRESS::ZegoPlayStreamQuality &quality);
+
+  // Returns `{streamID: {"publisher"|"player": {"sampleCount": n,
+  // metric: [p50, p95, max], ...}}}` over the samples of the last
+  // `windowSeconds`, for all streams if `streamIDs` is empty. Metrics a
+  // stream type does not report are left out.
+  flutter::EncodableMap query(const std::vector<std::string> &streamIDs, uint32_t windowSeconds);
+
+  void clear();
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Sample {
+    Clock::time_point time;
+    float values[ZEGO_STREAM_QUALITY_METRIC_COUNT];
+  };
+
+  struct StreamHistory {
+    std::vector<Sample> samples;
+    size_t next = 0;
+    Clock::time_point lastTime;
+    // Bit per metric that this stream type reports.
+    uint32_t metricMask = 0;
+  };
+
+  using HistoryMap = std::unordered_map<std::string, StreamHistory>;
+
+  void addSample(HistoryMap &histories, const std::string &streamID, const Sample &sample,
+                 uint32_t metricMask);
+
+  static flutter::EncodableMap summarize(const StreamHistory &history, Clock::time_point since);
+
+  // Drops streams without a sample in the longest window a ring can hold.
+  void pruneStale(Clock::time_point now);
+
+  std::mutex mutex_;
+  HistoryMap publisherHistories_;
+  HistoryMap playerHistories_;
+  Clock::time_point lastPruneTime_;
+};
@@ -0,0 +1,162 @@
+#include "ZegoTaskExecutor.h"
+
+#include <exception>
+
+#include "../ZegoLog.h"
+
+ZegoTaskExecutor::~ZegoTaskExecutor() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+  for (auto &worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+void ZegoTaskExecutor::attachWindow(HWND window, UINT message) {
+  message_ = message;
+  window_ = window;
+}
+
+void ZegoTaskExecutor::detachWindow() {
+  // Tasks running on a worker post their follow-ups while the window is
+  // still attached, so those run below on this thread and none runs on a
+  // worker once the window is gone.
+  flush();
+  window_ = nullptr;
+  platformPending_ = false;
+  // Run whatever is still pending before falling back to the posting thread.
+  runPlatformTasks();
+}
+
+void ZegoTaskExecutor::post(ZegoTaskQueue queue, Task task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopping_) {
+      return;
+    }
+    if (workers_.empty()) {
+      for (int i = 0; i < ZEGO_TASK_QUEUE_COUNT; i++) {
+        workers_.emplace_back(&ZegoTaskExecutor::runWorker, this);
+      }
+    }
+
+    auto &pending = queues_[queue];
+    pending.tasks.push_back({std::move(task), Clock::now()});
+    pending.stats.postedCount++;
+    auto depth = (uint32_t)pending.tasks.size();
+    pending.stats.maxDepth = depth > pending.stats.maxDepth ? depth : pending.stats.maxDepth;
+    if (pending.isScheduled) {
+      return;
+    }
+    pending.isScheduled = true;
+    readyQueues_.push_back(queue);
+  }
+  condition_.notify_one();
+}
+
+void ZegoTaskExecutor::postToPlatform(Task task) {
+  auto window = window_.load();
+  if (!window) {
+    task();
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(platformMutex_);
+    platformTasks_.push_back(std::move(task));
+  }
+  if (!platformPending_.exchange(true)) {
+    if (!PostMessage(window, message_, 0, 0)) {
+      platformPending_ = false;
+      runPlatformTasks();
+    }
+  }
+}
+
+void ZegoTaskExecutor::runPlatformTasks() {
+  platformPending_ = false;
+
+  std::vector<Task> tasks;
+  {
+    std::lock_guard<std::mutex> lock(platformMutex_);
+    tasks.swap(platformTasks_);
+  }
+  for (auto &task : tasks) {
+    task();
+  }
+}
+
+void ZegoTaskExecutor::flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  idleCondition_.wait(lock, [this] { return isIdle(); });
+}
+
+ZegoTaskExecutor::QueueStats ZegoTaskExecutor::getStats(ZegoTaskQueue queue) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto stats = queues_[queue].stats;
+  stats.depth = (uint32_t)queues_[queue].tasks.size();
+  return stats;
+}
+
+void ZegoTaskExecutor::runWorker() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    condition_.wait(lock, [this] { return stopping_ || !readyQueues_.empty(); });
+    if (readyQueues_.empty()) {
+      break;
+    }
+
+    auto queue = readyQueues_.front();
+    readyQueues_.pop_front();
+    auto &pending = queues_[queue];
+    auto task = std::move(pending.tasks.front());
+    pending.tasks.pop_front();
+
+    auto startTime = Clock::now();
+    auto wait = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        startTime - task.postTime).count();
+    pending.stats.totalWaitMicroseconds += wait;
+    pending.stats.maxWaitMicroseconds =
+        wait > pending.stats.maxWaitMicroseconds ? wait : pending.stats.maxWaitMicroseconds;
+
+    lock.unlock();
+    try {
+      task.task();
+    } catch (std::exception &e) {
+      ZF::logInfo("[ZegoTaskExecutor] queue: %d, exception: %s", queue, e.what());
+    }
+    auto run = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - startTime).count();
+    lock.lock();
+
+    pending.stats.completedCount++;
+    pending.stats.totalRunMicroseconds += run;
+    pending.stats.maxRunMicroseconds =
+        run > pending.stats.maxRunMicroseconds ? run : pending.stats.maxRunMicroseconds;
+
+    if (!pending.tasks.empty()) {
+      // Behind the queues that became ready meanwhile.
+      readyQueues_.push_back(queue);
+      condition_.notify_one();
+    } else {
+      pending.isScheduled = false;
+      if (isIdle()) {
+        idleCondition_.notify_all();
+      }
+    }
+  }
+}
+
+bool ZegoTaskExecutor::isIdle() {
+  for (auto const &queue : queues_) {
+    if (queue.isScheduled) {
+      return false;
+    }
+  }
+  return true;
+}
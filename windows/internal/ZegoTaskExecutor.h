@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <windows.h>
+
+enum ZegoTaskQueue {
+  // Audio and video device switching.
+  ZEGO_TASK_QUEUE_DEVICE = 0,
+  // Starting and stopping publishing.
+  ZEGO_TASK_QUEUE_PUBLISH,
+  ZEGO_TASK_QUEUE_COUNT
+};
+
+// Runs blocking SDK calls off the platform thread. Tasks of a named queue
+// run one at a time in the order they are posted, different queues run in
+// parallel on a small pool of worker threads. Follow-up tasks such as method
+// replies can be posted back to the platform thread, which runs them when
+// it processes `message` of the attached window.
+class ZegoTaskExecutor {
+ public:
+  struct QueueStats {
+    uint64_t postedCount = 0;
+    uint64_t completedCount = 0;
+    uint32_t depth = 0;
+    uint32_t maxDepth = 0;
+    // From posting a task until it starts running.
+    uint64_t totalWaitMicroseconds = 0;
+    uint64_t maxWaitMicroseconds = 0;
+    uint64_t totalRunMicroseconds = 0;
+    uint64_t maxRunMicroseconds = 0;
+  };
+
+  using Task = std::function<void()>;
+
+  static ZegoTaskExecutor &getInstance() {
+    static ZegoTaskExecutor instance;
+    return instance;
+  }
+
+  ~ZegoTaskExecutor();
+
+  // Prevent copying.
+  ZegoTaskExecutor(ZegoTaskExecutor const&) = delete;
+  ZegoTaskExecutor& operator=(ZegoTaskExecutor const&) = delete;
+
+  // Without a window platform tasks run on the posting thread.
+  void attachWindow(HWND window, UINT message);
+
+  // Waits for the tasks of the queues, then runs the pending platform tasks
+  // on the calling thread. Called on the platform thread.
+  void detachWindow();
+
+  // Whether postToPlatform reaches the platform thread, false without a
+  // window (e.g. a headless engine).
+  bool isPlatformAttached() const { return window_.load() != nullptr; }
+
+  void post(ZegoTaskQueue queue, Task task);
+
+  void postToPlatform(Task task);
+
+  // Called on the platform thread only.
+  void runPlatformTasks();
+
+  // Blocks until every task posted to a queue has run.
+  void flush();
+
+  QueueStats getStats(ZegoTaskQueue queue);
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct PendingTask {
+    Task task;
+    Clock::time_point postTime;
+  };
+
+  struct Queue {
+    std::deque<PendingTask> tasks;
+    // Waiting in readyQueues_ or running on a worker.
+    bool isScheduled = false;
+    QueueStats stats;
+  };
+
+  ZegoTaskExecutor() = default;
+
+  void runWorker();
+
+  bool isIdle();
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::condition_variable idleCondition_;
+  Queue queues_[ZEGO_TASK_QUEUE_COUNT];
+  // Queues that have tasks and none of them running, in the order they
+  // became ready.
+  std::deque<ZegoTaskQueue> readyQueues_;
+  // Started with the first task, a queue never uses more than one.
+  std::vector<std::thread> workers_;
+  bool stopping_ = false;
+
+  std::mutex platformMutex_;
+  std::vector<Task> platformTasks_;
+  std::atomic<HWND> window_ = nullptr;
+  UINT message_ = 0;
+  std::atomic_bool platformPending_ = false;
+};
@@ -0,0 +1,100 @@
+#include "ZegoTextureFrameScheduler.h"
+#include "ZegoTextureRenderer.h"
+
+#include <windows.h>
+#include <timeapi.h>
+
+#include <algorithm>
+
+ZegoTextureFrameScheduler::~ZegoTextureFrameScheduler() {
+  stop();
+}
+
+void ZegoTextureFrameScheduler::start(uint32_t intervalMs) {
+  stop();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  interval_ = intervalMs > 0 ? std::chrono::microseconds(intervalMs * 1000)
+                             : getDisplayRefreshInterval();
+  running_ = true;
+  thread_ = std::thread(&ZegoTextureFrameScheduler::run, this);
+}
+
+void ZegoTextureFrameScheduler::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_) {
+      return;
+    }
+    running_ = false;
+  }
+  condition_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  // Renderers marked ready after the last tick must not miss their frame.
+  flush();
+}
+
+void ZegoTextureFrameScheduler::markFrameReady(std::shared_ptr<ZegoTextureRenderer> renderer) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+      if (std::find(readyRenderers_.begin(), readyRenderers_.end(), renderer) ==
+          readyRenderers_.end()) {
+        readyRenderers_.push_back(std::move(renderer));
+      }
+      return;
+    }
+  }
+  renderer->markFrameAvailable();
+}
+
+void ZegoTextureFrameScheduler::run() {
+  // The default system timer resolution (~15.6ms) is too coarse to tick at
+  // display refresh rate.
+  timeBeginPeriod(1);
+
+  auto nextTick = std::chrono::steady_clock::now() + interval_;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (condition_.wait_until(lock, nextTick, [this] { return !running_; })) {
+        break;
+      }
+    }
+    flush();
+
+    // Schedule from the previous tick to keep the cadence, unless a flush
+    // took longer than a whole interval.
+    nextTick += interval_;
+    auto now = std::chrono::steady_clock::now();
+    if (nextTick < now) {
+      nextTick = now + interval_;
+    }
+  }
+
+  timeEndPeriod(1);
+}
+
+void ZegoTextureFrameScheduler::flush() {
+  std::vector<std::shared_ptr<ZegoTextureRenderer>> renderers;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    renderers.swap(readyRenderers_);
+  }
+  for (auto const& renderer : renderers) {
+    renderer->markFrameAvailable();
+  }
+}
+
+std::chrono::microseconds ZegoTextureFrameScheduler::getDisplayRefreshInterval() {
+  DEVMODEW mode = {};
+  mode.dmSize = sizeof(mode);
+  // 0 and 1 both stand for the hardware default refresh rate.
+  if (EnumDisplaySettingsW(nullptr, ENUM_CURRENT_SETTINGS, &mode) &&
+      mode.dmDisplayFrequency > 1) {
+    return std::chrono::microseconds(1000000 / mode.dmDisplayFrequency);
+  }
+  return std::chrono::microseconds(1000000 / 60);
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ZegoTextureRenderer;
+
+// Collects "frame ready" notifications from all texture renderers and marks
+// them available to flutter in one batch per display refresh interval, so
+// the engine sees one coherent update instead of a wakeup per texture.
+class ZegoTextureFrameScheduler {
+ public:
+  ZegoTextureFrameScheduler() = default;
+  ~ZegoTextureFrameScheduler();
+
+  // Prevent copying.
+  ZegoTextureFrameScheduler(ZegoTextureFrameScheduler const&) = delete;
+  ZegoTextureFrameScheduler& operator=(ZegoTextureFrameScheduler const&) = delete;
+
+  // Starts flushing every interval, 0 derives the interval from the refresh
+  // rate of the primary monitor.
+  void start(uint32_t intervalMs);
+
+  // Flushes pending renderers and joins the timer thread.
+  void stop();
+
+  void markFrameReady(std::shared_ptr<ZegoTextureRenderer> renderer);
+
+ private:
+  void run();
+
+  void flush();
+
+  static std::chrono::microseconds getDisplayRefreshInterval();
+
+  bool running_ = false;
+  std::chrono::microseconds interval_{16667};
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::vector<std::shared_ptr<ZegoTextureRenderer>> readyRenderers_;
+};
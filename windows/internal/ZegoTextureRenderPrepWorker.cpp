@@ -0,0 +1,60 @@
+#include "ZegoTextureRenderPrepWorker.h"
+#include "ZegoTextureRenderer.h"
+
+#include <algorithm>
+
+ZegoTextureRenderPrepWorker::~ZegoTextureRenderPrepWorker() {
+  stop();
+}
+
+void ZegoTextureRenderPrepWorker::start() {
+  std::lock_guard<std::mutex> lock(queueMutex_);
+  if (running_) {
+    return;
+  }
+  running_ = true;
+  thread_ = std::thread(&ZegoTextureRenderPrepWorker::run, this);
+}
+
+void ZegoTextureRenderPrepWorker::stop() {
+  {
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    if (!running_) {
+      return;
+    }
+    running_ = false;
+  }
+  queueCondition_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void ZegoTextureRenderPrepWorker::post(std::shared_ptr<ZegoTextureRenderer> renderer) {
+  {
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    if (!running_ ||
+        std::find(queue_.begin(), queue_.end(), renderer) != queue_.end()) {
+      return;
+    }
+    queue_.push_back(std::move(renderer));
+  }
+  queueCondition_.notify_one();
+}
+
+void ZegoTextureRenderPrepWorker::run() {
+  while (true) {
+    std::shared_ptr<ZegoTextureRenderer> renderer;
+    {
+      std::unique_lock<std::mutex> lock(queueMutex_);
+      queueCondition_.wait(lock, [this] { return !running_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        // Only reached once stopped and drained.
+        return;
+      }
+      renderer = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    renderer->prepareFrame();
+  }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+class ZegoTextureRenderer;
+
+// Converts ingested frames into flutter pixel buffers on a dedicated thread,
+// so the texture callback on flutter's raster thread only hands out a
+// pointer to an already converted buffer.
+class ZegoTextureRenderPrepWorker {
+ public:
+  ZegoTextureRenderPrepWorker() = default;
+  ~ZegoTextureRenderPrepWorker();
+
+  // Prevent copying.
+  ZegoTextureRenderPrepWorker(ZegoTextureRenderPrepWorker const&) = delete;
+  ZegoTextureRenderPrepWorker& operator=(ZegoTextureRenderPrepWorker const&) = delete;
+
+  void start();
+
+  // Drains pending renderers and joins the worker thread.
+  void stop();
+
+  // Queues the renderer for conversion. A renderer that is already queued is
+  // not queued again, it will convert its latest frame when it is reached.
+  void post(std::shared_ptr<ZegoTextureRenderer> renderer);
+
+ private:
+  void run();
+
+  bool running_ = false;
+  std::thread thread_;
+  std::mutex queueMutex_;
+  std::condition_variable queueCondition_;
+  std::deque<std::shared_ptr<ZegoTextureRenderer>> queue_;
+};
@@ -1,4 +1,6 @@
 #include "ZegoTextureRenderer.h"
+#include "ZegoTextureFrameScheduler.h"
+#include "ZegoTextureRenderPrepWorker.h"
 
 #include <cassert>
 #include <iostream>
@@ -10,7 +12,10 @@ ZegoTextureRenderer::ZegoTextureRenderer(flutter::TextureRegistrar* texture_regi
     texture_ =
         std::make_unique<flutter::TextureVariant>(flutter::PixelBufferTexture(
             [this](size_t width, size_t height) -> const FlutterDesktopPixelBuffer* {
-                return this->ConvertPixelBufferForFlutter(width, height);
+                auto start = std::chrono::steady_clock::now();
+                auto buffer = this->ConvertPixelBufferForFlutter(width, height);
+                this->recordRasterTime(std::chrono::steady_clock::now() - start);
+                return buffer;
         }));
 
     textureID_ = textureRegistrar_->RegisterTexture(texture_.get());
@@ -33,6 +38,9 @@ ZegoTextureRenderer::~ZegoTextureRenderer() {
 
 bool ZegoTextureRenderer::updateSrcFrameBuffer(uint8_t *data, uint32_t data_length,
                                                ZEGO::EXPRESS::ZegoVideoFrameParam frameParam) {
+  auto prepWorker = prepWorker_.load();
+  bool prepareOnWorker = false;
+
   // Scoped lock guard.
   {
     const std::lock_guard<std::mutex> lock(bufferMutex_);
@@ -40,23 +48,188 @@ bool ZegoTextureRenderer::updateSrcFrameBuffer(uint8_t *data, uint32_t data_leng
       return false;
     }
 
-    if (srcBuffer_.size() != data_length) {
-      // Update source buffer size.
-      srcBuffer_.resize(data_length);
-    }
-
     updateRenderSize(frameParam.width, frameParam.height);
 
     srcVideoFrameFormat_ = frameParam.format;
 
-    std::copy(data, data + data_length, srcBuffer_.data());
+    bool needsConversion = srcVideoFrameFormat_ != ZEGO::EXPRESS::ZEGO_VIDEO_FRAME_FORMAT_RGBA32;
+
+    if (isSingleCopy_) {
+      // Single-copy mode, convert straight from the SDK buffer into the
+      // buffer handed to flutter.
+      if (destBuffer_.size() != data_length) {
+        destBuffer_.resize(data_length);
+      }
+      if (!needsConversion) {
+        std::copy(data, data + data_length, destBuffer_.data());
+      } else if (!convertFrame(data, destBuffer_.data())) {
+        return false;
+      }
+      isDestMirrored_ = needsConversion && isUseMirror_;
+    } else {
+      if (srcBuffer_.size() != data_length) {
+        // Update source buffer size.
+        srcBuffer_.resize(data_length);
+      }
+
+      std::copy(data, data + data_length, srcBuffer_.data());
+
+      prepareOnWorker = prepWorker && needsConversion;
+      if (prepWorker && !needsConversion) {
+        // RGBA frames are handed to flutter as they are, drop any frame
+        // prepared for the previous format.
+        const std::lock_guard<std::mutex> prepared_lock(preparedMutex_);
+        hasPreparedFrame_ = false;
+      }
+    }
+  }
+
+  if (prepareOnWorker) {
+    // The worker marks the texture available once the frame is converted.
+    prepWorker->post(shared_from_this());
+  } else {
+    OnBufferUpdated();
   }
-  OnBufferUpdated();
   return true;
 };
 
+void ZegoTextureRenderer::setSingleCopy(bool enable) {
+  const std::lock_guard<std::mutex> lock(bufferMutex_);
+  if (isSingleCopy_ == enable) {
+    return;
+  }
+  isSingleCopy_ = enable;
+
+  // Whichever buffer the new mode ingests into is filled by the next frame.
+  std::vector<uint8_t>().swap(srcBuffer_);
+  std::vector<uint8_t>().swap(destBuffer_);
+
+  const std::lock_guard<std::mutex> prepared_lock(preparedMutex_);
+  hasPreparedFrame_ = false;
+}
+
+std::vector<uint8_t> ZegoTextureRenderer::getFrame() {
+  const std::lock_guard<std::mutex> lock(bufferMutex_);
+  if (!isSingleCopy_) {
+    return srcBuffer_;
+  }
+
+  // Single-copy mode keeps no source frame, serve the converted frame which
+  // is already in RGBA order and only undo the software mirror.
+  if (!isDestMirrored_ || destBuffer_.size() < (size_t)width_ * height_ * 4) {
+    return destBuffer_;
+  }
+
+  std::vector<uint8_t> frame(destBuffer_.size());
+  const FlutterDesktopPixel* src =
+      reinterpret_cast<const FlutterDesktopPixel*>(destBuffer_.data());
+  FlutterDesktopPixel* dst = reinterpret_cast<FlutterDesktopPixel*>(frame.data());
+  for (uint32_t y = 0; y < height_; y++) {
+    const FlutterDesktopPixel* srcRow = src + y * width_;
+    FlutterDesktopPixel* dstRow = dst + y * width_;
+    for (uint32_t x = 0; x < width_; x++) {
+      dstRow[x] = srcRow[(width_ - 1) - x];
+    }
+  }
+  return frame;
+}
+
+void ZegoTextureRenderer::setRenderPrepWorker(ZegoTextureRenderPrepWorker *worker) {
+  prepWorker_ = worker;
+  if (!worker) {
+    const std::lock_guard<std::mutex> prepared_lock(preparedMutex_);
+    hasPreparedFrame_ = false;
+  }
+}
+
+void ZegoTextureRenderer::prepareFrame() {
+  uint32_t width = 0;
+  uint32_t height = 0;
+  {
+    const std::lock_guard<std::mutex> lock(bufferMutex_);
+    if (!TextureRegistered() || srcBuffer_.empty()) {
+      return;
+    }
+
+    if (prepareBuffer_.size() != srcBuffer_.size()) {
+      prepareBuffer_.resize(srcBuffer_.size());
+    }
+
+    if (!convertFrame(srcBuffer_.data(), prepareBuffer_.data())) {
+      return;
+    }
+    width = width_;
+    height = height_;
+  }
+
+  {
+    // Only held for the swap, the raster thread never waits for a conversion.
+    const std::lock_guard<std::mutex> prepared_lock(preparedMutex_);
+    if (!prepWorker_) {
+      return;
+    }
+    std::swap(prepareBuffer_, preparedBuffer_);
+    preparedWidth_ = width;
+    preparedHeight_ = height;
+    hasPreparedFrame_ = true;
+  }
+
+  OnBufferUpdated();
+}
+
+ZegoTextureRenderer::RasterStats ZegoTextureRenderer::getRasterStats() {
+  RasterStats stats;
+  stats.frameCount = rasterFrameCount_;
+  stats.totalMicroseconds = rasterTotalMicroseconds_;
+  stats.maxMicroseconds = rasterMaxMicroseconds_;
+  return stats;
+}
+
+void ZegoTextureRenderer::recordRasterTime(std::chrono::steady_clock::duration duration) {
+  uint64_t microseconds =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+  rasterFrameCount_++;
+  rasterTotalMicroseconds_ += microseconds;
+  if (microseconds > rasterMaxMicroseconds_) {
+    rasterMaxMicroseconds_ = microseconds;
+  }
+}
+
+bool ZegoTextureRenderer::acceptFrame(uint32_t fpsLimit) {
+  if (fpsLimit == 0) {
+    return true;
+  }
+
+  auto now = std::chrono::steady_clock::now();
+  auto interval = std::chrono::microseconds(1000000 / fpsLimit);
+
+  // Allow a little arrival jitter so a 30fps source capped at 15fps doesn't
+  // fall to 10fps when every other frame lands a bit early.
+  if (now + interval / 8 < nextFrameTime_) {
+    return false;
+  }
+
+  // Advance from the previous deadline to keep the average rate, but resync
+  // when the source has stalled for longer than one interval.
+  if (now - nextFrameTime_ > interval) {
+    nextFrameTime_ = now + interval;
+  } else {
+    nextFrameTime_ += interval;
+  }
+  return true;
+}
+
 // Marks texture frame available after buffer is updated.
 void ZegoTextureRenderer::OnBufferUpdated() {
+  auto frameScheduler = frameScheduler_.load();
+  if (frameScheduler) {
+    frameScheduler->markFrameReady(shared_from_this());
+  } else {
+    markFrameAvailable();
+  }
+}
+
+void ZegoTextureRenderer::markFrameAvailable() {
   if (TextureRegistered()) {
     textureRegistrar_->MarkTextureFrameAvailable(textureID_);
   }
@@ -73,12 +246,41 @@ const FlutterDesktopPixelBuffer* ZegoTextureRenderer::ConvertPixelBufferForFlutt
   // call and implement IMFCaptureEngineOnSampleCallback2::OnSynchronizedEvent
   // to detect size changes.
 
+  if (prepWorker_) {
+    // Render-prep mode, the frame has already been converted by the worker.
+    std::unique_lock<std::mutex> prepared_lock(preparedMutex_);
+    if (hasPreparedFrame_) {
+      CreatePixelBufferIfNeeded();
+      flutterDesktopPixelBuffer_->buffer = preparedBuffer_.data();
+      flutterDesktopPixelBuffer_->width = preparedWidth_;
+      flutterDesktopPixelBuffer_->height = preparedHeight_;
+
+      // Keeps the prepared buffer locked until flutter has uploaded it.
+      flutterDesktopPixelBuffer_->release_context = prepared_lock.release();
+
+      return flutterDesktopPixelBuffer_.get();
+    }
+  }
+
   // Lock buffer mutex to protect texture processing
   std::unique_lock<std::mutex> buffer_lock(bufferMutex_);
   if (!TextureRegistered()) {
     return nullptr;
   }
 
+  if (isSingleCopy_) {
+    // Single-copy mode, the frame was converted while it was ingested.
+    if (destBuffer_.empty()) {
+      return nullptr;
+    }
+    CreatePixelBufferIfNeeded();
+    flutterDesktopPixelBuffer_->buffer = destBuffer_.data();
+    flutterDesktopPixelBuffer_->width = width_;
+    flutterDesktopPixelBuffer_->height = height_;
+    flutterDesktopPixelBuffer_->release_context = buffer_lock.release();
+    return flutterDesktopPixelBuffer_.get();
+  }
+
   const uint32_t bytes_per_pixel = 4;
   const uint32_t pixels_total = width_ * height_;
   const uint32_t data_size = pixels_total * bytes_per_pixel;
@@ -116,45 +318,12 @@ const FlutterDesktopPixelBuffer* ZegoTextureRenderer::ConvertPixelBufferForFlutt
     //   }
     // }
 
-    if (!flutterDesktopPixelBuffer_) {
-      flutterDesktopPixelBuffer_ =
-          std::make_unique<FlutterDesktopPixelBuffer>();
-
-      // Unlocks mutex after texture is processed.
-      flutterDesktopPixelBuffer_->release_callback =
-          [](void* release_context) {
-            auto mutex = reinterpret_cast<std::mutex*>(release_context);
-            mutex->unlock();
-          };
-    }
+    CreatePixelBufferIfNeeded();
 
     if (srcVideoFrameFormat_ == ZEGO::EXPRESS::ZEGO_VIDEO_FRAME_FORMAT_RGBA32) {
       flutterDesktopPixelBuffer_->buffer = srcBuffer_.data();
-    } else {
-      // Map buffers to structs for easier conversion.
-      switch (srcVideoFrameFormat_)
-      {
-      case ZEGO::EXPRESS::ZEGO_VIDEO_FRAME_FORMAT_BGRA32:
-          srcFrameFormatToFlutterFormat<VideoFormatBGRAPixel>();
-          flutterDesktopPixelBuffer_->buffer = destBuffer_.data();
-          break;
-      // case ZEGO::EXPRESS::ZEGO_VIDEO_FRAME_FORMAT_RGBA32:
-      //     {
-      //       // std::copy(srcBuffer_.data(), srcBuffer_.data() + srcBuffer_.size(), destBuffer_.data());
-      //       flutterDesktopPixelBuffer_->buffer = srcBuffer_.data();
-      //     }
-      //     break;
-      case ZEGO::EXPRESS::ZEGO_VIDEO_FRAME_FORMAT_ARGB32:
-          srcFrameFormatToFlutterFormat<VideoFormatARGBPixel>();
-          flutterDesktopPixelBuffer_->buffer = destBuffer_.data();
-          break;
-      case ZEGO::EXPRESS::ZEGO_VIDEO_FRAME_FORMAT_ABGR32:
-          srcFrameFormatToFlutterFormat<VideoFormatABGRPixel>();
-          flutterDesktopPixelBuffer_->buffer = destBuffer_.data();
-          break;   
-      default:
-          break;
-      }
+    } else if (convertFrame(srcBuffer_.data(), destBuffer_.data())) {
+      flutterDesktopPixelBuffer_->buffer = destBuffer_.data();
     }
 
     
@@ -170,13 +339,45 @@ const FlutterDesktopPixelBuffer* ZegoTextureRenderer::ConvertPixelBufferForFlutt
   return nullptr;
 }
 
+void ZegoTextureRenderer::CreatePixelBufferIfNeeded() {
+  if (!flutterDesktopPixelBuffer_) {
+    flutterDesktopPixelBuffer_ =
+        std::make_unique<FlutterDesktopPixelBuffer>();
+
+    // Unlocks mutex after texture is processed.
+    flutterDesktopPixelBuffer_->release_callback =
+        [](void* release_context) {
+          auto mutex = reinterpret_cast<std::mutex*>(release_context);
+          mutex->unlock();
+        };
+  }
+}
+
+bool ZegoTextureRenderer::convertFrame(const uint8_t *src, uint8_t *dst) {
+  // Map buffers to structs for easier conversion.
+  switch (srcVideoFrameFormat_)
+  {
+  case ZEGO::EXPRESS::ZEGO_VIDEO_FRAME_FORMAT_BGRA32:
+      srcFrameFormatToFlutterFormat<VideoFormatBGRAPixel>(src, dst);
+      return true;
+  case ZEGO::EXPRESS::ZEGO_VIDEO_FRAME_FORMAT_ARGB32:
+      srcFrameFormatToFlutterFormat<VideoFormatARGBPixel>(src, dst);
+      return true;
+  case ZEGO::EXPRESS::ZEGO_VIDEO_FRAME_FORMAT_ABGR32:
+      srcFrameFormatToFlutterFormat<VideoFormatABGRPixel>(src, dst);
+      return true;
+  default:
+      return false;
+  }
+}
+
 template<typename T>
-void ZegoTextureRenderer::srcFrameFormatToFlutterFormat() 
+void ZegoTextureRenderer::srcFrameFormatToFlutterFormat(const uint8_t *srcData, uint8_t *dstData)
 {
-    T* src =
-        reinterpret_cast<T*>(srcBuffer_.data());
+    const T* src =
+        reinterpret_cast<const T*>(srcData);
     FlutterDesktopPixel* dst =
-        reinterpret_cast<FlutterDesktopPixel*>(destBuffer_.data());
+        reinterpret_cast<FlutterDesktopPixel*>(dstData);
 
     for (uint32_t y = 0; y < height_; y++) {
       for (uint32_t x = 0; x < width_; x++) {
@@ -2,12 +2,17 @@
 
 #include <flutter/texture_registrar.h>
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
 
 #include <ZegoExpressSDK.h>
 
+class ZegoTextureFrameScheduler;
+class ZegoTextureRenderPrepWorker;
+
 // Describes flutter desktop pixelbuffers pixel data order.
 struct FlutterDesktopPixel {
   uint8_t r = 0;
@@ -47,7 +52,7 @@ struct VideoFormatABGRPixel {
 
 // Handles the registration of Flutter textures, pixel buffers, and the
 // conversion of texture formats.
-class ZegoTextureRenderer {
+class ZegoTextureRenderer : public std::enable_shared_from_this<ZegoTextureRenderer> {
  public:
   ZegoTextureRenderer(flutter::TextureRegistrar* texture_registrar, uint32_t width, uint32_t height);
       
@@ -76,9 +81,8 @@ class ZegoTextureRenderer {
     return std::pair<int32_t, int32_t>(width_, height_);
   }
 
-  inline const std::vector<uint8_t> * getFrame() {
-    return &srcBuffer_;
-  }
+  // Returns a copy of the latest frame for snapshots.
+  std::vector<uint8_t> getFrame();
 
   void setBackgroundColor(int colode) {}
   
@@ -92,20 +96,67 @@ class ZegoTextureRenderer {
 
   void setUseMirrorEffect(bool mirror) { isUseMirror_ = mirror; }
 
- private:
+  // Limits the rate at which new frames are accepted, 0 means unlimited.
+  void setMaxRenderFps(uint32_t fps) { maxRenderFps_ = fps; }
+
+  inline uint32_t getMaxRenderFps() {
+    return maxRenderFps_;
+  }
+
+  // Checks the frame arrival time against the given fps budget and returns
+  // false if the frame should be dropped before it is copied.
+  bool acceptFrame(uint32_t fpsLimit);
+
+  // Moves pixel conversion from the texture callback to the given worker,
+  // nullptr converts inside the texture callback again.
+  void setRenderPrepWorker(ZegoTextureRenderPrepWorker *worker);
+
+  // Converts frames while they are ingested instead of keeping a copy of the
+  // source frame, so each frame is only copied once before the upload.
+  void setSingleCopy(bool enable);
+
+  // Converts the latest source frame, called on the render-prep worker.
+  void prepareFrame();
+
+  // Defers marking new frames available to the given scheduler, nullptr
+  // marks them available as soon as the buffer is updated.
+  void setFrameScheduler(ZegoTextureFrameScheduler *scheduler) { frameScheduler_ = scheduler; }
+
   // Informs flutter texture registrar of updated texture.
+  void markFrameAvailable();
+
+  // Time spent in the texture callback, which runs on flutter's raster thread.
+  struct RasterStats {
+    uint64_t frameCount = 0;
+    uint64_t totalMicroseconds = 0;
+    uint64_t maxMicroseconds = 0;
+  };
+
+  RasterStats getRasterStats();
+
+ private:
+  // Marks texture frame available directly or through the frame scheduler.
   void OnBufferUpdated();
 
   // Converts local pixel buffer to flutter pixel buffer.
   const FlutterDesktopPixelBuffer* ConvertPixelBufferForFlutter(size_t width,
                                                                 size_t height);
 
+  // Creates the flutter pixel buffer which unlocks its mutex once uploaded.
+  void CreatePixelBufferIfNeeded();
+
   // Checks if texture registrar, texture id and texture are available.
   bool TextureRegistered() {
     return textureRegistrar_ && texture_ && textureID_ > -1;
   }
 
-  template<typename T> void srcFrameFormatToFlutterFormat();
+  // Converts a frame of srcVideoFrameFormat_ into flutter pixel order,
+  // returns false if the format is not supported.
+  bool convertFrame(const uint8_t *src, uint8_t *dst);
+
+  template<typename T> void srcFrameFormatToFlutterFormat(const uint8_t *src, uint8_t *dst);
+
+  void recordRasterTime(std::chrono::steady_clock::duration duration);
 
   bool isUseMirror_ = true;
   int64_t textureID_ = -1;
@@ -115,8 +166,32 @@ class ZegoTextureRenderer {
   ZEGO::EXPRESS::ZegoViewMode viewMode_ = ZEGO::EXPRESS::ZegoViewMode::ZEGO_VIEW_MODE_ASPECT_FIT;
   ZEGO::EXPRESS::ZegoVideoFrameFormat srcVideoFrameFormat_ = ZEGO::EXPRESS::ZEGO_VIDEO_FRAME_FORMAT_BGRA32;
 
+  std::atomic<uint32_t> maxRenderFps_ = 0;
+  std::chrono::steady_clock::time_point nextFrameTime_;
+
   std::vector<uint8_t> srcBuffer_;
   std::vector<uint8_t> destBuffer_;
+
+  // Single-copy mode: srcBuffer_ stays empty and destBuffer_ holds the
+  // converted frame.
+  bool isSingleCopy_ = false;
+  bool isDestMirrored_ = false;
+
+  // Render-prep mode: the worker converts into prepareBuffer_ and swaps it
+  // with preparedBuffer_, which the texture callback hands to flutter.
+  std::atomic<ZegoTextureRenderPrepWorker *> prepWorker_ = nullptr;
+  std::vector<uint8_t> prepareBuffer_;
+  std::vector<uint8_t> preparedBuffer_;
+  uint32_t preparedWidth_ = 0;
+  uint32_t preparedHeight_ = 0;
+  bool hasPreparedFrame_ = false;
+  std::mutex preparedMutex_;
+
+  std::atomic<ZegoTextureFrameScheduler *> frameScheduler_ = nullptr;
+
+  std::atomic<uint64_t> rasterFrameCount_ = 0;
+  std::atomic<uint64_t> rasterTotalMicroseconds_ = 0;
+  std::atomic<uint64_t> rasterMaxMicroseconds_ = 0;
   std::unique_ptr<flutter::TextureVariant> texture_;
   std::unique_ptr<FlutterDesktopPixelBuffer> flutterDesktopPixelBuffer_ =
       nullptr;
@@ -1,9 +1,13 @@
 #include "ZegoTextureRendererController.h"
 #include "../ZegoLog.h"
+#include "ZegoTaskExecutor.h"
 #include <flutter/standard_method_codec.h>
 
 using namespace ZEGO::EXPRESS;
 
+// Sound level (0 ~ 100) a remote stream must exceed to become the prioritized speaker.
+static const float kSpeakerPrioritySoundLevelThreshold = 5.0f;
+
 ZegoTextureRendererController::ZegoTextureRendererController(/* args */)
 {
 }
@@ -43,6 +47,11 @@ void ZegoTextureRendererController::init(flutter::BinaryMessenger *message)
 
 void ZegoTextureRendererController::uninit()
 {
+    enableRenderPrepWorker(false);
+    isSingleCopyEnabled_ = false;
+    enableFrameBatching(false, 0);
+    enableVideoHealthAnalyzer(false, 0, 0);
+
     {
         std::lock_guard<std::mutex> lock(rendersMutex_);
         capturedRenderers_.clear();
@@ -59,6 +68,15 @@ void ZegoTextureRendererController::uninit()
 int64_t ZegoTextureRendererController::createTextureRenderer(flutter::TextureRegistrar* texture_registrar, uint32_t width, uint32_t height)
 {
     auto textureRenderer = std::make_shared<ZegoTextureRenderer>(texture_registrar, width, height);
+    if (isRenderPrepEnabled_) {
+        textureRenderer->setRenderPrepWorker(&renderPrepWorker_);
+    }
+    if (isSingleCopyEnabled_) {
+        textureRenderer->setSingleCopy(true);
+    }
+    if (isFrameBatchingEnabled_) {
+        textureRenderer->setFrameScheduler(&frameScheduler_);
+    }
 
     ZF::logInfo("[createTextureRenderer] textureID: %d, width: %d, height: %d", textureRenderer->getTextureID(), width, height);
 
@@ -214,6 +232,187 @@ void ZegoTextureRendererController::setVideoSourceChannel(ZEGO::EXPRESS::ZegoPub
     }
 }
 
+bool ZegoTextureRendererController::setMaxRenderFps(int64_t textureID, uint32_t fps)
+{
+    ZF::logInfo("[setMaxRenderFps] textureID: %d, fps: %d", textureID, fps);
+
+    auto renderer = renderers_.find(textureID);
+    if (renderer == renderers_.end()) {
+        return false;
+    }
+
+    renderer->second->setMaxRenderFps(fps);
+    return true;
+}
+
+void ZegoTextureRendererController::setRenderFpsPolicy(ZegoTextureRenderFpsPolicy policy, uint32_t throttledFps)
+{
+    ZF::logInfo("[setRenderFpsPolicy] policy: %d, throttledFps: %d", policy, throttledFps);
+
+    std::lock_guard<std::mutex> lock(rendersMutex_);
+    fpsPolicy_ = policy;
+    throttledFps_ = throttledFps;
+}
+
+void ZegoTextureRendererController::enableRenderPrepWorker(bool enable)
+{
+    ZF::logInfo("[enableRenderPrepWorker] enable: %d", enable);
+
+    if (enable == isRenderPrepEnabled_) {
+        return;
+    }
+    isRenderPrepEnabled_ = enable;
+
+    if (enable) {
+        renderPrepWorker_.start();
+    }
+    for (auto const& renderer : renderers_) {
+        renderer.second->setRenderPrepWorker(enable ? &renderPrepWorker_ : nullptr);
+    }
+    if (!enable) {
+        renderPrepWorker_.stop();
+    }
+}
+
+void ZegoTextureRendererController::enableSingleCopy(bool enable)
+{
+    ZF::logInfo("[enableSingleCopy] enable: %d", enable);
+
+    isSingleCopyEnabled_ = enable;
+    for (auto const& renderer : renderers_) {
+        renderer.second->setSingleCopy(enable);
+    }
+}
+
+void ZegoTextureRendererController::enableFrameBatching(bool enable, uint32_t intervalMs)
+{
+    ZF::logInfo("[enableFrameBatching] enable: %d, intervalMs: %d", enable, intervalMs);
+
+    if (!enable && !isFrameBatchingEnabled_) {
+        return;
+    }
+    isFrameBatchingEnabled_ = enable;
+
+    if (enable) {
+        // Restarts with the new interval if already running.
+        frameScheduler_.start(intervalMs);
+    }
+    for (auto const& renderer : renderers_) {
+        renderer.second->setFrameScheduler(enable ? &frameScheduler_ : nullptr);
+    }
+    if (!enable) {
+        frameScheduler_.stop();
+    }
+}
+
+flutter::EncodableMap ZegoTextureRendererController::getRendererStats(int64_t textureID)
+{
+    flutter::EncodableMap map;
+    auto renderer = renderers_.find(textureID);
+    if (renderer == renderers_.end()) {
+        return map;
+    }
+
+    auto stats = renderer->second->getRasterStats();
+    map[flutter::EncodableValue("rasterFrameCount")] = flutter::EncodableValue((int64_t)stats.frameCount);
+    map[flutter::EncodableValue("rasterTotalMicroseconds")] = flutter::EncodableValue((int64_t)stats.totalMicroseconds);
+    map[flutter::EncodableValue("rasterMaxMicroseconds")] = flutter::EncodableValue((int64_t)stats.maxMicroseconds);
+    return map;
+}
+
+void ZegoTextureRendererController::enableVideoHealthAnalyzer(bool enable, uint32_t freezeThresholdMs, uint32_t sampleInterval)
+{
+    ZF::logInfo("[enableVideoHealthAnalyzer] enable: %d, freezeThresholdMs: %d, sampleInterval: %d", enable, freezeThresholdMs, sampleInterval);
+
+    isVideoHealthEnabled_ = false;
+    videoHealthAnalyzer_.stop();
+    if (!enable) {
+        return;
+    }
+
+    videoHealthAnalyzer_.start(freezeThresholdMs, sampleInterval, [this](const std::string &streamID, ZegoVideoHealthEvent event, uint32_t durationMs) {
+        if (hasEventSink_) {
+            flutter::EncodableMap map;
+            map[flutter::EncodableValue("type")] = flutter::EncodableValue("videoHealth");
+            map[flutter::EncodableValue("streamID")] = flutter::EncodableValue(streamID);
+            map[flutter::EncodableValue("event")] = flutter::EncodableValue((int32_t)event);
+            map[flutter::EncodableValue("duration")] = flutter::EncodableValue((int32_t)durationMs);
+            postEvent(std::move(map));
+        }
+    });
+    isVideoHealthEnabled_ = true;
+}
+
+flutter::EncodableMap ZegoTextureRendererController::getVideoHealthSummary(const std::string &streamID)
+{
+    flutter::EncodableMap map;
+    ZegoVideoHealthSummary summary;
+    if (!videoHealthAnalyzer_.getSummary(streamID, summary)) {
+        return map;
+    }
+
+    flutter::EncodableList jitterHistogram;
+    for (auto count : summary.jitterHistogram) {
+        jitterHistogram.emplace_back(flutter::EncodableValue((int64_t)count));
+    }
+
+    map[flutter::EncodableValue("frameCount")] = flutter::EncodableValue((int64_t)summary.frameCount);
+    map[flutter::EncodableValue("averageInterval")] = flutter::EncodableValue(summary.averageIntervalMs);
+    map[flutter::EncodableValue("jitterHistogram")] = flutter::EncodableValue(jitterHistogram);
+    map[flutter::EncodableValue("freezeCount")] = flutter::EncodableValue((int32_t)summary.freezeCount);
+    map[flutter::EncodableValue("totalFreezeDuration")] = flutter::EncodableValue((int64_t)summary.totalFreezeMs);
+    map[flutter::EncodableValue("isFrozen")] = flutter::EncodableValue(summary.isFrozen);
+    map[flutter::EncodableValue("sampledFrameCount")] = flutter::EncodableValue((int64_t)summary.sampledFrameCount);
+    map[flutter::EncodableValue("blackFrameCount")] = flutter::EncodableValue((int64_t)summary.blackFrameCount);
+    map[flutter::EncodableValue("uniformFrameCount")] = flutter::EncodableValue((int64_t)summary.uniformFrameCount);
+    return map;
+}
+
+void ZegoTextureRendererController::removeVideoHealthStream(const std::string &streamID)
+{
+    videoHealthAnalyzer_.removeStream(streamID);
+}
+
+void ZegoTextureRendererController::updateRemoteSoundLevels(const std::unordered_map<std::string, float> &soundLevels)
+{
+    std::lock_guard<std::mutex> lock(rendersMutex_);
+    if (fpsPolicy_ != ZEGO_TEXTURE_RENDER_FPS_POLICY_SPEAKER_PRIORITY) {
+        return;
+    }
+
+    // Keep the last speaker prioritized while the room is silent.
+    float loudestLevel = kSpeakerPrioritySoundLevelThreshold;
+    for (auto const& soundLevel : soundLevels) {
+        if (soundLevel.second > loudestLevel) {
+            loudestLevel = soundLevel.second;
+            loudestStreamID_ = soundLevel.first;
+        }
+    }
+}
+
+void ZegoTextureRendererController::postEvent(flutter::EncodableMap &&event)
+{
+    // The sink is not thread safe, and may be replaced or cleared by the
+    // time the task runs.
+    auto value = std::make_shared<flutter::EncodableValue>(std::move(event));
+    ZegoTaskExecutor::getInstance().postToPlatform([this, value]() {
+        std::lock_guard<std::mutex> lock(eventSinkMutex_);
+        if (eventSink_) {
+            eventSink_->Success(*value);
+        }
+    });
+}
+
+uint32_t ZegoTextureRendererController::getRemoteFpsLimit(const std::string &streamID, const std::shared_ptr<ZegoTextureRenderer> &renderer)
+{
+    uint32_t fps = renderer->getMaxRenderFps();
+    if (fpsPolicy_ == ZEGO_TEXTURE_RENDER_FPS_POLICY_SPEAKER_PRIORITY && throttledFps_ > 0 && streamID != loudestStreamID_) {
+        if (fps == 0 || fps > throttledFps_) {
+            fps = throttledFps_;
+        }
+    }
+    return fps;
+}
 
 void ZegoTextureRendererController::sendScreenCapturedVideoFrameRawData(unsigned char ** data,
                                         unsigned int * dataLength,
@@ -242,9 +441,10 @@ void ZegoTextureRendererController::onCapturedVideoFrameRawData(unsigned char **
     {
         std::lock_guard<std::mutex> lock(rendersMutex_);
         auto renderer = capturedRenderers_.find(channel);
-        if (renderer != capturedRenderers_.end()) {
+        // Frames over the texture's fps budget are dropped before any copy.
+        if (renderer != capturedRenderers_.end() && renderer->second->acceptFrame(renderer->second->getMaxRenderFps())) {
             bool isMirror = flipMode == ZEGO_VIDEO_FLIP_MODE_X;
-            if (eventSink_) {
+            if (hasEventSink_) {
                 auto size = renderer->second->getSize();
                 
                 if (size.first != param.width || size.second != param.height || renderer->second->getUseMirrorEffect() != isMirror) {
@@ -254,7 +454,7 @@ void ZegoTextureRendererController::onCapturedVideoFrameRawData(unsigned char **
                     map[flutter::EncodableValue("width")] =  flutter::EncodableValue(param.width);
                     map[flutter::EncodableValue("height")] =  flutter::EncodableValue(param.height);
                     map[flutter::EncodableValue("isMirror")] =  flutter::EncodableValue(isMirror ? 1 : 0);
-                    eventSink_->Success(map);
+                    postEvent(std::move(map));
                 }
             }
 
@@ -290,11 +490,16 @@ void ZegoTextureRendererController::onRemoteVideoFrameRawData(unsigned char ** d
                                            ZegoVideoFrameParam param,
                                            const std::string & streamID)
 {
+    if (isVideoHealthEnabled_) {
+        auto alphaIndex = (param.format == ZEGO_VIDEO_FRAME_FORMAT_ARGB32 || param.format == ZEGO_VIDEO_FRAME_FORMAT_ABGR32) ? 0 : 3;
+        videoHealthAnalyzer_.onFrame(streamID, data[0], param.width, param.height, param.strides[0], alphaIndex);
+    }
+
     {
         std::lock_guard<std::mutex> lock(rendersMutex_);
         auto renderer = remoteRenderers_.find(streamID);
-        if (renderer != remoteRenderers_.end()) {
-            if (eventSink_) {
+        if (renderer != remoteRenderers_.end() && renderer->second->acceptFrame(getRemoteFpsLimit(streamID, renderer->second))) {
+            if (hasEventSink_) {
                 auto size = renderer->second->getSize();
                 if (size.first != param.width || size.second != param.height) {
                     flutter::EncodableMap map;
@@ -302,7 +507,7 @@ void ZegoTextureRendererController::onRemoteVideoFrameRawData(unsigned char ** d
                     map[flutter::EncodableValue("textureID")] =  flutter::EncodableValue(renderer->second->getTextureID());
                     map[flutter::EncodableValue("width")] =  flutter::EncodableValue(param.width);
                     map[flutter::EncodableValue("height")] =  flutter::EncodableValue(param.height);
-                    eventSink_->Success(map);
+                    postEvent(std::move(map));
                 }
             }
 
@@ -350,8 +555,8 @@ void ZegoTextureRendererController::onVideoFrame(ZEGO::EXPRESS::IZegoMediaPlayer
     {
         std::lock_guard<std::mutex> lock(rendersMutex_);
         auto renderer = mediaPlayerRenderers_.find(mediaPlayer);
-        if (renderer != mediaPlayerRenderers_.end()) {
-            if (eventSink_) {
+        if (renderer != mediaPlayerRenderers_.end() && renderer->second->acceptFrame(renderer->second->getMaxRenderFps())) {
+            if (hasEventSink_) {
                 auto size = renderer->second->getSize();
                 if (size.first != param.width || size.second != param.height) {
                     flutter::EncodableMap map;
@@ -359,7 +564,7 @@ void ZegoTextureRendererController::onVideoFrame(ZEGO::EXPRESS::IZegoMediaPlayer
                     map[flutter::EncodableValue("textureID")] =  flutter::EncodableValue(renderer->second->getTextureID());
                     map[flutter::EncodableValue("width")] =  flutter::EncodableValue(param.width);
                     map[flutter::EncodableValue("height")] =  flutter::EncodableValue(param.height);
-                    eventSink_->Success(map);
+                    postEvent(std::move(map));
                 }
             }
             renderer->second->updateSrcFrameBuffer((uint8_t *)data[0], dataLength[0], param);
@@ -389,12 +594,12 @@ std::pair<int32_t, int32_t> ZegoTextureRendererController::getMediaPlayerSize(ZE
     return std::pair(0, 0);
 }
 
-const std::vector<uint8_t> *ZegoTextureRendererController::getMediaPlayerFrame(ZEGO::EXPRESS::IZegoMediaPlayer *mediaPlayer)
+std::vector<uint8_t> ZegoTextureRendererController::getMediaPlayerFrame(ZEGO::EXPRESS::IZegoMediaPlayer *mediaPlayer)
 {
     std::lock_guard<std::mutex> lock(rendersMutex_);
     auto renderer = mediaPlayerRenderers_.find(mediaPlayer);
     if (renderer != mediaPlayerRenderers_.end()) {
         return renderer->second->getFrame();
     }
-    return nullptr;
+    return std::vector<uint8_t>();
 }
\ No newline at end of file
@@ -1,14 +1,28 @@
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 #include <flutter/event_channel.h>
 
 
 #include "ZegoTextureRenderer.h"
+#include "ZegoTextureFrameScheduler.h"
+#include "ZegoTextureRenderPrepWorker.h"
+#include "ZegoVideoHealthAnalyzer.h"
 
 class ZegoTextureRendererControllerEventChannel;
 
+/// How the controller distributes frame rate between remote renderers.
+enum ZegoTextureRenderFpsPolicy {
+    /// Every texture runs at its own `maxRenderFps`.
+    ZEGO_TEXTURE_RENDER_FPS_POLICY_NONE = 0,
+
+    /// The loudest remote stream runs at its own `maxRenderFps`, the other
+    /// remote streams are additionally capped at the throttled fps.
+    ZEGO_TEXTURE_RENDER_FPS_POLICY_SPEAKER_PRIORITY = 1
+};
+
 class ZegoTextureRendererController : public ZEGO::EXPRESS::IZegoCustomVideoRenderHandler, 
     public ZEGO::EXPRESS::IZegoMediaPlayerVideoHandler
 {
@@ -24,9 +38,13 @@ public:
     }
 
     inline void setEventSink(std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> &&eventSink) {
+        std::lock_guard<std::mutex> lock(eventSinkMutex_);
         eventSink_ = std::move(eventSink);
+        hasEventSink_ = eventSink_ != nullptr;
     }
     inline void clearEventSink() {
+        std::lock_guard<std::mutex> lock(eventSinkMutex_);
+        hasEventSink_ = false;
         eventSink_.reset();
     }
 
@@ -57,7 +75,7 @@ public:
 
     /// Called when dart invoke `mediaPlayerTakeSnapshot`
     std::pair<int32_t, int32_t> getMediaPlayerSize(ZEGO::EXPRESS::IZegoMediaPlayer *mediaPlayer);
-    const std::vector<uint8_t> *getMediaPlayerFrame(ZEGO::EXPRESS::IZegoMediaPlayer *mediaPlayer);
+    std::vector<uint8_t> getMediaPlayerFrame(ZEGO::EXPRESS::IZegoMediaPlayer *mediaPlayer);
 
     /// For video preview/play
     void startRendering();
@@ -77,6 +95,36 @@ public:
     /// Called when dart invoke `setVideoSource`
     void setVideoSourceChannel(ZEGO::EXPRESS::ZegoPublishChannel channel, ZEGO::EXPRESS::ZegoVideoSourceType sourceType);
 
+    /// Called when dart invoke `setTextureRendererMaxFps`
+    bool setMaxRenderFps(int64_t textureID, uint32_t fps);
+
+    /// Called when dart invoke `setTextureRendererFpsPolicy`
+    void setRenderFpsPolicy(ZegoTextureRenderFpsPolicy policy, uint32_t throttledFps);
+
+    /// Called when dart invoke `enableTextureRendererPrepWorker`
+    void enableRenderPrepWorker(bool enable);
+
+    /// Called when dart invoke `enableTextureRendererSingleCopy`
+    void enableSingleCopy(bool enable);
+
+    /// Called when dart invoke `enableTextureRendererFrameBatching`
+    void enableFrameBatching(bool enable, uint32_t intervalMs);
+
+    /// Called when dart invoke `getTextureRendererStats`
+    flutter::EncodableMap getRendererStats(int64_t textureID);
+
+    /// Called when dart invoke `enableVideoHealthAnalyzer`
+    void enableVideoHealthAnalyzer(bool enable, uint32_t freezeThresholdMs, uint32_t sampleInterval);
+
+    /// Called when dart invoke `getVideoHealthSummary`
+    flutter::EncodableMap getVideoHealthSummary(const std::string &streamID);
+
+    /// Called when dart invoke `stopPlayingStream`
+    void removeVideoHealthStream(const std::string &streamID);
+
+    /// Called by the event handler when remote sound levels are updated
+    void updateRemoteSoundLevels(const std::unordered_map<std::string, float> &soundLevels);
+
 public:
     void sendScreenCapturedVideoFrameRawData(unsigned char ** data,
                                         unsigned int * dataLength,
@@ -110,6 +158,12 @@ protected:
                               unsigned int * dataLength, ZEGO::EXPRESS::ZegoVideoFrameParam param,
                               const char * extraInfo) override;
 private:
+    // Returns the fps budget of a remote renderer after applying the fps policy.
+    uint32_t getRemoteFpsLimit(const std::string &streamID, const std::shared_ptr<ZegoTextureRenderer> &renderer);
+
+    // Sends the event to dart on the platform thread.
+    void postEvent(flutter::EncodableMap &&event);
+
     std::unordered_map<int64_t , bool> alphaRenders_;
     std::unordered_map<int64_t , std::shared_ptr<ZegoTextureRenderer> > renderers_;
     std::unordered_map<ZEGO::EXPRESS::ZegoPublishChannel , std::shared_ptr<ZegoTextureRenderer> > capturedRenderers_;
@@ -119,9 +173,27 @@ private:
 
     std::atomic_bool isInit = false;
 
+    ZegoTextureRenderFpsPolicy fpsPolicy_ = ZEGO_TEXTURE_RENDER_FPS_POLICY_NONE;
+    uint32_t throttledFps_ = 0;
+    std::string loudestStreamID_;
+
+    bool isRenderPrepEnabled_ = false;
+    bool isSingleCopyEnabled_ = false;
+    ZegoTextureRenderPrepWorker renderPrepWorker_;
+
+    bool isFrameBatchingEnabled_ = false;
+    ZegoTextureFrameScheduler frameScheduler_;
+
+    std::atomic_bool isVideoHealthEnabled_ = false;
+    ZegoVideoHealthAnalyzer videoHealthAnalyzer_;
+
     std::shared_ptr<ZEGO::EXPRESS::IZegoMediaPlayerVideoHandler> mediaPlayerHandler_ = nullptr;
     std::shared_ptr<ZEGO::EXPRESS::IZegoCustomVideoRenderHandler> videoRenderHandler_ = nullptr;
 
+    // Frame and health callbacks run on SDK threads, so events go through
+    // postEvent to the platform thread and only check hasEventSink_ there.
+    std::mutex eventSinkMutex_;
+    std::atomic_bool hasEventSink_ = false;
     std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> eventSink_;
     std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>> eventChannel_;
 
@@ -0,0 +1,297 @@
+#include "ZegoVideoHealthAnalyzer.h"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define ZEGO_VIDEO_HEALTH_USE_SSE2 1
+#endif
+
+// The sampler reads up to kSampleRows rows, kSampleChunks chunks of 4 pixels
+// each, frames shorter than kSampleRows have fewer rows.
+static const uint32_t kSampleRows = 16;
+static const uint32_t kSampleChunks = 16;
+// Color channels of a chunk, alpha is ignored.
+static const uint32_t kChunkChannels = 4 * 3;
+
+// Mean channel value (0 ~ 255) below which a sampled frame counts as black.
+static const uint32_t kBlackMeanThreshold = 20;
+
+// Mean channel deviation from the first sampled pixel below which a sampled
+// frame counts as a single color.
+static const uint32_t kUniformDeviationThreshold = 6;
+
+ZegoVideoHealthAnalyzer::~ZegoVideoHealthAnalyzer() {
+  stop();
+}
+
+void ZegoVideoHealthAnalyzer::start(uint32_t freezeThresholdMs, uint32_t sampleInterval, EventCallback callback) {
+  stop();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  freezeThresholdMs_ = freezeThresholdMs > 0 ? freezeThresholdMs : 500;
+  sampleInterval_ = sampleInterval > 0 ? sampleInterval : 10;
+  callback_ = std::move(callback);
+  running_ = true;
+  thread_ = std::thread(&ZegoVideoHealthAnalyzer::run, this);
+}
+
+void ZegoVideoHealthAnalyzer::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_) {
+      return;
+    }
+    running_ = false;
+  }
+  condition_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  streams_.clear();
+  callback_ = nullptr;
+}
+
+bool ZegoVideoHealthAnalyzer::isRunning() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return running_;
+}
+
+void ZegoVideoHealthAnalyzer::onFrame(const std::string &streamID, const uint8_t *data, uint32_t width,
+                                      uint32_t height, uint32_t stride, uint32_t alphaIndex) {
+  auto now = std::chrono::steady_clock::now();
+  std::vector<PendingEvent> events;
+  EventCallback callback;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_) {
+      return;
+    }
+
+    auto result = streams_.emplace(streamID, StreamState());
+    auto &state = result.first->second;
+    if (result.second) {
+      state.lastContentChangeTime = now;
+    } else {
+      auto intervalMs = std::chrono::duration<double, std::milli>(now - state.lastFrameTime).count();
+      // Stalls are reported as freezes, they would only skew the interval.
+      if (intervalMs < freezeThresholdMs_) {
+        if (state.averageIntervalMs > 0) {
+          auto jitterMs = intervalMs > state.averageIntervalMs ? intervalMs - state.averageIntervalMs
+                                                               : state.averageIntervalMs - intervalMs;
+          size_t bucket = 0;
+          while (bucket < kZegoVideoHealthJitterBucketBounds.size() &&
+                 jitterMs >= kZegoVideoHealthJitterBucketBounds[bucket]) {
+            bucket++;
+          }
+          state.summary.jitterHistogram[bucket]++;
+          state.averageIntervalMs += (intervalMs - state.averageIntervalMs) / 8;
+        } else {
+          state.averageIntervalMs = intervalMs;
+        }
+      }
+    }
+    state.lastFrameTime = now;
+    state.summary.frameCount++;
+
+    if (state.freezeReason == FREEZE_STALL) {
+      endFreeze(streamID, state, now, events);
+    }
+
+    // Frozen content is sampled on every frame so that recovery is prompt.
+    if (state.framesUntilSample == 0 || state.freezeReason == FREEZE_CONTENT) {
+      state.framesUntilSample = sampleInterval_ - 1;
+
+      auto sample = sampleFrame(data, width, height, stride, alphaIndex);
+      state.summary.sampledFrameCount++;
+
+      if (sample.signature != state.lastSignature) {
+        state.lastSignature = sample.signature;
+        state.lastContentChangeTime = now;
+        if (state.freezeReason == FREEZE_CONTENT) {
+          endFreeze(streamID, state, now, events);
+        }
+      }
+
+      auto contentState = CONTENT_NORMAL;
+      if (sample.meanDeviation < kUniformDeviationThreshold) {
+        contentState = sample.meanChannel < kBlackMeanThreshold ? CONTENT_BLACK : CONTENT_UNIFORM;
+      }
+      if (contentState == CONTENT_BLACK) {
+        state.summary.blackFrameCount++;
+      } else if (contentState == CONTENT_UNIFORM) {
+        state.summary.uniformFrameCount++;
+      }
+      if (contentState != state.contentState) {
+        state.contentState = contentState;
+        auto event = contentState == CONTENT_BLACK     ? ZEGO_VIDEO_HEALTH_EVENT_BLACK
+                     : contentState == CONTENT_UNIFORM ? ZEGO_VIDEO_HEALTH_EVENT_UNIFORM
+                                                       : ZEGO_VIDEO_HEALTH_EVENT_CONTENT_RECOVERED;
+        events.push_back({streamID, event, 0});
+      }
+    } else {
+      state.framesUntilSample--;
+    }
+
+    if (!events.empty()) {
+      callback = callback_;
+    }
+  }
+  dispatch(callback, events);
+}
+
+void ZegoVideoHealthAnalyzer::removeStream(const std::string &streamID) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  streams_.erase(streamID);
+}
+
+bool ZegoVideoHealthAnalyzer::getSummary(const std::string &streamID, ZegoVideoHealthSummary &summary) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto stream = streams_.find(streamID);
+  if (stream == streams_.end()) {
+    return false;
+  }
+
+  summary = stream->second.summary;
+  summary.averageIntervalMs = stream->second.averageIntervalMs;
+  if (summary.isFrozen) {
+    summary.totalFreezeMs += std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - stream->second.freezeBeginTime).count();
+  }
+  return true;
+}
+
+ZegoVideoHealthAnalyzer::FrameSample ZegoVideoHealthAnalyzer::sampleFrame(const uint8_t *data, uint32_t width, uint32_t height,
+                                                                          uint32_t stride, uint32_t alphaIndex) {
+  FrameSample sample;
+  if (!data || width < 4 || height == 0 || stride < width * 4) {
+    return sample;
+  }
+
+  uint64_t channelSum = 0;
+  uint64_t deviationSum = 0;
+  uint32_t signature = 0;
+  uint32_t sampledChunks = 0;
+
+  // Chunks of 4 pixels spread evenly over the sampled rows.
+  auto chunkStep = (width - 4) / (kSampleChunks - 1) * 4;
+  auto rowStep = height > kSampleRows ? height / kSampleRows : 1;
+
+#ifdef ZEGO_VIDEO_HEALTH_USE_SSE2
+  uint32_t alphaMaskBits = 0xFFFFFFFFu & ~(0xFFu << (alphaIndex * 8));
+  auto colorMask = _mm_set1_epi32((int)alphaMaskBits);
+  auto zero = _mm_setzero_si128();
+  uint32_t firstPixel = 0;
+  memcpy(&firstPixel, data, sizeof(firstPixel));
+  auto reference = _mm_set1_epi32((int)(firstPixel & alphaMaskBits));
+
+  for (uint32_t row = 0; row < kSampleRows && row * rowStep < height; row++) {
+    auto rowData = data + (size_t)row * rowStep * stride;
+    for (uint32_t chunk = 0; chunk < kSampleChunks; chunk++) {
+      auto pixels = _mm_and_si128(_mm_loadu_si128((const __m128i *)(rowData + chunk * chunkStep)), colorMask);
+
+      auto sum = _mm_sad_epu8(pixels, zero);
+      channelSum += (uint32_t)_mm_cvtsi128_si32(sum) + (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(sum, 8));
+
+      auto deviation = _mm_sad_epu8(pixels, reference);
+      deviationSum += (uint32_t)_mm_cvtsi128_si32(deviation) + (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(deviation, 8));
+
+      auto folded = _mm_xor_si128(pixels, _mm_srli_si128(pixels, 8));
+      folded = _mm_xor_si128(folded, _mm_srli_si128(folded, 4));
+      signature = ((signature << 7) | (signature >> 25)) ^ (uint32_t)_mm_cvtsi128_si32(folded);
+      sampledChunks++;
+    }
+  }
+#else
+  auto reference = data;
+  for (uint32_t row = 0; row < kSampleRows && row * rowStep < height; row++) {
+    auto rowData = data + (size_t)row * rowStep * stride;
+    for (uint32_t chunk = 0; chunk < kSampleChunks; chunk++) {
+      auto pixels = rowData + chunk * chunkStep;
+      uint32_t folded = 0;
+      for (uint32_t i = 0; i < 16; i++) {
+        if (i % 4 == alphaIndex) {
+          continue;
+        }
+        channelSum += pixels[i];
+        deviationSum += pixels[i] > reference[i % 4] ? pixels[i] - reference[i % 4] : reference[i % 4] - pixels[i];
+        folded ^= (uint32_t)pixels[i] << ((i % 4) * 8);
+      }
+      signature = ((signature << 7) | (signature >> 25)) ^ folded;
+      sampledChunks++;
+    }
+  }
+#endif
+
+  auto sampledChannels = sampledChunks * kChunkChannels;
+  sample.meanChannel = (uint32_t)(channelSum / sampledChannels);
+  sample.meanDeviation = (uint32_t)(deviationSum / sampledChannels);
+  sample.signature = signature;
+  return sample;
+}
+
+void ZegoVideoHealthAnalyzer::run() {
+  while (true) {
+    std::vector<PendingEvent> events;
+    EventCallback callback;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto checkInterval = std::chrono::milliseconds(freezeThresholdMs_ / 2 > 10 ? freezeThresholdMs_ / 2 : 10);
+      if (condition_.wait_for(lock, checkInterval, [this] { return !running_; })) {
+        break;
+      }
+
+      auto now = std::chrono::steady_clock::now();
+      auto freezeThreshold = std::chrono::milliseconds(freezeThresholdMs_);
+      for (auto &stream : streams_) {
+        auto &state = stream.second;
+        if (state.freezeReason != FREEZE_NONE) {
+          continue;
+        }
+
+        // Content is only compared every sampleInterval_ frames, so allow
+        // for the sampling gap before calling identical content a freeze.
+        auto contentThreshold = freezeThreshold + std::chrono::milliseconds(
+            (int64_t)(state.averageIntervalMs * sampleInterval_));
+        if (now - state.lastFrameTime > freezeThreshold) {
+          state.freezeReason = FREEZE_STALL;
+          state.freezeBeginTime = state.lastFrameTime;
+        } else if (now - state.lastContentChangeTime > contentThreshold) {
+          state.freezeReason = FREEZE_CONTENT;
+          state.freezeBeginTime = state.lastContentChangeTime;
+        } else {
+          continue;
+        }
+        state.summary.isFrozen = true;
+        state.summary.freezeCount++;
+        events.push_back({stream.first, ZEGO_VIDEO_HEALTH_EVENT_FREEZE, (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+            now - state.freezeBeginTime).count()});
+      }
+      if (!events.empty()) {
+        callback = callback_;
+      }
+    }
+    dispatch(callback, events);
+  }
+}
+
+void ZegoVideoHealthAnalyzer::endFreeze(const std::string &streamID, StreamState &state,
+                                        std::chrono::steady_clock::time_point now, std::vector<PendingEvent> &events) {
+  auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - state.freezeBeginTime).count();
+  state.freezeReason = FREEZE_NONE;
+  state.summary.isFrozen = false;
+  state.summary.totalFreezeMs += durationMs;
+  state.lastContentChangeTime = now;
+  events.push_back({streamID, ZEGO_VIDEO_HEALTH_EVENT_FREEZE_RECOVERED, (uint32_t)durationMs});
+}
+
+void ZegoVideoHealthAnalyzer::dispatch(const EventCallback &callback, const std::vector<PendingEvent> &events) {
+  if (!callback) {
+    return;
+  }
+  for (auto const& event : events) {
+    callback(event.streamID, event.event, event.durationMs);
+  }
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+enum ZegoVideoHealthEvent {
+    /// No new frame, or no new content, for longer than the freeze threshold.
+    /// Only pixels are compared, so a still image that keeps arriving (e.g. a
+    /// shared slide) cannot be told apart from a stuck stream and counts as
+    /// frozen content too.
+    ZEGO_VIDEO_HEALTH_EVENT_FREEZE = 0,
+
+    /// New content arrives again after a freeze, carries the freeze duration.
+    ZEGO_VIDEO_HEALTH_EVENT_FREEZE_RECOVERED = 1,
+
+    /// The sampled frames became black.
+    ZEGO_VIDEO_HEALTH_EVENT_BLACK = 2,
+
+    /// The sampled frames became a single uniform color other than black.
+    ZEGO_VIDEO_HEALTH_EVENT_UNIFORM = 3,
+
+    /// The sampled frames show regular content again.
+    ZEGO_VIDEO_HEALTH_EVENT_CONTENT_RECOVERED = 4
+};
+
+/// Upper bounds (ms) of the jitter histogram buckets, the last bucket is open.
+static const std::array<uint32_t, 6> kZegoVideoHealthJitterBucketBounds = {2, 5, 10, 20, 50, 100};
+
+struct ZegoVideoHealthSummary {
+    uint64_t frameCount = 0;
+    uint64_t sampledFrameCount = 0;
+    uint64_t blackFrameCount = 0;
+    uint64_t uniformFrameCount = 0;
+    uint32_t freezeCount = 0;
+    uint64_t totalFreezeMs = 0;
+    bool isFrozen = false;
+    double averageIntervalMs = 0;
+    std::array<uint64_t, kZegoVideoHealthJitterBucketBounds.size() + 1> jitterHistogram = {};
+};
+
+// Tracks arrival jitter, freezes and black/uniform frames per stream. Only
+// every Kth frame is sampled and only a fixed grid of pixels is read, so it
+// is cheap enough to stay on for every played stream.
+class ZegoVideoHealthAnalyzer {
+ public:
+  using EventCallback = std::function<void(const std::string &streamID, ZegoVideoHealthEvent event, uint32_t durationMs)>;
+
+  ZegoVideoHealthAnalyzer() = default;
+  ~ZegoVideoHealthAnalyzer();
+
+  // Prevent copying.
+  ZegoVideoHealthAnalyzer(ZegoVideoHealthAnalyzer const&) = delete;
+  ZegoVideoHealthAnalyzer& operator=(ZegoVideoHealthAnalyzer const&) = delete;
+
+  void start(uint32_t freezeThresholdMs, uint32_t sampleInterval, EventCallback callback);
+
+  void stop();
+
+  bool isRunning();
+
+  // Called for every frame of a stream with 32-bit pixels, alphaIndex is the
+  // byte offset of the alpha channel which is ignored by the sampler.
+  void onFrame(const std::string &streamID, const uint8_t *data, uint32_t width,
+               uint32_t height, uint32_t stride, uint32_t alphaIndex);
+
+  void removeStream(const std::string &streamID);
+
+  bool getSummary(const std::string &streamID, ZegoVideoHealthSummary &summary);
+
+ private:
+  enum ContentState { CONTENT_NORMAL, CONTENT_BLACK, CONTENT_UNIFORM };
+  enum FreezeReason { FREEZE_NONE, FREEZE_STALL, FREEZE_CONTENT };
+
+  struct FrameSample {
+    uint32_t meanChannel = 0;
+    uint32_t meanDeviation = 0;
+    uint32_t signature = 0;
+  };
+
+  struct StreamState {
+    ZegoVideoHealthSummary summary;
+    std::chrono::steady_clock::time_point lastFrameTime;
+    // Last time the sampled content changed, to detect frozen content.
+    std::chrono::steady_clock::time_point lastContentChangeTime;
+    std::chrono::steady_clock::time_point freezeBeginTime;
+    double averageIntervalMs = 0;
+    uint32_t lastSignature = 0;
+    uint32_t framesUntilSample = 0;
+    ContentState contentState = CONTENT_NORMAL;
+    FreezeReason freezeReason = FREEZE_NONE;
+  };
+
+  struct PendingEvent {
+    std::string streamID;
+    ZegoVideoHealthEvent event;
+    uint32_t durationMs;
+  };
+
+  static FrameSample sampleFrame(const uint8_t *data, uint32_t width, uint32_t height,
+                                 uint32_t stride, uint32_t alphaIndex);
+
+  void run();
+
+  void endFreeze(const std::string &streamID, StreamState &state,
+                 std::chrono::steady_clock::time_point now, std::vector<PendingEvent> &events);
+
+  static void dispatch(const EventCallback &callback, const std::vector<PendingEvent> &events);
+
+  bool running_ = false;
+  uint32_t freezeThresholdMs_ = 500;
+  uint32_t sampleInterval_ = 10;
+  EventCallback callback_;
+  std::unordered_map<std::string, StreamState> streams_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::thread thread_;
+};
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "ZegoAudioDataRing.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+constexpr int32_t kCapturedSource = 1;
+constexpr int32_t kPlayerSource = 8;
+
+// Header fields as dart reads them, see ZegoAudioDataRing.h.
+struct RingView {
+  explicit RingView(int64_t address) : base(reinterpret_cast<uint8_t *>(address)) {}
+
+  uint32_t field(int index) const { return reinterpret_cast<const uint32_t *>(base)[index]; }
+  std::atomic<uint64_t> &position(int index) const {
+    return reinterpret_cast<std::atomic<uint64_t> *>(base)[index];
+  }
+  uint8_t *buffer() const { return base + field(1); }
+
+  // Reads the oldest record like the dart reader does.
+  bool readFrame(std::vector<uint8_t> &data, uint32_t &sampleRate) const {
+    auto readPosition = position(16).load();
+    if (readPosition == position(8).load(std::memory_order_acquire)) {
+      return false;
+    }
+    auto capacity = field(2);
+    auto offset = (uint32_t)(readPosition % capacity);
+    uint32_t recordHeader[4];
+    memcpy(recordHeader, buffer() + offset, sizeof(recordHeader));
+    sampleRate = recordHeader[1];
+    data.resize(recordHeader[0]);
+    for (uint32_t i = 0; i < recordHeader[0]; i++) {
+      data[i] = buffer()[(offset + ZegoAudioDataRing::kRecordHeaderSize + i) % capacity];
+    }
+    position(16).store(
+        readPosition + ZegoAudioDataRing::kRecordHeaderSize + ((recordHeader[0] + 15) & ~15u),
+        std::memory_order_release);
+    return true;
+  }
+
+  uint8_t *base;
+};
+
+std::vector<uint8_t> frame(uint32_t length, uint8_t seed) {
+  std::vector<uint8_t> data(length);
+  for (uint32_t i = 0; i < length; i++) {
+    data[i] = (uint8_t)(seed + i);
+  }
+  return data;
+}
+
+}  // namespace
+
+TEST(ZegoAudioDataRing, WrapsFramesAroundTheEnd) {
+  ZegoAudioDataRing ring(128);
+  RingView view(ring.getAddress());
+  EXPECT_EQ(view.field(0), ZegoAudioDataRing::kVersion);
+  EXPECT_EQ(view.field(2), 128u);
+
+  std::vector<uint8_t> data;
+  uint32_t sampleRate = 0;
+  for (uint8_t i = 0; i < 20; i++) {
+    // 16 byte header plus 24 bytes padded to 32, so records keep moving
+    // across the end of the 128 byte ring.
+    auto written = frame(24, i);
+    ASSERT_TRUE(ring.write(written.data(), (uint32_t)written.size(), 48000, 1));
+    ASSERT_TRUE(view.readFrame(data, sampleRate));
+    EXPECT_EQ(data, written);
+    EXPECT_EQ(sampleRate, 48000u);
+  }
+  EXPECT_FALSE(view.readFrame(data, sampleRate));
+  EXPECT_EQ(ring.getOverrunCount(), 0u);
+}
+
+TEST(ZegoAudioDataRing, CountsOverrunWhenFull) {
+  ZegoAudioDataRing ring(128);
+  RingView view(ring.getAddress());
+
+  auto written = frame(40, 0);
+  EXPECT_TRUE(ring.write(written.data(), (uint32_t)written.size(), 48000, 1));
+  EXPECT_TRUE(ring.write(written.data(), (uint32_t)written.size(), 48000, 1));
+  EXPECT_FALSE(ring.write(written.data(), (uint32_t)written.size(), 48000, 1));
+  EXPECT_EQ(ring.getOverrunCount(), 1u);
+  EXPECT_EQ(view.position(9).load(), 2u);
+}
+
+TEST(ZegoAudioDataRing, NotifiesOncePerDrain) {
+  ZegoAudioDataRing ring(128);
+  RingView view(ring.getAddress());
+
+  EXPECT_TRUE(ring.takeNotification());
+  EXPECT_FALSE(ring.takeNotification());
+  reinterpret_cast<std::atomic<uint32_t> *>(view.base)[34].exchange(0);
+  EXPECT_TRUE(ring.takeNotification());
+}
+
+TEST(ZegoAudioDataRingSet, RejectsSecondRingForTheSameSource) {
+  ZegoAudioDataRingSet rings;
+  auto address = rings.create(kPlayerSource, "a", 1024, true);
+  EXPECT_NE(address, 0);
+  EXPECT_EQ(rings.create(kPlayerSource, "a", 1024, true), 0);
+  EXPECT_NE(rings.create(kPlayerSource, "b", 1024, true), 0);
+
+  EXPECT_TRUE(rings.destroy(kPlayerSource, "a"));
+  EXPECT_FALSE(rings.destroy(kPlayerSource, "a"));
+  EXPECT_NE(rings.create(kPlayerSource, "a", 1024, true), 0);
+}
+
+TEST(ZegoAudioDataRingSet, WritesOnlyIntoTheMatchingRing) {
+  ZegoAudioDataRingSet rings;
+  auto address = rings.create(kPlayerSource, "a", 1024, true);
+  auto written = frame(32, 0);
+  int64_t notifyAddress = 0;
+
+  EXPECT_FALSE(rings.write(kCapturedSource, "", written.data(), 32, 48000, 1, notifyAddress));
+  EXPECT_FALSE(rings.write(kPlayerSource, "b", written.data(), 32, 48000, 1, notifyAddress));
+  EXPECT_TRUE(rings.write(kPlayerSource, "a", written.data(), 32, 48000, 1, notifyAddress));
+  EXPECT_EQ(notifyAddress, address);
+  EXPECT_TRUE(rings.write(kPlayerSource, "a", written.data(), 32, 48000, 1, notifyAddress));
+  EXPECT_EQ(notifyAddress, 0);
+
+  rings.destroy(kPlayerSource, "a");
+  EXPECT_FALSE(rings.write(kPlayerSource, "a", written.data(), 32, 48000, 1, notifyAddress));
+}
+
+TEST(ZegoAudioDataRingSet, DestroysWhileAudioThreadWrites) {
+  ZegoAudioDataRingSet rings;
+  std::atomic_bool running = true;
+  std::thread writer([&] {
+    auto written = frame(64, 0);
+    int64_t notifyAddress = 0;
+    while (running) {
+      rings.write(kCapturedSource, "", written.data(), 64, 48000, 1, notifyAddress);
+    }
+  });
+
+  for (int i = 0; i < 200; i++) {
+    ASSERT_NE(rings.create(kCapturedSource, "", 4096, false), 0);
+    ASSERT_TRUE(rings.destroy(kCapturedSource, ""));
+  }
+  running = false;
+  writer.join();
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "ZegoBatchTicker.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+// Emits the numbers added since the previous tick.
+class NumberBatcher : public ZegoTickBatcher {
+ public:
+  ~NumberBatcher() { stop(); }
+
+  void start(uint32_t intervalMs, ReadyCallback ready) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    startTicking(intervalMs, std::move(ready));
+  }
+
+  void stop() { stopTicking(); }
+
+  void add(int number) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.push_back(number);
+  }
+
+  std::vector<std::vector<int>> batches() {
+    std::lock_guard<std::mutex> lock(emittedMutex_);
+    return batches_;
+  }
+
+  std::atomic_bool lastBatchWasStopping = false;
+
+ protected:
+  bool hasPending() override { return !pending_.empty(); }
+
+  std::function<void()> takeBatch(bool isStopping) override {
+    lastBatchWasStopping = isStopping;
+    return [this, batch = std::move(pending_)]() {
+      std::lock_guard<std::mutex> lock(emittedMutex_);
+      batches_.push_back(batch);
+    };
+  }
+
+ private:
+  std::vector<int> pending_;
+  std::mutex emittedMutex_;
+  std::vector<std::vector<int>> batches_;
+};
+
+// Polls until condition holds, ticks run on the shared ticker thread.
+template <typename Condition>
+bool waitFor(Condition condition) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(ZegoBatchTicker, EmitsPendingItemsOnTick) {
+  NumberBatcher batcher;
+  batcher.start(5, nullptr);
+  batcher.add(1);
+  batcher.add(2);
+
+  ASSERT_TRUE(waitFor([&] { return !batcher.batches().empty(); }));
+  batcher.stop();
+  EXPECT_EQ(batcher.batches(), std::vector<std::vector<int>>({{1, 2}}));
+  EXPECT_FALSE(batcher.lastBatchWasStopping);
+}
+
+TEST(ZegoBatchTicker, SkipsTicksUntilReady) {
+  std::atomic_bool ready = false;
+  NumberBatcher batcher;
+  batcher.start(2, [&] { return ready.load(); });
+  batcher.add(1);
+
+  ASSERT_TRUE(waitFor([&] { return batcher.getSkippedTickCount() >= 2; }));
+  EXPECT_TRUE(batcher.batches().empty());
+  ready = true;
+  ASSERT_TRUE(waitFor([&] { return !batcher.batches().empty(); }));
+}
+
+TEST(ZegoBatchTicker, EmitsLastBatchOnStopRegardlessOfReady) {
+  NumberBatcher batcher;
+  batcher.start(1000, [] { return false; });
+  batcher.add(1);
+  batcher.stop();
+
+  EXPECT_EQ(batcher.batches(), std::vector<std::vector<int>>({{1}}));
+  EXPECT_TRUE(batcher.lastBatchWasStopping);
+  EXPECT_FALSE(batcher.isRunning());
+}
+
+TEST(ZegoBatchTicker, RunsBatchersOfDifferentIntervalsSideBySide) {
+  NumberBatcher fast;
+  NumberBatcher slow;
+  fast.start(2, nullptr);
+  slow.start(1000, nullptr);
+  fast.add(1);
+  slow.add(2);
+
+  ASSERT_TRUE(waitFor([&] { return !fast.batches().empty(); }));
+  EXPECT_TRUE(slow.batches().empty());
+  slow.stop();
+  EXPECT_EQ(slow.batches(), std::vector<std::vector<int>>({{2}}));
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
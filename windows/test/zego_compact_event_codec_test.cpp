@@ -0,0 +1,313 @@
+#include <flutter/standard_message_codec.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ZegoCompactEventCodec.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+// Reads a packet the way the dart ZegoCompactEventDecoder does, keeping its
+// string table across packets.
+class Decoder {
+ public:
+  struct Packet {
+    uint8_t version = 0;
+    uint8_t type = 0;
+    uint16_t epoch = 0;
+    uint16_t stringCount = 0;
+    uint16_t recordCount = 0;
+  };
+
+  Packet begin(std::vector<uint8_t> data) {
+    data_ = std::move(data);
+    offset_ = 0;
+
+    Packet packet;
+    packet.version = read<uint8_t>();
+    packet.type = read<uint8_t>();
+    packet.epoch = read<uint16_t>();
+    if (!hasEpoch_ || packet.epoch != epoch_) {
+      hasEpoch_ = true;
+      epoch_ = packet.epoch;
+      streamIDs_.clear();
+    }
+    packet.stringCount = read<uint16_t>();
+    for (uint16_t i = 0; i < packet.stringCount; i++) {
+      auto index = read<uint16_t>();
+      auto length = read<uint16_t>();
+      streamIDs_[index] = std::string(reinterpret_cast<const char *>(data_.data() + offset_), length);
+      offset_ += length;
+    }
+    packet.recordCount = read<uint16_t>();
+    return packet;
+  }
+
+  template <typename T>
+  T read() {
+    T value;
+    EXPECT_LE(offset_ + sizeof(T), data_.size());
+    memcpy(&value, data_.data() + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return value;
+  }
+
+  std::vector<float> readSpectrum() {
+    std::vector<float> spectrum(read<uint16_t>());
+    for (auto &value : spectrum) {
+      value = read<float>();
+    }
+    return spectrum;
+  }
+
+  std::string streamID() {
+    auto it = streamIDs_.find(read<uint16_t>());
+    return it == streamIDs_.end() ? "" : it->second;
+  }
+
+  bool atEnd() const { return offset_ == data_.size(); }
+
+ private:
+  std::vector<uint8_t> data_;
+  size_t offset_ = 0;
+  bool hasEpoch_ = false;
+  uint16_t epoch_ = 0;
+  std::map<uint16_t, std::string> streamIDs_;
+};
+
+ZEGO::EXPRESS::ZegoPublishStreamQuality publishQuality() {
+  ZEGO::EXPRESS::ZegoPublishStreamQuality quality{};
+  quality.videoCaptureFPS = 15;
+  quality.videoEncodeFPS = 14.5;
+  quality.videoSendFPS = 14;
+  quality.videoKBPS = 800.25;
+  quality.audioCaptureFPS = 50;
+  quality.audioSendFPS = 49;
+  quality.audioKBPS = 48.5;
+  quality.rtt = 37;
+  quality.packetLostRate = 0.125;
+  quality.level = (ZEGO::EXPRESS::ZegoStreamQualityLevel)1;
+  quality.isHardwareEncode = true;
+  quality.videoCodecID = (ZEGO::EXPRESS::ZegoVideoCodecID)2;
+  quality.totalSendBytes = 1e9;
+  quality.audioSendBytes = 2e6;
+  quality.videoSendBytes = 3e8;
+  return quality;
+}
+
+// Builds the event the way ZegoExpressEngineEventHandler does without the
+// compact encoding.
+flutter::EncodableMap remoteSoundLevelEvent(
+    const std::unordered_map<std::string, ZEGO::EXPRESS::ZegoSoundLevelInfo> &soundLevelInfos) {
+  flutter::EncodableMap event;
+  event[flutter::EncodableValue("method")] =
+      flutter::EncodableValue("onRemoteSoundLevelInfoUpdate");
+  flutter::EncodableMap soundLevelInfosMap;
+  for (auto &soundLevelInfo : soundLevelInfos) {
+    flutter::EncodableMap soundLevelInfoMap;
+    soundLevelInfoMap[flutter::EncodableValue("soundLevel")] =
+        flutter::EncodableValue((double)soundLevelInfo.second.soundLevel);
+    soundLevelInfoMap[flutter::EncodableValue("vad")] =
+        flutter::EncodableValue(soundLevelInfo.second.vad);
+    soundLevelInfosMap[flutter::EncodableValue(soundLevelInfo.first)] =
+        flutter::EncodableValue(soundLevelInfoMap);
+  }
+  event[flutter::EncodableValue("soundLevelInfos")] = flutter::EncodableValue(soundLevelInfosMap);
+  return event;
+}
+
+}  // namespace
+
+TEST(ZegoCompactEventCodec, RoundTripsPublisherQuality) {
+  ZegoCompactEventCodec codec;
+  Decoder decoder;
+  auto quality = publishQuality();
+  auto packet = decoder.begin(codec.encodePublisherQuality("stream", quality));
+  EXPECT_EQ(packet.version, (uint8_t)ZegoCompactEventCodec::kVersion);
+  EXPECT_EQ(packet.type, ZEGO_COMPACT_EVENT_TYPE_PUBLISHER_QUALITY);
+  EXPECT_EQ(packet.recordCount, 1);
+  EXPECT_EQ(decoder.streamID(), "stream");
+  EXPECT_EQ(decoder.read<double>(), quality.videoCaptureFPS);
+  EXPECT_EQ(decoder.read<double>(), quality.videoEncodeFPS);
+  EXPECT_EQ(decoder.read<double>(), quality.videoSendFPS);
+  EXPECT_EQ(decoder.read<double>(), quality.videoKBPS);
+  EXPECT_EQ(decoder.read<double>(), quality.audioCaptureFPS);
+  EXPECT_EQ(decoder.read<double>(), quality.audioSendFPS);
+  EXPECT_EQ(decoder.read<double>(), quality.audioKBPS);
+  EXPECT_EQ(decoder.read<int32_t>(), quality.rtt);
+  EXPECT_EQ(decoder.read<double>(), quality.packetLostRate);
+  EXPECT_EQ(decoder.read<int32_t>(), 1);
+  EXPECT_EQ(decoder.read<uint8_t>(), 1);
+  EXPECT_EQ(decoder.read<int32_t>(), 2);
+  EXPECT_EQ(decoder.read<double>(), quality.totalSendBytes);
+  EXPECT_EQ(decoder.read<double>(), quality.audioSendBytes);
+  EXPECT_EQ(decoder.read<double>(), quality.videoSendBytes);
+  EXPECT_TRUE(decoder.atEnd());
+}
+
+TEST(ZegoCompactEventCodec, RoundTripsRemoteSoundLevelsAndSpectrums) {
+  ZegoCompactEventCodec codec;
+  Decoder decoder;
+  std::unordered_map<std::string, ZEGO::EXPRESS::ZegoSoundLevelInfo> soundLevelInfos = {
+      {"a", {12.5f, 1}}, {"b", {80.0f, 0}}};
+  std::unordered_map<std::string, ZEGO::EXPRESS::ZegoAudioSpectrum> audioSpectrums = {
+      {"a", {1.0f, 2.0f, 3.0f}}, {"c", {}}};
+
+  auto packet = decoder.begin(codec.encodeRemoteSoundLevelInfos(soundLevelInfos));
+  EXPECT_EQ(packet.type, ZEGO_COMPACT_EVENT_TYPE_REMOTE_SOUND_LEVEL_INFO);
+  ASSERT_EQ(packet.recordCount, 2);
+  for (int i = 0; i < 2; i++) {
+    auto streamID = decoder.streamID();
+    EXPECT_EQ(decoder.read<float>(), soundLevelInfos[streamID].soundLevel);
+    EXPECT_EQ(decoder.read<int32_t>(), soundLevelInfos[streamID].vad);
+  }
+  EXPECT_TRUE(decoder.atEnd());
+
+  packet = decoder.begin(codec.encodeRemoteAudioSpectrums(audioSpectrums));
+  EXPECT_EQ(packet.type, ZEGO_COMPACT_EVENT_TYPE_REMOTE_AUDIO_SPECTRUM);
+  // Only "c" is new, "a" was interned by the sound level packet.
+  EXPECT_EQ(packet.stringCount, 1);
+  ASSERT_EQ(packet.recordCount, 2);
+  for (int i = 0; i < 2; i++) {
+    auto streamID = decoder.streamID();
+    EXPECT_EQ(decoder.readSpectrum(), audioSpectrums[streamID]);
+  }
+  EXPECT_TRUE(decoder.atEnd());
+}
+
+TEST(ZegoCompactEventCodec, SendsStreamIDsOnlyOnFirstUse) {
+  ZegoCompactEventCodec codec;
+  Decoder decoder;
+  auto quality = publishQuality();
+
+  auto first = decoder.begin(codec.encodePublisherQuality("stream", quality));
+  EXPECT_EQ(first.stringCount, 1);
+
+  auto second = decoder.begin(codec.encodePublisherQuality("stream", quality));
+  EXPECT_EQ(second.stringCount, 0);
+  EXPECT_EQ(second.epoch, first.epoch);
+  EXPECT_EQ(decoder.streamID(), "stream");
+}
+
+TEST(ZegoCompactEventCodec, ResendsStreamIDsAfterEpochReset) {
+  ZegoCompactEventCodec codec;
+  Decoder decoder;
+  auto quality = publishQuality();
+
+  auto first = decoder.begin(codec.encodePublisherQuality("a", quality));
+  decoder.begin(codec.encodePublisherQuality("b", quality));
+  codec.reset();
+
+  // "b" takes index 0 in the new epoch, which was "a" before. A decoder that
+  // kept its table would map it to the wrong stream.
+  auto packet = decoder.begin(codec.encodePublisherQuality("b", quality));
+  EXPECT_NE(packet.epoch, first.epoch);
+  EXPECT_EQ(packet.stringCount, 1);
+  EXPECT_EQ(decoder.streamID(), "b");
+}
+
+TEST(ZegoCompactEventCodec, RoundTripsCapturedEventsWithoutStreams) {
+  ZegoCompactEventCodec codec;
+  Decoder decoder;
+
+  auto packet = decoder.begin(codec.encodeCapturedSoundLevelInfo({42.5f, 1}));
+  EXPECT_EQ(packet.type, ZEGO_COMPACT_EVENT_TYPE_CAPTURED_SOUND_LEVEL_INFO);
+  EXPECT_EQ(packet.stringCount, 0);
+  EXPECT_EQ(decoder.read<float>(), 42.5f);
+  EXPECT_EQ(decoder.read<int32_t>(), 1);
+  EXPECT_TRUE(decoder.atEnd());
+
+  packet = decoder.begin(codec.encodeCapturedAudioSpectrum({0.5f, 0.25f}));
+  EXPECT_EQ(packet.type, ZEGO_COMPACT_EVENT_TYPE_CAPTURED_AUDIO_SPECTRUM);
+  EXPECT_EQ(decoder.readSpectrum(), std::vector<float>({0.5f, 0.25f}));
+  EXPECT_TRUE(decoder.atEnd());
+}
+
+TEST(ZegoCompactEventCodec, KeysPacketsOnTypeAndStreamSet) {
+  auto key = ZegoCompactEventCodec::latestKey(ZEGO_COMPACT_EVENT_TYPE_REMOTE_SOUND_LEVEL_INFO,
+                                              {"b", "a"});
+
+  EXPECT_EQ(key, ZegoCompactEventCodec::latestKey(ZEGO_COMPACT_EVENT_TYPE_REMOTE_SOUND_LEVEL_INFO,
+                                                  {"a", "b"}));
+  EXPECT_NE(key, ZegoCompactEventCodec::latestKey(ZEGO_COMPACT_EVENT_TYPE_REMOTE_AUDIO_SPECTRUM,
+                                                  {"a", "b"}));
+  EXPECT_NE(key, ZegoCompactEventCodec::latestKey(ZEGO_COMPACT_EVENT_TYPE_REMOTE_SOUND_LEVEL_INFO,
+                                                  {"a"}));
+}
+
+// Encodes and decodes remote sound levels of 16 streams both ways. Either
+// way the event goes through the standard codec of the event channel, the
+// compact packet as a single byte list. Dart decodes on its side, the
+// native decode here stands in for it.
+TEST(ZegoCompactEventCodec, BenchmarkAgainstTheMapPath) {
+  std::unordered_map<std::string, ZEGO::EXPRESS::ZegoSoundLevelInfo> soundLevelInfos;
+  for (int i = 0; i < 16; i++) {
+    soundLevelInfos["stream_" + std::to_string(i)] = {(float)i * 5, i % 2};
+  }
+  auto &messageCodec = flutter::StandardMessageCodec::GetInstance();
+  constexpr int kRounds = 2000;
+
+  size_t mapBytes = 0;
+  double mapSum = 0;
+  auto mapBegin = std::chrono::steady_clock::now();
+  for (int round = 0; round < kRounds; round++) {
+    auto message =
+        messageCodec.EncodeMessage(flutter::EncodableValue(remoteSoundLevelEvent(soundLevelInfos)));
+    mapBytes = message->size();
+    auto event = messageCodec.DecodeMessage(*message);
+    auto &infos = std::get<flutter::EncodableMap>(
+        std::get<flutter::EncodableMap>(*event)[flutter::EncodableValue("soundLevelInfos")]);
+    for (auto &info : infos) {
+      auto &infoMap = std::get<flutter::EncodableMap>(info.second);
+      mapSum += std::get<double>(infoMap[flutter::EncodableValue("soundLevel")]);
+    }
+  }
+  auto mapTime = std::chrono::steady_clock::now() - mapBegin;
+
+  ZegoCompactEventCodec codec;
+  Decoder decoder;
+  size_t compactBytes = 0;
+  double compactSum = 0;
+  auto compactBegin = std::chrono::steady_clock::now();
+  for (int round = 0; round < kRounds; round++) {
+    auto message = messageCodec.EncodeMessage(
+        flutter::EncodableValue(codec.encodeRemoteSoundLevelInfos(soundLevelInfos)));
+    compactBytes = message->size();
+    auto event = messageCodec.DecodeMessage(*message);
+    auto packet = decoder.begin(std::move(std::get<std::vector<uint8_t>>(*event)));
+    for (uint16_t i = 0; i < packet.recordCount; i++) {
+      decoder.streamID();
+      compactSum += decoder.read<float>();
+      decoder.read<int32_t>();
+    }
+  }
+  auto compactTime = std::chrono::steady_clock::now() - compactBegin;
+
+  EXPECT_EQ(compactSum, mapSum);
+  // After the first packet the stream IDs are sent as 16-bit indexes.
+  EXPECT_LT(compactBytes * 2, mapBytes);
+
+  auto mapMicroseconds = std::chrono::duration<double, std::micro>(mapTime).count() / kRounds;
+  auto compactMicroseconds =
+      std::chrono::duration<double, std::micro>(compactTime).count() / kRounds;
+  RecordProperty("mapMicrosecondsPerEvent", std::to_string(mapMicroseconds));
+  RecordProperty("compactMicrosecondsPerEvent", std::to_string(compactMicroseconds));
+  RecordProperty("mapBytesPerEvent", std::to_string(mapBytes));
+  RecordProperty("compactBytesPerEvent", std::to_string(compactBytes));
+  std::cout << "map: " << mapMicroseconds << " us, " << mapBytes
+            << " bytes per event, compact: " << compactMicroseconds << " us, " << compactBytes
+            << " bytes per event" << std::endl;
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "include/zego_express_engine/ZegoCustomAudioProcessManager.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+constexpr auto kType = ZG_FLUTTER_AUDIO_PROCESS_TYPE_CAPTURED;
+constexpr unsigned int kSampleRate = 48000;
+
+// Runs one frame of mono PCM through the chain of kType.
+void process(ZegoCustomAudioProcessManager &manager, std::vector<int16_t> &pcm) {
+  manager.process(kType, reinterpret_cast<unsigned char *>(pcm.data()),
+                  (unsigned int)(pcm.size() * sizeof(int16_t)), 1, kSampleRate, "");
+}
+
+int16_t peak(const std::vector<int16_t> &pcm) {
+  int peak = 0;
+  for (auto sample : pcm) {
+    peak = std::max(peak, std::abs((int)sample));
+  }
+  return (int16_t)std::min(peak, 32767);
+}
+
+class SleepingAudioProcessor : public IZegoFlutterAudioProcessor {
+ public:
+  void process(float *, unsigned int, unsigned int, unsigned int, const std::string &) override {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  std::string getName() override { return "sleeping"; }
+};
+
+}  // namespace
+
+TEST(ZegoCustomAudioProcessManager, SaturatesInsteadOfWrapping) {
+  ZegoCustomAudioProcessManager manager;
+  manager.addProcessor(kType, ZegoCustomAudioProcessManager::createGainProcessor(1e6f));
+
+  // 11 samples, the vector loop converts the first 8 and the scalar loop the rest.
+  std::vector<int16_t> pcm = {20000, -20000, 1, -1, 20000, -20000, 1, -1, 20000, -20000, 0};
+  process(manager, pcm);
+
+  EXPECT_EQ(pcm, std::vector<int16_t>({32767, -32768, 32767, -32768, 32767, -32768, 32767,
+                                       -32768, 32767, -32768, 0}));
+}
+
+TEST(ZegoCustomAudioProcessManager, LimitsThePeakToTheThreshold) {
+  ZegoCustomAudioProcessManager manager;
+  manager.addProcessor(kType, ZegoCustomAudioProcessManager::createLimiterProcessor(0.5f));
+
+  std::vector<int16_t> pcm(480);
+  for (size_t i = 0; i < pcm.size(); i++) {
+    pcm[i] = i % 2 ? 30000 : -30000;
+  }
+  process(manager, pcm);
+  EXPECT_LE(peak(pcm), 16384);
+  EXPECT_GE(peak(pcm), 16383);
+
+  // A quiet frame after it is not touched once the gain has recovered.
+  std::vector<int16_t> quiet(480, 1000);
+  for (int i = 0; i < 100; i++) {
+    quiet.assign(480, 1000);
+    process(manager, quiet);
+  }
+  EXPECT_EQ(quiet, std::vector<int16_t>(480, 1000));
+}
+
+TEST(ZegoCustomAudioProcessManager, HighPassRemovesDCAndKeepsHighFrequencies) {
+  ZegoCustomAudioProcessManager manager;
+  manager.addProcessor(kType, ZegoCustomAudioProcessManager::createHighPassProcessor(100.0f));
+
+  std::vector<int16_t> dc;
+  for (int i = 0; i < 50; i++) {
+    dc.assign(480, 10000);
+    process(manager, dc);
+  }
+  EXPECT_LE(peak(dc), 10);
+
+  // A quarter of the sample rate is far above the cutoff.
+  ZegoCustomAudioProcessManager toneManager;
+  toneManager.addProcessor(kType, ZegoCustomAudioProcessManager::createHighPassProcessor(100.0f));
+  std::vector<int16_t> tone;
+  for (int i = 0; i < 10; i++) {
+    tone.clear();
+    for (int j = 0; j < 480; j++) {
+      static const int16_t kQuarterRate[] = {0, 10000, 0, -10000};
+      tone.push_back(kQuarterRate[j % 4]);
+    }
+    process(toneManager, tone);
+  }
+  EXPECT_NEAR(peak(tone), 10000, 200);
+}
+
+TEST(ZegoCustomAudioProcessManager, BypassesAStageThatKeepsMissingItsDeadline) {
+  ZegoCustomAudioProcessManager manager;
+  manager.addProcessor(kType, std::make_shared<SleepingAudioProcessor>(), 1);
+
+  std::vector<int16_t> pcm(480);
+  for (int i = 0; i < 5; i++) {
+    process(manager, pcm);
+  }
+
+  auto stats = manager.getProcessorStats(kType);
+  ASSERT_EQ(stats.size(), 1u);
+  EXPECT_EQ(stats[0].name, "sleeping");
+  // Three overruns in a row bypass the stage for the next frames.
+  EXPECT_EQ(stats[0].callCount, 3u);
+  EXPECT_EQ(stats[0].overrunCount, 3u);
+  EXPECT_EQ(stats[0].bypassedCount, 2u);
+  EXPECT_GE(stats[0].maxMicroseconds, 1000u);
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
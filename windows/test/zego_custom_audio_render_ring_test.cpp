@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include "ZegoCustomAudioRenderRing.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+// Header fields as dart reads them, see ZegoCustomAudioRenderRing.h.
+uint32_t field(int64_t address, int index) {
+  return reinterpret_cast<const uint32_t *>(address)[index];
+}
+
+std::atomic<uint64_t> &position(int64_t address, int index) {
+  return reinterpret_cast<std::atomic<uint64_t> *>(address)[index];
+}
+
+}  // namespace
+
+TEST(ZegoCustomAudioRenderRing, SizesTheRingInChunks) {
+  ZegoCustomAudioRenderRing ring(16000, 2, 10, 40, [](uint8_t *, uint32_t) { return true; });
+  auto address = ring.getAddress();
+
+  EXPECT_EQ(field(address, 0), ZegoCustomAudioRenderRing::kVersion);
+  // 160 frames of 10 ms, 4 of them, each frame 2 channels of 16 bits.
+  EXPECT_EQ(field(address, 4), 160u);
+  EXPECT_EQ(field(address, 2), 640u);
+  EXPECT_EQ(field(address, 3), 4u);
+}
+
+TEST(ZegoCustomAudioRenderRing, SkipsFetchesWhileFull) {
+  uint8_t nextByte = 0;
+  ZegoCustomAudioRenderRing ring(16000, 1, 10, 20, [&](uint8_t *data, uint32_t dataLength) {
+    memset(data, nextByte++, dataLength);
+    return true;
+  });
+  auto address = ring.getAddress();
+
+  EXPECT_EQ(ring.fetch(3), 2u);
+  EXPECT_EQ(position(address, 8).load(), 320u);
+  EXPECT_EQ(position(address, 9).load(), 2u);
+  EXPECT_EQ(position(address, 10).load(), 1u);
+
+  // Reading a chunk makes room for one more, into the slot it freed.
+  position(address, 16).store(160, std::memory_order_release);
+  EXPECT_EQ(ring.fetch(1), 1u);
+  auto buffer = reinterpret_cast<const uint8_t *>(address) + field(address, 1);
+  EXPECT_EQ(buffer[0], 2);
+  EXPECT_EQ(buffer[160 * 2], 1);
+}
+
+TEST(ZegoCustomAudioRenderRing, CountsFailedFetches) {
+  ZegoCustomAudioRenderRing ring(16000, 1, 10, 40, [](uint8_t *, uint32_t) { return false; });
+  auto address = ring.getAddress();
+
+  EXPECT_EQ(ring.fetch(2), 0u);
+  EXPECT_EQ(position(address, 8).load(), 0u);
+  EXPECT_EQ(position(address, 11).load(), 1u);
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
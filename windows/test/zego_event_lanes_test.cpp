@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ZegoEventLanes.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+flutter::EncodableMap event(const std::string &method, const std::string &sourceKey,
+                            flutter::EncodableValue source) {
+  flutter::EncodableMap event;
+  event[flutter::EncodableValue("method")] = flutter::EncodableValue(method);
+  event[flutter::EncodableValue(sourceKey)] = std::move(source);
+  return event;
+}
+
+}  // namespace
+
+TEST(ZegoEventLanes, SortsEventsByMethod) {
+  EXPECT_EQ(ZegoEventLanes::laneOf("onPublisherQualityUpdate"), ZEGO_EVENT_LANE_LATEST);
+  EXPECT_EQ(ZegoEventLanes::laneOf("onCapturedAudioData"), ZEGO_EVENT_LANE_BOUNDED);
+  EXPECT_EQ(ZegoEventLanes::laneOf("onRoomStateChanged"), ZEGO_EVENT_LANE_CRITICAL);
+}
+
+TEST(ZegoEventLanes, KeepsSpeedTestUplinkAndDownlinkApart) {
+  auto method = std::string("onNetworkSpeedTestQualityUpdate");
+  auto uplink = ZegoEventLanes::latestKey(method, event(method, "type", flutter::EncodableValue(0)));
+  auto downlink = ZegoEventLanes::latestKey(method, event(method, "type", flutter::EncodableValue(1)));
+
+  EXPECT_NE(uplink, downlink);
+  EXPECT_EQ(uplink, ZegoEventLanes::latestKey(method, event(method, "type", flutter::EncodableValue(0))));
+}
+
+TEST(ZegoEventLanes, KeepsRecordChannelsApart) {
+  auto method = std::string("onCapturedDataRecordProgressUpdate");
+  auto main = ZegoEventLanes::latestKey(method, event(method, "channel", flutter::EncodableValue(0)));
+  auto aux = ZegoEventLanes::latestKey(method, event(method, "channel", flutter::EncodableValue(1)));
+
+  EXPECT_NE(main, aux);
+}
+
+TEST(ZegoEventLanes, KeysOnEverySourceField) {
+  auto method = std::string("onPublisherQualityUpdate");
+  auto first = event(method, "streamID", flutter::EncodableValue("a"));
+  auto second = first;
+  first[flutter::EncodableValue("channel")] = flutter::EncodableValue(0);
+  second[flutter::EncodableValue("channel")] = flutter::EncodableValue(1);
+
+  EXPECT_NE(ZegoEventLanes::latestKey(method, first), ZegoEventLanes::latestKey(method, second));
+  // Equal values under different field names are different sources too.
+  EXPECT_NE(ZegoEventLanes::latestKey(method, event(method, "channel", flutter::EncodableValue(1))),
+            ZegoEventLanes::latestKey(method, event(method, "type", flutter::EncodableValue(1))));
+}
+
+TEST(ZegoEventLanes, DoesNotCoalesceDistinctSourcesInTheQueue) {
+  std::vector<int32_t> delivered;
+  ZegoPlatformEventQueue queue(4, [&](const flutter::EncodableValue &event) {
+    delivered.push_back(std::get<int32_t>(event));
+  });
+  queue.attachWindow(reinterpret_cast<HWND>(static_cast<uintptr_t>(1)), WM_USER + 1);
+
+  auto method = std::string("onNetworkSpeedTestQualityUpdate");
+  auto uplink = ZegoEventLanes::latestKey(method, event(method, "type", flutter::EncodableValue(0)));
+  auto downlink = ZegoEventLanes::latestKey(method, event(method, "type", flutter::EncodableValue(1)));
+  EXPECT_TRUE(queue.push(ZEGO_EVENT_LANE_LATEST, uplink, flutter::EncodableValue(1)));
+  EXPECT_TRUE(queue.push(ZEGO_EVENT_LANE_LATEST, downlink, flutter::EncodableValue(2)));
+  EXPECT_FALSE(queue.push(ZEGO_EVENT_LANE_LATEST, uplink, flutter::EncodableValue(3)));
+  queue.drain();
+
+  EXPECT_EQ(delivered, std::vector<int32_t>({3, 2}));
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "ZegoIMMessageBuffer.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+ZEGO::EXPRESS::ZegoBarrageMessageInfo barrage(const std::string &messageID, const std::string &userID) {
+  ZEGO::EXPRESS::ZegoBarrageMessageInfo info;
+  info.message = "message " + messageID;
+  info.messageID = messageID;
+  info.sendTime = 0;
+  info.fromUser.userID = userID;
+  return info;
+}
+
+std::vector<std::string> messageIDs(const std::vector<flutter::EncodableList> &batches) {
+  std::vector<std::string> ids;
+  for (auto const &batch : batches) {
+    for (auto const &message : batch) {
+      auto &map = std::get<flutter::EncodableMap>(message);
+      ids.push_back(std::get<std::string>(map.at(flutter::EncodableValue("messageID"))));
+    }
+  }
+  return ids;
+}
+
+}  // namespace
+
+TEST(ZegoIMMessageBuffer, FlushesWholeBacklogOnStop) {
+  std::vector<flutter::EncodableList> batches;
+  ZegoIMMessageBuffer buffer;
+  ZegoIMMessageBuffer::Config config;
+  config.intervalMs = 60000;
+  config.maxBatchSize = 2;
+  // Never ready, so only the flush on stop can emit.
+  buffer.start(config, [] { return false; },
+               [&](flutter::EncodableList &&messageList) { batches.push_back(std::move(messageList)); });
+
+  buffer.addBarrageMessages("room", {barrage("a", "u1"), barrage("b", "u1"), barrage("c", "u2")});
+  buffer.stop();
+
+  // The last batch is not cut at maxBatchSize.
+  ASSERT_EQ(batches.size(), 1u);
+  EXPECT_EQ(messageIDs(batches), std::vector<std::string>({"a", "b", "c"}));
+  EXPECT_EQ(buffer.getStats().deliveredCount, 3u);
+  EXPECT_FALSE(buffer.isRunning());
+}
+
+TEST(ZegoIMMessageBuffer, DropsDuplicatesAndOverflow) {
+  std::vector<flutter::EncodableList> batches;
+  ZegoIMMessageBuffer buffer;
+  ZegoIMMessageBuffer::Config config;
+  config.intervalMs = 60000;
+  config.maxBacklog = 2;
+  buffer.start(config, nullptr,
+               [&](flutter::EncodableList &&messageList) { batches.push_back(std::move(messageList)); });
+
+  buffer.addBarrageMessages("room", {barrage("a", "u1"), barrage("a", "u1"), barrage("b", "u1")});
+  buffer.addBarrageMessages("room", {barrage("c", "u1")});
+  auto stats = buffer.getStats();
+  buffer.stop();
+
+  EXPECT_EQ(messageIDs(batches), std::vector<std::string>({"b", "c"}));
+  EXPECT_EQ(stats.receivedCount, 4u);
+  EXPECT_EQ(stats.duplicateCount, 1u);
+  EXPECT_EQ(stats.overflowCount, 1u);
+}
+
+TEST(ZegoIMMessageBuffer, EmitsNothingOnStopWhenEmpty) {
+  int emitCount = 0;
+  ZegoIMMessageBuffer buffer;
+  buffer.start(ZegoIMMessageBuffer::Config(), nullptr, [&](flutter::EncodableList &&) { emitCount++; });
+  buffer.stop();
+
+  EXPECT_EQ(emitCount, 0);
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <ZegoInternalPrivate.h>
+
+#include "ZegoLog.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+// ZF::logInfo before the log rings, which formatted and wrote the line on
+// the calling thread.
+void synchronousLogInfo(const char *format, ...) {
+  char line[4096] = {0};
+  va_list la;
+  va_start(la, format);
+  vsnprintf(line, sizeof(line), format, la);
+  va_end(la);
+
+  printf("flutter: %s\n", line);
+  zego_express_custom_log(line, "Flutter");
+}
+
+}  // namespace
+
+TEST(ZegoLog, FiltersLinesBelowTheLevel) {
+  auto before = ZF::getLogStats();
+  ZF::setLogLevel(ZF::LOG_LEVEL_WARNING);
+  ZF::logInfo("filtered %d", 1);
+  ZF::log(ZF::LOG_LEVEL_DEBUG, "filtered %d", 2);
+  ZF::setLogLevel(ZF::LOG_LEVEL_INFO);
+
+  EXPECT_EQ(ZF::getLogStats().filteredCount - before.filteredCount, 2u);
+}
+
+// Time spent at the call site per line, writing on the calling thread
+// against queueing into the ring of the thread. Not a pass or fail check of
+// the speed, which depends on the console, it records both.
+TEST(ZegoLog, BenchmarkCallSiteAgainstSynchronousWrite) {
+  // Fits in a ring, so no line is dropped whatever the writer thread does.
+  constexpr int kLineCount = 400;
+  ZF::setLogLevel(ZF::LOG_LEVEL_INFO);
+  // Warms up the ring of this thread and the writer thread.
+  ZF::logInfo("[ZegoLogTest] start");
+  ZF::flushLog();
+  auto before = ZF::getLogStats();
+
+  // Captured, so neither path pays for a console here, only for the format
+  // and the SDK log write.
+  testing::internal::CaptureStdout();
+  auto synchronousBegin = std::chrono::steady_clock::now();
+  for (int i = 0; i < kLineCount; i++) {
+    synchronousLogInfo("[DartCall][startPublishingStream] synchronous line %d", i);
+  }
+  auto synchronousTime = std::chrono::steady_clock::now() - synchronousBegin;
+
+  auto queuedBegin = std::chrono::steady_clock::now();
+  for (int i = 0; i < kLineCount; i++) {
+    ZF::logInfo("[DartCall][startPublishingStream] queued line %d", i);
+  }
+  auto queuedTime = std::chrono::steady_clock::now() - queuedBegin;
+  ZF::flushLog();
+  auto output = testing::internal::GetCapturedStdout();
+
+  auto stats = ZF::getLogStats();
+  EXPECT_EQ(stats.droppedCount, before.droppedCount);
+  EXPECT_EQ(stats.writtenCount - before.writtenCount, (uint64_t)kLineCount);
+  EXPECT_NE(output.find("queued line 0\n"), std::string::npos);
+  EXPECT_NE(output.find("queued line 399\n"), std::string::npos);
+
+  auto synchronousNanoseconds =
+      std::chrono::duration<double, std::nano>(synchronousTime).count() / kLineCount;
+  auto queuedNanoseconds = std::chrono::duration<double, std::nano>(queuedTime).count() / kLineCount;
+  RecordProperty("synchronousNanosecondsPerLine", std::to_string(synchronousNanoseconds));
+  RecordProperty("queuedNanosecondsPerLine", std::to_string(queuedNanoseconds));
+  std::cout << "call site per line, synchronous: " << synchronousNanoseconds
+            << " ns, queued: " << queuedNanoseconds << " ns" << std::endl;
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ZegoMethodTable.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+struct Entry {
+  std::string_view name;
+  int value;
+};
+
+constexpr Entry kEntries[] = {{"createEngine", 1}, {"destroyEngine", 2}, {"loginRoom", 3},
+                              {"startPublishingStream", 4}, {"sendSEI", 5}};
+constexpr ZegoMethodTable<5> kTable(kEntries);
+
+static_assert(kTable.find(kEntries, "loginRoom")->value == 3, "Not found at compile time");
+
+constexpr Entry kDuplicateEntries[] = {{"sendSEI", 1}, {"loginRoom", 2}, {"sendSEI", 3}};
+
+// Size of the plugin's method list.
+constexpr size_t kBenchmarkMethodCount = 400;
+
+// Stands in for ZegoExpressEngineMethodHandler, the table dispatches
+// through member function pointers and the map through std::function.
+class Handler {
+ public:
+  void handle(int value) { sum_ += value; }
+  int sum() const { return sum_; }
+
+ private:
+  int sum_ = 0;
+};
+
+struct BenchmarkEntry {
+  std::string_view name;
+  void (Handler::*handler)(int);
+};
+
+}  // namespace
+
+TEST(ZegoMethodTable, FindsEveryEntry) {
+  for (auto &entry : kEntries) {
+    auto found = kTable.find(kEntries, entry.name);
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(found, &entry);
+  }
+  EXPECT_FALSE(kTable.hasDuplicate);
+  EXPECT_EQ(kTable.kSize, 32u);
+}
+
+TEST(ZegoMethodTable, ReturnsNullForAnUnknownName) {
+  EXPECT_EQ(kTable.find(kEntries, "stopPublishingStream"), nullptr);
+  EXPECT_EQ(kTable.find(kEntries, ""), nullptr);
+  // A prefix of a registered name.
+  EXPECT_EQ(kTable.find(kEntries, "login"), nullptr);
+}
+
+TEST(ZegoMethodTable, FlagsDuplicateNames) {
+  ZegoMethodTable<3> table(kDuplicateEntries);
+  EXPECT_TRUE(table.hasDuplicate);
+}
+
+// Not a pass or fail check of the speed, which depends on the build type,
+// it records both so runs can be compared.
+TEST(ZegoMethodTable, BenchmarkAgainstStdMapDispatch) {
+  std::vector<std::string> names;
+  for (size_t i = 0; i < kBenchmarkMethodCount; i++) {
+    names.push_back("benchmarkMethod" + std::to_string(i) + "WithALongerName");
+  }
+
+  BenchmarkEntry entries[kBenchmarkMethodCount];
+  std::map<std::string, std::function<void(Handler &, int)>> map;
+  for (size_t i = 0; i < kBenchmarkMethodCount; i++) {
+    entries[i] = {names[i], &Handler::handle};
+    map[names[i]] = std::bind(&Handler::handle, std::placeholders::_1, std::placeholders::_2);
+  }
+  ZegoMethodTable<kBenchmarkMethodCount> table(entries);
+  ASSERT_FALSE(table.hasDuplicate);
+
+  constexpr int kRounds = 200;
+  Handler tableHandler;
+  auto tableBegin = std::chrono::steady_clock::now();
+  for (int round = 0; round < kRounds; round++) {
+    for (auto &name : names) {
+      auto entry = table.find(entries, name);
+      (tableHandler.*entry->handler)(1);
+    }
+  }
+  auto tableTime = std::chrono::steady_clock::now() - tableBegin;
+
+  Handler mapHandler;
+  auto mapBegin = std::chrono::steady_clock::now();
+  for (int round = 0; round < kRounds; round++) {
+    for (auto &name : names) {
+      map.find(name)->second(mapHandler, 1);
+    }
+  }
+  auto mapTime = std::chrono::steady_clock::now() - mapBegin;
+
+  EXPECT_EQ(tableHandler.sum(), kRounds * (int)kBenchmarkMethodCount);
+  EXPECT_EQ(mapHandler.sum(), tableHandler.sum());
+
+  auto lookupCount = (double)kRounds * kBenchmarkMethodCount;
+  auto tableNanoseconds = std::chrono::duration<double, std::nano>(tableTime).count() / lookupCount;
+  auto mapNanoseconds = std::chrono::duration<double, std::nano>(mapTime).count() / lookupCount;
+  RecordProperty("tableNanosecondsPerCall", std::to_string(tableNanoseconds));
+  RecordProperty("mapNanosecondsPerCall", std::to_string(mapNanoseconds));
+  std::cout << "table: " << tableNanoseconds << " ns/call, std::map: " << mapNanoseconds
+            << " ns/call, max probes: " << table.maxProbeCount << std::endl;
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "ZegoPlatformEventQueue.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+constexpr UINT kDrainMessage = WM_USER + 1;
+
+// Window handle that is only compared against, drains are run by the tests.
+HWND fakeWindow() { return reinterpret_cast<HWND>(static_cast<uintptr_t>(1)); }
+
+int32_t intValue(const flutter::EncodableValue &event) { return std::get<int32_t>(event); }
+
+}  // namespace
+
+TEST(ZegoPlatformEventQueue, DeliversInlineWithoutWindow) {
+  std::vector<int32_t> delivered;
+  ZegoPlatformEventQueue queue(4, [&](const flutter::EncodableValue &event) {
+    delivered.push_back(intValue(event));
+  });
+
+  uint64_t position = 1;
+  queue.push(flutter::EncodableValue(1), &position);
+
+  EXPECT_EQ(delivered, std::vector<int32_t>({1}));
+  EXPECT_TRUE(queue.isDelivered(position));
+}
+
+TEST(ZegoPlatformEventQueue, DeliversCriticalEventsInOrderAcrossSpill) {
+  std::vector<int32_t> delivered;
+  ZegoPlatformEventQueue queue(2, [&](const flutter::EncodableValue &event) {
+    delivered.push_back(intValue(event));
+  });
+  queue.attachWindow(fakeWindow(), kDrainMessage);
+
+  std::vector<uint64_t> positions(5);
+  for (int32_t i = 0; i < 5; i++) {
+    queue.push(flutter::EncodableValue(i), &positions[i]);
+  }
+  EXPECT_FALSE(queue.isDelivered(positions[4]));
+
+  queue.drain();
+
+  EXPECT_EQ(delivered, std::vector<int32_t>({0, 1, 2, 3, 4}));
+  for (auto position : positions) {
+    EXPECT_TRUE(queue.isDelivered(position));
+  }
+}
+
+TEST(ZegoPlatformEventQueue, KeepsRingEventsAheadOfLaterSpill) {
+  std::vector<int32_t> delivered;
+  ZegoPlatformEventQueue *queuePointer = nullptr;
+  ZegoPlatformEventQueue queue(2, [&](const flutter::EncodableValue &event) {
+    delivered.push_back(intValue(event));
+    if (intValue(event) == 0) {
+      // While the drain runs, one event goes into the freed ring slot after
+      // the drain recorded its end, the next one spills.
+      queuePointer->push(flutter::EncodableValue(2));
+      queuePointer->push(flutter::EncodableValue(3));
+    }
+  });
+  queuePointer = &queue;
+  queue.attachWindow(fakeWindow(), kDrainMessage);
+
+  queue.push(flutter::EncodableValue(0));
+  queue.push(flutter::EncodableValue(1));
+  queue.drain();
+  queue.drain();
+
+  EXPECT_EQ(delivered, std::vector<int32_t>({0, 1, 2, 3}));
+}
+
+TEST(ZegoPlatformEventQueue, ReplacesLatestEventsWithTheSameKeyOnly) {
+  std::vector<int32_t> delivered;
+  ZegoPlatformEventQueue queue(4, [&](const flutter::EncodableValue &event) {
+    delivered.push_back(intValue(event));
+  });
+  queue.attachWindow(fakeWindow(), kDrainMessage);
+
+  EXPECT_TRUE(queue.push(ZEGO_EVENT_LANE_LATEST, "a", flutter::EncodableValue(1)));
+  EXPECT_TRUE(queue.push(ZEGO_EVENT_LANE_LATEST, "b", flutter::EncodableValue(2)));
+  EXPECT_FALSE(queue.push(ZEGO_EVENT_LANE_LATEST, "a", flutter::EncodableValue(3)));
+  queue.drain();
+
+  // The replacement keeps the place of the event it replaced.
+  EXPECT_EQ(delivered, std::vector<int32_t>({3, 2}));
+  auto stats = queue.getLaneStats(ZEGO_EVENT_LANE_LATEST);
+  EXPECT_EQ(stats.enqueuedCount, 3u);
+  EXPECT_EQ(stats.replacedCount, 1u);
+  EXPECT_EQ(stats.deliveredCount, 2u);
+}
+
+TEST(ZegoPlatformEventQueue, DrainsLanesInPriorityOrder) {
+  std::vector<int32_t> delivered;
+  ZegoPlatformEventQueue queue(4, [&](const flutter::EncodableValue &event) {
+    delivered.push_back(intValue(event));
+  });
+  queue.attachWindow(fakeWindow(), kDrainMessage);
+
+  queue.push(ZEGO_EVENT_LANE_BOUNDED, std::string(), flutter::EncodableValue(3));
+  queue.push(ZEGO_EVENT_LANE_LATEST, "a", flutter::EncodableValue(2));
+  queue.push(flutter::EncodableValue(1));
+  queue.drain();
+
+  EXPECT_EQ(delivered, std::vector<int32_t>({1, 2, 3}));
+}
+
+TEST(ZegoPlatformEventQueue, DropsOldestBoundedEventWhenFull) {
+  std::vector<int32_t> delivered;
+  ZegoPlatformEventQueue queue(4, [&](const flutter::EncodableValue &event) {
+    delivered.push_back(intValue(event));
+  });
+  queue.attachWindow(fakeWindow(), kDrainMessage);
+  queue.setLaneMaxDepth(ZEGO_EVENT_LANE_BOUNDED, 2);
+
+  EXPECT_TRUE(queue.push(ZEGO_EVENT_LANE_BOUNDED, std::string(), flutter::EncodableValue(1)));
+  EXPECT_TRUE(queue.push(ZEGO_EVENT_LANE_BOUNDED, std::string(), flutter::EncodableValue(2)));
+  EXPECT_FALSE(queue.push(ZEGO_EVENT_LANE_BOUNDED, std::string(), flutter::EncodableValue(3)));
+  queue.drain();
+
+  EXPECT_EQ(delivered, std::vector<int32_t>({2, 3}));
+  EXPECT_EQ(queue.getLaneStats(ZEGO_EVENT_LANE_BOUNDED).droppedCount, 1u);
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ZegoRealTimeSequentialDataBatcher.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+template <typename T>
+const T &field(const flutter::EncodableMap &batch, const char *name) {
+  return std::get<T>(batch.at(flutter::EncodableValue(name)));
+}
+
+}  // namespace
+
+TEST(ZegoRealTimeSequentialDataBatcher, FlushesPackedRecordsOnStop) {
+  std::vector<std::pair<int, flutter::EncodableMap>> batches;
+  ZegoRealTimeSequentialDataBatcher batcher;
+  // Never ready, so only the flush on stop can emit.
+  batcher.start(60000, 0, [] { return false; },
+                [&](int managerIndex, flutter::EncodableMap &&batch) {
+                  batches.emplace_back(managerIndex, std::move(batch));
+                });
+
+  const unsigned char first[] = {1, 2, 3};
+  const unsigned char second[] = {4, 5};
+  batcher.add(0, first, sizeof(first), "a");
+  batcher.add(0, second, sizeof(second), "b");
+  batcher.stop();
+
+  ASSERT_EQ(batches.size(), 1u);
+  EXPECT_EQ(batches[0].first, 0);
+  auto &batch = batches[0].second;
+  EXPECT_EQ(field<std::vector<int32_t>>(batch, "offsets"), std::vector<int32_t>({0, 3}));
+  EXPECT_EQ(field<std::vector<uint8_t>>(batch, "data"), std::vector<uint8_t>({1, 2, 3, 4, 5}));
+  EXPECT_EQ(field<flutter::EncodableList>(batch, "streamIDs"),
+            flutter::EncodableList({flutter::EncodableValue("a"), flutter::EncodableValue("b")}));
+  EXPECT_EQ(batcher.getStats().deliveredCount, 2u);
+}
+
+TEST(ZegoRealTimeSequentialDataBatcher, EmitsOneBatchPerManager) {
+  std::vector<int> managers;
+  ZegoRealTimeSequentialDataBatcher batcher;
+  batcher.start(60000, 0, nullptr, [&](int managerIndex, flutter::EncodableMap &&) {
+    managers.push_back(managerIndex);
+  });
+
+  const unsigned char data[] = {1};
+  batcher.add(0, data, sizeof(data), "a");
+  batcher.add(1, data, sizeof(data), "a");
+  batcher.add(0, data, sizeof(data), "b");
+  batcher.stop();
+
+  EXPECT_EQ(managers.size(), 2u);
+  EXPECT_EQ(batcher.getStats().batchCount, 2u);
+}
+
+TEST(ZegoRealTimeSequentialDataBatcher, DropsRecordsPastMaxPendingBytes) {
+  ZegoRealTimeSequentialDataBatcher batcher;
+  batcher.start(60000, 4, nullptr, [](int, flutter::EncodableMap &&) {});
+
+  const unsigned char data[] = {1, 2, 3};
+  batcher.add(0, data, sizeof(data), "a");
+  batcher.add(0, data, sizeof(data), "a");
+  auto stats = batcher.getStats();
+  batcher.stop();
+
+  EXPECT_EQ(stats.receivedCount, 2u);
+  EXPECT_EQ(stats.droppedCount, 1u);
+  EXPECT_EQ(stats.depth, 1u);
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "ZegoRoomRoster.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+ZEGO::EXPRESS::ZegoStream stream(const std::string &streamID, const std::string &extraInfo) {
+  ZEGO::EXPRESS::ZegoStream stream;
+  stream.streamID = streamID;
+  stream.extraInfo = extraInfo;
+  stream.user.userID = "user_" + streamID;
+  return stream;
+}
+
+std::string extraInfoAt(const flutter::EncodableMap &page, size_t index) {
+  auto &streamList = std::get<flutter::EncodableList>(page.at(flutter::EncodableValue("streamList")));
+  auto &streamMap = std::get<flutter::EncodableMap>(streamList.at(index));
+  return std::get<std::string>(streamMap.at(flutter::EncodableValue("extraInfo")));
+}
+
+}  // namespace
+
+TEST(ZegoRoomRoster, KeepsStreamsInTheOrderTheyWereAdded) {
+  ZegoRoomRoster roster;
+  auto summary = roster.updateStreams("room", ZEGO::EXPRESS::ZEGO_UPDATE_TYPE_ADD,
+                                      {stream("a", ""), stream("b", ""), stream("c", "")});
+  EXPECT_EQ(summary.changedCount, 3u);
+  EXPECT_EQ(summary.totalCount, 3u);
+
+  summary = roster.updateStreams("room", ZEGO::EXPRESS::ZEGO_UPDATE_TYPE_DELETE,
+                                 {stream("b", ""), stream("unknown", "")});
+  EXPECT_EQ(summary.changedCount, 1u);
+  EXPECT_EQ(summary.totalCount, 2u);
+
+  auto page = roster.getStreams("room", 1, 10, "");
+  auto &streamList = std::get<flutter::EncodableList>(page.at(flutter::EncodableValue("streamList")));
+  ASSERT_EQ(streamList.size(), 1u);
+  auto &streamMap = std::get<flutter::EncodableMap>(streamList[0]);
+  EXPECT_EQ(std::get<std::string>(streamMap.at(flutter::EncodableValue("streamID"))), "c");
+}
+
+TEST(ZegoRoomRoster, AppliesExtraInfoToStreamsInTheRoster) {
+  ZegoRoomRoster roster;
+  auto added = roster.updateStreams("room", ZEGO::EXPRESS::ZEGO_UPDATE_TYPE_ADD,
+                                    {stream("a", "old"), stream("b", "old")});
+
+  auto summary = roster.updateStreamExtraInfo(
+      "room", {stream("a", "new"), stream("b", "old"), stream("unknown", "new")});
+  EXPECT_EQ(summary.changedCount, 1u);
+  EXPECT_EQ(summary.totalCount, 2u);
+  EXPECT_GT(summary.version, added.version);
+
+  auto page = roster.getStreams("room", 0, 10, "");
+  EXPECT_EQ(extraInfoAt(page, 0), "new");
+  EXPECT_EQ(extraInfoAt(page, 1), "old");
+  EXPECT_EQ(std::get<int32_t>(page.at(flutter::EncodableValue("totalCount"))), 2);
+}
+
+TEST(ZegoRoomRoster, IgnoresExtraInfoOfAnUnknownRoom) {
+  ZegoRoomRoster roster;
+  auto summary = roster.updateStreamExtraInfo("room", {stream("a", "new")});
+  EXPECT_EQ(summary.changedCount, 0u);
+  EXPECT_EQ(summary.version, 0u);
+
+  // No room is created for it.
+  auto page = roster.getStreams("room", 0, 10, "");
+  EXPECT_EQ(std::get<int64_t>(page.at(flutter::EncodableValue("version"))), 0);
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
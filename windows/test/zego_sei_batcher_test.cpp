@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "ZegoSEIBatcher.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+template <typename T>
+const T &field(const flutter::EncodableMap &batch, const char *name) {
+  return std::get<T>(batch.at(flutter::EncodableValue(name)));
+}
+
+}  // namespace
+
+TEST(ZegoSEIBatcher, FlushesPendingUnitsOnStop) {
+  std::vector<flutter::EncodableMap> batches;
+  ZegoSEIBatcher batcher;
+  ZegoSEIBatcher::Config config;
+  config.intervalMs = 60000;
+  // Never ready, so only the flush on stop can emit.
+  batcher.start(config, [] { return false; },
+                [&](flutter::EncodableMap &&batch) { batches.push_back(std::move(batch)); });
+
+  const unsigned char first[] = {1, 2};
+  const unsigned char second[] = {3};
+  batcher.add(ZEGO_SEI_BATCH_TYPE_PLAYER_SEI, 0, "a", first, sizeof(first), 0);
+  batcher.add(ZEGO_SEI_BATCH_TYPE_MEDIA_PLAYER_SEI, 2, "", second, sizeof(second), 7);
+  batcher.stop();
+
+  ASSERT_EQ(batches.size(), 1u);
+  auto &batch = batches[0];
+  EXPECT_EQ(field<std::vector<int32_t>>(batch, "types"),
+            std::vector<int32_t>({ZEGO_SEI_BATCH_TYPE_PLAYER_SEI, ZEGO_SEI_BATCH_TYPE_MEDIA_PLAYER_SEI}));
+  EXPECT_EQ(field<std::vector<int32_t>>(batch, "sources"), std::vector<int32_t>({0, 2}));
+  EXPECT_EQ(field<std::vector<int64_t>>(batch, "timestamps"), std::vector<int64_t>({0, 7}));
+  EXPECT_EQ(field<std::vector<int32_t>>(batch, "offsets"), std::vector<int32_t>({0, 2}));
+  EXPECT_EQ(field<std::vector<uint8_t>>(batch, "data"), std::vector<uint8_t>({1, 2, 3}));
+  EXPECT_EQ(batcher.getStats().deliveredCount, 2u);
+}
+
+TEST(ZegoSEIBatcher, KeepsOnlyTheNewestUnitWithLatestOnly) {
+  std::vector<flutter::EncodableMap> batches;
+  ZegoSEIBatcher batcher;
+  ZegoSEIBatcher::Config config;
+  config.intervalMs = 60000;
+  config.latestOnly = true;
+  batcher.start(config, nullptr, [&](flutter::EncodableMap &&batch) { batches.push_back(std::move(batch)); });
+
+  for (unsigned char i = 0; i < 3; i++) {
+    batcher.add(ZEGO_SEI_BATCH_TYPE_PLAYER_SEI, 0, "a", &i, 1, 0);
+  }
+  batcher.stop();
+
+  ASSERT_EQ(batches.size(), 1u);
+  EXPECT_EQ(field<std::vector<uint8_t>>(batches[0], "data"), std::vector<uint8_t>({2}));
+  EXPECT_EQ(batcher.getStats().replacedCount, 2u);
+}
+
+TEST(ZegoSEIBatcher, DropsOldestUnitsOfAFullRing) {
+  std::vector<flutter::EncodableMap> batches;
+  ZegoSEIBatcher batcher;
+  ZegoSEIBatcher::Config config;
+  config.intervalMs = 60000;
+  config.maxUnitsPerStream = 2;
+  batcher.start(config, nullptr, [&](flutter::EncodableMap &&batch) { batches.push_back(std::move(batch)); });
+
+  for (unsigned char i = 0; i < 3; i++) {
+    batcher.add(ZEGO_SEI_BATCH_TYPE_PLAYER_SEI, 0, "a", &i, 1, 0);
+  }
+  batcher.stop();
+
+  ASSERT_EQ(batches.size(), 1u);
+  EXPECT_EQ(field<std::vector<uint8_t>>(batches[0], "data"), std::vector<uint8_t>({1, 2}));
+  EXPECT_EQ(batcher.getStats().droppedCount, 1u);
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ZegoVideoHealthAnalyzer.h"
+
+namespace zego_express_engine {
+namespace test {
+
+namespace {
+
+// BGRA frame of a single color with opaque alpha.
+std::vector<uint8_t> solidFrame(uint32_t width, uint32_t height, uint8_t value) {
+  std::vector<uint8_t> frame(width * height * 4, value);
+  for (size_t i = 3; i < frame.size(); i += 4) {
+    frame[i] = 255;
+  }
+  return frame;
+}
+
+}  // namespace
+
+TEST(ZegoVideoHealthAnalyzer, AveragesOverTheRowsOfShortFrames) {
+  std::vector<ZegoVideoHealthEvent> events;
+  ZegoVideoHealthAnalyzer analyzer;
+  analyzer.start(500, 1, [&](const std::string &, ZegoVideoHealthEvent event, uint32_t) {
+    events.push_back(event);
+  });
+
+  // Only 2 of the 16 sampled rows exist, a grey frame must not read as black.
+  auto frame = solidFrame(64, 2, 100);
+  analyzer.onFrame("a", frame.data(), 64, 2, 64 * 4, 3);
+  analyzer.stop();
+
+  EXPECT_EQ(events, std::vector<ZegoVideoHealthEvent>({ZEGO_VIDEO_HEALTH_EVENT_UNIFORM}));
+}
+
+TEST(ZegoVideoHealthAnalyzer, ReportsBlackFrames) {
+  std::vector<ZegoVideoHealthEvent> events;
+  ZegoVideoHealthAnalyzer analyzer;
+  analyzer.start(500, 1, [&](const std::string &, ZegoVideoHealthEvent event, uint32_t) {
+    events.push_back(event);
+  });
+
+  auto frame = solidFrame(64, 64, 0);
+  analyzer.onFrame("a", frame.data(), 64, 64, 64 * 4, 3);
+  ZegoVideoHealthSummary summary;
+  ASSERT_TRUE(analyzer.getSummary("a", summary));
+  analyzer.stop();
+
+  EXPECT_EQ(events, std::vector<ZegoVideoHealthEvent>({ZEGO_VIDEO_HEALTH_EVENT_BLACK}));
+  EXPECT_EQ(summary.blackFrameCount, 1u);
+}
+
+}  // namespace test
+}  // namespace zego_express_engine
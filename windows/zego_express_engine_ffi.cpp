@@ -0,0 +1,154 @@
+#include "include/zego_express_engine/zego_express_engine_ffi.h"
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <shared_mutex>
+#include <string>
+
+#include "internal/ZegoExpressEngineEventHandler.h"
+#include "internal/ZegoExpressEngineMethodHandler.h"
+
+namespace {
+
+EXPRESS::ZegoAudioFrameParam audioFrameParam(int32_t sampleRate, int32_t audioChannel) {
+    EXPRESS::ZegoAudioFrameParam param;
+    param.sampleRate = (EXPRESS::ZegoAudioSampleRate)sampleRate;
+    param.channel = (EXPRESS::ZegoAudioChannel)audioChannel;
+    return param;
+}
+
+}  // namespace
+
+void *zego_express_ffi_alloc(uint32_t size) { return malloc(size); }
+
+void zego_express_ffi_free(void *data) { free(data); }
+
+uint64_t zego_express_ffi_load_acquire(uint64_t *address) {
+    return reinterpret_cast<std::atomic<uint64_t> *>(address)->load(std::memory_order_acquire);
+}
+
+void zego_express_ffi_store_release(uint64_t *address, uint64_t value) {
+    reinterpret_cast<std::atomic<uint64_t> *>(address)->store(value, std::memory_order_release);
+}
+
+uint32_t zego_express_ffi_exchange(uint32_t *address, uint32_t value) {
+    return reinterpret_cast<std::atomic<uint32_t> *>(address)->exchange(value,
+                                                                         std::memory_order_acq_rel);
+}
+
+int32_t zego_express_ffi_send_sei(uint8_t *data, uint32_t dataLength, int32_t channel) {
+    std::shared_lock<std::shared_mutex> lock(
+        ZegoExpressEngineMethodHandler::getInstance().getEngineMutex());
+    auto engine = EXPRESS::ZegoExpressSDK::getEngine();
+    if (!engine) {
+        return ZEGO_EXPRESS_FFI_ERROR_ENGINE_NOT_CREATED;
+    }
+
+    engine->sendSEI(data, dataLength, (EXPRESS::ZegoPublishChannel)channel);
+    return 0;
+}
+
+int32_t zego_express_ffi_send_audio_side_info(uint8_t *data, uint32_t dataLength,
+                                              double timeStampMs, int32_t channel) {
+    std::shared_lock<std::shared_mutex> lock(
+        ZegoExpressEngineMethodHandler::getInstance().getEngineMutex());
+    auto engine = EXPRESS::ZegoExpressSDK::getEngine();
+    if (!engine) {
+        return ZEGO_EXPRESS_FFI_ERROR_ENGINE_NOT_CREATED;
+    }
+
+    engine->sendAudioSideInfo(data, dataLength, timeStampMs, (EXPRESS::ZegoPublishChannel)channel);
+    return 0;
+}
+
+int32_t zego_express_ffi_send_custom_audio_capture_pcm_data(uint8_t *data,
+                                                            uint32_t dataLength,
+                                                            int32_t sampleRate,
+                                                            int32_t audioChannel,
+                                                            int32_t channel) {
+    std::shared_lock<std::shared_mutex> lock(
+        ZegoExpressEngineMethodHandler::getInstance().getEngineMutex());
+    auto engine = EXPRESS::ZegoExpressSDK::getEngine();
+    if (!engine) {
+        return ZEGO_EXPRESS_FFI_ERROR_ENGINE_NOT_CREATED;
+    }
+
+    engine->sendCustomAudioCapturePCMData(data, dataLength,
+                                          audioFrameParam(sampleRate, audioChannel),
+                                          (EXPRESS::ZegoPublishChannel)channel);
+    return 0;
+}
+
+int32_t zego_express_ffi_send_custom_audio_capture_aac_data(
+    uint8_t *data, uint32_t dataLength, uint32_t configLength,
+    uint64_t referenceTimeMillisecond, uint32_t samples, int32_t sampleRate,
+    int32_t audioChannel, int32_t channel) {
+    std::shared_lock<std::shared_mutex> lock(
+        ZegoExpressEngineMethodHandler::getInstance().getEngineMutex());
+    auto engine = EXPRESS::ZegoExpressSDK::getEngine();
+    if (!engine) {
+        return ZEGO_EXPRESS_FFI_ERROR_ENGINE_NOT_CREATED;
+    }
+
+    engine->sendCustomAudioCaptureAACData(data, dataLength, configLength,
+                                          referenceTimeMillisecond, samples,
+                                          audioFrameParam(sampleRate, audioChannel),
+                                          (EXPRESS::ZegoPublishChannel)channel);
+    return 0;
+}
+
+int32_t zego_express_ffi_data_manager_send_real_time_sequential_data(int32_t index,
+                                                                     uint8_t *data,
+                                                                     uint32_t dataLength,
+                                                                     const char *streamID,
+                                                                     int64_t sequence) {
+    auto &methodHandler = ZegoExpressEngineMethodHandler::getInstance();
+    std::shared_lock<std::shared_mutex> lock(methodHandler.getEngineMutex());
+    if (!EXPRESS::ZegoExpressSDK::getEngine()) {
+        return ZEGO_EXPRESS_FFI_ERROR_ENGINE_NOT_CREATED;
+    }
+    auto dataManager = methodHandler.getRealTimeSequentialDataManager(index);
+    if (!dataManager) {
+        return ZEGO_EXPRESS_FFI_ERROR_INSTANCE_NOT_FOUND;
+    }
+    if (!ZegoExpressEngineEventHandler::getInstance()->hasEventSink()) {
+        return ZEGO_EXPRESS_FFI_ERROR_NO_EVENT_SINK;
+    }
+
+    dataManager->sendRealTimeSequentialData(
+        data, dataLength, std::string(streamID), [sequence](int errorCode) {
+            ZegoExpressEngineEventHandler::getInstance()->postRealTimeSequentialDataSent(sequence,
+                                                                                          errorCode);
+        });
+    return 0;
+}
+
+int32_t zego_express_ffi_fetch_custom_audio_render_pcm_data(uint8_t *data, uint32_t dataLength,
+                                                            int32_t sampleRate,
+                                                            int32_t audioChannel) {
+    std::shared_lock<std::shared_mutex> lock(
+        ZegoExpressEngineMethodHandler::getInstance().getEngineMutex());
+    auto engine = EXPRESS::ZegoExpressSDK::getEngine();
+    if (!engine) {
+        return ZEGO_EXPRESS_FFI_ERROR_ENGINE_NOT_CREATED;
+    }
+
+    engine->fetchCustomAudioRenderPCMData(data, dataLength,
+                                          audioFrameParam(sampleRate, audioChannel));
+    return 0;
+}
+
+int32_t zego_express_ffi_fetch_custom_audio_render_ring(int64_t address, uint32_t chunkCount,
+                                                        uint32_t *fetchedCount) {
+    *fetchedCount = 0;
+    // The ring takes the engine mutex itself for each chunk.
+    if (!EXPRESS::ZegoExpressSDK::getEngine()) {
+        return ZEGO_EXPRESS_FFI_ERROR_ENGINE_NOT_CREATED;
+    }
+    if (!ZegoExpressEngineMethodHandler::getInstance().fetchCustomAudioRenderRing(
+            address, chunkCount, *fetchedCount)) {
+        return ZEGO_EXPRESS_FFI_ERROR_INSTANCE_NOT_FOUND;
+    }
+    return 0;
+}
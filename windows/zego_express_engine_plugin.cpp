@@ -9,41 +9,135 @@
 #include <flutter/plugin_registrar_windows.h>
 #include <flutter/standard_method_codec.h>
 
-#include <map>
+#include <atomic>
+#include <chrono>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <sstream>
+#include <string_view>
 
 #include "ZegoLog.h"
 #include "internal/ZegoExpressEngineEventHandler.h"
 #include "internal/ZegoExpressEngineMethodHandler.h"
+#include "internal/ZegoMethodCallStats.h"
+#include "internal/ZegoMethodTable.h"
+#include "internal/ZegoTaskExecutor.h"
+
+using ZegoMethodHandler = void (ZegoExpressEngineMethodHandler::*)(
+    const flutter::EncodableMap &argument,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
+
+constexpr uint8_t queueBit(ZegoTaskQueue queue) { return (uint8_t)(1u << queue); }
+
+constexpr uint8_t kAllQueues = (uint8_t)((1u << ZEGO_TASK_QUEUE_COUNT) - 1);
+
+// Set along with kAllQueues for the methods every later call is ordered
+// after.
+constexpr uint8_t kEveryCallBit = 0x80;
+
+// Methods whose handler runs the SDK call on a task queue with runOnQueue.
+constexpr std::string_view G_DeviceQueueMethods[] = {
+    "useAudioDevice", "setAudioDeviceVolume", "enableAudioCaptureDevice", "enableCamera",
+    "useVideoDevice",
+};
+
+constexpr std::string_view G_PublishQueueMethods[] = {
+    "startPublishingStream",
+    "stopPublishingStream",
+};
+
+// Methods that read or change the state the calls of a queue change, they
+// wait until the queued calls made before them have replied.
+constexpr std::string_view G_DeviceDependentMethods[] = {
+    "startPublishingStream", "startPreview", "stopPreview", "muteMicrophone",
+    "isMicrophoneMuted", "muteSpeaker", "isSpeakerMuted", "getAudioDeviceList",
+    "getDefaultAudioDeviceID", "getCurrentAudioDevice", "getAudioDeviceVolume",
+    "setSpeakerVolumeInAPP", "getSpeakerVolumeInAPP", "startAudioDeviceVolumeMonitor",
+    "stopAudioDeviceVolumeMonitor", "muteAudioDevice", "isAudioDeviceMuted",
+    "setAudioDeviceMode", "enableCameraAdaptiveFPS", "getVideoDeviceList",
+    "getDefaultVideoDeviceID", "useFrontCamera", "setCameraZoomFactor",
+    "getCameraMaxZoomFactor", "setVideoSource", "setAudioSource",
+};
+
+constexpr std::string_view G_PublishDependentMethods[] = {
+    "setStreamExtraInfo", "startPreview", "stopPreview", "setVideoConfig",
+    "setPublishDualStreamConfig", "setVideoMirrorMode", "setAudioConfig",
+    "setPublishStreamEncryptionKey", "takePublishStreamSnapshot",
+    "setMinVideoBitrateForTrafficControl", "setMinVideoFpsForTrafficControl",
+    "setMinVideoResolutionForTrafficControl", "setTrafficControlFocusOn", "addPublishCdnUrl",
+    "removePublishCdnUrl", "enablePublishDirectToCDN", "setPublishWatermark",
+    "mutePublishStreamAudio", "mutePublishStreamVideo", "sendSEI", "sendAudioSideInfo",
+    "enableHardwareEncoder", "setCapturePipelineScaleMode", "enableTrafficControl",
+    "sendCustomAudioCaptureAACData", "sendCustomAudioCapturePCMData", "setVideoSource",
+    "setAudioSource", "setSEIConfig",
+};
+
+// Methods that change the state of every queue, they wait for all queued
+// calls and every later call waits for them.
+constexpr std::string_view G_AllQueuesDependentMethods[] = {
+    "createEngine", "createEngineWithProfile", "destroyEngine", "loginRoom", "logoutRoom",
+    "switchRoom",
+};
+
+template <size_t N>
+constexpr bool containsMethod(const std::string_view (&methods)[N], std::string_view name) {
+    for (auto method : methods) {
+        if (method == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The queue the handler runs its SDK call on, -1 for none.
+constexpr int8_t methodQueue(std::string_view name) {
+    return containsMethod(G_DeviceQueueMethods, name)    ? (int8_t)ZEGO_TASK_QUEUE_DEVICE
+           : containsMethod(G_PublishQueueMethods, name) ? (int8_t)ZEGO_TASK_QUEUE_PUBLISH
+                                                         : (int8_t)-1;
+}
+
+// Bits of the queues whose calls made earlier the method is ordered after.
+constexpr uint8_t methodQueues(std::string_view name) {
+    if (containsMethod(G_AllQueuesDependentMethods, name)) {
+        return kAllQueues | kEveryCallBit;
+    }
+    uint8_t queues = 0;
+    if (containsMethod(G_DeviceQueueMethods, name) ||
+        containsMethod(G_DeviceDependentMethods, name)) {
+        queues |= queueBit(ZEGO_TASK_QUEUE_DEVICE);
+    }
+    if (containsMethod(G_PublishQueueMethods, name) ||
+        containsMethod(G_PublishDependentMethods, name)) {
+        queues |= queueBit(ZEGO_TASK_QUEUE_PUBLISH);
+    }
+    return queues;
+}
+
+struct ZegoMethodEntry {
+    std::string_view name;
+    ZegoMethodHandler handler;
+    // Can be called before the engine is created.
+    bool isStatic;
+    // See methodQueue and methodQueues.
+    int8_t queue;
+    uint8_t queues;
+};
 
 #define EngineMethodHandler(funcName)                                                              \
     {                                                                                              \
-        #funcName, {                                                                               \
-            std::bind(&ZegoExpressEngineMethodHandler::funcName,                                   \
-                      &ZegoExpressEngineMethodHandler::getInstance(), std::placeholders::_1,       \
-                      std::placeholders::_2),                                                      \
-                false                                                                              \
-        }                                                                                          \
+        #funcName, &ZegoExpressEngineMethodHandler::funcName, false, methodQueue(#funcName),      \
+            methodQueues(#funcName)                                                                \
     }
 
 #define EngineStaticMethodHandler(funcName)                                                        \
     {                                                                                              \
-        #funcName, {                                                                               \
-            std::bind(&ZegoExpressEngineMethodHandler::funcName,                                   \
-                      &ZegoExpressEngineMethodHandler::getInstance(), std::placeholders::_1,       \
-                      std::placeholders::_2),                                                      \
-                true                                                                               \
-        }                                                                                          \
-    }
-
-static const std::map<
-    std::string,
-    std::pair<
-        std::function<void(flutter::EncodableMap &argument,
-                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result)>,
-        bool>>
-    G_MethodMap = {
+        #funcName, &ZegoExpressEngineMethodHandler::funcName, true, methodQueue(#funcName),       \
+            methodQueues(#funcName)                                                                \
+    }
+
+static constexpr ZegoMethodEntry G_MethodList[] = {
         EngineStaticMethodHandler(getVersion),
         EngineStaticMethodHandler(isFeatureSupported),
         EngineStaticMethodHandler(setPluginVersion),
@@ -233,7 +327,6 @@ static const std::map<
         EngineMethodHandler(useVideoDevice),
         EngineMethodHandler(getVideoDeviceList),
         EngineMethodHandler(getDefaultVideoDeviceID),
-        EngineMethodHandler(enableMixSystemPlayout),
         EngineMethodHandler(startAudioVADStableStateMonitor),
         EngineMethodHandler(stopAudioVADStableStateMonitor),
         EngineMethodHandler(getCurrentAudioDevice),
@@ -373,6 +466,7 @@ static const std::map<
         EngineMethodHandler(createRealTimeSequentialDataManager),
         EngineMethodHandler(destroyRealTimeSequentialDataManager),
         EngineMethodHandler(dataManagerSendRealTimeSequentialData),
+        EngineMethodHandler(dataManagerSendRealTimeSequentialDataBatch),
         EngineMethodHandler(dataManagerStartBroadcasting),
         EngineMethodHandler(dataManagerStartSubscribing),
         EngineMethodHandler(dataManagerStopBroadcasting),
@@ -403,8 +497,385 @@ static const std::map<
         // textureRenderer
         EngineMethodHandler(createTextureRenderer),
         EngineMethodHandler(destroyTextureRenderer),
+        EngineMethodHandler(setTextureRendererMaxFps),
+        EngineMethodHandler(setTextureRendererFpsPolicy),
+        EngineMethodHandler(enableTextureRendererPrepWorker),
+        EngineMethodHandler(enableTextureRendererSingleCopy),
+        EngineMethodHandler(enableTextureRendererFrameBatching),
+        EngineMethodHandler(getTextureRendererStats),
+        EngineMethodHandler(enableVideoHealthAnalyzer),
+        EngineMethodHandler(getVideoHealthSummary),
+        EngineStaticMethodHandler(getEventQueueStats),
+        EngineStaticMethodHandler(enableCompactEventEncoding),
+        EngineStaticMethodHandler(enableAudioMeterCoalescing),
+        EngineStaticMethodHandler(setUnsubscribedEvents),
+        EngineStaticMethodHandler(getSuppressedEventCounts),
+        EngineStaticMethodHandler(createAudioDataRing),
+        EngineStaticMethodHandler(destroyAudioDataRing),
+        EngineStaticMethodHandler(queryStreamQuality),
+        EngineStaticMethodHandler(enableRoomRoster),
+        EngineStaticMethodHandler(getRoomUsers),
+        EngineStaticMethodHandler(getRoomStreams),
+        EngineStaticMethodHandler(enableIMMessageBuffer),
+        EngineStaticMethodHandler(getIMMessageBufferStats),
+        EngineStaticMethodHandler(enableRealTimeSequentialDataBatching),
+        EngineStaticMethodHandler(getRealTimeSequentialDataStats),
+        EngineStaticMethodHandler(enableSEIBatching),
+        EngineStaticMethodHandler(getSEIBatchStats),
+        EngineStaticMethodHandler(setEventLaneMaxDepth),
+        EngineStaticMethodHandler(getEventLaneStats),
+        EngineStaticMethodHandler(getMethodCallStats),
+        EngineStaticMethodHandler(setMethodCallStatsLogInterval),
+        EngineStaticMethodHandler(getTaskQueueStats),
+        EngineStaticMethodHandler(setPluginLogLevel),
+        EngineStaticMethodHandler(getPluginLogStats),
+        EngineStaticMethodHandler(createCustomAudioRenderRing),
+        EngineStaticMethodHandler(destroyCustomAudioRenderRing),
 };
 
+constexpr size_t kMethodCount = sizeof(G_MethodList) / sizeof(G_MethodList[0]);
+
+static constexpr ZegoMethodTable<kMethodCount> G_MethodTable(G_MethodList);
+static_assert(!G_MethodTable.hasDuplicate, "Method registered twice");
+
+template <size_t N> constexpr bool areRegistered(const std::string_view (&methods)[N]) {
+    for (auto method : methods) {
+        if (!G_MethodTable.find(G_MethodList, method)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(areRegistered(G_DeviceQueueMethods) && areRegistered(G_PublishQueueMethods) &&
+                  areRegistered(G_DeviceDependentMethods) &&
+                  areRegistered(G_PublishDependentMethods) &&
+                  areRegistered(G_AllQueuesDependentMethods),
+              "A queue order list names a method that is not registered");
+
+static const ZegoMethodEntry *findMethod(std::string_view name) {
+    return G_MethodTable.find(G_MethodList, name);
+}
+
+// Reply of one method call, shared by its result and the dispatcher, so a
+// handler that throws replies with the exception message.
+struct ZegoMethodReply {
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result;
+    size_t methodIndex;
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    std::atomic<bool> isReplied = false;
+    // While set, a result dropped without a reply leaves the reply to the
+    // dispatcher, which knows whether the handler threw.
+    std::atomic<bool> isInHandler = true;
+    std::atomic<bool> isDropped = false;
+
+    // Whether the caller is the one to reply, at most one caller is.
+    bool claim() {
+        if (isReplied.exchange(true)) {
+            return false;
+        }
+        ZegoMethodCallStats::getInstance().recordReply(
+            methodIndex, std::chrono::steady_clock::now() - startTime);
+        return true;
+    }
+
+    void replyError(const std::string &errorMessage) {
+        if (claim()) {
+            result->Error("method_call_error", errorMessage);
+        }
+    }
+};
+
+// Forwards the reply of a method and records the time until it.
+class ZegoTimedMethodResult final : public flutter::MethodResult<flutter::EncodableValue> {
+  public:
+    explicit ZegoTimedMethodResult(std::shared_ptr<ZegoMethodReply> reply)
+        : reply_(std::move(reply)) {}
+
+    ~ZegoTimedMethodResult() override {
+        reply_->isDropped = true;
+        if (!reply_->isInHandler) {
+            reply_->replyError("The method did not reply");
+        }
+    }
+
+  protected:
+    void SuccessInternal(const flutter::EncodableValue *result) override {
+        if (!reply_->claim()) {
+            return;
+        }
+        if (result) {
+            reply_->result->Success(*result);
+        } else {
+            reply_->result->Success();
+        }
+    }
+
+    void ErrorInternal(const std::string &errorCode, const std::string &errorMessage,
+                       const flutter::EncodableValue *errorDetails) override {
+        if (!reply_->claim()) {
+            return;
+        }
+        if (errorDetails) {
+            reply_->result->Error(errorCode, errorMessage, *errorDetails);
+        } else {
+            reply_->result->Error(errorCode, errorMessage);
+        }
+    }
+
+    void NotImplementedInternal() override {
+        if (reply_->claim()) {
+            reply_->result->NotImplemented();
+        }
+    }
+
+  private:
+    std::shared_ptr<ZegoMethodReply> reply_;
+};
+
+static void dispatchMethod(const ZegoMethodEntry *method, const flutter::EncodableMap &argument,
+                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    if (!method) {
+        result->NotImplemented();
+        return;
+    }
+
+    if (!method->isStatic && !ZegoExpressEngineMethodHandler::getInstance().isEngineCreated()) {
+        result->Error("Engine_not_created", "Please call createEngineWithProfile first");
+        return;
+    }
+
+    auto methodIndex = (size_t)(method - G_MethodList);
+    auto reply = std::make_shared<ZegoMethodReply>();
+    reply->result = std::move(result);
+    reply->methodIndex = methodIndex;
+    auto startTime = std::chrono::steady_clock::now();
+    try {
+        (ZegoExpressEngineMethodHandler::getInstance().*method->handler)(
+            argument, std::make_unique<ZegoTimedMethodResult>(reply));
+    } catch (std::exception &e) {
+        ZF::logInfo("[DartCall][%s] exception: %s", method->name.data(), e.what());
+        reply->replyError(e.what());
+    }
+    reply->isInHandler = false;
+    // Dropped by the handler without a reply, or by another thread while
+    // the handler ran.
+    if (reply->isDropped) {
+        reply->replyError("The method did not reply");
+    }
+    ZegoMethodCallStats::getInstance().recordHandler(methodIndex,
+                                                     std::chrono::steady_clock::now() - startTime);
+}
+
+// A method call that arrived while a call it is ordered after had not
+// replied yet.
+struct ZegoDeferredMethodCall {
+    const ZegoMethodEntry *method;
+    flutter::EncodableMap argument;
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result;
+};
+
+// Calls wait on the platform thread behind the queued calls they depend on,
+// as they waited behind them when they blocked the platform thread, so dart
+// calls on the same state keep their order. Calls that depend on none of
+// the busy queues run right away.
+static std::deque<ZegoDeferredMethodCall> G_DeferredMethodCalls;
+
+static bool isOrderedAfter(uint8_t queues, uint8_t earlierQueues) {
+    return ((queues | earlierQueues) & kEveryCallBit) != 0 || (queues & earlierQueues) != 0;
+}
+
+// Whether `method` has to wait for a queued call or for one of the first
+// `deferredCount` deferred calls.
+static bool mustWait(const ZegoMethodEntry *method, size_t deferredCount) {
+    for (size_t i = 0; i < deferredCount; i++) {
+        if (isOrderedAfter(method->queues, G_DeferredMethodCalls[i].method->queues)) {
+            return true;
+        }
+    }
+
+    auto &methodHandler = ZegoExpressEngineMethodHandler::getInstance();
+    for (int queue = 0; queue < ZEGO_TASK_QUEUE_COUNT; queue++) {
+        // The queue itself keeps the order of the calls that run on it.
+        if (queue == method->queue || !(method->queues & queueBit((ZegoTaskQueue)queue))) {
+            continue;
+        }
+        if (methodHandler.hasQueuedCalls((ZegoTaskQueue)queue)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void runDeferredMethodCalls() {
+    for (size_t i = 0; i < G_DeferredMethodCalls.size();) {
+        if (mustWait(G_DeferredMethodCalls[i].method, i)) {
+            i++;
+            continue;
+        }
+        auto call = std::move(G_DeferredMethodCalls[i]);
+        G_DeferredMethodCalls.erase(G_DeferredMethodCalls.begin() + i);
+        dispatchMethod(call.method, call.argument, std::move(call.result));
+    }
+}
+
+static void dispatchMethodInOrder(std::string_view name, const flutter::EncodableMap &argument,
+                                  std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    // Unknown methods only reply not implemented.
+    auto method = findMethod(name);
+    if (method && mustWait(method, G_DeferredMethodCalls.size())) {
+        // The argument only lives for this call.
+        G_DeferredMethodCalls.push_back({method, argument, std::move(result)});
+        return;
+    }
+    dispatchMethod(method, argument, std::move(result));
+}
+
+// Results of the calls of an invokeBatch, which may arrive after their
+// handlers return. The batch replies once every started call has replied.
+struct ZegoBatchState {
+    std::mutex mutex;
+    flutter::EncodableList results;
+    size_t pendingCount = 0;
+    bool isSealed = false;
+    bool hasError = false;
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result;
+
+    size_t start() {
+        std::lock_guard<std::mutex> lock(mutex);
+        results.emplace_back();
+        pendingCount++;
+        return results.size() - 1;
+    }
+
+    void complete(size_t index, flutter::EncodableMap &&callResult, bool isError) {
+        std::unique_lock<std::mutex> lock(mutex);
+        results[index] = flutter::EncodableValue(std::move(callResult));
+        hasError = hasError || isError;
+        pendingCount--;
+        replyIfDone(lock);
+    }
+
+    // No call is started after this.
+    void seal() {
+        std::unique_lock<std::mutex> lock(mutex);
+        isSealed = true;
+        replyIfDone(lock);
+    }
+
+    bool failed() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return hasError;
+    }
+
+  private:
+    void replyIfDone(std::unique_lock<std::mutex> &lock) {
+        if (!isSealed || pendingCount > 0 || !result) {
+            return;
+        }
+        auto reply = std::move(result);
+        auto value = flutter::EncodableValue(std::move(results));
+        lock.unlock();
+        reply->Success(value);
+    }
+};
+
+class ZegoBatchCallResult final : public flutter::MethodResult<flutter::EncodableValue> {
+  public:
+    ZegoBatchCallResult(std::shared_ptr<ZegoBatchState> state, size_t index)
+        : state_(std::move(state)), index_(index) {}
+
+    ~ZegoBatchCallResult() override {
+        // Dropped without a reply.
+        if (state_) {
+            ErrorInternal("no_result", "The method did not reply", nullptr);
+        }
+    }
+
+  protected:
+    void SuccessInternal(const flutter::EncodableValue *result) override {
+        flutter::EncodableMap callResult;
+        if (result) {
+            callResult[flutter::EncodableValue("result")] = *result;
+        }
+        complete(std::move(callResult), false);
+    }
+
+    void ErrorInternal(const std::string &errorCode, const std::string &errorMessage,
+                       const flutter::EncodableValue *errorDetails) override {
+        flutter::EncodableMap callResult;
+        callResult[flutter::EncodableValue("errorCode")] = flutter::EncodableValue(errorCode);
+        callResult[flutter::EncodableValue("errorMessage")] = flutter::EncodableValue(errorMessage);
+        if (errorDetails) {
+            callResult[flutter::EncodableValue("errorDetails")] = *errorDetails;
+        }
+        complete(std::move(callResult), true);
+    }
+
+    void NotImplementedInternal() override {
+        ErrorInternal("not_implemented", "Unknown method", nullptr);
+    }
+
+  private:
+    void complete(flutter::EncodableMap &&callResult, bool isError) {
+        auto state = std::move(state_);
+        if (state) {
+            state->complete(index_, std::move(callResult), isError);
+        }
+    }
+
+    std::shared_ptr<ZegoBatchState> state_;
+    size_t index_;
+};
+
+// Value of `key` in `map`, null if it is missing.
+static const flutter::EncodableValue *findValue(const flutter::EncodableMap &map, const char *key) {
+    auto it = map.find(flutter::EncodableValue(key));
+    return it != map.end() ? &it->second : nullptr;
+}
+
+// Runs `calls` in order in this slice of the platform thread. With
+// `stopOnError` the calls after the first error known at that point are
+// not run and have no result, errors of calls that reply later do not
+// stop the batch.
+static void invokeBatch(const flutter::EncodableMap &argument,
+                        std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    auto calls = std::get_if<flutter::EncodableList>(findValue(argument, "calls"));
+    auto stopOnError = std::get_if<bool>(findValue(argument, "stopOnError"));
+    if (!calls) {
+        result->Error("invokeBatch_invalid_arguments", "calls must be a list");
+        return;
+    }
+
+    auto state = std::make_shared<ZegoBatchState>();
+    state->result = std::move(result);
+    state->results.reserve(calls->size());
+
+    for (auto &call : *calls) {
+        auto index = state->start();
+        auto callResult = std::make_unique<ZegoBatchCallResult>(state, index);
+
+        auto callMap = std::get_if<flutter::EncodableMap>(&call);
+        auto name = callMap ? std::get_if<std::string>(findValue(*callMap, "method")) : nullptr;
+        if (!name) {
+            callResult->Error("invokeBatch_invalid_call", "A call must have a method name");
+        } else {
+            ZF::logInfo("[DartCall][invokeBatch][%s]", name->c_str());
+
+            static const flutter::EncodableMap emptyArgument;
+            auto callArgument = std::get_if<flutter::EncodableMap>(findValue(*callMap, "arguments"));
+            dispatchMethodInOrder(*name, callArgument ? *callArgument : emptyArgument,
+                                  std::move(callResult));
+        }
+
+        if (stopOnError && *stopOnError && state->failed()) {
+            break;
+        }
+    }
+
+    state->seal();
+}
+
 class ZegoExpressEnginePlugin : public flutter::Plugin,
                                 public flutter::StreamHandler<flutter::EncodableValue> {
 
@@ -428,18 +899,33 @@ class ZegoExpressEnginePlugin : public flutter::Plugin,
     void HandleMethodCall(const flutter::MethodCall<flutter::EncodableValue> &method_call,
                           std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result);
 
+    // Delivers engine events on the platform thread, which runs the top level
+    // window proc.
+    void attachEventQueueToWindow(flutter::PluginRegistrarWindows *registrar);
+
   public:
     std::unique_ptr<flutter::MethodChannel<flutter::EncodableValue>> methodChannel_;
     std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>> eventChannel_;
 
   private:
     std::shared_ptr<ZegoExpressEngineEventHandler> eventHandler_;
+    flutter::PluginRegistrarWindows *registrar_ = nullptr;
+    int windowProcDelegateID_ = -1;
 };
 
 // static
 void ZegoExpressEnginePlugin::RegisterWithRegistrar(flutter::PluginRegistrarWindows *registrar) {
     ZegoExpressEngineMethodHandler::getInstance().setPluginRegistrar(registrar);
 
+    std::vector<std::string> methodNames;
+    methodNames.reserve(kMethodCount);
+    for (auto const &method : G_MethodList) {
+        methodNames.emplace_back(method.name);
+    }
+    ZegoMethodCallStats::getInstance().init(std::move(methodNames));
+    ZegoExpressEngineMethodHandler::getInstance().setQueuedCallsDoneCallback(
+        runDeferredMethodCalls);
+
     auto plugin = std::make_unique<ZegoExpressEnginePlugin>();
 
     plugin->methodChannel_ = std::make_unique<flutter::MethodChannel<flutter::EncodableValue>>(
@@ -455,6 +941,8 @@ void ZegoExpressEnginePlugin::RegisterWithRegistrar(flutter::PluginRegistrarWind
             plugin_pointer->HandleMethodCall(call, std::move(result));
         });
 
+    plugin->attachEventQueueToWindow(registrar);
+
     plugin->eventChannel_->SetStreamHandler(std::move(plugin));
 
     ZegoExpressEngineMethodHandler::getInstance().initApiCalledCallback();
@@ -464,7 +952,44 @@ void ZegoExpressEnginePlugin::RegisterWithRegistrar(flutter::PluginRegistrarWind
 
 ZegoExpressEnginePlugin::ZegoExpressEnginePlugin() {}
 
-ZegoExpressEnginePlugin::~ZegoExpressEnginePlugin() {}
+ZegoExpressEnginePlugin::~ZegoExpressEnginePlugin() {
+    if (registrar_ && windowProcDelegateID_ != -1) {
+        ZegoExpressEngineEventHandler::getInstance()->detachPlatformWindow();
+        ZegoTaskExecutor::getInstance().detachWindow();
+        registrar_->UnregisterTopLevelWindowProcDelegate(windowProcDelegateID_);
+    }
+}
+
+void ZegoExpressEnginePlugin::attachEventQueueToWindow(flutter::PluginRegistrarWindows *registrar) {
+    // Without a view (e.g. a headless engine) events are delivered directly.
+    auto view = registrar->GetView();
+    if (!view) {
+        return;
+    }
+    auto window = GetAncestor(view->GetNativeWindow(), GA_ROOT);
+    auto message = RegisterWindowMessageW(L"ZegoExpressEngineDrainEvents");
+    auto taskMessage = RegisterWindowMessageW(L"ZegoExpressEngineRunPlatformTasks");
+    if (!window || !message || !taskMessage) {
+        return;
+    }
+
+    registrar_ = registrar;
+    windowProcDelegateID_ = registrar->RegisterTopLevelWindowProcDelegate(
+        [message, taskMessage](HWND hwnd, UINT msg, WPARAM wparam,
+                               LPARAM lparam) -> std::optional<LRESULT> {
+            if (msg == message) {
+                ZegoExpressEngineEventHandler::getInstance()->drainEvents();
+                return 0;
+            }
+            if (msg == taskMessage) {
+                ZegoTaskExecutor::getInstance().runPlatformTasks();
+                return 0;
+            }
+            return std::nullopt;
+        });
+    ZegoExpressEngineEventHandler::getInstance()->attachPlatformWindow(window, message);
+    ZegoTaskExecutor::getInstance().attachWindow(window, taskMessage);
+}
 
 std::unique_ptr<flutter::StreamHandlerError<flutter::EncodableValue>>
 ZegoExpressEnginePlugin::OnListenInternal(
@@ -492,26 +1017,17 @@ void ZegoExpressEnginePlugin::HandleMethodCall(
 
     ZF::logInfo("[DartCall][%s]", method_call.method_name().c_str());
 
-    flutter::EncodableMap argument;
-    if (std::holds_alternative<flutter::EncodableMap>(*method_call.arguments())) {
-        argument = std::get<flutter::EncodableMap>(*method_call.arguments());
-    }
-
-    auto pair = G_MethodMap.find(method_call.method_name());
-    if (pair != G_MethodMap.end()) {
-        try {
-            if (!pair->second.second &&
-                !ZegoExpressEngineMethodHandler::getInstance().isEngineCreated()) {
-                result->Error("Engine_not_created", "Please call createEngineWithProfile first");
-            } else {
-                pair->second.first(argument, std::move(result));
-            }
-        } catch (std::exception &e) {
-            result->Error("method_call_error", e.what());
-        }
-    } else {
-        result->NotImplemented();
+    // Handlers read the decoded arguments in place instead of a copy.
+    static const flutter::EncodableMap emptyArgument;
+    auto map = std::get_if<flutter::EncodableMap>(method_call.arguments());
+    auto &argument = map ? *map : emptyArgument;
+
+    if (method_call.method_name() == "invokeBatch") {
+        invokeBatch(argument, std::move(result));
+        return;
     }
+
+    dispatchMethodInOrder(method_call.method_name(), argument, std::move(result));
 }
 
 void ZegoExpressEnginePluginRegisterWithRegistrar(FlutterDesktopPluginRegistrarRef registrar) {